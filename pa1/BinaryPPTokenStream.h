@@ -0,0 +1,124 @@
+#pragma once
+
+#include "IPPTokenStream.h"
+#include "BinaryTokenStream.h"
+
+// Binary preprocessing-token stream (pptoken --format=binary)
+//
+//     stream := BinaryPPTokensMagic token*
+//     token  := kind [spelling] varint(offset delta)
+//
+// `kind` is one EPPTokenKind byte.  whitespace-sequence, new-line and eof
+// carry no spelling.  The offset delta is the token's source offset minus
+// that of the previous token, zigzag encoded.  The stream ends with PPK_EOF.
+
+enum EPPTokenKind
+{
+	PPK_WHITESPACE_SEQUENCE,
+	PPK_NEW_LINE,
+	PPK_HEADER_NAME,
+	PPK_IDENTIFIER,
+	PPK_PP_NUMBER,
+	PPK_CHARACTER_LITERAL,
+	PPK_USER_DEFINED_CHARACTER_LITERAL,
+	PPK_STRING_LITERAL,
+	PPK_USER_DEFINED_STRING_LITERAL,
+	PPK_PREPROCESSING_OP_OR_PUNC,
+	PPK_NON_WHITESPACE_CHAR,
+	PPK_EOF
+};
+
+// BinaryPPTokenStream: token sink producing the binary stream format
+struct BinaryPPTokenStream
+{
+	BinaryPPTokenStream(ostream& out)
+		: writer(out, BinaryPPTokensMagic), offset(0)
+	{}
+
+	void emit_whitespace_sequence(PPTokenSpelling data) { write_token(PPK_WHITESPACE_SEQUENCE, data, false); }
+	void emit_new_line(PPTokenSpelling data) { write_token(PPK_NEW_LINE, data, false); }
+	void emit_header_name(PPTokenSpelling data) { write_token(PPK_HEADER_NAME, data, true); }
+	void emit_identifier(PPTokenSpelling data) { write_token(PPK_IDENTIFIER, data, true); }
+	void emit_pp_number(PPTokenSpelling data) { write_token(PPK_PP_NUMBER, data, true); }
+	void emit_character_literal(PPTokenSpelling data) { write_token(PPK_CHARACTER_LITERAL, data, true); }
+	void emit_user_defined_character_literal(PPTokenSpelling data) { write_token(PPK_USER_DEFINED_CHARACTER_LITERAL, data, true); }
+	void emit_string_literal(PPTokenSpelling data) { write_token(PPK_STRING_LITERAL, data, true); }
+	void emit_user_defined_string_literal(PPTokenSpelling data) { write_token(PPK_USER_DEFINED_STRING_LITERAL, data, true); }
+	void emit_preprocessing_op_or_punc(PPTokenSpelling data) { write_token(PPK_PREPROCESSING_OP_OR_PUNC, data, true); }
+	void emit_non_whitespace_char(PPTokenSpelling data) { write_token(PPK_NON_WHITESPACE_CHAR, data, true); }
+
+	void emit_eof()
+	{
+		writer.write_byte(PPK_EOF);
+		writer.flush();
+	}
+
+private:
+	BinaryStreamWriter writer;
+	size_t offset;
+
+	void write_token(EPPTokenKind kind, PPTokenSpelling data, bool has_spelling)
+	{
+		writer.write_byte(kind);
+
+		if (has_spelling)
+			writer.write_spelling(data.data, data.size);
+
+		// offsets only go backwards for tokens the tokenizer synthesizes
+		// (eg the new-line added at end of file), so send a signed delta
+		int64_t delta = int64_t(data.offset) - int64_t(offset);
+		writer.write_varint((uint64_t(delta) << 1) ^ uint64_t(delta >> 63));
+		offset = data.offset;
+	}
+};
+
+// ReadBinaryPPTokens: decode binary stream [begin, end), replaying each
+// token into `output` (for example a DebugPPTokenStream to get text back)
+template<typename TokenSink>
+void ReadBinaryPPTokens(const char* begin, const char* end, TokenSink& output)
+{
+	BinaryStreamReader reader(begin, end, BinaryPPTokensMagic);
+
+	int64_t offset = 0;
+
+	for (;;)
+	{
+		unsigned char byte = reader.read_byte();
+
+		if (byte > PPK_EOF)
+			throw runtime_error("bad token kind in binary token stream");
+
+		EPPTokenKind kind = EPPTokenKind(byte);
+
+		if (kind == PPK_EOF)
+		{
+			output.emit_eof();
+			return;
+		}
+
+		PPTokenSpelling data;
+
+		if (kind != PPK_WHITESPACE_SEQUENCE && kind != PPK_NEW_LINE)
+			reader.read_spelling(data.data, data.size);
+
+		uint64_t zigzag = reader.read_varint();
+		offset += int64_t(zigzag >> 1) ^ -int64_t(zigzag & 1);
+		data.offset = offset;
+
+		switch (kind)
+		{
+		case PPK_WHITESPACE_SEQUENCE: output.emit_whitespace_sequence(data); break;
+		case PPK_NEW_LINE: output.emit_new_line(data); break;
+		case PPK_HEADER_NAME: output.emit_header_name(data); break;
+		case PPK_IDENTIFIER: output.emit_identifier(data); break;
+		case PPK_PP_NUMBER: output.emit_pp_number(data); break;
+		case PPK_CHARACTER_LITERAL: output.emit_character_literal(data); break;
+		case PPK_USER_DEFINED_CHARACTER_LITERAL: output.emit_user_defined_character_literal(data); break;
+		case PPK_STRING_LITERAL: output.emit_string_literal(data); break;
+		case PPK_USER_DEFINED_STRING_LITERAL: output.emit_user_defined_string_literal(data); break;
+		case PPK_PREPROCESSING_OP_OR_PUNC: output.emit_preprocessing_op_or_punc(data); break;
+		case PPK_NON_WHITESPACE_CHAR: output.emit_non_whitespace_char(data); break;
+		case PPK_EOF: break;
+		}
+	}
+}
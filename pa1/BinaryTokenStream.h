@@ -0,0 +1,269 @@
+#pragma once
+
+// Building blocks of the binary token stream formats passed between stages
+// instead of the text formats.
+//
+// Integers are LEB128 varints (7 bits per byte, least significant first,
+// high bit set on all but the last byte).  Spellings are interned: each
+// distinct spelling is sent once, and later occurrences only send its id:
+//
+//     spelling := varint(id)                        if id was seen before
+//               | varint(id) varint(length) bytes   if id is the next new id
+
+// first 4 bytes of a stream: format and version
+const char BinaryPPTokensMagic[4] = { 'P', 'P', 'T', 1 };
+const char BinaryPostTokensMagic[4] = { 'P', 'O', 'T', 1 };
+
+// id returned by BinarySpellingTable::find for a spelling not found
+constexpr uint32_t BinarySpellingNotFound = 0xFFFFFFFF;
+
+// BinarySpellingTable: interns spellings to dense ids 0, 1, 2, ...
+//
+// Open addressing over a power-of-two table of ids; the spellings
+// themselves are stored back to back in `pool`.
+struct BinarySpellingTable
+{
+	BinarySpellingTable()
+		: slots(1024, BinarySpellingNotFound)
+	{}
+
+	// number of distinct spellings interned so far
+	size_t size() const { return starts.size(); }
+
+	// look up spelling [data, data+nbytes), interning it if `insert`
+	// returns its id, or BinarySpellingNotFound
+	uint32_t find(const char* data, size_t nbytes, bool insert)
+	{
+		size_t mask = slots.size() - 1;
+
+		for (size_t i = Hash(data, nbytes) & mask; ; i = (i + 1) & mask)
+		{
+			uint32_t id = slots[i];
+
+			if (id == BinarySpellingNotFound)
+			{
+				if (!insert)
+					return BinarySpellingNotFound;
+
+				id = starts.size();
+				starts.push_back(pool.size());
+				pool.append(data, nbytes);
+				slots[i] = id;
+
+				if (2 * starts.size() > slots.size())
+					grow();
+
+				return id;
+			}
+
+			if (spelling_size(id) == nbytes && memcmp(spelling_data(id), data, nbytes) == 0)
+				return id;
+		}
+	}
+
+	const char* spelling_data(uint32_t id) const
+	{
+		return pool.data() + starts[id];
+	}
+
+	size_t spelling_size(uint32_t id) const
+	{
+		return (id + 1 < starts.size() ? starts[id + 1] : pool.size()) - starts[id];
+	}
+
+private:
+	vector<uint32_t> slots;
+	vector<size_t> starts;
+	string pool;
+
+	// FNV-1a
+	static size_t Hash(const char* data, size_t nbytes)
+	{
+		uint64_t h = 14695981039346656037ULL;
+
+		for (size_t i = 0; i < nbytes; i++)
+			h = (h ^ (unsigned char) data[i]) * 1099511628211ULL;
+
+		return h;
+	}
+
+	void grow()
+	{
+		slots.assign(2 * slots.size(), BinarySpellingNotFound);
+
+		size_t mask = slots.size() - 1;
+
+		for (uint32_t id = 0; id < starts.size(); id++)
+		{
+			size_t i = Hash(spelling_data(id), spelling_size(id)) & mask;
+
+			while (slots[i] != BinarySpellingNotFound)
+				i = (i + 1) & mask;
+
+			slots[i] = id;
+		}
+	}
+};
+
+// BinaryStreamWriter: buffered encoder writing to an ostream
+struct BinaryStreamWriter
+{
+	BinaryStreamWriter(ostream& out, const char (&magic)[4])
+		: out(out)
+	{
+		buffer.reserve(BufferSize + 64);
+		buffer.append(magic, 4);
+	}
+
+	~BinaryStreamWriter()
+	{
+		flush();
+	}
+
+	void write_byte(unsigned char b)
+	{
+		buffer.push_back(b);
+	}
+
+	void write_varint(uint64_t x)
+	{
+		while (x >= 0x80)
+		{
+			buffer.push_back((char) (x | 0x80));
+			x >>= 7;
+		}
+
+		buffer.push_back((char) x);
+
+		if (buffer.size() >= BufferSize)
+			flush();
+	}
+
+	void write_bytes(const void* data, size_t nbytes)
+	{
+		write_varint(nbytes);
+		buffer.append((const char*) data, nbytes);
+
+		if (buffer.size() >= BufferSize)
+			flush();
+	}
+
+	void write_spelling(const char* data, size_t nbytes)
+	{
+		size_t next_id = spellings.size();
+		uint32_t id = spellings.find(data, nbytes, true);
+
+		write_varint(id);
+
+		if (id == next_id)
+			write_bytes(data, nbytes);
+	}
+
+	void write_spelling(const string& s)
+	{
+		write_spelling(s.data(), s.size());
+	}
+
+	void flush()
+	{
+		out.write(buffer.data(), buffer.size());
+		out.flush();
+		buffer.clear();
+	}
+
+private:
+	static constexpr size_t BufferSize = 64 * 1024;
+
+	ostream& out;
+	string buffer;
+	BinarySpellingTable spellings;
+};
+
+// BinaryStreamReader: decoder over an in-memory stream
+struct BinaryStreamReader
+{
+	BinaryStreamReader(const char* begin, const char* end, const char (&magic)[4])
+		: p(begin), end(end)
+	{
+		if (end - begin < 4 || memcmp(begin, magic, 4) != 0)
+			throw runtime_error("not a binary token stream of the expected format");
+
+		p += 4;
+	}
+
+	bool at_end() const { return p == end; }
+
+	unsigned char read_byte()
+	{
+		if (p == end)
+			throw runtime_error("truncated binary token stream");
+
+		return *p++;
+	}
+
+	uint64_t read_varint()
+	{
+		uint64_t x = 0;
+
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			unsigned char b = read_byte();
+
+			x |= uint64_t(b & 0x7F) << shift;
+
+			if (!(b & 0x80))
+				return x;
+		}
+
+		throw runtime_error("malformed varint in binary token stream");
+	}
+
+	// returns pointer to `nbytes` bytes inside the stream
+	const char* read_bytes(size_t& nbytes)
+	{
+		nbytes = read_varint();
+
+		if (size_t(end - p) < nbytes)
+			throw runtime_error("truncated binary token stream");
+
+		const char* data = p;
+		p += nbytes;
+		return data;
+	}
+
+	// returns spelling id; data/nbytes point at the spelling
+	uint32_t read_spelling(const char*& data, size_t& nbytes)
+	{
+		uint64_t id = read_varint();
+
+		if (id == spellings.size())
+		{
+			data = read_bytes(nbytes);
+			spellings.push_back(make_pair(data, nbytes));
+		}
+		else if (id < spellings.size())
+		{
+			data = spellings[id].first;
+			nbytes = spellings[id].second;
+		}
+		else
+			throw runtime_error("bad spelling id in binary token stream");
+
+		return id;
+	}
+
+	string read_spelling()
+	{
+		const char* data;
+		size_t nbytes;
+		read_spelling(data, nbytes);
+		return string(data, nbytes);
+	}
+
+private:
+	const char* p;
+	const char* end;
+
+	// spellings point into the stream itself, so nothing is copied
+	vector<pair<const char*, size_t>> spellings;
+};
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "IndexSequence.h"
+
+// Character classification tables
+//
+// All tables are generated by constexpr functions at compile time, so
+// there is no startup cost and no dynamic initialization.
+
+// Word-at-a-time (SWAR) byte classification.
+//
+// Only the C++ standard library may be used, so instead of SSE2/AVX2
+// intrinsics a 64-bit word is treated as a vector of 8 code units.  Each
+// classifier returns a word with the high bit of every byte that is a
+// member of the class set, and all other bits clear.
+typedef uint64_t PPWord;
+
+constexpr PPWord PPWordOnes = 0x0101010101010101ULL;
+constexpr PPWord PPWordLows = 0x7F7F7F7F7F7F7F7FULL;
+constexpr PPWord PPWordHighs = 0x8080808080808080ULL;
+
+// load 8 code units starting at p (no alignment required)
+inline PPWord PPWordLoad(const char* p)
+{
+	PPWord w;
+	memcpy(&w, p, sizeof(w));
+	return w;
+}
+
+// high bit set in each byte of w that is equal to b
+inline PPWord PPWordEqual(PPWord w, unsigned char b)
+{
+	PPWord x = w ^ (PPWordOnes * b);
+	return ~(((x & PPWordLows) + PPWordLows) | x | PPWordLows);
+}
+
+// high bit set in each ASCII byte of w that lies in [lo, hi] (lo <= hi < 0x80)
+inline PPWord PPWordInRange(PPWord w, unsigned char lo, unsigned char hi)
+{
+	PPWord x = w & PPWordLows;
+	PPWord ge_lo = x + PPWordOnes * (0x80 - lo);
+	PPWord gt_hi = x + PPWordOnes * (0x7F - hi);
+	return ge_lo & ~gt_hi & ~w & PPWordHighs;
+}
+
+// ASCII character classes, bit flags of CodeUnitTable::char_class entries
+enum ECharClass
+{
+	CC_IDENTIFIER_START = 1 << 0, // [A-Za-z_]
+	CC_IDENTIFIER_CONTINUE = 1 << 1, // [A-Za-z_0-9]
+	CC_DIGIT = 1 << 2, // [0-9]
+	CC_HEX_DIGIT = 1 << 3, // [0-9A-Fa-f]
+	CC_PUNCTUATOR_START = 1 << 4, // first character of a preprocessing-op-or-punc
+	CC_WHITESPACE = 1 << 5 // whitespace other than new-line
+};
+
+constexpr bool IsCharInRange(int c, int first, int last)
+{
+	return c >= first && c <= last;
+}
+
+constexpr unsigned char CharClassOf(int c)
+{
+	return
+		((IsCharInRange(c, 'A', 'Z') || IsCharInRange(c, 'a', 'z') || c == '_') ? CC_IDENTIFIER_START | CC_IDENTIFIER_CONTINUE : 0) |
+		(IsCharInRange(c, '0', '9') ? CC_IDENTIFIER_CONTINUE | CC_DIGIT | CC_HEX_DIGIT : 0) |
+		((IsCharInRange(c, 'A', 'F') || IsCharInRange(c, 'a', 'f')) ? CC_HEX_DIGIT : 0) |
+		((c == '{' || c == '}' || c == '[' || c == ']' || c == '#' || c == '(' || c == ')' ||
+		  c == '<' || c == '>' || c == '%' || c == ':' || c == ';' || c == '.' || c == '?' ||
+		  c == '*' || c == '+' || c == '-' || c == '/' || c == '^' || c == '&' || c == '|' ||
+		  c == '~' || c == '!' || c == '=' || c == ',') ? CC_PUNCTUATOR_START : 0) |
+		((c == ' ' || c == '\t' || c == '\v' || c == '\f') ? CC_WHITESPACE : 0);
+}
+
+constexpr unsigned char HexValueOf(int c)
+{
+	return IsCharInRange(c, '0', '9') ? c - '0' :
+		IsCharInRange(c, 'A', 'F') ? c - 'A' + 10 :
+		IsCharInRange(c, 'a', 'f') ? c - 'a' + 10 :
+		0xFF;
+}
+
+template<typename Seq>
+struct CodeUnitTables;
+
+template<size_t... I>
+struct CodeUnitTables<IndexSequence<I...>>
+{
+	// ECharClass flags of each code unit (0 for non-ASCII)
+	static constexpr unsigned char char_class[sizeof...(I)] = { CharClassOf(I)... };
+
+	// value of each hex digit code unit, 0xFF if not a hex digit
+	static constexpr unsigned char hex_value[sizeof...(I)] = { HexValueOf(I)... };
+};
+
+template<size_t... I>
+constexpr unsigned char CodeUnitTables<IndexSequence<I...>>::char_class[sizeof...(I)];
+
+template<size_t... I>
+constexpr unsigned char CodeUnitTables<IndexSequence<I...>>::hex_value[sizeof...(I)];
+
+typedef CodeUnitTables<MakeIndexSequence<256>::type> CodeUnitTable;
+
+// true iff code unit c (0..255) is in any of the ECharClass classes `mask`
+inline bool IsCharClass(unsigned char c, unsigned char mask)
+{
+	return CodeUnitTable::char_class[c] & mask;
+}
+
+// given hex digit character c, return its value
+inline int HexCharToValue(int c)
+{
+	unsigned char value = (c >= 0 && c < 256) ? CodeUnitTable::hex_value[c] : 0xFF;
+
+	if (value == 0xFF)
+		throw logic_error("HexCharToValue of nonhex char");
+
+	return value;
+}
+
+// inclusive range of code points
+struct CodePointRange
+{
+	int first;
+	int last;
+};
+
+// See C++ standard 2.11 Identifiers and Appendix/Annex E.1
+constexpr CodePointRange AnnexE1_Allowed_RangesSorted[] =
+{
+	{0xA8,0xA8},
+	{0xAA,0xAA},
+	{0xAD,0xAD},
+	{0xAF,0xAF},
+	{0xB2,0xB5},
+	{0xB7,0xBA},
+	{0xBC,0xBE},
+	{0xC0,0xD6},
+	{0xD8,0xF6},
+	{0xF8,0xFF},
+	{0x100,0x167F},
+	{0x1681,0x180D},
+	{0x180F,0x1FFF},
+	{0x200B,0x200D},
+	{0x202A,0x202E},
+	{0x203F,0x2040},
+	{0x2054,0x2054},
+	{0x2060,0x206F},
+	{0x2070,0x218F},
+	{0x2460,0x24FF},
+	{0x2776,0x2793},
+	{0x2C00,0x2DFF},
+	{0x2E80,0x2FFF},
+	{0x3004,0x3007},
+	{0x3021,0x302F},
+	{0x3031,0x303F},
+	{0x3040,0xD7FF},
+	{0xF900,0xFD3D},
+	{0xFD40,0xFDCF},
+	{0xFDF0,0xFE44},
+	{0xFE47,0xFFFD},
+	{0x10000,0x1FFFD},
+	{0x20000,0x2FFFD},
+	{0x30000,0x3FFFD},
+	{0x40000,0x4FFFD},
+	{0x50000,0x5FFFD},
+	{0x60000,0x6FFFD},
+	{0x70000,0x7FFFD},
+	{0x80000,0x8FFFD},
+	{0x90000,0x9FFFD},
+	{0xA0000,0xAFFFD},
+	{0xB0000,0xBFFFD},
+	{0xC0000,0xCFFFD},
+	{0xD0000,0xDFFFD},
+	{0xE0000,0xEFFFD}
+};
+
+// See C++ standard 2.11 Identifiers and Appendix/Annex E.2
+constexpr CodePointRange AnnexE2_DisallowedInitially_RangesSorted[] =
+{
+	{0x300,0x36F},
+	{0x1DC0,0x1DFF},
+	{0x20D0,0x20FF},
+	{0xFE20,0xFE2F}
+};
+
+// CodePointTrie<Ranges, N>: two-level bitmap over all code points 0..0x10FFFF
+//
+// The first level has one entry per block of 4096 code points: 0 if no code
+// point in the block is in a range, 1 if all are, otherwise 2 + k for the
+// k-th mixed block.  Only mixed blocks have a second level, a 4096-bit
+// bitmap stored as 64 words in `leaves`.
+constexpr int CodePointTrieBlockBits = 12;
+constexpr int CodePointTrieBlocks = 0x110000 >> CodePointTrieBlockBits;
+constexpr int CodePointTrieBlockWords = (1 << CodePointTrieBlockBits) / 64;
+
+constexpr int MinCodePoint(int a, int b) { return a < b ? a : b; }
+constexpr int MaxCodePoint(int a, int b) { return a < b ? b : a; }
+
+// word with bits [0, n) set
+constexpr uint64_t LowBits(int n)
+{
+	return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+}
+
+// bits of the code points [base, base+63] that are in `range`
+constexpr uint64_t RangeWord(CodePointRange range, int base)
+{
+	return (range.last < base || range.first > base + 63) ? 0 :
+		LowBits(MinCodePoint(range.last, base + 63) - base + 1) & ~LowBits(MaxCodePoint(range.first, base) - base);
+}
+
+// bits of the code points [base, base+63] that are in any of ranges[0, n)
+constexpr uint64_t RangesWord(const CodePointRange* ranges, size_t n, int base)
+{
+	return n == 0 ? 0 : RangeWord(ranges[0], base) | RangesWord(ranges + 1, n - 1, base);
+}
+
+// true iff some range intersects [first, last]
+constexpr bool RangesIntersect(const CodePointRange* ranges, size_t n, int first, int last)
+{
+	return n != 0 && ((ranges[0].first <= last && ranges[0].last >= first) || RangesIntersect(ranges + 1, n - 1, first, last));
+}
+
+// true iff a single range covers [first, last]
+constexpr bool RangesCover(const CodePointRange* ranges, size_t n, int first, int last)
+{
+	return n != 0 && ((ranges[0].first <= first && ranges[0].last >= last) || RangesCover(ranges + 1, n - 1, first, last));
+}
+
+constexpr bool IsBlockEmpty(const CodePointRange* ranges, size_t n, int block)
+{
+	return !RangesIntersect(ranges, n, block << CodePointTrieBlockBits, ((block + 1) << CodePointTrieBlockBits) - 1);
+}
+
+constexpr bool IsBlockFull(const CodePointRange* ranges, size_t n, int block)
+{
+	return RangesCover(ranges, n, block << CodePointTrieBlockBits, ((block + 1) << CodePointTrieBlockBits) - 1);
+}
+
+constexpr bool IsBlockMixed(const CodePointRange* ranges, size_t n, int block)
+{
+	return !IsBlockEmpty(ranges, n, block) && !IsBlockFull(ranges, n, block);
+}
+
+// number of mixed blocks before `block`
+constexpr int MixedBlocksBefore(const CodePointRange* ranges, size_t n, int block)
+{
+	return block == 0 ? 0 : MixedBlocksBefore(ranges, n, block - 1) + IsBlockMixed(ranges, n, block - 1);
+}
+
+constexpr uint16_t TrieLevel1Entry(const CodePointRange* ranges, size_t n, int block)
+{
+	return IsBlockEmpty(ranges, n, block) ? 0 :
+		IsBlockFull(ranges, n, block) ? 1 :
+		2 + MixedBlocksBefore(ranges, n, block);
+}
+
+// number of the block whose first level entry is `entry`
+constexpr int FindTrieBlock(const uint16_t* level1, unsigned int entry, int block = 0)
+{
+	return level1[block] == entry ? block : FindTrieBlock(level1, entry, block + 1);
+}
+
+// i-th word of the second level
+constexpr uint64_t TrieLeafWord(const CodePointRange* ranges, size_t n, const uint16_t* level1, int i)
+{
+	return RangesWord(ranges, n,
+		(FindTrieBlock(level1, 2 + i / CodePointTrieBlockWords) << CodePointTrieBlockBits) + 64 * (i % CodePointTrieBlockWords));
+}
+
+template<const CodePointRange* Ranges, size_t N, typename Seq>
+struct CodePointTrieLevel1;
+
+template<const CodePointRange* Ranges, size_t N, size_t... B>
+struct CodePointTrieLevel1<Ranges, N, IndexSequence<B...>>
+{
+	static constexpr uint16_t level1[sizeof...(B)] = { TrieLevel1Entry(Ranges, N, B)... };
+};
+
+template<const CodePointRange* Ranges, size_t N, size_t... B>
+constexpr uint16_t CodePointTrieLevel1<Ranges, N, IndexSequence<B...>>::level1[sizeof...(B)];
+
+template<const CodePointRange* Ranges, size_t N, typename Seq>
+struct CodePointTrieLeaves;
+
+template<const CodePointRange* Ranges, size_t N, size_t... W>
+struct CodePointTrieLeaves<Ranges, N, IndexSequence<W...>>
+	: CodePointTrieLevel1<Ranges, N, MakeIndexSequence<CodePointTrieBlocks>::type>
+{
+	typedef CodePointTrieLevel1<Ranges, N, MakeIndexSequence<CodePointTrieBlocks>::type> Level1;
+
+	static constexpr uint64_t leaves[sizeof...(W)] = { TrieLeafWord(Ranges, N, Level1::level1, W)... };
+};
+
+template<const CodePointRange* Ranges, size_t N, size_t... W>
+constexpr uint64_t CodePointTrieLeaves<Ranges, N, IndexSequence<W...>>::leaves[sizeof...(W)];
+
+template<const CodePointRange* Ranges, size_t N>
+struct CodePointTrie
+	: CodePointTrieLeaves<Ranges, N,
+		typename MakeIndexSequence<MixedBlocksBefore(Ranges, N, CodePointTrieBlocks) * CodePointTrieBlockWords>::type>
+{
+	// true iff code point c is in one of the ranges
+	static bool test(int c)
+	{
+		if (c < 0 || c > 0x10FFFF)
+			return false;
+
+		unsigned int entry = CodePointTrie::level1[c >> CodePointTrieBlockBits];
+
+		if (entry < 2)
+			return entry;
+
+		uint64_t word = CodePointTrie::leaves[(entry - 2) * CodePointTrieBlockWords + ((c >> 6) & (CodePointTrieBlockWords - 1))];
+
+		return (word >> (c & 63)) & 1;
+	}
+};
+
+typedef CodePointTrie<AnnexE1_Allowed_RangesSorted,
+	sizeof(AnnexE1_Allowed_RangesSorted) / sizeof(CodePointRange)> AnnexE1_Allowed_Trie;
+
+typedef CodePointTrie<AnnexE2_DisallowedInitially_RangesSorted,
+	sizeof(AnnexE2_DisallowedInitially_RangesSorted) / sizeof(CodePointRange)> AnnexE2_DisallowedInitially_Trie;
+
+// true iff code point c may appear in an identifier (Annex E.1)
+inline bool IsAnnexE1Allowed(int c)
+{
+	return AnnexE1_Allowed_Trie::test(c);
+}
+
+// true iff code point c may not begin an identifier (Annex E.2)
+inline bool IsAnnexE2DisallowedInitially(int c)
+{
+	return AnnexE2_DisallowedInitially_Trie::test(c);
+}
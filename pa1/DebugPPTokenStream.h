@@ -4,74 +4,76 @@
 
 #include "IPPTokenStream.h"
 
-struct DebugPPTokenStream : IPPTokenStream
+// DebugPPTokenStream: token sink producing the PA1 text output format
+struct DebugPPTokenStream
 {
-	void emit_whitespace_sequence()
+	void emit_whitespace_sequence(PPTokenSpelling)
 	{
-		cout << "whitespace-sequence 0 " << endl;
+		cout << "whitespace-sequence 0 \n";
 	}
 
-	void emit_new_line()
+	void emit_new_line(PPTokenSpelling)
 	{
-		cout << "new-line 0 " << endl;
+		cout << "new-line 0 \n";
 	}
 
-	void emit_header_name(const string& data)
+	void emit_header_name(PPTokenSpelling data)
 	{
 		write_token("header-name", data);
 	}
 
-	void emit_identifier(const string& data)
+	void emit_identifier(PPTokenSpelling data)
 	{
 		write_token("identifier", data);
 	}
 
-	void emit_pp_number(const string& data)
+	void emit_pp_number(PPTokenSpelling data)
 	{
 		write_token("pp-number", data);
 	}
 
-	void emit_character_literal(const string& data)
+	void emit_character_literal(PPTokenSpelling data)
 	{
 		write_token("character-literal", data);
 	}
 
-	void emit_user_defined_character_literal(const string& data)
+	void emit_user_defined_character_literal(PPTokenSpelling data)
 	{
 		write_token("user-defined-character-literal", data);
 	}
 
-	void emit_string_literal(const string& data)
+	void emit_string_literal(PPTokenSpelling data)
 	{
 		write_token("string-literal", data);
 	}
 
-	void emit_user_defined_string_literal(const string& data)
+	void emit_user_defined_string_literal(PPTokenSpelling data)
 	{
 		write_token("user-defined-string-literal", data);
 	}
 
-	void emit_preprocessing_op_or_punc(const string& data)
+	void emit_preprocessing_op_or_punc(PPTokenSpelling data)
 	{
 		write_token("preprocessing-op-or-punc", data);
 	}
 
-	void emit_non_whitespace_char(const string& data)
+	void emit_non_whitespace_char(PPTokenSpelling data)
 	{
 		write_token("non-whitespace-character", data);
 	}
 
 	void emit_eof()
 	{
-		cout << "eof" << endl;
+		cout << "eof\n";
+		cout.flush();
 	}
 
 private:
 
-	void write_token(const string& type, const string& data)
+	void write_token(const char* type, PPTokenSpelling data)
 	{
-		cout << type << " " << data.size() << " ";
-		cout.write(data.data(), data.size());
-		cout << endl;
+		cout << type << " " << data.size << " ";
+		cout.write(data.data, data.size);
+		cout << '\n';
 	}
 };
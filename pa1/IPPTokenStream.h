@@ -1,5 +1,30 @@
 #pragma once
 
+#include "PPTokenSpelling.h"
+
+// Token sinks
+//
+// PPTokenizer is a template over its sink type, so emits are resolved at
+// compile time and can be inlined.  A sink is any type with these members
+// (whitespace-sequence and new-line spellings are the raw source slices,
+// passed along for their offset; the output formats show them as empty):
+//
+//     void emit_whitespace_sequence(PPTokenSpelling data);
+//     void emit_new_line(PPTokenSpelling data);
+//     void emit_header_name(PPTokenSpelling data);
+//     void emit_identifier(PPTokenSpelling data);
+//     void emit_pp_number(PPTokenSpelling data);
+//     void emit_character_literal(PPTokenSpelling data);
+//     void emit_user_defined_character_literal(PPTokenSpelling data);
+//     void emit_string_literal(PPTokenSpelling data);
+//     void emit_user_defined_string_literal(PPTokenSpelling data);
+//     void emit_preprocessing_op_or_punc(PPTokenSpelling data);
+//     void emit_non_whitespace_char(PPTokenSpelling data);
+//     void emit_eof();
+//
+// IPPTokenStream is the runtime-polymorphic variant, for consumers chosen at
+// run time; plug it into PPTokenizer through IPPTokenStreamSink.
+
 struct IPPTokenStream
 {
 	virtual void emit_whitespace_sequence() = 0;
@@ -17,3 +42,26 @@ struct IPPTokenStream
 
 	virtual ~IPPTokenStream() {}
 };
+
+// IPPTokenStreamSink: sink forwarding to an IPPTokenStream
+struct IPPTokenStreamSink
+{
+	IPPTokenStream& output;
+
+	IPPTokenStreamSink(IPPTokenStream& output)
+		: output(output)
+	{}
+
+	void emit_whitespace_sequence(PPTokenSpelling) { output.emit_whitespace_sequence(); }
+	void emit_new_line(PPTokenSpelling) { output.emit_new_line(); }
+	void emit_header_name(PPTokenSpelling data) { output.emit_header_name(data.str()); }
+	void emit_identifier(PPTokenSpelling data) { output.emit_identifier(data.str()); }
+	void emit_pp_number(PPTokenSpelling data) { output.emit_pp_number(data.str()); }
+	void emit_character_literal(PPTokenSpelling data) { output.emit_character_literal(data.str()); }
+	void emit_user_defined_character_literal(PPTokenSpelling data) { output.emit_user_defined_character_literal(data.str()); }
+	void emit_string_literal(PPTokenSpelling data) { output.emit_string_literal(data.str()); }
+	void emit_user_defined_string_literal(PPTokenSpelling data) { output.emit_user_defined_string_literal(data.str()); }
+	void emit_preprocessing_op_or_punc(PPTokenSpelling data) { output.emit_preprocessing_op_or_punc(data.str()); }
+	void emit_non_whitespace_char(PPTokenSpelling data) { output.emit_non_whitespace_char(data.str()); }
+	void emit_eof() { output.emit_eof(); }
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+// IndexSequence<0, 1, ..., N-1>: pack of indices to expand table entries
+// over (std::index_sequence is C++14).  Built by halving, so the template
+// depth stays logarithmic in N.
+template<size_t... I>
+struct IndexSequence
+{
+	typedef IndexSequence type;
+};
+
+template<typename A, typename B>
+struct ConcatIndexSequence;
+
+template<size_t... I, size_t... J>
+struct ConcatIndexSequence<IndexSequence<I...>, IndexSequence<J...>>
+	: IndexSequence<I..., (sizeof...(I) + J)...>
+{};
+
+template<size_t N>
+struct MakeIndexSequence
+	: ConcatIndexSequence<typename MakeIndexSequence<N / 2>::type, typename MakeIndexSequence<N - N / 2>::type>
+{};
+
+template<> struct MakeIndexSequence<0> : IndexSequence<> {};
+template<> struct MakeIndexSequence<1> : IndexSequence<0> {};
@@ -0,0 +1,49 @@
+#pragma once
+
+// PPTokenSpelling: non-owning UTF-8 spelling of a preprocessing token
+//
+// Usually a slice of the source buffer.  When phases 1 and 2 changed the
+// spelling (trigraphs, line splices, universal-character-names) it points
+// into a scratch buffer owned by the tokenizer instead.  Either way it is
+// only valid until the sink returns; copy it with str() to keep it.
+//
+// `offset` is the source byte offset of the first code unit of the token.
+struct PPTokenSpelling
+{
+	const char* data;
+	size_t size;
+	size_t offset;
+
+	constexpr PPTokenSpelling()
+		: data(""), size(0), offset(0)
+	{}
+
+	constexpr PPTokenSpelling(const char* data, size_t size, size_t offset = 0)
+		: data(data), size(size), offset(offset)
+	{}
+
+	template<size_t N>
+	constexpr PPTokenSpelling(const char (&literal)[N])
+		: data(literal), size(N - 1), offset(0)
+	{}
+
+	PPTokenSpelling(const string& s, size_t offset = 0)
+		: data(s.data()), size(s.size()), offset(offset)
+	{}
+
+	const char* begin() const { return data; }
+	const char* end() const { return data + size; }
+	bool empty() const { return size == 0; }
+
+	string str() const { return string(data, size); }
+
+	bool operator==(const PPTokenSpelling& that) const
+	{
+		return size == that.size && memcmp(data, that.data, size) == 0;
+	}
+
+	bool operator!=(const PPTokenSpelling& that) const
+	{
+		return !(*this == that);
+	}
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CharClass.h"
+
+// UTF-8 validation and decoding (translation phase 1)
+//
+// Decoding is defined to match the reference implementation: lead
+// units 0xF8..0xFF, stray trailing units, truncated sequences and code
+// points above 0x10FFFF are errors, overlong forms and surrogates are not.
+//
+// Runs of ASCII are skipped 16 code units at a time, so ASCII sources cost
+// little more than a scan and are never transcoded.
+
+// first position in [begin, end) that is not ASCII
+inline const char* SkipAscii(const char* begin, const char* end)
+{
+	while (end - begin >= (ptrdiff_t) (2 * sizeof(PPWord)))
+	{
+		PPWord w = (PPWordLoad(begin) | PPWordLoad(begin + sizeof(PPWord))) & PPWordHighs;
+
+		if (w)
+			break;
+
+		begin += 2 * sizeof(PPWord);
+	}
+
+	while (begin != end && !((unsigned char) *begin & 0x80))
+		begin++;
+
+	return begin;
+}
+
+[[noreturn]] inline void ThrowUtf8Error(const char* what, size_t offset)
+{
+	throw runtime_error(string("utf8 ") + what + " at byte offset " + to_string(offset));
+}
+
+// decode the sequence starting at non-ASCII code unit `p`, advancing `p`
+// `base` is the start of the source, for the offset in error messages
+inline int DecodeUtf8Sequence(const char*& p, const char* end, const char* base)
+{
+	unsigned char lead = *p;
+
+	if (lead < 0xC0)
+		ThrowUtf8Error("unexpected trailing code unit (10xxxxxx)", p - base);
+
+	if (lead >= 0xF8)
+		ThrowUtf8Error("invalid unit (11111xxx)", p - base);
+
+	int ntrailing = lead < 0xE0 ? 1 : lead < 0xF0 ? 2 : 3;
+	int c = lead & (0x3F >> ntrailing);
+
+	if (end - p <= ntrailing)
+		ThrowUtf8Error("expected trailing byte (10xxxxxx)", p - base);
+
+	for (int i = 1; i <= ntrailing; i++)
+	{
+		unsigned char trailing = p[i];
+
+		if ((trailing & 0xC0) != 0x80)
+			ThrowUtf8Error("expected trailing byte (10xxxxxx)", p + i - base);
+
+		c = (c << 6) | (trailing & 0x3F);
+	}
+
+	if (c > 0x10FFFF)
+		ThrowUtf8Error("invalid code point", p - base);
+
+	p += ntrailing + 1;
+	return c;
+}
+
+// check that [begin, end) is valid UTF-8, throwing with the byte offset of
+// the first invalid sequence
+// returns true iff it is pure ASCII
+inline bool ValidateUtf8(const char* begin, const char* end)
+{
+	bool ascii = true;
+
+	for (const char* p = SkipAscii(begin, end); p != end; p = SkipAscii(p, end))
+	{
+		DecodeUtf8Sequence(p, end, begin);
+		ascii = false;
+	}
+
+	return ascii;
+}
+
+// decode [begin, end) to code points appended to `out`
+inline void DecodeUtf8(const char* begin, const char* end, vector<int>& out)
+{
+	out.reserve(out.size() + (end - begin));
+
+	const char* p = begin;
+
+	while (p != end)
+	{
+		const char* ascii_end = SkipAscii(p, end);
+
+		for (; p != ascii_end; p++)
+			out.push_back((unsigned char) *p);
+
+		if (p != end)
+			out.push_back(DecodeUtf8Sequence(p, end, begin));
+	}
+}
@@ -0,0 +1,119 @@
+// Annex E identifier range lookup: constexpr bitmap trie vs the former
+// binary search over a vector of ranges, on CJK and Cyrillic identifiers
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../CharClass.h"
+
+// former representation: sorted ranges searched at run time
+bool BinarySearchRanges(const vector<pair<int, int>>& ranges, int c)
+{
+	auto it = upper_bound(ranges.begin(), ranges.end(), make_pair(c, 0x7FFFFFFF));
+
+	return it != ranges.begin() && (it - 1)->second >= c;
+}
+
+vector<pair<int, int>> ToVector(const CodePointRange* ranges, size_t n)
+{
+	vector<pair<int, int>> v;
+
+	for (size_t i = 0; i < n; i++)
+		v.emplace_back(ranges[i].first, ranges[i].last);
+
+	return v;
+}
+
+// code points of identifiers in a synthetic source: mostly CJK unified
+// ideographs and Cyrillic letters, with some ASCII and combining marks
+vector<int> MakeIdentifierCodePoints(size_t n)
+{
+	vector<int> v;
+	v.reserve(n);
+
+	uint32_t seed = 12345;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		uint32_t r = seed >> 8;
+
+		switch (r % 8)
+		{
+		case 0: case 1: case 2: v.push_back(0x4E00 + (r >> 3) % 0x5200); break; // CJK
+		case 3: case 4: case 5: v.push_back(0x410 + (r >> 3) % 0x40); break; // Cyrillic
+		case 6: v.push_back('a' + (r >> 3) % 26); break;
+		default: v.push_back(0x300 + (r >> 3) % 0x70); break; // combining marks
+		}
+	}
+
+	return v;
+}
+
+template<typename F>
+double Time(const vector<int>& input, int repeat, F f, size_t& count)
+{
+	auto start = chrono::steady_clock::now();
+
+	count = 0;
+
+	for (int r = 0; r < repeat; r++)
+		for (int c : input)
+			count += f(c);
+
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+	vector<pair<int, int>> e1 = ToVector(AnnexE1_Allowed_RangesSorted, sizeof(AnnexE1_Allowed_RangesSorted) / sizeof(CodePointRange));
+	vector<pair<int, int>> e2 = ToVector(AnnexE2_DisallowedInitially_RangesSorted, sizeof(AnnexE2_DisallowedInitially_RangesSorted) / sizeof(CodePointRange));
+
+	// tables must agree with the ranges on every code point
+	for (int c = -1; c <= 0x110000; c++)
+	{
+		if (IsAnnexE1Allowed(c) != BinarySearchRanges(e1, c) || IsAnnexE2DisallowedInitially(c) != BinarySearchRanges(e2, c))
+		{
+			cerr << "ERROR: trie mismatch at code point " << c << endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	for (int c = 0; c < 256; c++)
+	{
+		bool hex = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+
+		if (IsCharClass(c, CC_HEX_DIGIT) != hex)
+		{
+			cerr << "ERROR: char class mismatch at code unit " << c << endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	vector<int> input = MakeIdentifierCodePoints(1 << 20);
+	const int repeat = 64;
+	double mcp = double(input.size()) * repeat / 1e6;
+
+	size_t n1, n2;
+
+	double t1 = Time(input, repeat, [&](int c) { return BinarySearchRanges(e1, c) && !(BinarySearchRanges(e2, c)); }, n1);
+	double t2 = Time(input, repeat, [](int c) { return IsAnnexE1Allowed(c) && !IsAnnexE2DisallowedInitially(c); }, n2);
+
+	if (n1 != n2)
+	{
+		cerr << "ERROR: result mismatch" << endl;
+		return EXIT_FAILURE;
+	}
+
+	cout << "annex-e identifier-start checks over " << mcp << "M code points" << endl;
+	cout << "  binary search: " << t1 << " s, " << mcp / t1 << " Mcp/s" << endl;
+	cout << "  bitmap trie:   " << t2 << " s, " << mcp / t2 << " Mcp/s" << endl;
+}
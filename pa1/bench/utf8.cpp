@@ -0,0 +1,96 @@
+// UTF-8 validation and decoding throughput, ASCII fast path vs a
+// byte-at-a-time decoder, on mostly-ASCII source with some UTF-8 literals
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../Utf8.h"
+
+// reference: decode every code unit through the sequence decoder
+void DecodeUtf8Bytewise(const char* begin, const char* end, vector<int>& out)
+{
+	for (const char* p = begin; p != end; )
+	{
+		if ((unsigned char) *p < 0x80)
+			out.push_back((unsigned char) *p++);
+		else
+			out.push_back(DecodeUtf8Sequence(p, end, begin));
+	}
+}
+
+string MakeSource(size_t nbytes, bool with_utf8)
+{
+	const string line = "\tfor (int i = 0; i < n; i++) total += table[i] * weight(i); // sum\n";
+	const string utf8_line = "\tconst char* greeting = u8\"\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 \xe4\xb8\x96\xe7\x95\x8c\";\n";
+
+	string s;
+
+	for (size_t i = 0; s.size() < nbytes; i++)
+		s += (with_utf8 && i % 50 == 0) ? utf8_line : line;
+
+	return s;
+}
+
+template<typename F>
+double Time(F f)
+{
+	auto start = chrono::steady_clock::now();
+	f();
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+	for (bool with_utf8 : { false, true })
+	{
+		string source = MakeSource(64 << 20, with_utf8);
+		const char* begin = source.data();
+		const char* end = begin + source.size();
+		double mb = source.size() / double(1 << 20);
+
+		vector<int> a, b;
+		bool ascii = false;
+
+		double t_validate = Time([&] { ascii = ValidateUtf8(begin, end); });
+		double t_bytewise = Time([&] { DecodeUtf8Bytewise(begin, end, a); });
+		double t_decode = Time([&] { DecodeUtf8(begin, end, b); });
+
+		if (a != b || ascii == with_utf8)
+		{
+			cerr << "ERROR: decoders disagree" << endl;
+			return EXIT_FAILURE;
+		}
+
+		cout << (with_utf8 ? "mixed" : "ascii") << " source, " << mb << " MB" << endl;
+		cout << "  validate:        " << mb / t_validate << " MB/s" << endl;
+		cout << "  decode bytewise: " << mb / t_bytewise << " MB/s" << endl;
+		cout << "  decode:          " << mb / t_decode << " MB/s" << endl;
+	}
+
+	// errors are reported with the byte offset of the invalid sequence, here
+	// a truncated one at the end of the input
+	const char bad[] = "int x = 1;\n\xe4\xb8";
+
+	try
+	{
+		ValidateUtf8(bad, bad + sizeof(bad) - 1);
+		cerr << "ERROR: invalid sequence accepted" << endl;
+		return EXIT_FAILURE;
+	}
+	catch (runtime_error& e)
+	{
+		if (string(e.what()).find("offset 11") == string::npos)
+		{
+			cerr << "ERROR: wrong offset: " << e.what() << endl;
+			return EXIT_FAILURE;
+		}
+	}
+}
@@ -5,11 +5,20 @@
 #include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <memory>
 
 using namespace std;
 
 #include "IPPTokenStream.h"
 #include "DebugPPTokenStream.h"
+#include "BinaryPPTokenStream.h"
+#include "SourceBuffer.h"
+#include "CharClass.h"
+#include "Utf8.h"
 
 // Translation features you need to implement:
 // - utf8 decoder
@@ -23,96 +32,6 @@ using namespace std;
 // EndOfFile: synthetic "character" to represent the end of source file
 constexpr int EndOfFile = -1;
 
-// given hex digit character c, return its value
-int HexCharToValue(int c)
-{
-	switch (c)
-	{
-	case '0': return 0;
-	case '1': return 1;
-	case '2': return 2;
-	case '3': return 3;
-	case '4': return 4;
-	case '5': return 5;
-	case '6': return 6;
-	case '7': return 7;
-	case '8': return 8;
-	case '9': return 9;
-	case 'A': return 10;
-	case 'a': return 10;
-	case 'B': return 11;
-	case 'b': return 11;
-	case 'C': return 12;
-	case 'c': return 12;
-	case 'D': return 13;
-	case 'd': return 13;
-	case 'E': return 14;
-	case 'e': return 14;
-	case 'F': return 15;
-	case 'f': return 15;
-	default: throw logic_error("HexCharToValue of nonhex char");
-	}
-}
-
-// See C++ standard 2.11 Identifiers and Appendix/Annex E.1
-const vector<pair<int, int>> AnnexE1_Allowed_RangesSorted =
-{
-	{0xA8,0xA8},
-	{0xAA,0xAA},
-	{0xAD,0xAD},
-	{0xAF,0xAF},
-	{0xB2,0xB5},
-	{0xB7,0xBA},
-	{0xBC,0xBE},
-	{0xC0,0xD6},
-	{0xD8,0xF6},
-	{0xF8,0xFF},
-	{0x100,0x167F},
-	{0x1681,0x180D},
-	{0x180F,0x1FFF},
-	{0x200B,0x200D},
-	{0x202A,0x202E},
-	{0x203F,0x2040},
-	{0x2054,0x2054},
-	{0x2060,0x206F},
-	{0x2070,0x218F},
-	{0x2460,0x24FF},
-	{0x2776,0x2793},
-	{0x2C00,0x2DFF},
-	{0x2E80,0x2FFF},
-	{0x3004,0x3007},
-	{0x3021,0x302F},
-	{0x3031,0x303F},
-	{0x3040,0xD7FF},
-	{0xF900,0xFD3D},
-	{0xFD40,0xFDCF},
-	{0xFDF0,0xFE44},
-	{0xFE47,0xFFFD},
-	{0x10000,0x1FFFD},
-	{0x20000,0x2FFFD},
-	{0x30000,0x3FFFD},
-	{0x40000,0x4FFFD},
-	{0x50000,0x5FFFD},
-	{0x60000,0x6FFFD},
-	{0x70000,0x7FFFD},
-	{0x80000,0x8FFFD},
-	{0x90000,0x9FFFD},
-	{0xA0000,0xAFFFD},
-	{0xB0000,0xBFFFD},
-	{0xC0000,0xCFFFD},
-	{0xD0000,0xDFFFD},
-	{0xE0000,0xEFFFD}
-};
-
-// See C++ standard 2.11 Identifiers and Appendix/Annex E.2
-const vector<pair<int, int>> AnnexE2_DisallowedInitially_RangesSorted =
-{
-	{0x300,0x36F},
-	{0x1DC0,0x1DFF},
-	{0x20D0,0x20FF},
-	{0xFE20,0xFE2F}
-};
-
 // See C++ standard 2.13 Operators and punctuators
 const unordered_set<string> Digraph_IdentifierLike_Operators =
 {
@@ -127,12 +46,61 @@ const unordered_set<int> SimpleEscapeSequence_CodePoints =
 	'\'', '"', '?', '\\', 'a', 'b', 'f', 'n', 'r', 't', 'v'
 };
 
+// Word-at-a-time byte classes (see PPWord in CharClass.h).  Each class
+// has a scalar test() and a word() returning the high bit of every byte
+// that is a member of the class.
+
+// PlainCodeUnit: ASCII code units that phases 1 and 2 pass through unchanged,
+// that is, anything but `?` (trigraphs), `\` (line splices and
+// universal-character-names) and non-ASCII (UTF-8 sequences).
+struct PlainCodeUnit
+{
+	static bool test(unsigned char c)
+	{
+		return c < 0x80 && c != '?' && c != '\\';
+	}
+
+	static PPWord word(PPWord w)
+	{
+		return ~(w | PPWordEqual(w, '?') | PPWordEqual(w, '\\')) & PPWordHighs;
+	}
+};
+
+// SkipRun<Class>: return first position in [begin, end) that is not in Class
+template<typename Class>
+const char* SkipRun(const char* begin, const char* end)
+{
+	while (end - begin >= (ptrdiff_t) sizeof(PPWord))
+	{
+		PPWord stop = ~Class::word(PPWordLoad(begin)) & PPWordHighs;
+
+		if (stop)
+			return begin + (__builtin_ctzll(stop) >> 3);
+
+		begin += sizeof(PPWord);
+	}
+
+	while (begin != end && Class::test(*begin))
+		begin++;
+
+	return begin;
+}
+
 // Tokenizer
+//
+// TokenSink is any type with the emit_* members listed in IPPTokenStream.h.
+// Token spellings are emitted as slices of the source where possible; only
+// a token whose spelling phases 1 and 2 changed is copied into `spelling`.
+template<typename TokenSink>
 struct PPTokenizer
 {
-	IPPTokenStream& output;
+	TokenSink& output;
+
+	// scratch buffer for the spelling of the current token, used once a
+	// trigraph, line splice or universal-character-name changed it
+	string spelling;
 
-	PPTokenizer(IPPTokenStream& output)
+	PPTokenizer(TokenSink& output)
 		: output(output)
 	{}
 
@@ -154,28 +122,126 @@ struct PPTokenizer
 		// It is a state machine with about 50 states, most of which
 		// are simple transitions of the operators.
 	}
-};
 
-int main()
-{
-	try
+	// process code units [begin, end) as one block
+	//
+	// Phases 1 and 2 only rewrite the input at `?`, `\\` and non-ASCII code
+	// units.  Runs in between reach phase 3 unchanged and are handed to
+	// process_run(), boundaries go through the per-code-unit process().
+	// Until process_run() consumes runs this only adds the boundary scan, so
+	// Tokenize uses it with --block only.
+	void process(const char* begin, const char* end)
 	{
-		ostringstream oss;
-		oss << cin.rdbuf();
+		while (begin != end)
+		{
+			const char* boundary = SkipRun<PlainCodeUnit>(begin, end);
+
+			if (boundary != begin)
+			{
+				process_run(begin, boundary);
+				begin = boundary;
+			}
+			else
+			{
+				process((unsigned char) *begin++);
+			}
+		}
+	}
 
-		string input = oss.str();
+	// process a run of PlainCodeUnit code units
+	//
+	// A state that consumes long runs (identifier, pp-number,
+	// whitespace-sequence, comment bodies) can take the longest prefix of its
+	// class with a SkipRun in one step; until then every state goes through
+	// process(int).
+	void process_run(const char* begin, const char* end)
+	{
+		for (; begin != end; begin++)
+			process((unsigned char) *begin);
+	}
+};
 
-		DebugPPTokenStream output;
+// tokenize `input` into `output`
+// if `block`, feed the tokenizer runs between phase 1/2 boundaries (for
+// benchmarking), otherwise one code unit at a time
+template<typename TokenSink>
+void Tokenize(const SourceBuffer& input, TokenSink& output, bool block)
+{
+	// phase 1: reject ill-formed UTF-8 up front, with its byte offset
+	ValidateUtf8(input.begin(), input.end());
 
-		PPTokenizer tokenizer(output);
+	PPTokenizer<TokenSink> tokenizer(output);
 
+	if (block)
+	{
+		tokenizer.process(input.begin(), input.end());
+	}
+	else
+	{
 		for (char c : input)
 		{
 			unsigned char code_unit = c;
 			tokenizer.process(code_unit);
 		}
+	}
+
+	tokenizer.process(EndOfFile);
+}
+
+// usage: pptoken [--block] [--format=text|binary] [--decode] [srcfile]
+//
+// --format=binary writes the binary token stream (see BinaryPPTokenStream.h)
+// --decode reads a binary token stream instead of source and writes it in
+//          the text format, so binary output can be compared with the tests
+int main(int argc, char** argv)
+{
+	try
+	{
+		vector<string> args;
+
+		for (int i = 1; i < argc; i++)
+			args.emplace_back(argv[i]);
+
+		bool block = false;
+		bool binary = false;
+		bool decode = false;
+
+		// optional source file path, otherwise standard input
+		string srcfile;
+
+		for (const string& arg : args)
+		{
+			if (arg == "--block")
+				block = true;
+			else if (arg == "--format=binary")
+				binary = true;
+			else if (arg == "--format=text")
+				binary = false;
+			else if (arg == "--decode")
+				decode = true;
+			else if (srcfile.empty())
+				srcfile = arg;
+			else
+				throw logic_error("invalid usage");
+		}
 
-		tokenizer.process(EndOfFile);
+		unique_ptr<SourceBuffer> input(srcfile.empty() ? new SourceBuffer(0) : new SourceBuffer(srcfile));
+
+		if (decode)
+		{
+			DebugPPTokenStream output;
+			ReadBinaryPPTokens(input->begin(), input->end(), output);
+		}
+		else if (binary)
+		{
+			BinaryPPTokenStream output(cout);
+			Tokenize(*input, output, block);
+		}
+		else
+		{
+			DebugPPTokenStream output;
+			Tokenize(*input, output, block);
+		}
 	}
 	catch (exception& e)
 	{
@@ -183,4 +249,3 @@ int main()
 		return EXIT_FAILURE;
 	}
 }
-
@@ -0,0 +1,74 @@
+#!/usr/bin/perl
+
+use strict;
+use warnings;
+use Time::HiRes qw(time);
+
+if (scalar(@ARGV) < 1 || scalar(@ARGV) > 2)
+{
+	die "Usage: run_benchmark.pl <app> [<corpus_megabytes>]";
+}
+
+my $app = $ARGV[0];
+my $corpus_mb = scalar(@ARGV) == 2 ? $ARGV[1] : 32;
+
+# build corpus from the well-formed tests, repeated up to `corpus_mb` megabytes
+
+my @tests = split(/\s+/, `find tests -type f`);
+
+my $sample = "";
+
+for my $test (sort @tests)
+{
+	next if $test !~ m/\.t$/;
+
+	my $testbase = $test;
+	$testbase =~ s/\.t$//;
+
+	my $exit_status = `cat $testbase.ref.exit_status`;
+	next if $exit_status !~ m/EXIT_SUCCESS/;
+
+	my $data = `cat $test`;
+	$data .= "\n" if $data !~ m/\n$/;
+	$sample .= $data;
+}
+
+die "empty corpus" if length($sample) == 0;
+
+my $corpus = "bench.corpus";
+
+open(my $fh, '>', $corpus) or die "cannot write $corpus";
+binmode($fh);
+my $nbytes = 0;
+while ($nbytes < $corpus_mb * 1024 * 1024)
+{
+	print $fh $sample;
+	$nbytes += length($sample);
+}
+close($fh);
+
+# run app over corpus and report throughput
+#
+# --block only scans for the phase 1/2 boundaries (`?`, `\` and non-ASCII)
+# a word at a time; both paths then feed the tokenizer one code unit at a
+# time, so the difference is the cost of the boundary scan.
+
+sub run
+{
+	my ($name, $flags) = @_;
+
+	my $start = time();
+	my $sys_ret = system("./$app $flags < $corpus > /dev/null");
+	my $elapsed = time() - $start;
+
+	die "$app $flags failed" if $sys_ret != 0;
+
+	printf("%-16s %10.3f s %10.2f MB/s\n", $name, $elapsed, $nbytes / (1024 * 1024) / $elapsed);
+}
+
+printf("corpus: %d bytes\n", $nbytes);
+
+run("per-code-unit", "");
+run("boundary-scan", "--block");
+
+unlink($corpus);
@@ -0,0 +1,88 @@
+#!/usr/bin/perl
+
+use strict;
+use warnings;
+
+if (scalar(@ARGV) != 1)
+{
+	die "Usage: run_binary_roundtrip.pl <app>";
+}
+
+my $app = $ARGV[0];
+
+# for each test, check that `--format=binary | --decode` writes the same
+# output and exit status as the text format, then that corrupt streams are
+# rejected
+
+my @tests = split(/\s+/, `find tests -type f`);
+
+my $npass = 0;
+my $nfail = 0;
+
+for my $test (sort @tests)
+{
+	next if $test !~ m/\.t$/;
+
+	my $text = `./$app < $test 2>/dev/null`;
+	my $text_status = $? == 0;
+
+	my $binary = `./$app --format=binary < $test 2>/dev/null`;
+	my $binary_status = $? == 0;
+
+	my $decoded = "";
+
+	if ($binary_status)
+	{
+		open(my $fh, '|-', "./$app --decode > roundtrip.out") or die "cannot run $app --decode";
+		binmode($fh);
+		print $fh $binary;
+		close($fh);
+		$binary_status = $? == 0;
+		$decoded = `cat roundtrip.out`;
+		unlink("roundtrip.out");
+	}
+
+	if ($text_status == $binary_status && (!$text_status || $text eq $decoded))
+	{
+		$npass++;
+	}
+	else
+	{
+		print "$test: binary round trip differs from text output\n";
+		$nfail++;
+	}
+}
+
+# corrupt streams must be rejected with an error, not decoded or crash on
+
+my @corrupt =
+(
+	# token kind past PPK_EOF
+	"PPT\x01\xf0",
+);
+
+for my $stream (@corrupt)
+{
+	open(my $fh, '>', "corrupt.bin") or die "cannot write corrupt.bin";
+	binmode($fh);
+	print $fh $stream;
+	close($fh);
+
+	my $error = `./$app --decode < corrupt.bin 2>&1 > /dev/null`;
+	my $status = $?;
+	unlink("corrupt.bin");
+
+	if (($status & 127) == 0 && ($status >> 8) != 0 && $error =~ m/^ERROR: /)
+	{
+		$npass++;
+	}
+	else
+	{
+		printf("corrupt stream %s: not rejected with an error\n", unpack("H*", $stream));
+		$nfail++;
+	}
+}
+
+print "binary round trip: $npass passed, $nfail failed\n";
+
+exit($nfail == 0 ? 0 : 1);
@@ -0,0 +1,259 @@
+#pragma once
+
+// Encoding of string-literal payloads (2.14.5)
+//
+// A run of adjacent string-literals is one array.  Rather than encoding
+// each piece into its own u16string/u32string and joining them, the code
+// points of all the pieces are measured first, the final array is
+// allocated once in a LiteralArena, and each code point is encoded straight
+// into it.
+
+// LiteralArena: bump-pointer allocator for literal payloads
+//
+// Memory is handed out from 64 KiB blocks (a larger payload gets a block of
+// its own).  clear() releases everything at once and keeps the first block,
+// so a tokenizer that clears after emitting each literal allocates only
+// when a literal is bigger than any before it.
+struct LiteralArena
+{
+	LiteralArena()
+		: head(nullptr), last(nullptr), next(nullptr), limit(nullptr)
+	{}
+
+	LiteralArena(const LiteralArena&) = delete;
+	LiteralArena& operator=(const LiteralArena&) = delete;
+
+	~LiteralArena()
+	{
+		free_blocks(head);
+	}
+
+	// uninitialized memory for `nbytes` bytes, aligned for any code unit
+	void* allocate(size_t nbytes)
+	{
+		nbytes = (nbytes + Alignment - 1) & ~(Alignment - 1);
+
+		if (size_t(limit - next) < nbytes)
+			add_block(nbytes);
+
+		void* p = next;
+		next += nbytes;
+		return p;
+	}
+
+	// release all allocations, keeping the first block for reuse
+	void clear()
+	{
+		if (!head)
+			return;
+
+		free_blocks(head->more);
+		head->more = nullptr;
+		last = head;
+		next = head->data();
+		limit = next + head->size;
+	}
+
+private:
+	static constexpr size_t Alignment = 8;
+	static constexpr size_t BlockSize = 64 * 1024;
+
+	// block header, followed by `size` bytes of payload
+	struct Block
+	{
+		Block* more;
+		size_t size;
+
+		char* data() { return (char*) this + sizeof(Block); }
+	};
+
+	static_assert(sizeof(Block) % Alignment == 0, "block payload must stay aligned");
+
+	Block* head;
+	Block* last;
+	char* next;
+	char* limit;
+
+	void add_block(size_t nbytes)
+	{
+		size_t size = max(nbytes, size_t(BlockSize));
+
+		// an unused first block that is too small is replaced rather than
+		// followed, so the block kept by clear() grows to the largest literal
+		if (head == last && head && next == head->data())
+		{
+			operator delete(head);
+			head = last = nullptr;
+		}
+
+		Block* block = (Block*) operator new(sizeof(Block) + size);
+		block->more = nullptr;
+		block->size = size;
+
+		if (last)
+			last->more = block;
+		else
+			head = block;
+
+		last = block;
+		next = block->data();
+		limit = next + size;
+	}
+
+	static void free_blocks(Block* block)
+	{
+		while (block)
+		{
+			Block* more = block->more;
+			operator delete(block);
+			block = more;
+		}
+	}
+};
+
+// code units of a string-literal array: UTF-8 for ordinary and u8
+// literals, UTF-16 for u, UTF-32 for U and L
+enum ELiteralEncoding
+{
+	LE_UTF8,
+	LE_UTF16,
+	LE_UTF32
+};
+
+// CodePointSpan: decoded code points of one string-literal piece
+struct CodePointSpan
+{
+	const int* begin;
+	const int* end;
+};
+
+// EncodedLiteral: string-literal array, including the terminating 0
+struct EncodedLiteral
+{
+	const void* data;
+	size_t nbytes;
+	size_t num_elements;
+};
+
+inline size_t Utf8CodeUnitCount(int c)
+{
+	return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+}
+
+inline unsigned char* EncodeUtf8(int c, unsigned char* p)
+{
+	if (c < 0x80)
+	{
+		*p++ = c;
+	}
+	else if (c < 0x800)
+	{
+		*p++ = 0xC0 | (c >> 6);
+		*p++ = 0x80 | (c & 0x3F);
+	}
+	else if (c < 0x10000)
+	{
+		*p++ = 0xE0 | (c >> 12);
+		*p++ = 0x80 | ((c >> 6) & 0x3F);
+		*p++ = 0x80 | (c & 0x3F);
+	}
+	else
+	{
+		*p++ = 0xF0 | (c >> 18);
+		*p++ = 0x80 | ((c >> 12) & 0x3F);
+		*p++ = 0x80 | ((c >> 6) & 0x3F);
+		*p++ = 0x80 | (c & 0x3F);
+	}
+
+	return p;
+}
+
+inline char16_t* EncodeUtf16(int c, char16_t* p)
+{
+	if (c < 0x10000)
+	{
+		*p++ = c;
+	}
+	else
+	{
+		c -= 0x10000;
+		*p++ = 0xD800 | (c >> 10);
+		*p++ = 0xDC00 | (c & 0x3FF);
+	}
+
+	return p;
+}
+
+// EncodeStringLiteral: encode the concatenation of `npieces` pieces of
+// code points, plus the terminating 0, into one array in `arena`
+inline EncodedLiteral EncodeStringLiteral(LiteralArena& arena, ELiteralEncoding encoding, const CodePointSpan* pieces, size_t npieces)
+{
+	size_t ncodeunits = 1;
+
+	for (size_t i = 0; i < npieces; i++)
+	{
+		if (encoding == LE_UTF8)
+		{
+			for (const int* c = pieces[i].begin; c != pieces[i].end; c++)
+				ncodeunits += Utf8CodeUnitCount(*c);
+		}
+		else
+		{
+			ncodeunits += pieces[i].end - pieces[i].begin;
+
+			if (encoding == LE_UTF16)
+				for (const int* c = pieces[i].begin; c != pieces[i].end; c++)
+					ncodeunits += *c >= 0x10000;
+		}
+	}
+
+	EncodedLiteral literal;
+	literal.num_elements = ncodeunits;
+
+	switch (encoding)
+	{
+	case LE_UTF8:
+	{
+		unsigned char* p = (unsigned char*) arena.allocate(ncodeunits);
+		literal.data = p;
+
+		for (size_t i = 0; i < npieces; i++)
+			for (const int* c = pieces[i].begin; c != pieces[i].end; c++)
+				p = EncodeUtf8(*c, p);
+
+		*p = 0;
+		literal.nbytes = ncodeunits;
+		break;
+	}
+
+	case LE_UTF16:
+	{
+		char16_t* p = (char16_t*) arena.allocate(ncodeunits * sizeof(char16_t));
+		literal.data = p;
+
+		for (size_t i = 0; i < npieces; i++)
+			for (const int* c = pieces[i].begin; c != pieces[i].end; c++)
+				p = EncodeUtf16(*c, p);
+
+		*p = 0;
+		literal.nbytes = ncodeunits * sizeof(char16_t);
+		break;
+	}
+
+	case LE_UTF32:
+	{
+		char32_t* p = (char32_t*) arena.allocate(ncodeunits * sizeof(char32_t));
+		literal.data = p;
+
+		for (size_t i = 0; i < npieces; i++)
+			for (const int* c = pieces[i].begin; c != pieces[i].end; c++)
+				*p++ = *c;
+
+		*p = 0;
+		literal.nbytes = ncodeunits * sizeof(char32_t);
+		break;
+	}
+	}
+
+	return literal;
+}
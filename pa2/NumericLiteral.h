@@ -0,0 +1,362 @@
+#pragma once
+
+// Allocation-free decoding of integer-literal and floating-literal values
+//
+// Floating literals must decode bit for bit as the starter code's
+// istringstream extraction does (the reference implementation uses it).
+// libstdc++ extracts a float by collecting the characters of the number
+// and passing them to strtof/strtod/strtold in the "C" locale, mapping an
+// overflow to the largest finite value.  So:
+//
+// - the decimal significand and exponent are scanned once, without
+//   copying
+// - when the significand and the power of ten are both exact in the
+//   target type (Clinger's fast path) the result is one correctly rounded
+//   multiplication or division, which is what strto* returns too
+// - otherwise the literal is copied to a stack buffer and handed to
+//   strto*, exactly as the stream would
+// - anything that is not a well formed unsuffixed decimal floating literal
+//   goes through an actual istringstream, so odd inputs keep their odd
+//   results
+
+// exact powers of ten of each floating type: 10^k is exact while 5^k fits
+// the significand (24, 53 and 64 bits)
+constexpr float ExactPowersOfTen_float[] =
+{
+	1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+constexpr double ExactPowersOfTen_double[] =
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+constexpr long double ExactPowersOfTen_long_double[] =
+{
+	1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L, 1e12L, 1e13L,
+	1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+};
+
+// FloatingTraits<T>: fast path limits and slow path of floating type T
+template<typename T>
+struct FloatingTraits;
+
+template<>
+struct FloatingTraits<float>
+{
+	static constexpr uint64_t max_exact_significand = uint64_t(1) << 24;
+	static constexpr int max_exact_power = 10;
+	static float power_of_ten(int k) { return ExactPowersOfTen_float[k]; }
+	static float strto(const char* s, char** end) { return strtof(s, end); }
+};
+
+template<>
+struct FloatingTraits<double>
+{
+	static constexpr uint64_t max_exact_significand = uint64_t(1) << 53;
+	static constexpr int max_exact_power = 22;
+	static double power_of_ten(int k) { return ExactPowersOfTen_double[k]; }
+	static double strto(const char* s, char** end) { return strtod(s, end); }
+};
+
+// x87 80-bit extended: the fast path relies on the FPU computing in full
+// 64-bit precision, which is the Linux default
+template<>
+struct FloatingTraits<long double>
+{
+	static constexpr uint64_t max_exact_significand = UINT64_MAX;
+	static constexpr int max_exact_power = 27;
+	static long double power_of_ten(int k) { return ExactPowersOfTen_long_double[k]; }
+	static long double strto(const char* s, char** end) { return strtold(s, end); }
+};
+
+// DecimalFloating: floating-literal [begin, end) as significand * 10^exponent
+struct DecimalFloating
+{
+	uint64_t significand;
+	int exponent;
+
+	// more than 19 significant digits, `significand` holds the first 19
+	bool truncated;
+};
+
+inline bool IsDecimalDigit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+// scan unsuffixed decimal floating literal [begin, end):
+//
+//     digits [. digits] [(e|E) [+|-] digits]  |  . digits [(e|E) [+|-] digits]
+//
+// returns false if [begin, end) is not of that form
+inline bool ScanDecimalFloating(const char* begin, const char* end, DecimalFloating& x)
+{
+	const int MaxDigits = 19;
+
+	const char* p = begin;
+	int ndigits = 0;
+	bool any_digit = false;
+
+	x.significand = 0;
+	x.exponent = 0;
+	x.truncated = false;
+
+	for (bool fraction = false; p != end; p++)
+	{
+		if (*p == '.' && !fraction)
+		{
+			fraction = true;
+			continue;
+		}
+
+		if (!IsDecimalDigit(*p))
+			break;
+
+		any_digit = true;
+		int d = *p - '0';
+
+		if (ndigits < MaxDigits)
+		{
+			// leading zeros are not significant
+			if (ndigits > 0 || d != 0)
+			{
+				x.significand = x.significand * 10 + d;
+				ndigits++;
+			}
+
+			x.exponent -= fraction;
+		}
+		else
+		{
+			x.truncated |= d != 0;
+			x.exponent += !fraction;
+		}
+	}
+
+	if (!any_digit)
+		return false;
+
+	if (p != end && (*p == 'e' || *p == 'E'))
+	{
+		p++;
+
+		bool negative = p != end && *p == '-';
+
+		if (p != end && (*p == '-' || *p == '+'))
+			p++;
+
+		if (p == end || !IsDecimalDigit(*p))
+			return false;
+
+		// beyond any type's range either way, but keep going to check the syntax
+		int e = 0;
+
+		for (; p != end && IsDecimalDigit(*p); p++)
+			if (e < 100000)
+				e = e * 10 + (*p - '0');
+
+		x.exponent += negative ? -e : e;
+	}
+
+	return p == end;
+}
+
+// Clinger's fast path: significand * 10^exponent when the operands are exact
+// in T, so one correctly rounded multiplication or division gives the result
+template<typename T>
+bool DecodeDecimalFloatingFast(DecimalFloating x, T& value)
+{
+	typedef FloatingTraits<T> Traits;
+
+	if (x.truncated || x.significand > Traits::max_exact_significand)
+		return false;
+
+	if (x.significand == 0)
+	{
+		value = 0;
+		return true;
+	}
+
+	if (x.exponent < -Traits::max_exact_power)
+		return false;
+
+	// 1e30 is 1e8 * 1e22 with both factors exact
+	while (x.exponent > Traits::max_exact_power)
+	{
+		if (x.significand > Traits::max_exact_significand / 10)
+			return false;
+
+		x.significand *= 10;
+		x.exponent--;
+	}
+
+	T m = T(x.significand);
+
+	value = x.exponent < 0 ? m / Traits::power_of_ten(-x.exponent) : m * Traits::power_of_ten(x.exponent);
+	return true;
+}
+
+// what `istringstream(s) >> value` yields for any string s
+template<typename T>
+T DecodeFloatingStream(const char* begin, const char* end)
+{
+	istringstream iss(string(begin, end));
+	T value;
+	iss >> value;
+	return value;
+}
+
+// strto* on a NUL terminated copy, with overflow mapped as the stream does
+template<typename T>
+T DecodeFloatingSlow(const char* begin, const char* end)
+{
+	char buffer[128];
+	size_t n = end - begin;
+
+	if (n >= sizeof(buffer))
+		return DecodeFloatingStream<T>(begin, end);
+
+	memcpy(buffer, begin, n);
+	buffer[n] = '\0';
+
+	T value = FloatingTraits<T>::strto(buffer, nullptr);
+
+	if (value > numeric_limits<T>::max())
+		value = numeric_limits<T>::max();
+
+	return value;
+}
+
+// DecodeFloating<T>: value of floating-literal [begin, end) (without
+// floating-suffix) as T, identical to extraction from an istringstream
+template<typename T>
+T DecodeFloating(const char* begin, const char* end)
+{
+	DecimalFloating x;
+
+	if (!ScanDecimalFloating(begin, end, x))
+		return DecodeFloatingStream<T>(begin, end);
+
+	T value;
+
+	if (DecodeDecimalFloatingFast(x, value))
+		return value;
+
+	return DecodeFloatingSlow<T>(begin, end);
+}
+
+// IntegerLiteral: value and suffix of an integer-literal (2.14.2)
+struct IntegerLiteral
+{
+	unsigned long long value;
+
+	// value does not fit in unsigned long long
+	bool overflow;
+
+	// decimal-literal, rather than octal or hexadecimal, which matters
+	// for the choice of type (2.14.2 Table 6)
+	bool decimal;
+
+	// integer-suffix: u or U, and number of l or L (0, 1 or 2)
+	bool is_unsigned;
+	int longs;
+};
+
+inline int HexDigitValue(char c)
+{
+	return IsDecimalDigit(c) ? c - '0' :
+		c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+		c >= 'A' && c <= 'F' ? c - 'A' + 10 :
+		-1;
+}
+
+// scan integer-suffix [begin, end): u, l, ll in either case and order,
+// where ll must be both lower or both upper case
+inline bool ScanIntegerSuffix(const char* begin, const char* end, IntegerLiteral& x)
+{
+	x.is_unsigned = false;
+	x.longs = 0;
+
+	const char* p = begin;
+
+	for (int part = 0; part < 2 && p != end; part++)
+	{
+		if ((*p == 'u' || *p == 'U') && !x.is_unsigned)
+		{
+			x.is_unsigned = true;
+			p++;
+		}
+		else if ((*p == 'l' || *p == 'L') && x.longs == 0)
+		{
+			x.longs = 1;
+
+			if (p + 1 != end && p[1] == p[0])
+			{
+				x.longs = 2;
+				p++;
+			}
+
+			p++;
+		}
+		else
+			return false;
+	}
+
+	return p == end;
+}
+
+// DecodeIntegerLiteral: decode integer-literal [begin, end) (without
+// ud-suffix) into `x`
+// returns false if [begin, end) is not an integer-literal
+inline bool DecodeIntegerLiteral(const char* begin, const char* end, IntegerLiteral& x)
+{
+	const char* p = begin;
+
+	if (p == end || !IsDecimalDigit(*p))
+		return false;
+
+	int radix = 10;
+
+	if (*p == '0')
+	{
+		p++;
+		radix = 8;
+
+		if (p != end && (*p == 'x' || *p == 'X'))
+		{
+			p++;
+			radix = 16;
+
+			// 0x needs at least one hex digit
+			if (p == end || HexDigitValue(*p) < 0)
+				return false;
+		}
+	}
+
+	x.value = 0;
+	x.overflow = false;
+	x.decimal = radix == 10;
+
+	for (; p != end; p++)
+	{
+		int d = HexDigitValue(*p);
+
+		if (d < 0)
+			break;
+
+		if (d >= radix)
+			return false;
+
+		unsigned long long value;
+
+		if (__builtin_mul_overflow(x.value, (unsigned long long) radix, &value) ||
+			__builtin_add_overflow(value, (unsigned long long) d, &value))
+			x.overflow = true;
+
+		x.value = value;
+	}
+
+	return ScanIntegerSuffix(p, end, x);
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "IndexSequence.h"
+
+// bootstrap system call interface, used by OutputBuffer
+extern "C" long int syscall(long int n, ...) throw ();
+
+// HexByteDigits: upper case hex digits of each byte value, two per byte
+// (HexByteDigits::digits + 2*b is the hex of byte b)
+constexpr char HexDigitOf(size_t value)
+{
+	return "0123456789ABCDEF"[value & 0xF];
+}
+
+template<typename Indices>
+struct HexByteDigitsOf;
+
+template<size_t... I>
+struct HexByteDigitsOf<IndexSequence<I...>>
+{
+	// even entries are the high nibble of byte I/2, odd entries the low
+	static constexpr char digits[sizeof...(I)] = { HexDigitOf((I & 1) ? I / 2 : I / 32)... };
+};
+
+template<size_t... I>
+constexpr char HexByteDigitsOf<IndexSequence<I...>>::digits[sizeof...(I)];
+
+typedef HexByteDigitsOf<MakeIndexSequence<512>::type> HexByteDigits;
+
+// HexBytes: `out << HexBytes(data, nbytes)` appends the upper case hex
+// dump of memory range [data, data+nbytes) to OutputBuffer `out`
+struct HexBytes
+{
+	HexBytes(const void* data, size_t nbytes)
+		: data(data), nbytes(nbytes)
+	{}
+
+	const void* data;
+	size_t nbytes;
+};
+
+// OutputBuffer: buffered writer to a file descriptor
+//
+// Text is appended to one reusable buffer which is written out with a
+// single write(2) when it fills up, on flush() and on destruction, rather
+// than through iostreams flushing each line.
+struct OutputBuffer
+{
+	explicit OutputBuffer(int fd = 1)
+		: fd(fd), buffer(BufferSize), used(0)
+	{}
+
+	OutputBuffer(const OutputBuffer&) = delete;
+	OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+	// write errors surface from explicit flush() calls only
+	~OutputBuffer()
+	{
+		try
+		{
+			flush();
+		}
+		catch (...)
+		{
+		}
+	}
+
+	void write(const char* data, size_t nbytes)
+	{
+		if (nbytes > BufferSize - used)
+		{
+			flush();
+
+			if (nbytes > BufferSize)
+			{
+				write_all(data, nbytes);
+				return;
+			}
+		}
+
+		memcpy(buffer.data() + used, data, nbytes);
+		used += nbytes;
+	}
+
+	OutputBuffer& operator<<(const string& s)
+	{
+		write(s.data(), s.size());
+		return *this;
+	}
+
+	OutputBuffer& operator<<(const char* s)
+	{
+		write(s, strlen(s));
+		return *this;
+	}
+
+	OutputBuffer& operator<<(char c)
+	{
+		if (used == BufferSize)
+			flush();
+
+		buffer[used++] = c;
+		return *this;
+	}
+
+	OutputBuffer& operator<<(size_t n)
+	{
+		char digits[20];
+		char* p = digits + sizeof(digits);
+
+		do
+		{
+			*--p = '0' + n % 10;
+			n /= 10;
+		}
+		while (n);
+
+		write(p, digits + sizeof(digits) - p);
+		return *this;
+	}
+
+	// two digits per byte, straight from the HexByteDigits table
+	OutputBuffer& operator<<(HexBytes hex)
+	{
+		const unsigned char* p = (const unsigned char*) hex.data;
+		size_t nbytes = hex.nbytes;
+
+		while (nbytes > 0)
+		{
+			if (BufferSize - used < 2)
+				flush();
+
+			size_t n = min(nbytes, (BufferSize - used) / 2);
+			char* q = buffer.data() + used;
+
+			for (size_t i = 0; i < n; i++)
+				memcpy(q + 2 * i, HexByteDigits::digits + 2 * p[i], 2);
+
+			used += 2 * n;
+			p += n;
+			nbytes -= n;
+		}
+
+		return *this;
+	}
+
+	void flush()
+	{
+		size_t n = used;
+		used = 0;
+		write_all(buffer.data(), n);
+	}
+
+private:
+	static constexpr size_t BufferSize = 256 * 1024;
+
+	int fd;
+	vector<char> buffer;
+	size_t used;
+
+	void write_all(const char* data, size_t nbytes)
+	{
+		while (nbytes > 0)
+		{
+			long int n = syscall(/* write */ 1, fd, data, nbytes);
+
+			if (n < 0 && errno == EINTR)
+				continue;
+
+			if (n <= 0)
+				throw runtime_error("unable to write output");
+
+			data += n;
+			nbytes -= n;
+		}
+	}
+};
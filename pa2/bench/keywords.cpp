@@ -0,0 +1,154 @@
+// `simple` token recognition: constexpr perfect hash vs the former
+// unordered_map<string, ETokenType>, on 10M identifiers from real code
+//
+// usage: bench/keywords srcfile...
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../SourceBuffer.h"
+#include "../SimpleTokens.h"
+
+struct Identifier
+{
+	const char* data;
+	size_t length;
+};
+
+bool IsIdentifierStart(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+bool IsIdentifierContinue(char c)
+{
+	return IsIdentifierStart(c) || (c >= '0' && c <= '9');
+}
+
+// append the identifier-like words of [begin, end) to `out`
+void ExtractIdentifiers(const char* begin, const char* end, vector<Identifier>& out)
+{
+	const char* p = begin;
+
+	while (p != end)
+	{
+		if (!IsIdentifierStart(*p))
+		{
+			// skip pp-numbers whole, so 0x1F does not yield x1F
+			if (*p >= '0' && *p <= '9')
+				while (p != end && IsIdentifierContinue(*p))
+					p++;
+			else
+				p++;
+
+			continue;
+		}
+
+		const char* start = p;
+
+		while (p != end && IsIdentifierContinue(*p))
+			p++;
+
+		out.push_back(Identifier{start, size_t(p - start)});
+	}
+}
+
+template<typename F>
+double Time(const vector<Identifier>& input, size_t n, F f, size_t& checksum)
+{
+	auto start = chrono::steady_clock::now();
+
+	checksum = 0;
+
+	for (size_t i = 0; i < n; i++)
+		checksum = checksum * 31 + f(input[i % input.size()]);
+
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		vector<unique_ptr<SourceBuffer>> sources;
+		vector<Identifier> input;
+
+		for (int i = 1; i < argc; i++)
+		{
+			sources.emplace_back(new SourceBuffer(string(argv[i])));
+			ExtractIdentifiers(sources.back()->begin(), sources.back()->end(), input);
+		}
+
+		if (input.empty())
+			throw runtime_error("no identifiers in input, usage: bench/keywords srcfile...");
+
+		// former representation
+		unordered_map<string, ETokenType> map;
+
+		for (const SimpleTokenSpelling& s : SimpleTokenSpellings)
+			map.emplace(s.spelling, s.token_type);
+
+		// tables must agree on every spelling and every input word
+		for (const SimpleTokenSpelling& s : SimpleTokenSpellings)
+		{
+			ETokenType token_type;
+
+			if (!LookupSimpleToken(s.spelling, s.length, token_type) || token_type != s.token_type)
+				throw runtime_error(string("perfect hash misses ") + s.spelling);
+		}
+
+		size_t nkeywords = 0;
+
+		for (const Identifier& id : input)
+		{
+			ETokenType token_type;
+			bool found = LookupSimpleToken(id.data, id.length, token_type);
+			auto it = map.find(string(id.data, id.length));
+
+			if (found != (it != map.end()) || (found && token_type != it->second))
+				throw runtime_error("perfect hash disagrees on " + string(id.data, id.length));
+
+			nkeywords += found;
+		}
+
+		const size_t n = 10 * 1000 * 1000;
+		size_t c1, c2;
+
+		double t1 = Time(input, n, [&](const Identifier& id)
+		{
+			auto it = map.find(string(id.data, id.length));
+			return it == map.end() ? -1 : int(it->second);
+		}, c1);
+
+		double t2 = Time(input, n, [](const Identifier& id)
+		{
+			ETokenType token_type;
+			return LookupSimpleToken(id.data, id.length, token_type) ? int(token_type) : -1;
+		}, c2);
+
+		if (c1 != c2)
+			throw runtime_error("result mismatch");
+
+		double m = n / 1e6;
+
+		cout << "simple token lookups of " << m << "M identifiers (" << input.size() << " words, "
+			<< 100.0 * nkeywords / input.size() << "% keywords/alternative tokens)" << endl;
+		cout << "  unordered_map: " << t1 << " s, " << m / t1 << " M/s" << endl;
+		cout << "  perfect hash:  " << t2 << " s, " << m / t2 << " M/s" << endl;
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,222 @@
+// string-literal encoding: one arena array per run of adjacent literals vs
+// encoding each piece to its own string and joining them
+//
+// Counts heap allocations (by replacing global operator new) to check the
+// arena path allocates at most once per literal group, and usually never.
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <new>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../LiteralArena.h"
+
+size_t nallocations = 0;
+
+void* operator new(size_t n)
+{
+	nallocations++;
+
+	if (void* p = malloc(n ? n : 1))
+		return p;
+
+	throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+struct Random
+{
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	uint64_t next()
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+};
+
+// a literal group: code points of 1 to 8 adjacent pieces, mostly ASCII
+// with some Latin, CJK and astral code points
+struct LiteralGroup
+{
+	ELiteralEncoding encoding;
+	vector<vector<int>> pieces;
+};
+
+vector<LiteralGroup> MakeGroups(size_t n)
+{
+	vector<LiteralGroup> groups(n);
+	Random r;
+
+	for (LiteralGroup& group : groups)
+	{
+		group.encoding = ELiteralEncoding(r.next() % 3);
+		group.pieces.resize(1 + r.next() % 8);
+
+		for (vector<int>& piece : group.pieces)
+		{
+			piece.resize(r.next() % 40);
+
+			for (int& c : piece)
+			{
+				uint64_t x = r.next();
+
+				switch (x % 16)
+				{
+				case 0: c = 0xA0 + (x >> 8) % 0x700; break;
+				case 1: c = 0x4E00 + (x >> 8) % 0x5200; break;
+				case 2: c = 0x10000 + (x >> 8) % 0x100000; break;
+				default: c = 0x20 + (x >> 8) % 0x5F; break;
+				}
+			}
+		}
+	}
+
+	// one literal larger than the arena block size
+	groups[n / 2].pieces.assign(1, vector<int>(100000, 'x'));
+
+	return groups;
+}
+
+// former approach: encode each piece into its own string, then join
+string EncodeNaive(const LiteralGroup& group)
+{
+	if (group.encoding == LE_UTF8)
+	{
+		string s;
+
+		for (const vector<int>& piece : group.pieces)
+		{
+			string t;
+
+			for (int c : piece)
+			{
+				unsigned char buffer[4];
+				t.append((char*) buffer, EncodeUtf8(c, buffer) - buffer);
+			}
+
+			s += t;
+		}
+
+		s.push_back('\0');
+		return s;
+	}
+	else if (group.encoding == LE_UTF16)
+	{
+		u16string s;
+
+		for (const vector<int>& piece : group.pieces)
+		{
+			u16string t;
+
+			for (int c : piece)
+			{
+				char16_t buffer[2];
+				t.append(buffer, EncodeUtf16(c, buffer) - buffer);
+			}
+
+			s += t;
+		}
+
+		s.push_back(0);
+		return string((const char*) s.data(), s.size() * sizeof(char16_t));
+	}
+	else
+	{
+		u32string s;
+
+		for (const vector<int>& piece : group.pieces)
+			s += u32string(piece.begin(), piece.end());
+
+		s.push_back(0);
+		return string((const char*) s.data(), s.size() * sizeof(char32_t));
+	}
+}
+
+EncodedLiteral EncodeArena(LiteralArena& arena, const LiteralGroup& group, vector<CodePointSpan>& spans)
+{
+	spans.clear();
+
+	for (const vector<int>& piece : group.pieces)
+		spans.push_back(CodePointSpan{piece.data(), piece.data() + piece.size()});
+
+	return EncodeStringLiteral(arena, group.encoding, spans.data(), spans.size());
+}
+
+int main()
+{
+	try
+	{
+		vector<LiteralGroup> groups = MakeGroups(200000);
+
+		LiteralArena arena;
+		vector<CodePointSpan> spans;
+		spans.reserve(8);
+
+		// arrays must match the former encoding byte for byte
+		for (const LiteralGroup& group : groups)
+		{
+			EncodedLiteral literal = EncodeArena(arena, group, spans);
+			string expected = EncodeNaive(group);
+
+			if (literal.nbytes != expected.size() || memcmp(literal.data, expected.data(), literal.nbytes) != 0)
+				throw runtime_error("encoding mismatch");
+
+			arena.clear();
+		}
+
+		// at most one allocation per group, clearing after each as a
+		// tokenizer does after emitting the literal, from a fresh arena
+		LiteralArena fresh;
+		size_t before = nallocations;
+		size_t nbytes = 0;
+		auto start = chrono::steady_clock::now();
+
+		for (const LiteralGroup& group : groups)
+		{
+			nbytes += EncodeArena(fresh, group, spans).nbytes;
+			fresh.clear();
+		}
+
+		double t2 = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		size_t arena_allocations = nallocations - before;
+
+		if (arena_allocations > groups.size())
+			throw runtime_error("arena allocated more than once per literal group");
+
+		before = nallocations;
+		start = chrono::steady_clock::now();
+		size_t nbytes_naive = 0;
+
+		for (const LiteralGroup& group : groups)
+			nbytes_naive += EncodeNaive(group).size();
+
+		double t1 = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		size_t naive_allocations = nallocations - before;
+
+		if (nbytes != nbytes_naive)
+			throw runtime_error("result mismatch");
+
+		cout << "encoding " << groups.size() << " literal groups (" << nbytes / 1e6 << " MB)" << endl;
+		cout << "  per-piece strings: " << t1 << " s, " << naive_allocations << " allocations" << endl;
+		cout << "  arena:             " << t2 << " s, " << arena_allocations << " allocations" << endl;
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
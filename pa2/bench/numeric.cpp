@@ -0,0 +1,288 @@
+// floating-literal decoding: DecodeFloating vs the former istringstream
+// extraction, checked bit for bit on generated and boundary literals,
+// then timed on a table-like corpus
+//
+// usage: bench/numeric [--exhaustive]
+//
+// --exhaustive checks every positive finite float (printed with 6 and 9
+//              significant digits) instead of a sample, which takes a while
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <limits>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+
+#include "../NumericLiteral.h"
+
+// significant bytes of the representation (x87 long double has 6 bytes padding)
+template<typename T> size_t ValueBytes() { return sizeof(T); }
+template<> size_t ValueBytes<long double>() { return 10; }
+
+size_t nchecked = 0;
+
+template<typename T>
+void Check(const string& s)
+{
+	T expected = DecodeFloatingStream<T>(s.data(), s.data() + s.size());
+	T actual = DecodeFloating<T>(s.data(), s.data() + s.size());
+
+	nchecked++;
+
+	if (memcmp(&expected, &actual, ValueBytes<T>()) != 0)
+	{
+		ostringstream oss;
+		oss.precision(25);
+		oss << "decode mismatch on \"" << s << "\" (" << sizeof(T) << " bytes): expected " << expected << " got " << actual;
+		throw runtime_error(oss.str());
+	}
+}
+
+void CheckAll(const string& s)
+{
+	Check<float>(s);
+	Check<double>(s);
+	Check<long double>(s);
+}
+
+string Format(const char* format, long double x)
+{
+	char buffer[128];
+	snprintf(buffer, sizeof(buffer), format, x);
+	return buffer;
+}
+
+struct Random
+{
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	uint64_t next()
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+};
+
+void CheckBoundaries()
+{
+	const char* cases[] =
+	{
+		"0", "0.", ".0", "0.0", "0e0", "0e99999", "000.000e-5", "1", "1.", ".5", "5.", "00000.0001",
+		"1e", "1e+", "1e-", "e5", ".", "", "abc", "1.2.3", "1ee5", "1e5x", "0x1p3", "1e+5", "1E-5",
+		"3.4028234663852886e38", "3.4028235e38", "3.4028236e38", "3.40282357e38", "1e39", "1e309", "1e4933", "1e5000",
+		"1.17549435e-38", "1.4e-45", "7e-46", "1e-46", "2.2250738585072014e-308", "4.9e-324", "2.4e-324",
+		"1e-400", "3.6e-4951", "1e-5000",
+		"9007199254740992", "9007199254740993", "9007199254740994", "16777216", "16777217", "16777218",
+		"18446744073709551615", "18446744073709551616", "18446744073709551617", "1844674407370955161.5",
+		"9999999999999999999", "99999999999999999999", "10000000000000000000000", "1000000000000000000000000000",
+		"1e22", "1e23", "1e27", "1e28", "1e10", "1e11", "123456789e-22", "123456789e-23", "1e-27", "1e-28",
+		"0.1", "0.2", "0.3", "2.5", "1.5e10", "42.421e20", "42.525e-20", "52.521515e300", "421.45252e-300",
+		"0.000000000000000000000000000000000000000000000000000000000000000000000000000000001",
+		"1.000000000000000000000000000000000000000000000000000000000000000000000000000000001",
+		"100000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+		"000000000000000000000000000000000000000000000000000000000000000000000000000000000000000.5",
+	};
+
+	for (const char* s : cases)
+		CheckAll(s);
+}
+
+// short decimals in every position: m, m.0, .m, m e k for all small m, k
+void CheckShortDecimals()
+{
+	for (int m = 0; m < 1000; m++)
+	{
+		string digits = to_string(m);
+
+		for (size_t point = 0; point <= digits.size(); point++)
+		{
+			string base = digits.substr(0, point) + "." + digits.substr(point);
+
+			for (int e = -60; e <= 60; e++)
+				CheckAll(base + "e" + to_string(e));
+		}
+	}
+}
+
+// floats printed as C programs and generated tables print them
+void CheckFloats(bool exhaustive)
+{
+	uint32_t stride = exhaustive ? 1 : 997;
+
+	for (uint64_t bits = 1; bits < 0x7F800000; bits += stride)
+	{
+		uint32_t b = bits;
+		float x;
+		memcpy(&x, &b, sizeof(x));
+
+		Check<float>(Format("%.9Lg", x));
+		Check<float>(Format("%.6Lg", x));
+	}
+}
+
+// random doubles and long doubles at full precision, and the exact
+// midpoints between neighbouring doubles (the hard cases for rounding)
+void CheckDoubles(size_t n)
+{
+	Random r;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		uint64_t bits = r.next() & 0x7FFFFFFFFFFFFFFFULL;
+		double x;
+		memcpy(&x, &bits, sizeof(x));
+
+		if (!isfinite(x))
+			continue;
+
+		Check<double>(Format("%.17Lg", x));
+		Check<double>(Format("%.15Lg", x));
+
+		long double mid = ((long double) x + nextafter(x, numeric_limits<double>::infinity())) / 2;
+		Check<double>(Format("%.40Le", mid));
+
+		long double y = ldexpl((long double) (r.next() | 1) / 18446744073709551616.0L, int(r.next() % 32000) - 16000);
+		Check<long double>(Format("%.21Lg", y));
+		Check<long double>(Format("%.17Lg", y));
+	}
+}
+
+void CheckIntegers()
+{
+	Random r;
+
+	for (int i = 0; i < 1000000; i++)
+	{
+		unsigned long long v = r.next() >> (r.next() % 64);
+		const char* formats[] = { "%llu", "0%llo", "0x%llx", "0X%llX" };
+		const char* format = formats[i % 4];
+
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer), format, v);
+
+		IntegerLiteral x;
+
+		if (!DecodeIntegerLiteral(buffer, buffer + strlen(buffer), x) || x.value != v || x.overflow)
+			throw runtime_error(string("integer decode mismatch on ") + buffer);
+	}
+
+	struct { const char* s; bool valid; unsigned long long value; bool overflow; bool is_unsigned; int longs; } cases[] =
+	{
+		{ "0", true, 0, false, false, 0 },
+		{ "00", true, 0, false, false, 0 },
+		{ "0u", true, 0, false, true, 0 },
+		{ "0x", false, 0, false, false, 0 },
+		{ "0xg", false, 0, false, false, 0 },
+		{ "08", false, 0, false, false, 0 },
+		{ "0b101", false, 0, false, false, 0 },
+		{ "1ul", true, 1, false, true, 1 },
+		{ "1LU", true, 1, false, true, 1 },
+		{ "1llu", true, 1, false, true, 2 },
+		{ "1uLL", true, 1, false, true, 2 },
+		{ "1lL", false, 0, false, false, 0 },
+		{ "1uu", false, 0, false, false, 0 },
+		{ "1lul", false, 0, false, false, 0 },
+		{ "1lll", false, 0, false, false, 0 },
+		{ "1_ud", false, 0, false, false, 0 },
+		{ "1e5", false, 0, false, false, 0 },
+		{ "18446744073709551615", true, 18446744073709551615ULL, false, false, 0 },
+		{ "18446744073709551616", true, 0, true, false, 0 },
+		{ "0xFFFFFFFFFFFFFFFF", true, 18446744073709551615ULL, false, false, 0 },
+		{ "0x10000000000000000", true, 0, true, false, 0 },
+		{ "01777777777777777777777", true, 18446744073709551615ULL, false, false, 0 },
+		{ "02000000000000000000000", true, 0, true, false, 0 },
+	};
+
+	for (auto& c : cases)
+	{
+		IntegerLiteral x;
+		bool valid = DecodeIntegerLiteral(c.s, c.s + strlen(c.s), x);
+
+		if (valid != c.valid || (valid && (x.overflow != c.overflow || (!x.overflow && x.value != c.value) ||
+			x.is_unsigned != c.is_unsigned || x.longs != c.longs)))
+			throw runtime_error(string("integer decode mismatch on ") + c.s);
+	}
+}
+
+// literals as they appear in generated tables: mostly %.9g floats and
+// %.17g doubles, some short hand-written constants
+vector<string> MakeCorpus(size_t n)
+{
+	vector<string> v;
+	v.reserve(n);
+
+	Random r;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		double x = ldexp(double(r.next() >> 11), -53) * pow(10.0, int(r.next() % 12) - 6);
+
+		switch (i % 4)
+		{
+		case 0: case 1: v.push_back(Format("%.9Lg", (float) x)); break;
+		case 2: v.push_back(Format("%.17Lg", x)); break;
+		default: v.push_back(Format("%.4Lg", x)); break;
+		}
+	}
+
+	return v;
+}
+
+template<typename F>
+double Time(const vector<string>& input, F f, double& sum)
+{
+	auto start = chrono::steady_clock::now();
+
+	sum = 0;
+
+	for (const string& s : input)
+		sum += f(s);
+
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		bool exhaustive = argc > 1 && string(argv[1]) == "--exhaustive";
+
+		CheckBoundaries();
+		CheckShortDecimals();
+		CheckFloats(exhaustive);
+		CheckDoubles(exhaustive ? 10000000 : 300000);
+		CheckIntegers();
+
+		cout << "decoders agree on " << nchecked << " floating literals" << endl;
+
+		vector<string> corpus = MakeCorpus(1000000);
+		double m = corpus.size() / 1e6;
+		double sum1, sum2;
+
+		double t1 = Time(corpus, [](const string& s) { return DecodeFloatingStream<double>(s.data(), s.data() + s.size()); }, sum1);
+		double t2 = Time(corpus, [](const string& s) { return DecodeFloating<double>(s.data(), s.data() + s.size()); }, sum2);
+
+		if (sum1 != sum2)
+			throw runtime_error("result mismatch");
+
+		cout << "double decodes of " << m << "M floating literals" << endl;
+		cout << "  istringstream: " << t1 << " s, " << m / t1 << " M/s" << endl;
+		cout << "  DecodeFloating: " << t2 << " s, " << m / t2 << " M/s" << endl;
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
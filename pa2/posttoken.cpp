@@ -12,10 +12,20 @@
 #include <cstring>
 #include <cstdint>
 #include <climits>
+#include <cerrno>
+#include <limits>
 #include <map>
+#include <vector>
 
 using namespace std;
 
+#include "SourceBuffer.h"
+#include "BinaryTokenStream.h"
+#include "SimpleTokens.h"
+#include "NumericLiteral.h"
+#include "OutputBuffer.h"
+#include "LiteralArena.h"
+
 // See 3.9.1: Fundamental Types
 enum EFundamentalType
 {
@@ -78,569 +88,353 @@ template<> constexpr EFundamentalType FundamentalTypeOf<long double>() { return
 template<> constexpr EFundamentalType FundamentalTypeOf<void>() { return FT_VOID; }
 template<> constexpr EFundamentalType FundamentalTypeOf<nullptr_t>() { return FT_NULLPTR_T; }
 
-// convert EFundamentalType to a source code
-const map<EFundamentalType, string> FundamentalTypeToStringMap
-{
-	{FT_SIGNED_CHAR, "signed char"},
-	{FT_SHORT_INT, "short int"},
-	{FT_INT, "int"},
-	{FT_LONG_INT, "long int"},
-	{FT_LONG_LONG_INT, "long long int"},
-	{FT_UNSIGNED_CHAR, "unsigned char"},
-	{FT_UNSIGNED_SHORT_INT, "unsigned short int"},
-	{FT_UNSIGNED_INT, "unsigned int"},
-	{FT_UNSIGNED_LONG_INT, "unsigned long int"},
-	{FT_UNSIGNED_LONG_LONG_INT, "unsigned long long int"},
-	{FT_WCHAR_T, "wchar_t"},
-	{FT_CHAR, "char"},
-	{FT_CHAR16_T, "char16_t"},
-	{FT_CHAR32_T, "char32_t"},
-	{FT_BOOL, "bool"},
-	{FT_FLOAT, "float"},
-	{FT_DOUBLE, "double"},
-	{FT_LONG_DOUBLE, "long double"},
-	{FT_VOID, "void"},
-	{FT_NULLPTR_T, "nullptr_t"}
-};
-
-// token type enum for `simples`
-enum ETokenType
+// convert EFundamentalType to a source code, indexed by EFundamentalType
+constexpr const char* FundamentalTypeToStringTable[] =
 {
-	// keywords
-	KW_ALIGNAS,
-	KW_ALIGNOF,
-	KW_ASM,
-	KW_AUTO,
-	KW_BOOL,
-	KW_BREAK,
-	KW_CASE,
-	KW_CATCH,
-	KW_CHAR,
-	KW_CHAR16_T,
-	KW_CHAR32_T,
-	KW_CLASS,
-	KW_CONST,
-	KW_CONSTEXPR,
-	KW_CONST_CAST,
-	KW_CONTINUE,
-	KW_DECLTYPE,
-	KW_DEFAULT,
-	KW_DELETE,
-	KW_DO,
-	KW_DOUBLE,
-	KW_DYNAMIC_CAST,
-	KW_ELSE,
-	KW_ENUM,
-	KW_EXPLICIT,
-	KW_EXPORT,
-	KW_EXTERN,
-	KW_FALSE,
-	KW_FLOAT,
-	KW_FOR,
-	KW_FRIEND,
-	KW_GOTO,
-	KW_IF,
-	KW_INLINE,
-	KW_INT,
-	KW_LONG,
-	KW_MUTABLE,
-	KW_NAMESPACE,
-	KW_NEW,
-	KW_NOEXCEPT,
-	KW_NULLPTR,
-	KW_OPERATOR,
-	KW_PRIVATE,
-	KW_PROTECTED,
-	KW_PUBLIC,
-	KW_REGISTER,
-	KW_REINTERPET_CAST,
-	KW_RETURN,
-	KW_SHORT,
-	KW_SIGNED,
-	KW_SIZEOF,
-	KW_STATIC,
-	KW_STATIC_ASSERT,
-	KW_STATIC_CAST,
-	KW_STRUCT,
-	KW_SWITCH,
-	KW_TEMPLATE,
-	KW_THIS,
-	KW_THREAD_LOCAL,
-	KW_THROW,
-	KW_TRUE,
-	KW_TRY,
-	KW_TYPEDEF,
-	KW_TYPEID,
-	KW_TYPENAME,
-	KW_UNION,
-	KW_UNSIGNED,
-	KW_USING,
-	KW_VIRTUAL,
-	KW_VOID,
-	KW_VOLATILE,
-	KW_WCHAR_T,
-	KW_WHILE,
-
-	// operators/punctuation
-	OP_LBRACE,
-	OP_RBRACE,
-	OP_LSQUARE,
-	OP_RSQUARE,
-	OP_LPAREN,
-	OP_RPAREN,
-	OP_BOR,
-	OP_XOR,
-	OP_COMPL,
-	OP_AMP,
-	OP_LNOT,
-	OP_SEMICOLON,
-	OP_COLON,
-	OP_DOTS,
-	OP_QMARK,
-	OP_COLON2,
-	OP_DOT,
-	OP_DOTSTAR,
-	OP_PLUS,
-	OP_MINUS,
-	OP_STAR,
-	OP_DIV,
-	OP_MOD,
-	OP_ASS,
-	OP_LT,
-	OP_GT,
-	OP_PLUSASS,
-	OP_MINUSASS,
-	OP_STARASS,
-	OP_DIVASS,
-	OP_MODASS,
-	OP_XORASS,
-	OP_BANDASS,
-	OP_BORASS,
-	OP_LSHIFT,
-	OP_RSHIFT,
-	OP_RSHIFTASS,
-	OP_LSHIFTASS,
-	OP_EQ,
-	OP_NE,
-	OP_LE,
-	OP_GE,
-	OP_LAND,
-	OP_LOR,
-	OP_INC,
-	OP_DEC,
-	OP_COMMA,
-	OP_ARROWSTAR,
-	OP_ARROW,
+	"signed char",
+	"short int",
+	"int",
+	"long int",
+	"long long int",
+	"unsigned char",
+	"unsigned short int",
+	"unsigned int",
+	"unsigned long int",
+	"unsigned long long int",
+	"wchar_t",
+	"char",
+	"char16_t",
+	"char32_t",
+	"bool",
+	"float",
+	"double",
+	"long double",
+	"void",
+	"nullptr_t"
 };
 
-// StringToETokenTypeMap map of `simple` `preprocessing-tokens` to ETokenType
-const unordered_map<string, ETokenType> StringToTokenTypeMap =
-{
-	// keywords
-	{"alignas", KW_ALIGNAS},
-	{"alignof", KW_ALIGNOF},
-	{"asm", KW_ASM},
-	{"auto", KW_AUTO},
-	{"bool", KW_BOOL},
-	{"break", KW_BREAK},
-	{"case", KW_CASE},
-	{"catch", KW_CATCH},
-	{"char", KW_CHAR},
-	{"char16_t", KW_CHAR16_T},
-	{"char32_t", KW_CHAR32_T},
-	{"class", KW_CLASS},
-	{"const", KW_CONST},
-	{"constexpr", KW_CONSTEXPR},
-	{"const_cast", KW_CONST_CAST},
-	{"continue", KW_CONTINUE},
-	{"decltype", KW_DECLTYPE},
-	{"default", KW_DEFAULT},
-	{"delete", KW_DELETE},
-	{"do", KW_DO},
-	{"double", KW_DOUBLE},
-	{"dynamic_cast", KW_DYNAMIC_CAST},
-	{"else", KW_ELSE},
-	{"enum", KW_ENUM},
-	{"explicit", KW_EXPLICIT},
-	{"export", KW_EXPORT},
-	{"extern", KW_EXTERN},
-	{"false", KW_FALSE},
-	{"float", KW_FLOAT},
-	{"for", KW_FOR},
-	{"friend", KW_FRIEND},
-	{"goto", KW_GOTO},
-	{"if", KW_IF},
-	{"inline", KW_INLINE},
-	{"int", KW_INT},
-	{"long", KW_LONG},
-	{"mutable", KW_MUTABLE},
-	{"namespace", KW_NAMESPACE},
-	{"new", KW_NEW},
-	{"noexcept", KW_NOEXCEPT},
-	{"nullptr", KW_NULLPTR},
-	{"operator", KW_OPERATOR},
-	{"private", KW_PRIVATE},
-	{"protected", KW_PROTECTED},
-	{"public", KW_PUBLIC},
-	{"register", KW_REGISTER},
-	{"reinterpret_cast", KW_REINTERPET_CAST},
-	{"return", KW_RETURN},
-	{"short", KW_SHORT},
-	{"signed", KW_SIGNED},
-	{"sizeof", KW_SIZEOF},
-	{"static", KW_STATIC},
-	{"static_assert", KW_STATIC_ASSERT},
-	{"static_cast", KW_STATIC_CAST},
-	{"struct", KW_STRUCT},
-	{"switch", KW_SWITCH},
-	{"template", KW_TEMPLATE},
-	{"this", KW_THIS},
-	{"thread_local", KW_THREAD_LOCAL},
-	{"throw", KW_THROW},
-	{"true", KW_TRUE},
-	{"try", KW_TRY},
-	{"typedef", KW_TYPEDEF},
-	{"typeid", KW_TYPEID},
-	{"typename", KW_TYPENAME},
-	{"union", KW_UNION},
-	{"unsigned", KW_UNSIGNED},
-	{"using", KW_USING},
-	{"virtual", KW_VIRTUAL},
-	{"void", KW_VOID},
-	{"volatile", KW_VOLATILE},
-	{"wchar_t", KW_WCHAR_T},
-	{"while", KW_WHILE},
-
-	// operators/punctuation
-	{"{", OP_LBRACE},
-	{"<%", OP_LBRACE},
-	{"}", OP_RBRACE},
-	{"%>", OP_RBRACE},
-	{"[", OP_LSQUARE},
-	{"<:", OP_LSQUARE},
-	{"]", OP_RSQUARE},
-	{":>", OP_RSQUARE},
-	{"(", OP_LPAREN},
-	{")", OP_RPAREN},
-	{"|", OP_BOR},
-	{"bitor", OP_BOR},
-	{"^", OP_XOR},
-	{"xor", OP_XOR},
-	{"~", OP_COMPL},
-	{"compl", OP_COMPL},
-	{"&", OP_AMP},
-	{"bitand", OP_AMP},
-	{"!", OP_LNOT},
-	{"not", OP_LNOT},
-	{";", OP_SEMICOLON},
-	{":", OP_COLON},
-	{"...", OP_DOTS},
-	{"?", OP_QMARK},
-	{"::", OP_COLON2},
-	{".", OP_DOT},
-	{".*", OP_DOTSTAR},
-	{"+", OP_PLUS},
-	{"-", OP_MINUS},
-	{"*", OP_STAR},
-	{"/", OP_DIV},
-	{"%", OP_MOD},
-	{"=", OP_ASS},
-	{"<", OP_LT},
-	{">", OP_GT},
-	{"+=", OP_PLUSASS},
-	{"-=", OP_MINUSASS},
-	{"*=", OP_STARASS},
-	{"/=", OP_DIVASS},
-	{"%=", OP_MODASS},
-	{"^=", OP_XORASS},
-	{"xor_eq", OP_XORASS},
-	{"&=", OP_BANDASS},
-	{"and_eq", OP_BANDASS},
-	{"|=", OP_BORASS},
-	{"or_eq", OP_BORASS},
-	{"<<", OP_LSHIFT},
-	{">>", OP_RSHIFT},
-	{">>=", OP_RSHIFTASS},
-	{"<<=", OP_LSHIFTASS},
-	{"==", OP_EQ},
-	{"!=", OP_NE},
-	{"not_eq", OP_NE},
-	{"<=", OP_LE},
-	{">=", OP_GE},
-	{"&&", OP_LAND},
-	{"and", OP_LAND},
-	{"||", OP_LOR},
-	{"or", OP_LOR},
-	{"++", OP_INC},
-	{"--", OP_DEC},
-	{",", OP_COMMA},
-	{"->*", OP_ARROWSTAR},
-	{"->", OP_ARROW}
-};
-
-// map of enum to string
-const map<ETokenType, string> TokenTypeToStringMap =
-{
-	{KW_ALIGNAS, "KW_ALIGNAS"},
-	{KW_ALIGNOF, "KW_ALIGNOF"},
-	{KW_ASM, "KW_ASM"},
-	{KW_AUTO, "KW_AUTO"},
-	{KW_BOOL, "KW_BOOL"},
-	{KW_BREAK, "KW_BREAK"},
-	{KW_CASE, "KW_CASE"},
-	{KW_CATCH, "KW_CATCH"},
-	{KW_CHAR, "KW_CHAR"},
-	{KW_CHAR16_T, "KW_CHAR16_T"},
-	{KW_CHAR32_T, "KW_CHAR32_T"},
-	{KW_CLASS, "KW_CLASS"},
-	{KW_CONST, "KW_CONST"},
-	{KW_CONSTEXPR, "KW_CONSTEXPR"},
-	{KW_CONST_CAST, "KW_CONST_CAST"},
-	{KW_CONTINUE, "KW_CONTINUE"},
-	{KW_DECLTYPE, "KW_DECLTYPE"},
-	{KW_DEFAULT, "KW_DEFAULT"},
-	{KW_DELETE, "KW_DELETE"},
-	{KW_DO, "KW_DO"},
-	{KW_DOUBLE, "KW_DOUBLE"},
-	{KW_DYNAMIC_CAST, "KW_DYNAMIC_CAST"},
-	{KW_ELSE, "KW_ELSE"},
-	{KW_ENUM, "KW_ENUM"},
-	{KW_EXPLICIT, "KW_EXPLICIT"},
-	{KW_EXPORT, "KW_EXPORT"},
-	{KW_EXTERN, "KW_EXTERN"},
-	{KW_FALSE, "KW_FALSE"},
-	{KW_FLOAT, "KW_FLOAT"},
-	{KW_FOR, "KW_FOR"},
-	{KW_FRIEND, "KW_FRIEND"},
-	{KW_GOTO, "KW_GOTO"},
-	{KW_IF, "KW_IF"},
-	{KW_INLINE, "KW_INLINE"},
-	{KW_INT, "KW_INT"},
-	{KW_LONG, "KW_LONG"},
-	{KW_MUTABLE, "KW_MUTABLE"},
-	{KW_NAMESPACE, "KW_NAMESPACE"},
-	{KW_NEW, "KW_NEW"},
-	{KW_NOEXCEPT, "KW_NOEXCEPT"},
-	{KW_NULLPTR, "KW_NULLPTR"},
-	{KW_OPERATOR, "KW_OPERATOR"},
-	{KW_PRIVATE, "KW_PRIVATE"},
-	{KW_PROTECTED, "KW_PROTECTED"},
-	{KW_PUBLIC, "KW_PUBLIC"},
-	{KW_REGISTER, "KW_REGISTER"},
-	{KW_REINTERPET_CAST, "KW_REINTERPET_CAST"},
-	{KW_RETURN, "KW_RETURN"},
-	{KW_SHORT, "KW_SHORT"},
-	{KW_SIGNED, "KW_SIGNED"},
-	{KW_SIZEOF, "KW_SIZEOF"},
-	{KW_STATIC, "KW_STATIC"},
-	{KW_STATIC_ASSERT, "KW_STATIC_ASSERT"},
-	{KW_STATIC_CAST, "KW_STATIC_CAST"},
-	{KW_STRUCT, "KW_STRUCT"},
-	{KW_SWITCH, "KW_SWITCH"},
-	{KW_TEMPLATE, "KW_TEMPLATE"},
-	{KW_THIS, "KW_THIS"},
-	{KW_THREAD_LOCAL, "KW_THREAD_LOCAL"},
-	{KW_THROW, "KW_THROW"},
-	{KW_TRUE, "KW_TRUE"},
-	{KW_TRY, "KW_TRY"},
-	{KW_TYPEDEF, "KW_TYPEDEF"},
-	{KW_TYPEID, "KW_TYPEID"},
-	{KW_TYPENAME, "KW_TYPENAME"},
-	{KW_UNION, "KW_UNION"},
-	{KW_UNSIGNED, "KW_UNSIGNED"},
-	{KW_USING, "KW_USING"},
-	{KW_VIRTUAL, "KW_VIRTUAL"},
-	{KW_VOID, "KW_VOID"},
-	{KW_VOLATILE, "KW_VOLATILE"},
-	{KW_WCHAR_T, "KW_WCHAR_T"},
-	{KW_WHILE, "KW_WHILE"},
-	{OP_LBRACE, "OP_LBRACE"},
-	{OP_RBRACE, "OP_RBRACE"},
-	{OP_LSQUARE, "OP_LSQUARE"},
-	{OP_RSQUARE, "OP_RSQUARE"},
-	{OP_LPAREN, "OP_LPAREN"},
-	{OP_RPAREN, "OP_RPAREN"},
-	{OP_BOR, "OP_BOR"},
-	{OP_XOR, "OP_XOR"},
-	{OP_COMPL, "OP_COMPL"},
-	{OP_AMP, "OP_AMP"},
-	{OP_LNOT, "OP_LNOT"},
-	{OP_SEMICOLON, "OP_SEMICOLON"},
-	{OP_COLON, "OP_COLON"},
-	{OP_DOTS, "OP_DOTS"},
-	{OP_QMARK, "OP_QMARK"},
-	{OP_COLON2, "OP_COLON2"},
-	{OP_DOT, "OP_DOT"},
-	{OP_DOTSTAR, "OP_DOTSTAR"},
-	{OP_PLUS, "OP_PLUS"},
-	{OP_MINUS, "OP_MINUS"},
-	{OP_STAR, "OP_STAR"},
-	{OP_DIV, "OP_DIV"},
-	{OP_MOD, "OP_MOD"},
-	{OP_ASS, "OP_ASS"},
-	{OP_LT, "OP_LT"},
-	{OP_GT, "OP_GT"},
-	{OP_PLUSASS, "OP_PLUSASS"},
-	{OP_MINUSASS, "OP_MINUSASS"},
-	{OP_STARASS, "OP_STARASS"},
-	{OP_DIVASS, "OP_DIVASS"},
-	{OP_MODASS, "OP_MODASS"},
-	{OP_XORASS, "OP_XORASS"},
-	{OP_BANDASS, "OP_BANDASS"},
-	{OP_BORASS, "OP_BORASS"},
-	{OP_LSHIFT, "OP_LSHIFT"},
-	{OP_RSHIFT, "OP_RSHIFT"},
-	{OP_RSHIFTASS, "OP_RSHIFTASS"},
-	{OP_LSHIFTASS, "OP_LSHIFTASS"},
-	{OP_EQ, "OP_EQ"},
-	{OP_NE, "OP_NE"},
-	{OP_LE, "OP_LE"},
-	{OP_GE, "OP_GE"},
-	{OP_LAND, "OP_LAND"},
-	{OP_LOR, "OP_LOR"},
-	{OP_INC, "OP_INC"},
-	{OP_DEC, "OP_DEC"},
-	{OP_COMMA, "OP_COMMA"},
-	{OP_ARROWSTAR, "OP_ARROWSTAR"},
-	{OP_ARROW, "OP_ARROW"}
-};
-
-// convert integer [0,15] to hexadecimal digit
-char ValueToHexChar(int c)
-{
-	switch (c)
-	{
-	case 0: return '0';
-	case 1: return '1';
-	case 2: return '2';
-	case 3: return '3';
-	case 4: return '4';
-	case 5: return '5';
-	case 6: return '6';
-	case 7: return '7';
-	case 8: return '8';
-	case 9: return '9';
-	case 10: return 'A';
-	case 11: return 'B';
-	case 12: return 'C';
-	case 13: return 'D';
-	case 14: return 'E';
-	case 15: return 'F';
-	default: throw logic_error("ValueToHexChar of nonhex value");
-	}
-}
+static_assert(sizeof(FundamentalTypeToStringTable) / sizeof(FundamentalTypeToStringTable[0]) == FT_NULLPTR_T + 1,
+	"FundamentalTypeToStringTable must have one entry per EFundamentalType");
 
-// hex dump memory range
-string HexDump(const void* pdata, size_t nbytes)
+inline const char* FundamentalTypeToString(EFundamentalType type)
 {
-	unsigned char* p = (unsigned char*) pdata;
-
-	string s(nbytes*2, '?');
-
-	for (size_t i = 0; i < nbytes; i++)
-	{
-		s[2*i+0] = ValueToHexChar((p[i] & 0xF0) >> 4);
-		s[2*i+1] = ValueToHexChar((p[i] & 0x0F) >> 0);
-	}
-
-	return s;
+	return FundamentalTypeToStringTable[type];
 }
 
 // DebugPostTokenOutputStream: helper class to produce PA2 output format
+//
+// Lines are batched in an OutputBuffer on standard output, flushed at eof
+// and when the stream is destroyed (before any error message is printed).
 struct DebugPostTokenOutputStream
 {
 	// output: invalid <source>
 	void emit_invalid(const string& source)
 	{
-		cout << "invalid " << source << endl;
+		out << "invalid " << source << '\n';
 	}
 
 	// output: simple <source> <token_type>
 	void emit_simple(const string& source, ETokenType token_type)
 	{
-		cout << "simple " << source << " " << TokenTypeToStringMap.at(token_type) << endl;
+		out << "simple " << source << " " << TokenTypeToString(token_type) << '\n';
 	}
 
 	// output: identifier <source>
 	void emit_identifier(const string& source)
 	{
-		cout << "identifier " << source << endl;
+		out << "identifier " << source << '\n';
 	}
 
 	// output: literal <source> <type> <hexdump(data,nbytes)>
 	void emit_literal(const string& source, EFundamentalType type, const void* data, size_t nbytes)
 	{
-		cout << "literal " << source << " " << FundamentalTypeToStringMap.at(type) << " " << HexDump(data, nbytes) << endl;
+		out << "literal " << source << " " << FundamentalTypeToString(type) << " " << HexBytes(data, nbytes) << '\n';
 	}
 
 	// output: literal <source> array of <num_elements> <type> <hexdump(data,nbytes)>
 	void emit_literal_array(const string& source, size_t num_elements, EFundamentalType type, const void* data, size_t nbytes)
 	{
-		cout << "literal " << source << " array of " << num_elements << " " << FundamentalTypeToStringMap.at(type) << " " << HexDump(data, nbytes) << endl;
+		out << "literal " << source << " array of " << num_elements << " " << FundamentalTypeToString(type) << " " << HexBytes(data, nbytes) << '\n';
 	}
 
 	// output: user-defined-literal <source> <ud_suffix> character <type> <hexdump(data,nbytes)>
 	void emit_user_defined_literal_character(const string& source, const string& ud_suffix, EFundamentalType type, const void* data, size_t nbytes)
 	{
-		cout << "user-defined-literal " << source << " " << ud_suffix << " character " << FundamentalTypeToStringMap.at(type) << " " << HexDump(data, nbytes) << endl;
+		out << "user-defined-literal " << source << " " << ud_suffix << " character " << FundamentalTypeToString(type) << " " << HexBytes(data, nbytes) << '\n';
 	}
 
 	// output: user-defined-literal <source> <ud_suffix> string array of <num_elements> <type> <hexdump(data, nbytes)>
 	void emit_user_defined_literal_string_array(const string& source, const string& ud_suffix, size_t num_elements, EFundamentalType type, const void* data, size_t nbytes)
 	{
-		cout << "user-defined-literal " << source << " " << ud_suffix << " string array of " << num_elements << " " << FundamentalTypeToStringMap.at(type) << " " << HexDump(data, nbytes) << endl;
+		out << "user-defined-literal " << source << " " << ud_suffix << " string array of " << num_elements << " " << FundamentalTypeToString(type) << " " << HexBytes(data, nbytes) << '\n';
 	}
 
 	// output: user-defined-literal <source> <ud_suffix> <prefix>
 	void emit_user_defined_literal_integer(const string& source, const string& ud_suffix, const string& prefix)
 	{
-		cout << "user-defined-literal " << source << " " << ud_suffix << " integer " << prefix << endl;
+		out << "user-defined-literal " << source << " " << ud_suffix << " integer " << prefix << '\n';
 	}
 
 	// output: user-defined-literal <source> <ud_suffix> <prefix>
 	void emit_user_defined_literal_floating(const string& source, const string& ud_suffix, const string& prefix)
 	{
-		cout << "user-defined-literal " << source << " " << ud_suffix << " floating " << prefix << endl;
+		out << "user-defined-literal " << source << " " << ud_suffix << " floating " << prefix << '\n';
 	}
 
 	// output : eof
 	void emit_eof()
 	{
-		cout << "eof" << endl;
+		out << "eof\n";
+		out.flush();
+	}
+
+private:
+	OutputBuffer out;
+};
+
+
+// Binary post-token stream (posttoken --format=binary)
+//
+//     stream := BinaryPostTokensMagic record*
+//     record := kind fields
+//
+// `kind` is one EPostTokenKind byte and the fields are those of the matching
+// DebugPostTokenOutputStream emit function in order: strings as interned
+// spellings, ETokenType and EFundamentalType as one byte, counts as varints
+// and literal data as varint length followed by the bytes.
+enum EPostTokenKind
+{
+	PTK_INVALID,
+	PTK_SIMPLE,
+	PTK_IDENTIFIER,
+	PTK_LITERAL,
+	PTK_LITERAL_ARRAY,
+	PTK_USER_DEFINED_LITERAL_CHARACTER,
+	PTK_USER_DEFINED_LITERAL_STRING_ARRAY,
+	PTK_USER_DEFINED_LITERAL_INTEGER,
+	PTK_USER_DEFINED_LITERAL_FLOATING,
+	PTK_EOF
+};
+
+// BinaryPostTokenOutputStream: same interface as DebugPostTokenOutputStream,
+// producing the binary post-token stream on `out`
+struct BinaryPostTokenOutputStream
+{
+	BinaryPostTokenOutputStream(ostream& out)
+		: writer(out, BinaryPostTokensMagic)
+	{}
+
+	void emit_invalid(const string& source)
+	{
+		writer.write_byte(PTK_INVALID);
+		writer.write_spelling(source);
+	}
+
+	void emit_simple(const string& source, ETokenType token_type)
+	{
+		writer.write_byte(PTK_SIMPLE);
+		writer.write_spelling(source);
+		writer.write_byte(token_type);
+	}
+
+	void emit_identifier(const string& source)
+	{
+		writer.write_byte(PTK_IDENTIFIER);
+		writer.write_spelling(source);
+	}
+
+	void emit_literal(const string& source, EFundamentalType type, const void* data, size_t nbytes)
+	{
+		writer.write_byte(PTK_LITERAL);
+		writer.write_spelling(source);
+		writer.write_byte(type);
+		writer.write_bytes(data, nbytes);
+	}
+
+	void emit_literal_array(const string& source, size_t num_elements, EFundamentalType type, const void* data, size_t nbytes)
+	{
+		writer.write_byte(PTK_LITERAL_ARRAY);
+		writer.write_spelling(source);
+		writer.write_varint(num_elements);
+		writer.write_byte(type);
+		writer.write_bytes(data, nbytes);
+	}
+
+	void emit_user_defined_literal_character(const string& source, const string& ud_suffix, EFundamentalType type, const void* data, size_t nbytes)
+	{
+		writer.write_byte(PTK_USER_DEFINED_LITERAL_CHARACTER);
+		writer.write_spelling(source);
+		writer.write_spelling(ud_suffix);
+		writer.write_byte(type);
+		writer.write_bytes(data, nbytes);
+	}
+
+	void emit_user_defined_literal_string_array(const string& source, const string& ud_suffix, size_t num_elements, EFundamentalType type, const void* data, size_t nbytes)
+	{
+		writer.write_byte(PTK_USER_DEFINED_LITERAL_STRING_ARRAY);
+		writer.write_spelling(source);
+		writer.write_spelling(ud_suffix);
+		writer.write_varint(num_elements);
+		writer.write_byte(type);
+		writer.write_bytes(data, nbytes);
+	}
+
+	void emit_user_defined_literal_integer(const string& source, const string& ud_suffix, const string& prefix)
+	{
+		writer.write_byte(PTK_USER_DEFINED_LITERAL_INTEGER);
+		writer.write_spelling(source);
+		writer.write_spelling(ud_suffix);
+		writer.write_spelling(prefix);
+	}
+
+	void emit_user_defined_literal_floating(const string& source, const string& ud_suffix, const string& prefix)
+	{
+		writer.write_byte(PTK_USER_DEFINED_LITERAL_FLOATING);
+		writer.write_spelling(source);
+		writer.write_spelling(ud_suffix);
+		writer.write_spelling(prefix);
+	}
+
+	void emit_eof()
+	{
+		writer.write_byte(PTK_EOF);
+		writer.flush();
 	}
+
+private:
+	BinaryStreamWriter writer;
 };
 
+// ReadBinaryPostTokens: decode binary stream [begin, end), replaying each
+// record into `output` (for example a DebugPostTokenOutputStream)
+template<typename PostTokenOutputStream>
+void ReadBinaryPostTokens(const char* begin, const char* end, PostTokenOutputStream& output)
+{
+	BinaryStreamReader reader(begin, end, BinaryPostTokensMagic);
+
+	// read a byte of an enum whose last enumerator is `last`, checking it
+	// is one before it is cast
+	auto read_enum_byte = [&](int last)
+	{
+		unsigned char byte = reader.read_byte();
+
+		if (byte > last)
+			throw runtime_error("invalid binary token stream");
+
+		return byte;
+	};
+
+	while (!reader.at_end())
+	{
+		EPostTokenKind kind = EPostTokenKind(read_enum_byte(PTK_EOF));
+
+		if (kind == PTK_EOF)
+		{
+			output.emit_eof();
+			continue;
+		}
+
+		string source = reader.read_spelling();
+
+		switch (kind)
+		{
+		case PTK_INVALID:
+			output.emit_invalid(source);
+			break;
+
+		case PTK_SIMPLE:
+			output.emit_simple(source, ETokenType(read_enum_byte(OP_ARROW)));
+			break;
+
+		case PTK_IDENTIFIER:
+			output.emit_identifier(source);
+			break;
+
+		case PTK_LITERAL:
+		{
+			EFundamentalType type = EFundamentalType(read_enum_byte(FT_NULLPTR_T));
+			size_t nbytes;
+			const char* data = reader.read_bytes(nbytes);
+			output.emit_literal(source, type, data, nbytes);
+			break;
+		}
+
+		case PTK_LITERAL_ARRAY:
+		{
+			size_t num_elements = reader.read_varint();
+			EFundamentalType type = EFundamentalType(read_enum_byte(FT_NULLPTR_T));
+			size_t nbytes;
+			const char* data = reader.read_bytes(nbytes);
+			output.emit_literal_array(source, num_elements, type, data, nbytes);
+			break;
+		}
+
+		case PTK_USER_DEFINED_LITERAL_CHARACTER:
+		{
+			string ud_suffix = reader.read_spelling();
+			EFundamentalType type = EFundamentalType(read_enum_byte(FT_NULLPTR_T));
+			size_t nbytes;
+			const char* data = reader.read_bytes(nbytes);
+			output.emit_user_defined_literal_character(source, ud_suffix, type, data, nbytes);
+			break;
+		}
+
+		case PTK_USER_DEFINED_LITERAL_STRING_ARRAY:
+		{
+			string ud_suffix = reader.read_spelling();
+			size_t num_elements = reader.read_varint();
+			EFundamentalType type = EFundamentalType(read_enum_byte(FT_NULLPTR_T));
+			size_t nbytes;
+			const char* data = reader.read_bytes(nbytes);
+			output.emit_user_defined_literal_string_array(source, ud_suffix, num_elements, type, data, nbytes);
+			break;
+		}
+
+		case PTK_USER_DEFINED_LITERAL_INTEGER:
+		{
+			string ud_suffix = reader.read_spelling();
+			output.emit_user_defined_literal_integer(source, ud_suffix, reader.read_spelling());
+			break;
+		}
+
+		case PTK_USER_DEFINED_LITERAL_FLOATING:
+		{
+			string ud_suffix = reader.read_spelling();
+			output.emit_user_defined_literal_floating(source, ud_suffix, reader.read_spelling());
+			break;
+		}
+
+		case PTK_EOF:
+			break;
+		}
+	}
+}
 
 // use these 3 functions to scan `floating-literals` (see PA2)
 // for example PA2Decode_float("12.34") returns "12.34" as a `float` type
+// (bit for bit what `istringstream(s) >> x` gives, see NumericLiteral.h)
 float PA2Decode_float(const string& s)
 {
-	istringstream iss(s);
-	float x;
-	iss >> x;
-	return x;
+	return DecodeFloating<float>(s.data(), s.data() + s.size());
 }
 
 double PA2Decode_double(const string& s)
 {
-	istringstream iss(s);
-	double x;
-	iss >> x;
-	return x;
+	return DecodeFloating<double>(s.data(), s.data() + s.size());
 }
 
 long double PA2Decode_long_double(const string& s)
 {
-	istringstream iss(s);
-	long double x;
-	iss >> x;
-	return x;
+	return DecodeFloating<long double>(s.data(), s.data() + s.size());
 }
 
-int main()
+// post-tokenize source `input` into `output`
+template<typename PostTokenOutputStream>
+void PostTokenize(const SourceBuffer& input, PostTokenOutputStream& output)
 {
 	// TODO:
 	// 1. apply your code from PA1 to produce `preprocessing-tokens`
+	//    (feed it input.begin() .. input.end() through the block entry point)
 	// 2. "post-tokenize" the `preprocessing-tokens` as described in PA2
 	// 3. write them out in the PA2 output format specifed
 
@@ -649,15 +443,75 @@ int main()
 	// In particular there is the DebugPostTokenOutputStream class which helps form the
 	// correct output format:
 
-	DebugPostTokenOutputStream output;
-
 	// example usage:
 
 	output.emit_invalid("foo");
 	output.emit_simple("auto", KW_AUTO);
 
-	u16string bar = u"bar";
-	output.emit_literal_array("u\"bar\"", bar.size()+1, FT_CHAR16_T, bar.data(), bar.size() * 2 + 2);
+	// adjacent string-literals are encoded once, into one array in an arena
+	// (see LiteralArena.h), from the code points of all their pieces:
+	LiteralArena arena;
+
+	const int bar[] = { 'b', 'a', 'r' };
+	CodePointSpan pieces[] = { { bar, bar + 3 } };
+	EncodedLiteral literal = EncodeStringLiteral(arena, LE_UTF16, pieces, 1);
+	output.emit_literal_array("u\"bar\"", literal.num_elements, FT_CHAR16_T, literal.data, literal.nbytes);
+	arena.clear();
 
 	output.emit_user_defined_literal_integer("123_ud1", "ud1", "123");
 }
+
+// usage: posttoken [--format=text|binary] [--decode]
+//
+// --format=binary writes the binary post-token stream
+// --decode reads a binary post-token stream on standard input instead of
+//          source and writes it in the text format
+int main(int argc, char** argv)
+{
+	try
+	{
+		vector<string> args;
+
+		for (int i = 1; i < argc; i++)
+			args.emplace_back(argv[i]);
+
+		bool binary = false;
+		bool decode = false;
+
+		for (const string& arg : args)
+		{
+			if (arg == "--format=binary")
+				binary = true;
+			else if (arg == "--format=text")
+				binary = false;
+			else if (arg == "--decode")
+				decode = true;
+			else
+				throw logic_error("invalid usage");
+		}
+
+		// source file on standard input, mapped when it is a regular file
+		SourceBuffer input(0);
+
+		if (decode)
+		{
+			DebugPostTokenOutputStream output;
+			ReadBinaryPostTokens(input.begin(), input.end(), output);
+		}
+		else if (binary)
+		{
+			BinaryPostTokenOutputStream output(cout);
+			PostTokenize(input, output);
+		}
+		else
+		{
+			DebugPostTokenOutputStream output;
+			PostTokenize(input, output);
+		}
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
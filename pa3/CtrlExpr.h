@@ -0,0 +1,1103 @@
+#pragma once
+
+#include "SimpleTokens.h"
+
+// Controlling expression compiler and evaluator (16.1)
+//
+// A controlling expression is parsed once into a compact postfix bytecode
+// program.  The signedness of every sub-expression is known statically
+// (literals have types, every operator's result type follows from its
+// operands', `defined` is int), so each instruction is specialized on it
+// and values are plain 64-bit words with no type tags.  Sub-expressions
+// with constant operands are folded while parsing, && || and ?: become
+// jumps, and a division by zero found while folding becomes an ERROR
+// instruction, which only fails the expression if it is reached.
+//
+// CtrlExprEvaluator caches compiled programs by token sequence, and the
+// result of each program by the `defined` results of the identifiers it
+// references, so a condition seen again (the same #if in a header included
+// by many translation units) costs a hash lookup and one `defined` query
+// per identifier.  `defined` is answered by an IDefinedOracle, asked by the
+// interned id of the identifier rather than by its spelling.
+
+// ECtrlExprTokenKind: kind of CtrlExprToken
+enum ECtrlExprTokenKind
+{
+	// anything that cannot appear in a controlling expression: invalid
+	// tokens, non-integral literals, user-defined literals...
+	CTK_INVALID,
+
+	// literal of integral type (PA3 integral-literal)
+	CTK_INTEGRAL_LITERAL,
+
+	// identifier or keyword (including `defined`, `true` and `false`)
+	CTK_IDENTIFIER,
+
+	// operator or punctuator
+	CTK_SIMPLE
+};
+
+// CtrlExprToken: post-tokenized controlling expression token
+//
+// The spelling of an identifier must stay valid while the token is
+// evaluated; it is copied by the compiler where needed.
+struct CtrlExprToken
+{
+	ECtrlExprTokenKind kind;
+
+	// CTK_SIMPLE
+	ETokenType token_type;
+
+	// CTK_INTEGRAL_LITERAL: value promoted to intmax_t or uintmax_t
+	uint64_t value;
+	bool is_unsigned;
+
+	// CTK_IDENTIFIER
+	const char* spelling;
+	size_t length;
+
+	static CtrlExprToken Invalid()
+	{
+		return CtrlExprToken{CTK_INVALID, OP_ARROW, 0, false, nullptr, 0};
+	}
+
+	static CtrlExprToken Literal(uint64_t value, bool is_unsigned)
+	{
+		return CtrlExprToken{CTK_INTEGRAL_LITERAL, OP_ARROW, value, is_unsigned, nullptr, 0};
+	}
+
+	static CtrlExprToken Identifier(const char* spelling, size_t length)
+	{
+		return CtrlExprToken{CTK_IDENTIFIER, OP_ARROW, 0, false, spelling, length};
+	}
+
+	static CtrlExprToken Simple(ETokenType token_type)
+	{
+		return CtrlExprToken{CTK_SIMPLE, token_type, 0, false, nullptr, 0};
+	}
+};
+
+// CtrlExprResult: value of a controlling expression, or an error
+struct CtrlExprResult
+{
+	bool error;
+	bool is_unsigned;
+	uint64_t value;
+};
+
+// PA3 output format: decimal, `u` suffixed if unsigned, or `error`
+inline string CtrlExprResultToString(const CtrlExprResult& result)
+{
+	if (result.error)
+		return "error";
+	else if (result.is_unsigned)
+		return to_string(result.value) + "u";
+	else
+		return to_string(int64_t(result.value));
+}
+
+// ECtrlExprOp: bytecode instructions
+//
+// Operands are popped from and results pushed to a stack of 64-bit words.
+// The _S/_U variants are for signed and unsigned operands.
+enum ECtrlExprOp : unsigned char
+{
+	CEO_CONSTANT,    // push constants[operand]
+	CEO_DEFINED,     // push `defined` result of identifiers[operand]
+	CEO_ERROR,       // fail
+
+	CEO_NEG,
+	CEO_LNOT,
+	CEO_COMPL,
+	CEO_BOOL,        // x != 0
+
+	CEO_MUL,
+	CEO_DIV_S,
+	CEO_DIV_U,
+	CEO_MOD_S,
+	CEO_MOD_U,
+	CEO_ADD,
+	CEO_SUB,
+	CEO_SHL,
+	CEO_SHR_S,       // signed left operand
+	CEO_SHR_U,
+	CEO_LT_S,
+	CEO_LT_U,
+	CEO_GT_S,
+	CEO_GT_U,
+	CEO_LE_S,
+	CEO_LE_U,
+	CEO_GE_S,
+	CEO_GE_U,
+	CEO_EQ,
+	CEO_NE,
+	CEO_AND,
+	CEO_XOR,
+	CEO_OR,
+
+	CEO_JUMP,        // jump to operand
+	CEO_JUMP_FALSE,  // pop, jump to operand if zero
+	CEO_AND_JUMP,    // if top is zero replace it with 0 and jump, else pop
+	CEO_OR_JUMP      // if top is non-zero replace it with 1 and jump, else pop
+};
+
+struct CtrlExprInstruction
+{
+	ECtrlExprOp op;
+	uint32_t operand;
+};
+
+// CtrlExprProgram: compiled controlling expression
+struct CtrlExprProgram
+{
+	// the tokens do not match the grammar: always an error
+	bool syntax_error = false;
+
+	bool is_unsigned = false;
+
+	vector<CtrlExprInstruction> code;
+	vector<uint64_t> constants;
+
+	// identifiers operand of `defined`, in order of first reference
+	vector<string> identifiers;
+
+	// memoized results by `defined` results of `identifiers` (bit i is
+	// identifiers[i]), only kept when there are at most 64 of them
+	vector<pair<uint64_t, CtrlExprResult>> results;
+};
+
+// apply a binary operator to two words, false on an evaluation error
+inline bool CtrlExprBinary(ECtrlExprOp op, uint64_t a, uint64_t b, uint64_t& x)
+{
+	const uint64_t SignedMin = uint64_t(1) << 63;
+
+	switch (op)
+	{
+	case CEO_MUL: x = a * b; return true;
+
+	case CEO_DIV_S:
+		if (b == 0 || (a == SignedMin && b == uint64_t(-1)))
+			return false;
+		x = uint64_t(int64_t(a) / int64_t(b));
+		return true;
+
+	case CEO_DIV_U:
+		if (b == 0)
+			return false;
+		x = a / b;
+		return true;
+
+	case CEO_MOD_S:
+		if (b == 0)
+			return false;
+		x = b == uint64_t(-1) ? 0 : uint64_t(int64_t(a) % int64_t(b));
+		return true;
+
+	case CEO_MOD_U:
+		if (b == 0)
+			return false;
+		x = a % b;
+		return true;
+
+	case CEO_ADD: x = a + b; return true;
+	case CEO_SUB: x = a - b; return true;
+
+	// a shift count is an error if negative or >= 64, and a negative
+	// signed count is >= 64 as a word, so the count's type does not matter
+	case CEO_SHL:
+		if (b >= 64)
+			return false;
+		x = a << b;
+		return true;
+
+	case CEO_SHR_S:
+		if (b >= 64)
+			return false;
+		x = uint64_t(int64_t(a) >> b);
+		return true;
+
+	case CEO_SHR_U:
+		if (b >= 64)
+			return false;
+		x = a >> b;
+		return true;
+
+	case CEO_LT_S: x = int64_t(a) < int64_t(b); return true;
+	case CEO_LT_U: x = a < b; return true;
+	case CEO_GT_S: x = int64_t(a) > int64_t(b); return true;
+	case CEO_GT_U: x = a > b; return true;
+	case CEO_LE_S: x = int64_t(a) <= int64_t(b); return true;
+	case CEO_LE_U: x = a <= b; return true;
+	case CEO_GE_S: x = int64_t(a) >= int64_t(b); return true;
+	case CEO_GE_U: x = a >= b; return true;
+	case CEO_EQ: x = a == b; return true;
+	case CEO_NE: x = a != b; return true;
+	case CEO_AND: x = a & b; return true;
+	case CEO_XOR: x = a ^ b; return true;
+	case CEO_OR: x = a | b; return true;
+
+	default:
+		throw logic_error("CtrlExprBinary of non-binary op");
+	}
+}
+
+inline uint64_t CtrlExprUnary(ECtrlExprOp op, uint64_t a)
+{
+	switch (op)
+	{
+	case CEO_NEG: return -a;
+	case CEO_LNOT: return a == 0;
+	case CEO_COMPL: return ~a;
+	case CEO_BOOL: return a != 0;
+	default: throw logic_error("CtrlExprUnary of non-unary op");
+	}
+}
+
+// CtrlExprCompiler: recursive descent parser of the controlling expression
+// grammar (PA3 README) emitting a CtrlExprProgram
+struct CtrlExprCompiler
+{
+	CtrlExprCompiler(const CtrlExprToken* begin, const CtrlExprToken* end, CtrlExprProgram& program)
+		: p(begin), end(end), program(program)
+	{}
+
+	// compile the whole token sequence, setting program.syntax_error if it
+	// does not match controlling-expression
+	void compile()
+	{
+		program.code.clear();
+		program.constants.clear();
+		program.identifiers.clear();
+		program.results.clear();
+
+		try
+		{
+			Operand x = controlling_expression();
+
+			if (p != end)
+				throw SyntaxError();
+
+			program.syntax_error = false;
+			program.is_unsigned = x.is_unsigned;
+			compact_constants();
+		}
+		catch (SyntaxError&)
+		{
+			program.syntax_error = true;
+			program.code.clear();
+			program.constants.clear();
+			program.identifiers.clear();
+		}
+	}
+
+private:
+	struct SyntaxError {};
+
+	// code of a sub-expression: code[start, end)
+	struct Operand
+	{
+		size_t start;
+		size_t end;
+		bool is_unsigned;
+	};
+
+	const CtrlExprToken* p;
+	const CtrlExprToken* end;
+	CtrlExprProgram& program;
+
+	bool at(ETokenType token_type) const
+	{
+		return p != end && p->kind == CTK_SIMPLE && p->token_type == token_type;
+	}
+
+	void expect(ETokenType token_type)
+	{
+		if (!at(token_type))
+			throw SyntaxError();
+
+		p++;
+	}
+
+	bool at_identifier(const char* spelling) const
+	{
+		size_t length = strlen(spelling);
+
+		return p != end && p->kind == CTK_IDENTIFIER && p->length == length && memcmp(p->spelling, spelling, length) == 0;
+	}
+
+	void emit(ECtrlExprOp op, uint32_t operand = 0)
+	{
+		program.code.push_back(CtrlExprInstruction{op, operand});
+	}
+
+	Operand operand(size_t start, bool is_unsigned) const
+	{
+		return Operand{start, program.code.size(), is_unsigned};
+	}
+
+	// replace code from `start` on with a push of `value`
+	// (folded away constants stay in the pool until compact_constants)
+	Operand constant(size_t start, uint64_t value, bool is_unsigned)
+	{
+		program.code.resize(start);
+		emit(CEO_CONSTANT, program.constants.size());
+		program.constants.push_back(value);
+		return operand(start, is_unsigned);
+	}
+
+	// replace code from `start` on with an evaluation error
+	Operand error(size_t start, bool is_unsigned)
+	{
+		program.code.resize(start);
+		emit(CEO_ERROR);
+		return operand(start, is_unsigned);
+	}
+
+	// the operand is exactly one CEO_CONSTANT
+	bool is_constant(const Operand& x) const
+	{
+		return x.end == x.start + 1 && program.code[x.start].op == CEO_CONSTANT;
+	}
+
+	uint64_t constant_value(const Operand& x) const
+	{
+		return program.constants[program.code[x.start].operand];
+	}
+
+	// remove code[from, to), moving the code after it down
+	void erase_code(size_t from, size_t to)
+	{
+		vector<CtrlExprInstruction>& code = program.code;
+
+		for (size_t i = to; i < code.size(); i++)
+			if (code[i].op >= CEO_JUMP)
+				code[i].operand -= to - from;
+
+		code.erase(code.begin() + from, code.begin() + to);
+	}
+
+	// drop constants that were folded away
+	void compact_constants()
+	{
+		vector<uint64_t> constants;
+
+		for (CtrlExprInstruction& instruction : program.code)
+		{
+			if (instruction.op == CEO_CONSTANT)
+			{
+				constants.push_back(program.constants[instruction.operand]);
+				instruction.operand = constants.size() - 1;
+			}
+		}
+
+		program.constants.swap(constants);
+	}
+
+	uint32_t identifier_index(const CtrlExprToken& identifier)
+	{
+		vector<string>& identifiers = program.identifiers;
+
+		for (size_t i = 0; i < identifiers.size(); i++)
+			if (identifiers[i].size() == identifier.length && memcmp(identifiers[i].data(), identifier.spelling, identifier.length) == 0)
+				return i;
+
+		identifiers.emplace_back(identifier.spelling, identifier.length);
+		return identifiers.size() - 1;
+	}
+
+	Operand primary_expression()
+	{
+		if (p == end)
+			throw SyntaxError();
+
+		size_t start = program.code.size();
+
+		if (p->kind == CTK_INTEGRAL_LITERAL)
+		{
+			const CtrlExprToken& literal = *p++;
+			return constant(start, literal.value, literal.is_unsigned);
+		}
+
+		if (at(OP_LPAREN))
+		{
+			p++;
+			Operand x = controlling_expression();
+			expect(OP_RPAREN);
+			return x;
+		}
+
+		if (p->kind != CTK_IDENTIFIER)
+			throw SyntaxError();
+
+		if (at_identifier("true"))
+		{
+			p++;
+			return constant(start, 1, false);
+		}
+
+		if (!at_identifier("defined"))
+		{
+			// any other identifier (and `false`) evaluates as 0
+			p++;
+			return constant(start, 0, false);
+		}
+
+		p++;
+
+		bool paren = at(OP_LPAREN);
+
+		if (paren)
+			p++;
+
+		if (p == end || p->kind != CTK_IDENTIFIER)
+			throw SyntaxError();
+
+		emit(CEO_DEFINED, identifier_index(*p++));
+
+		if (paren)
+			expect(OP_RPAREN);
+
+		return operand(start, false);
+	}
+
+	Operand unary_expression()
+	{
+		ECtrlExprOp op;
+
+		if (at(OP_PLUS))
+		{
+			p++;
+			return unary_expression();
+		}
+		else if (at(OP_MINUS))
+			op = CEO_NEG;
+		else if (at(OP_LNOT))
+			op = CEO_LNOT;
+		else if (at(OP_COMPL))
+			op = CEO_COMPL;
+		else
+			return primary_expression();
+
+		p++;
+
+		Operand x = unary_expression();
+		bool is_unsigned = op == CEO_LNOT ? false : x.is_unsigned;
+
+		if (is_constant(x))
+			return constant(x.start, CtrlExprUnary(op, constant_value(x)), is_unsigned);
+
+		emit(op);
+		return operand(x.start, is_unsigned);
+	}
+
+	// x op y with result signedness `is_unsigned`, folded when both are constant
+	Operand binary(const Operand& x, const Operand& y, ECtrlExprOp op, bool is_unsigned)
+	{
+		if (is_constant(x) && is_constant(y))
+		{
+			uint64_t value;
+
+			if (!CtrlExprBinary(op, constant_value(x), constant_value(y), value))
+				return error(x.start, is_unsigned);
+
+			return constant(x.start, value, is_unsigned);
+		}
+
+		emit(op);
+		return operand(x.start, is_unsigned);
+	}
+
+	// arithmetic operator: operands and result after the usual arithmetic
+	// conversions, `op` + 1 is the unsigned variant where there is one
+	Operand arithmetic(const Operand& x, const Operand& y, ECtrlExprOp op, bool has_unsigned_variant)
+	{
+		bool is_unsigned = x.is_unsigned || y.is_unsigned;
+
+		return binary(x, y, ECtrlExprOp(op + (has_unsigned_variant && is_unsigned)), is_unsigned);
+	}
+
+	// comparison: operands after the usual arithmetic conversions, result int
+	Operand comparison(const Operand& x, const Operand& y, ECtrlExprOp op, bool has_unsigned_variant)
+	{
+		bool is_unsigned = x.is_unsigned || y.is_unsigned;
+
+		return binary(x, y, ECtrlExprOp(op + (has_unsigned_variant && is_unsigned)), false);
+	}
+
+	Operand multiplicative_expression()
+	{
+		Operand x = unary_expression();
+
+		for (;;)
+		{
+			if (at(OP_STAR))
+			{
+				p++;
+				x = arithmetic(x, unary_expression(), CEO_MUL, false);
+			}
+			else if (at(OP_DIV))
+			{
+				p++;
+				x = arithmetic(x, unary_expression(), CEO_DIV_S, true);
+			}
+			else if (at(OP_MOD))
+			{
+				p++;
+				x = arithmetic(x, unary_expression(), CEO_MOD_S, true);
+			}
+			else
+				return x;
+		}
+	}
+
+	Operand additive_expression()
+	{
+		Operand x = multiplicative_expression();
+
+		for (;;)
+		{
+			if (at(OP_PLUS))
+			{
+				p++;
+				x = arithmetic(x, multiplicative_expression(), CEO_ADD, false);
+			}
+			else if (at(OP_MINUS))
+			{
+				p++;
+				x = arithmetic(x, multiplicative_expression(), CEO_SUB, false);
+			}
+			else
+				return x;
+		}
+	}
+
+	Operand shift_expression()
+	{
+		Operand x = additive_expression();
+
+		// the result has the type of the left operand (5.8)
+		for (;;)
+		{
+			if (at(OP_LSHIFT))
+			{
+				p++;
+				x = binary(x, additive_expression(), CEO_SHL, x.is_unsigned);
+			}
+			else if (at(OP_RSHIFT))
+			{
+				p++;
+				x = binary(x, additive_expression(), ECtrlExprOp(CEO_SHR_S + x.is_unsigned), x.is_unsigned);
+			}
+			else
+				return x;
+		}
+	}
+
+	Operand relational_expression()
+	{
+		Operand x = shift_expression();
+
+		for (;;)
+		{
+			ECtrlExprOp op;
+
+			if (at(OP_LT))
+				op = CEO_LT_S;
+			else if (at(OP_GT))
+				op = CEO_GT_S;
+			else if (at(OP_LE))
+				op = CEO_LE_S;
+			else if (at(OP_GE))
+				op = CEO_GE_S;
+			else
+				return x;
+
+			p++;
+			x = comparison(x, shift_expression(), op, true);
+		}
+	}
+
+	Operand equality_expression()
+	{
+		Operand x = relational_expression();
+
+		for (;;)
+		{
+			if (at(OP_EQ))
+			{
+				p++;
+				x = comparison(x, relational_expression(), CEO_EQ, false);
+			}
+			else if (at(OP_NE))
+			{
+				p++;
+				x = comparison(x, relational_expression(), CEO_NE, false);
+			}
+			else
+				return x;
+		}
+	}
+
+	Operand and_expression()
+	{
+		Operand x = equality_expression();
+
+		while (at(OP_AMP))
+		{
+			p++;
+			x = arithmetic(x, equality_expression(), CEO_AND, false);
+		}
+
+		return x;
+	}
+
+	Operand exclusive_or_expression()
+	{
+		Operand x = and_expression();
+
+		while (at(OP_XOR))
+		{
+			p++;
+			x = arithmetic(x, and_expression(), CEO_XOR, false);
+		}
+
+		return x;
+	}
+
+	Operand inclusive_or_expression()
+	{
+		Operand x = exclusive_or_expression();
+
+		while (at(OP_BOR))
+		{
+			p++;
+			x = arithmetic(x, exclusive_or_expression(), CEO_OR, false);
+		}
+
+		return x;
+	}
+
+	Operand to_bool(const Operand& x)
+	{
+		if (is_constant(x))
+			return constant(x.start, constant_value(x) != 0, false);
+
+		emit(CEO_BOOL);
+		return operand(x.start, false);
+	}
+
+	// x && y, x || y: `jump_op` leaves the result and skips y when x
+	// decides it, otherwise the result is bool(y)
+	template<typename Parse>
+	Operand logical(const Operand& x, ECtrlExprOp jump_op, Parse parse)
+	{
+		bool is_and = jump_op == CEO_AND_JUMP;
+
+		if (is_constant(x))
+		{
+			bool decided = (constant_value(x) != 0) != is_and;
+
+			program.code.resize(x.start);
+
+			// y is still parsed for its syntax, but never evaluated
+			Operand y = parse();
+
+			if (decided)
+				return constant(x.start, !is_and, false);
+
+			return to_bool(y);
+		}
+
+		size_t jump = program.code.size();
+		emit(jump_op);
+
+		to_bool(parse());
+
+		program.code[jump].operand = program.code.size();
+		return operand(x.start, false);
+	}
+
+	Operand logical_and_expression()
+	{
+		Operand x = inclusive_or_expression();
+
+		while (at(OP_LAND))
+		{
+			p++;
+			x = logical(x, CEO_AND_JUMP, [this] { return inclusive_or_expression(); });
+		}
+
+		return x;
+	}
+
+	Operand logical_or_expression()
+	{
+		Operand x = logical_and_expression();
+
+		while (at(OP_LOR))
+		{
+			p++;
+			x = logical(x, CEO_OR_JUMP, [this] { return logical_and_expression(); });
+		}
+
+		return x;
+	}
+
+	Operand controlling_expression()
+	{
+		Operand c = logical_or_expression();
+
+		if (!at(OP_QMARK))
+			return c;
+
+		p++;
+
+		// with a constant condition both branches are still parsed, then
+		// the one not taken is dropped
+		bool folded = is_constant(c);
+		bool condition = folded && constant_value(c) != 0;
+		size_t jump_false = 0;
+		size_t jump_end = 0;
+
+		if (folded)
+			program.code.resize(c.start);
+		else
+		{
+			jump_false = program.code.size();
+			emit(CEO_JUMP_FALSE);
+		}
+
+		Operand x = controlling_expression();
+
+		if (!folded)
+		{
+			jump_end = program.code.size();
+			emit(CEO_JUMP);
+			program.code[jump_false].operand = program.code.size();
+		}
+
+		expect(OP_COLON);
+
+		Operand y = controlling_expression();
+
+		// the result has the type of both branches after the usual
+		// arithmetic conversions, whichever is taken; a signed word
+		// converts to unsigned unchanged, so only the type changes
+		bool is_unsigned = x.is_unsigned || y.is_unsigned;
+
+		if (!folded)
+		{
+			program.code[jump_end].operand = program.code.size();
+			return operand(c.start, is_unsigned);
+		}
+
+		if (condition)
+			program.code.resize(x.end);
+		else
+			erase_code(x.start, y.start);
+
+		return operand(c.start, is_unsigned);
+	}
+};
+
+// RunCtrlExprProgram: interpret `program` with `defined[i]` the result of
+// `defined` for program.identifiers[i], on `stack` (scratch, reused between calls)
+inline CtrlExprResult RunCtrlExprProgram(const CtrlExprProgram& program, const vector<bool>& defined, vector<uint64_t>& stack)
+{
+	CtrlExprResult result = { true, program.is_unsigned, 0 };
+
+	if (program.syntax_error)
+		return result;
+
+	// every instruction pushes at most one word
+	if (stack.size() < program.code.size() + 1)
+		stack.resize(program.code.size() + 1);
+
+	uint64_t* top = stack.data();
+	const CtrlExprInstruction* code = program.code.data();
+	size_t n = program.code.size();
+
+	for (size_t pc = 0; pc < n; pc++)
+	{
+		const CtrlExprInstruction& instruction = code[pc];
+
+		switch (instruction.op)
+		{
+		case CEO_CONSTANT: *++top = program.constants[instruction.operand]; break;
+		case CEO_DEFINED: *++top = defined[instruction.operand]; break;
+		case CEO_ERROR: return result;
+
+		case CEO_NEG:
+		case CEO_LNOT:
+		case CEO_COMPL:
+		case CEO_BOOL:
+			*top = CtrlExprUnary(instruction.op, *top);
+			break;
+
+		case CEO_JUMP:
+			pc = instruction.operand - 1;
+			break;
+
+		case CEO_JUMP_FALSE:
+			if (*top-- == 0)
+				pc = instruction.operand - 1;
+			break;
+
+		case CEO_AND_JUMP:
+			if (*top == 0)
+				pc = instruction.operand - 1;
+			else
+				top--;
+			break;
+
+		case CEO_OR_JUMP:
+			if (*top != 0)
+			{
+				*top = 1;
+				pc = instruction.operand - 1;
+			}
+			else
+				top--;
+			break;
+
+		default:
+		{
+			uint64_t b = *top--;
+
+			if (!CtrlExprBinary(instruction.op, *top, b, *top))
+				return result;
+		}
+		}
+	}
+
+	result.error = false;
+	result.value = *top;
+	return result;
+}
+
+// mix 64-bit word `x` into hash `h`
+//
+// Only a rotate and xor per word, to keep the dependency chain through a
+// long token sequence short; HashCtrlExprTokens scrambles the result once
+// at the end, and equal hashes are compared token by token anyway.
+inline uint64_t CtrlExprHashMix(uint64_t h, uint64_t x)
+{
+	return ((h << 7) | (h >> 57)) ^ x;
+}
+
+// hash of a token sequence, identifier spellings mixed a word at a time
+inline uint64_t HashCtrlExprTokens(const CtrlExprToken* begin, const CtrlExprToken* end)
+{
+	uint64_t h = 0;
+
+	for (const CtrlExprToken* t = begin; t != end; t++)
+	{
+		h = CtrlExprHashMix(h, t->kind | (uint64_t(t->token_type) << 8) | (uint64_t(t->is_unsigned) << 16));
+
+		if (t->kind == CTK_INTEGRAL_LITERAL)
+			h = CtrlExprHashMix(h, t->value);
+
+		if (t->kind == CTK_IDENTIFIER)
+		{
+			size_t i = 0;
+
+			for (; i + 8 <= t->length; i += 8)
+			{
+				uint64_t w;
+				memcpy(&w, t->spelling + i, 8);
+				h = CtrlExprHashMix(h, w);
+			}
+
+			uint64_t w = t->length;
+
+			for (; i < t->length; i++)
+				w = (w << 8) | (unsigned char) t->spelling[i];
+
+			h = CtrlExprHashMix(h, w);
+		}
+	}
+
+	h *= 0x9E3779B97F4A7C15ULL;
+	return h ^ (h >> 29);
+}
+
+inline bool EqualCtrlExprTokens(const CtrlExprToken* a, const CtrlExprToken* a_end, const CtrlExprToken* b, const CtrlExprToken* b_end)
+{
+	if (a_end - a != b_end - b)
+		return false;
+
+	for (; a != a_end; a++, b++)
+	{
+		if (a->kind != b->kind)
+			return false;
+
+		switch (a->kind)
+		{
+		case CTK_INVALID:
+			break;
+
+		case CTK_INTEGRAL_LITERAL:
+			if (a->value != b->value || a->is_unsigned != b->is_unsigned)
+				return false;
+			break;
+
+		case CTK_IDENTIFIER:
+			if (a->length != b->length || memcmp(a->spelling, b->spelling, a->length) != 0)
+				return false;
+			break;
+
+		case CTK_SIMPLE:
+			if (a->token_type != b->token_type)
+				return false;
+			break;
+		}
+	}
+
+	return true;
+}
+
+// IDefinedOracle: answers `defined` for CtrlExprEvaluator
+//
+// Each identifier is interned once, when the first program referencing it
+// is compiled, and from then on asked about by id, so a macro table that
+// keeps its entries by interned identifier answers with an index instead
+// of hashing the spelling on every evaluation.
+struct IDefinedOracle
+{
+	// id of identifier [spelling, spelling + length), the same for every
+	// call with the same spelling
+	virtual uint32_t intern(const char* spelling, size_t length) = 0;
+
+	// whether the identifier interned as `id` is defined as a macro
+	virtual bool is_defined(uint32_t id) = 0;
+
+	virtual ~IDefinedOracle() {}
+};
+
+// CtrlExprEvaluator: evaluates controlling expressions, caching compiled
+// programs and their results
+//
+// Programs hold the ids `oracle` gave their identifiers, so an evaluator
+// must only be used with the oracle it was created with.
+struct CtrlExprEvaluator
+{
+	CtrlExprEvaluator(IDefinedOracle& oracle, bool cache = true)
+		: oracle(oracle), cache(cache)
+	{}
+
+	CtrlExprResult evaluate(const CtrlExprToken* begin, const CtrlExprToken* end)
+	{
+		if (!cache)
+		{
+			CtrlExprCompiler(begin, end, scratch).compile();
+			intern_identifiers(scratch, scratch_ids);
+			query_defined(scratch_ids);
+			return RunCtrlExprProgram(scratch, defined, stack);
+		}
+
+		CachedProgram& program = lookup(begin, end);
+
+		uint64_t bits = query_defined(program.ids);
+
+		if (program.identifiers.size() > 64)
+			return RunCtrlExprProgram(program, defined, stack);
+
+		for (const pair<uint64_t, CtrlExprResult>& memo : program.results)
+			if (memo.first == bits)
+				return memo.second;
+
+		CtrlExprResult result = RunCtrlExprProgram(program, defined, stack);
+		program.results.emplace_back(bits, result);
+		return result;
+	}
+
+	CtrlExprResult evaluate(const vector<CtrlExprToken>& tokens)
+	{
+		return evaluate(tokens.data(), tokens.data() + tokens.size());
+	}
+
+private:
+	IDefinedOracle& oracle;
+	bool cache;
+
+	// CachedProgram: program with the token sequence it was compiled from
+	// and the interned ids of its identifiers
+	struct CachedProgram : CtrlExprProgram
+	{
+		vector<CtrlExprToken> tokens;
+		string spellings;
+		vector<uint32_t> ids;
+		unique_ptr<CachedProgram> next;
+	};
+
+	// programs by hash of their token sequence (see HashCtrlExprTokens),
+	// programs with colliding hashes chained through `next`
+	unordered_map<uint64_t, unique_ptr<CachedProgram>> programs;
+
+	// scratch, reused between evaluations
+	vector<bool> defined;
+	vector<uint64_t> stack;
+	CtrlExprProgram scratch;
+	vector<uint32_t> scratch_ids;
+
+	void intern_identifiers(const CtrlExprProgram& program, vector<uint32_t>& ids)
+	{
+		ids.clear();
+
+		for (const string& identifier : program.identifiers)
+			ids.push_back(oracle.intern(identifier.data(), identifier.size()));
+	}
+
+	// `defined` results of the identifiers with `ids` into `defined`,
+	// returned as bits too when there are at most 64
+	uint64_t query_defined(const vector<uint32_t>& ids)
+	{
+		uint64_t bits = 0;
+
+		defined.resize(ids.size());
+
+		for (size_t i = 0; i < ids.size(); i++)
+		{
+			defined[i] = oracle.is_defined(ids[i]);
+
+			if (defined[i] && i < 64)
+				bits |= uint64_t(1) << i;
+		}
+
+		return bits;
+	}
+
+	CachedProgram& lookup(const CtrlExprToken* begin, const CtrlExprToken* end)
+	{
+		unique_ptr<CachedProgram>* slot = &programs[HashCtrlExprTokens(begin, end)];
+
+		for (; *slot; slot = &(*slot)->next)
+			if (EqualCtrlExprTokens(begin, end, (*slot)->tokens.data(), (*slot)->tokens.data() + (*slot)->tokens.size()))
+				return **slot;
+
+		slot->reset(new CachedProgram);
+		CachedProgram& program = **slot;
+
+		// keep a copy of the tokens, identifiers spelled from `spellings`
+		for (const CtrlExprToken* t = begin; t != end; t++)
+			if (t->kind == CTK_IDENTIFIER)
+				program.spellings.append(t->spelling, t->length);
+
+		size_t offset = 0;
+
+		for (const CtrlExprToken* t = begin; t != end; t++)
+		{
+			program.tokens.push_back(*t);
+
+			if (t->kind == CTK_IDENTIFIER)
+			{
+				program.tokens.back().spelling = program.spellings.data() + offset;
+				offset += t->length;
+			}
+		}
+
+		CtrlExprCompiler(begin, end, program).compile();
+		intern_identifiers(program, program.ids);
+		return program;
+	}
+};
@@ -0,0 +1,476 @@
+// controlling expression evaluation: cached bytecode programs vs parsing
+// every line again, and `defined` answered by spelling vs by interned id,
+// on a synthetic file of 1M #if lines
+//
+// usage: bench/ctrlexpr             run the benchmark
+//        bench/ctrlexpr --generate  write the synthetic lines to stdout
+//        bench/ctrlexpr --eval      evaluate lines of stdin, PA3 output format
+//
+// Lines are tokenized by a small lexer for the subset of C++ in the
+// synthetic file (no escapes, raw strings, line splices or UCNs), so
+// --eval output can be compared with ctrlexpr-ref on that subset.
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../CtrlExpr.h"
+
+bool PA3Mock_IsDefinedIdentifier(const string& identifier)
+{
+	if (identifier.empty())
+		return false;
+	else
+		return identifier[0] % 2;
+}
+
+struct PA3MockDefinedOracle : IDefinedOracle
+{
+	uint32_t intern(const char* spelling, size_t length)
+	{
+		auto it = ids.emplace(string(spelling, length), defined.size());
+
+		if (it.second)
+			defined.push_back(PA3Mock_IsDefinedIdentifier(it.first->first));
+
+		return it.first->second;
+	}
+
+	bool is_defined(uint32_t id)
+	{
+		return defined[id];
+	}
+
+private:
+	unordered_map<string, uint32_t> ids;
+	vector<bool> defined;
+};
+
+// macro table keyed by spelling: each `defined` query hashes the spelling
+struct StringKeyedMacroTable : IDefinedOracle
+{
+	void define(const string& name)
+	{
+		macros.insert(name);
+	}
+
+	uint32_t intern(const char* spelling, size_t length)
+	{
+		auto it = ids.emplace(string(spelling, length), spellings.size());
+
+		if (it.second)
+			spellings.push_back(it.first->first);
+
+		return it.first->second;
+	}
+
+	bool is_defined(uint32_t id)
+	{
+		return macros.count(spellings[id]);
+	}
+
+private:
+	unordered_set<string> macros;
+	unordered_map<string, uint32_t> ids;
+	vector<string> spellings;
+};
+
+// macro table keyed by interned identifier: each `defined` query is an index
+struct IdKeyedMacroTable : IDefinedOracle
+{
+	void define(const string& name)
+	{
+		defined[intern(name.data(), name.size())] = true;
+	}
+
+	uint32_t intern(const char* spelling, size_t length)
+	{
+		auto it = ids.emplace(string(spelling, length), defined.size());
+
+		if (it.second)
+			defined.push_back(false);
+
+		return it.first->second;
+	}
+
+	bool is_defined(uint32_t id)
+	{
+		return defined[id];
+	}
+
+private:
+	unordered_map<string, uint32_t> ids;
+	vector<bool> defined;
+};
+
+bool IsIdentifierStart(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+bool IsIdentifierContinue(char c)
+{
+	return IsIdentifierStart(c) || (c >= '0' && c <= '9');
+}
+
+// integer-literal to a token, with the signedness of its type (2.14.2)
+CtrlExprToken IntegerToken(const string& s)
+{
+	size_t i = 0;
+	int radix = 10;
+
+	if (s.size() > 1 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+	{
+		radix = 16;
+		i = 2;
+	}
+	else if (s[0] == '0')
+		radix = 8;
+
+	uint64_t value = 0;
+	bool overflow = false;
+	size_t ndigits = 0;
+
+	for (; i < s.size(); i++, ndigits++)
+	{
+		char c = s[i];
+		int d = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+
+		if (d < 0 || d >= radix)
+			break;
+
+		uint64_t next = value * radix + d;
+		overflow |= next / radix != value;
+		value = next;
+	}
+
+	bool is_unsigned = false;
+
+	for (; i < s.size(); i++)
+	{
+		if (s[i] == 'u' || s[i] == 'U')
+			is_unsigned = true;
+		else if (s[i] != 'l' && s[i] != 'L')
+			return CtrlExprToken::Invalid();
+	}
+
+	if (overflow || (radix == 16 && ndigits == 0))
+		return CtrlExprToken::Invalid();
+
+	// a decimal literal without u only has signed types to choose from,
+	// octal and hex ones move on to unsigned long long
+	if (!is_unsigned && value > uint64_t(INT64_MAX))
+	{
+		if (radix == 10)
+			return CtrlExprToken::Invalid();
+
+		is_unsigned = true;
+	}
+
+	return CtrlExprToken::Literal(value, is_unsigned);
+}
+
+// tokenize one line
+void Lex(const string& line, vector<CtrlExprToken>& tokens)
+{
+	tokens.clear();
+
+	const char* p = line.data();
+	const char* end = p + line.size();
+
+	while (p != end)
+	{
+		if (*p == ' ' || *p == '\t')
+		{
+			p++;
+		}
+		else if (*p == '/' && p + 1 != end && p[1] == '/')
+		{
+			break;
+		}
+		else if (IsIdentifierStart(*p) && !((*p == 'u' || *p == 'U' || *p == 'L') && p + 1 != end && p[1] == '\''))
+		{
+			const char* start = p;
+
+			while (p != end && IsIdentifierContinue(*p))
+				p++;
+
+			// alternative tokens are operators, keywords stay identifiers
+			ETokenType token_type;
+
+			if (LookupSimpleToken(start, p - start, token_type) && token_type >= OP_LBRACE)
+				tokens.push_back(CtrlExprToken::Simple(token_type));
+			else
+				tokens.push_back(CtrlExprToken::Identifier(start, p - start));
+		}
+		else if ((*p >= '0' && *p <= '9') || (*p == '.' && p + 1 != end && p[1] >= '0' && p[1] <= '9'))
+		{
+			// pp-number
+			const char* start = p;
+
+			while (p != end && (IsIdentifierContinue(*p) || *p == '.' ||
+				((*p == '+' || *p == '-') && (p[-1] == 'e' || p[-1] == 'E'))))
+				p++;
+
+			string s(start, p);
+
+			if (s.find_first_of(".eE") != string::npos && s.find_first_of("xX") == string::npos)
+				tokens.push_back(CtrlExprToken::Invalid());
+			else
+				tokens.push_back(IntegerToken(s));
+		}
+		else if (*p == '\'' || *p == '"' || ((*p == 'u' || *p == 'U' || *p == 'L') && p + 1 != end && p[1] == '\''))
+		{
+			// one ASCII character literal, anything else is invalid here
+			char prefix = *p == '\'' || *p == '"' ? 0 : *p++;
+			char quote = *p++;
+			const char* start = p;
+
+			while (p != end && *p != quote)
+				p++;
+
+			size_t n = p - start;
+
+			if (p != end)
+				p++;
+
+			if (quote == '\'' && n == 1)
+				tokens.push_back(CtrlExprToken::Literal((unsigned char) *start, prefix == 'u' || prefix == 'U'));
+			else
+				tokens.push_back(CtrlExprToken::Invalid());
+		}
+		else
+		{
+			// longest operator or punctuator
+			ETokenType token_type;
+			size_t n = min(size_t(4), size_t(end - p));
+
+			while (n > 0 && !LookupSimpleToken(p, n, token_type))
+				n--;
+
+			if (n == 0)
+			{
+				tokens.push_back(CtrlExprToken::Invalid());
+				p++;
+			}
+			else
+			{
+				tokens.push_back(CtrlExprToken::Simple(token_type));
+				p += n;
+			}
+		}
+	}
+}
+
+struct Random
+{
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	uint64_t next()
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	size_t below(size_t n) { return next() % n; }
+};
+
+const char* const Macros[] =
+{
+	"__GNUC__", "__GNUC_MINOR__", "__clang__", "_WIN32", "_WIN64", "__linux__", "__APPLE__", "_MSC_VER",
+	"__cplusplus", "__STDC_VERSION__", "NDEBUG", "_DEBUG", "HAVE_CONFIG_H", "HAVE_UNISTD_H", "USE_THREADS",
+	"LIBFOO_VERSION", "LIBFOO_STATIC", "BAR_API", "__SIZEOF_POINTER__", "__x86_64__", "__aarch64__",
+	"_POSIX_C_SOURCE", "_GNU_SOURCE", "__has_feature", "ENABLE_SSE2", "CONFIG_SMP", "CONFIG_64BIT"
+};
+
+// random controlling expression in the style of feature and platform tests
+string MakeExpression(Random& r, int depth)
+{
+	const size_t nmacros = sizeof(Macros) / sizeof(Macros[0]);
+	string macro = Macros[r.below(nmacros)];
+
+	if (depth == 0)
+	{
+		switch (r.below(6))
+		{
+		case 0: return "defined(" + macro + ")";
+		case 1: return "defined " + macro;
+		case 2: return "!defined(" + macro + ")";
+		case 3: return macro + " >= " + to_string(r.below(200000));
+		case 4: return "(" + macro + " & 0x" + to_string(1 << r.below(16)) + ")";
+		default: return to_string(r.below(3)) + (r.below(4) ? "" : "u");
+		}
+	}
+
+	string x = MakeExpression(r, depth - 1);
+	string y = MakeExpression(r, depth - 1);
+
+	switch (r.below(8))
+	{
+	case 0: case 1: case 2: return x + " && " + y;
+	case 3: case 4: return x + " || " + y;
+	case 5: return "(" + x + ") " + (r.below(2) ? "and" : "or") + " (" + y + ")";
+	case 6: return "(" + x + " ? " + y + " : " + to_string(r.below(10)) + ")";
+	default: return "(" + macro + " * 100 + " + to_string(r.below(100)) + ") / " + to_string(r.below(4)) + " > " + to_string(r.below(5000));
+	}
+}
+
+// 1M lines drawn from 2000 distinct conditions, the frequent ones (as in
+// common headers) far more often than the rest
+const size_t NumDistinctLines = 2000;
+
+vector<string> MakeDistinctLines()
+{
+	Random r;
+	vector<string> distinct;
+
+	for (size_t i = 0; i < NumDistinctLines; i++)
+		distinct.push_back(MakeExpression(r, 1 + r.below(3)));
+
+	return distinct;
+}
+
+// indices into MakeDistinctLines()
+vector<size_t> MakeLines(size_t n)
+{
+	Random r;
+	vector<size_t> lines;
+	lines.reserve(n);
+
+	for (size_t i = 0; i < n; i++)
+	{
+		size_t k = r.below(NumDistinctLines);
+		lines.push_back(r.below(4) ? k % 50 : k);
+	}
+
+	return lines;
+}
+
+const size_t NumOtherMacros = 10000;
+
+// evaluate `lines`, returning seconds taken and a checksum of the results
+double Time(IDefinedOracle& oracle, bool cache, const vector<vector<CtrlExprToken>>& tokens, const vector<size_t>& lines, uint64_t& checksum)
+{
+	CtrlExprEvaluator evaluator(oracle, cache);
+
+	auto start = chrono::steady_clock::now();
+
+	for (size_t line : lines)
+	{
+		CtrlExprResult result = evaluator.evaluate(tokens[line]);
+		checksum = checksum * 31 + (result.error ? 7 : result.value);
+	}
+
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		string mode = argc > 1 ? argv[1] : "";
+
+		if (mode == "--generate")
+		{
+			vector<string> distinct = MakeDistinctLines();
+
+			for (size_t line : MakeLines(1000000))
+				cout << distinct[line] << '\n';
+
+			return EXIT_SUCCESS;
+		}
+
+		if (mode == "--eval")
+		{
+			PA3MockDefinedOracle oracle;
+			CtrlExprEvaluator evaluator(oracle);
+			vector<CtrlExprToken> tokens;
+			string line;
+
+			while (getline(cin, line))
+			{
+				Lex(line, tokens);
+
+				if (!tokens.empty())
+					cout << CtrlExprResultToString(evaluator.evaluate(tokens)) << '\n';
+			}
+
+			cout << "eof" << endl;
+			return EXIT_SUCCESS;
+		}
+
+		// tokens of each distinct line, as a lexer would just have
+		// produced them (so they are in cache)
+		vector<string> distinct = MakeDistinctLines();
+		vector<vector<CtrlExprToken>> tokens(distinct.size());
+
+		for (size_t i = 0; i < distinct.size(); i++)
+			Lex(distinct[i], tokens[i]);
+
+		vector<size_t> lines = MakeLines(1000000);
+
+		double m = lines.size() / 1e6;
+		uint64_t checksum[2] = { 0, 0 };
+		double seconds[2];
+
+		for (int cache = 0; cache < 2; cache++)
+		{
+			PA3MockDefinedOracle oracle;
+			seconds[cache] = Time(oracle, cache, tokens, lines, checksum[cache]);
+		}
+
+		if (checksum[0] != checksum[1])
+			throw runtime_error("result mismatch");
+
+		cout << "controlling expressions of " << m << "M #if lines (" << distinct.size() << " distinct)" << endl;
+		cout << "  parse every line: " << seconds[0] << " s, " << m / seconds[0] << " M/s" << endl;
+		cout << "  cached programs:  " << seconds[1] << " s, " << m / seconds[1] << " M/s" << endl;
+
+		// the same macros defined in a table of realistic size, every other
+		// one of Macros and many that the lines never mention
+		StringKeyedMacroTable by_string;
+		IdKeyedMacroTable by_id;
+
+		for (size_t i = 0; i < sizeof(Macros) / sizeof(Macros[0]); i += 2)
+		{
+			by_string.define(Macros[i]);
+			by_id.define(Macros[i]);
+		}
+
+		for (size_t i = 0; i < NumOtherMacros; i++)
+		{
+			by_string.define("CONFIG_OPTION_" + to_string(i));
+			by_id.define("CONFIG_OPTION_" + to_string(i));
+		}
+
+		uint64_t checksum_by_string = 0;
+		uint64_t checksum_by_id = 0;
+		double seconds_by_string = Time(by_string, true, tokens, lines, checksum_by_string);
+		double seconds_by_id = Time(by_id, true, tokens, lines, checksum_by_id);
+
+		if (checksum_by_string != checksum_by_id)
+			throw runtime_error("result mismatch");
+
+		cout << "cached programs, `defined` against " << NumOtherMacros << " macros" << endl;
+		cout << "  keyed by spelling: " << seconds_by_string << " s, " << m / seconds_by_string << " M/s" << endl;
+		cout << "  keyed by id:       " << seconds_by_id << " s, " << m / seconds_by_id << " M/s" << endl;
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
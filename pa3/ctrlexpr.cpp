@@ -1,9 +1,17 @@
 // (C) 2013 CPPGM Foundation www.cppgm.org.  All rights reserved.
 
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
 
 using namespace std;
 
+#include "CtrlExpr.h"
+
 // mock implementation of IsDefinedIdentifier for PA3
 // return true iff first code point is odd
 bool PA3Mock_IsDefinedIdentifier(const string& identifier)
@@ -17,5 +25,8 @@ bool PA3Mock_IsDefinedIdentifier(const string& identifier)
 int main()
 {
 	// TODO: Implement ctrlexpr as per PA3 assignment description
+	//
+	// Post-tokenize each logical line into CtrlExprTokens and evaluate them
+	// with a CtrlExprEvaluator (see CtrlExpr.h) over an IDefinedOracle that
+	// answers with PA3Mock_IsDefinedIdentifier, as bench/ctrlexpr.cpp does.
 }
-
@@ -0,0 +1,236 @@
+#pragma once
+
+// Hide sets: the names of the macros a token is nested in (16.3.4)
+//
+// Every identifier produced by a macro replacement carries the names of
+// the invocations it is nested in (the "blacklist" of the PA4 design
+// notes).  Copying a set per token makes deep expansions quadratic, so
+// sets are hash-consed instead: each distinct set is stored once, as a
+// sorted array of name spelling ids, and a token only carries its 32-bit
+// HideSet id.  Equal sets have equal ids, and the results of insert,
+// unite and intersect are memoized by their operand ids, so the same
+// operation on the same sets (the common case: every token of one
+// replacement list gets the same set) costs one probe.
+
+// HideSet: id of a set in a HideSetTable
+typedef uint32_t HideSet;
+
+// the empty set, in every table
+constexpr HideSet EmptyHideSet = 0;
+
+// id that no set has
+constexpr HideSet NoHideSet = 0xFFFFFFFF;
+
+struct HideSetTable
+{
+	HideSetTable()
+		: slots(1024, NoHideSet), memo(1024, MemoSlot{NoHideSet, 0, 0, 0}), memo_count(0)
+	{
+		starts.push_back(0);
+		starts.push_back(0);
+		slots[Hash(nullptr, nullptr) & (slots.size() - 1)] = EmptyHideSet;
+	}
+
+	// number of distinct sets
+	size_t size() const { return starts.size() - 1; }
+
+	// bytes used by the sets and memo
+	size_t memory() const
+	{
+		return (elements.capacity() + starts.capacity() + slots.capacity()) * sizeof(uint32_t) + memo.capacity() * sizeof(MemoSlot);
+	}
+
+	// names in `s`, sorted
+	const uint32_t* begin(HideSet s) const { return elements.data() + starts[s]; }
+	const uint32_t* end(HideSet s) const { return elements.data() + starts[s + 1]; }
+
+	bool contains(HideSet s, uint32_t name) const
+	{
+		return binary_search(begin(s), end(s), name);
+	}
+
+	// s ∪ {name}
+	HideSet insert(HideSet s, uint32_t name)
+	{
+		MemoSlot& slot = memo_slot(OP_INSERT, s, name);
+
+		if (slot.op != NoHideSet)
+			return slot.result;
+
+		const uint32_t* position = lower_bound(begin(s), end(s), name);
+
+		if (position != end(s) && *position == name)
+			return memoize(slot, OP_INSERT, s, name, s);
+
+		scratch.assign(begin(s), position);
+		scratch.push_back(name);
+		scratch.insert(scratch.end(), position, end(s));
+		return memoize(slot, OP_INSERT, s, name, intern());
+	}
+
+	// a ∪ b
+	HideSet unite(HideSet a, HideSet b)
+	{
+		if (a == b || b == EmptyHideSet)
+			return a;
+
+		if (a == EmptyHideSet)
+			return b;
+
+		if (a > b)
+			swap(a, b);
+
+		MemoSlot& slot = memo_slot(OP_UNITE, a, b);
+
+		if (slot.op != NoHideSet)
+			return slot.result;
+
+		scratch.clear();
+		set_union(begin(a), end(a), begin(b), end(b), back_inserter(scratch));
+		return memoize(slot, OP_UNITE, a, b, intern());
+	}
+
+	// a ∩ b
+	HideSet intersect(HideSet a, HideSet b)
+	{
+		if (a == b || a == EmptyHideSet)
+			return a;
+
+		if (b == EmptyHideSet)
+			return b;
+
+		if (a > b)
+			swap(a, b);
+
+		MemoSlot& slot = memo_slot(OP_INTERSECT, a, b);
+
+		if (slot.op != NoHideSet)
+			return slot.result;
+
+		scratch.clear();
+		set_intersection(begin(a), end(a), begin(b), end(b), back_inserter(scratch));
+		return memoize(slot, OP_INTERSECT, a, b, intern());
+	}
+
+private:
+	enum EOp : uint32_t
+	{
+		OP_INSERT,
+		OP_UNITE,
+		OP_INTERSECT
+	};
+
+	// set s is elements[starts[s], starts[s + 1])
+	vector<uint32_t> elements;
+	vector<uint32_t> starts;
+
+	// set ids by content, open addressing
+	vector<uint32_t> slots;
+
+	// results by operation and operands, open addressing (op is NoHideSet
+	// in an empty slot)
+	struct MemoSlot
+	{
+		uint32_t op;
+		uint32_t a;
+		uint32_t b;
+		HideSet result;
+	};
+
+	vector<MemoSlot> memo;
+	size_t memo_count;
+
+	vector<uint32_t> scratch;
+
+	static size_t Hash(const uint32_t* begin, const uint32_t* end)
+	{
+		uint64_t h = end - begin;
+
+		for (const uint32_t* p = begin; p != end; p++)
+			h = (h ^ *p) * 0x9E3779B97F4A7C15ULL;
+
+		return h ^ (h >> 32);
+	}
+
+	static size_t MemoHash(uint32_t op, uint32_t a, uint32_t b)
+	{
+		uint64_t h = ((uint64_t(a) << 32) | b) * 0x9E3779B97F4A7C15ULL + op;
+		return h ^ (h >> 29);
+	}
+
+	MemoSlot& memo_slot(uint32_t op, uint32_t a, uint32_t b)
+	{
+		size_t mask = memo.size() - 1;
+
+		for (size_t i = MemoHash(op, a, b) & mask; ; i = (i + 1) & mask)
+		{
+			MemoSlot& slot = memo[i];
+
+			if (slot.op == NoHideSet || (slot.op == op && slot.a == a && slot.b == b))
+				return slot;
+		}
+	}
+
+	HideSet memoize(MemoSlot& slot, uint32_t op, uint32_t a, uint32_t b, HideSet result)
+	{
+		slot = MemoSlot{op, a, b, result};
+
+		if (2 * ++memo_count > memo.size())
+		{
+			vector<MemoSlot> old(2 * memo.size(), MemoSlot{NoHideSet, 0, 0, 0});
+			old.swap(memo);
+
+			for (const MemoSlot& s : old)
+				if (s.op != NoHideSet)
+					memo_slot(s.op, s.a, s.b) = s;
+		}
+
+		return result;
+	}
+
+	// id of the set in `scratch`, adding it if new
+	HideSet intern()
+	{
+		size_t mask = slots.size() - 1;
+		const uint32_t* data = scratch.data();
+		size_t n = scratch.size();
+
+		for (size_t i = Hash(data, data + n) & mask; ; i = (i + 1) & mask)
+		{
+			HideSet s = slots[i];
+
+			if (s == NoHideSet)
+			{
+				s = size();
+				elements.insert(elements.end(), scratch.begin(), scratch.end());
+				starts.push_back(elements.size());
+				slots[i] = s;
+
+				if (2 * size() > slots.size())
+					grow();
+
+				return s;
+			}
+
+			if (size_t(end(s) - begin(s)) == n && equal(begin(s), end(s), data))
+				return s;
+		}
+	}
+
+	void grow()
+	{
+		slots.assign(2 * slots.size(), NoHideSet);
+
+		size_t mask = slots.size() - 1;
+
+		for (HideSet s = 0; s < size(); s++)
+		{
+			size_t i = Hash(begin(s), end(s)) & mask;
+
+			while (slots[i] != NoHideSet)
+				i = (i + 1) & mask;
+
+			slots[i] = s;
+		}
+	}
+};
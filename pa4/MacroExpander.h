@@ -0,0 +1,797 @@
+#pragma once
+
+#include "MacroTable.h"
+#include "SimpleTokens.h"
+#include "MacroProfiler.h"
+
+// Macro replacement of text-sequences (16.3), pull based
+//
+// MacroExpander::next produces the macro-replaced tokens of a text-sequence
+// one at a time, so they can go straight on to the post-tokenizer.  No
+// replacement is ever materialized: the expander keeps a stack of cursors
+// (frames), each over either the classified replacement list of an
+// invocation being substituted or a span of argument tokens, and pulls the
+// next token from the top one, falling through to the source when the
+// stack is empty.  So rescanning is just pulling again, and an invocation
+// found while rescanning can take its arguments from the rest of the
+// replacement list, from enclosing ones, and from the source alike.
+//
+// What is kept per invocation is its arguments as written (needed for # and
+// ## and for pre-expansion), and each argument's macro replacement, which
+// is computed the first time its parameter is substituted outside # and ##,
+// and only then.  Memory is proportional to the nesting depth and the size
+// of the arguments being substituted, not to the size of the expansion.
+//
+// Nesting follows the PA4 rules (README): every token produced by an
+// invocation gets the hide set of the macro name token plus the macro
+// (substituted argument tokens also keep their own), and a macro name found
+// in its own hide set is flagged noninvokable for good.
+
+// PPTokenSpanSource: tokens [p, end) as a MacroExpander source
+struct PPTokenSpanSource
+{
+	const PPToken* p;
+	const PPToken* end;
+
+	bool next(PPToken& token)
+	{
+		if (p == end)
+			return false;
+
+		token = *p++;
+		return true;
+	}
+};
+
+inline bool IsIdentifierNondigit(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (unsigned char) c >= 0x80;
+}
+
+inline bool IsIdentifierCodeUnit(char c)
+{
+	return IsIdentifierNondigit(c) || (c >= '0' && c <= '9');
+}
+
+// skip identifier [p, end), which may be empty
+inline const char* SkipIdentifier(const char* p, const char* end)
+{
+	while (p != end && IsIdentifierCodeUnit(*p))
+		p++;
+
+	return p;
+}
+
+// skip quoted c-chars or s-chars from the opening `quote` at p, returning
+// the position after the closing quote, or nullptr if there is none
+inline const char* SkipQuoted(const char* p, const char* end, char quote)
+{
+	for (p++; p != end; p++)
+	{
+		if (*p == '\\')
+		{
+			if (++p == end)
+				return nullptr;
+		}
+		else if (*p == quote)
+			return p + 1;
+	}
+
+	return nullptr;
+}
+
+// skip raw-string from the `"` after R at p (2.14.5), returning the
+// position after the closing `"`, or nullptr if malformed
+inline const char* SkipRawString(const char* p, const char* end)
+{
+	const char* delimiter = ++p;
+
+	while (p != end && *p != '(')
+	{
+		if (*p == ')' || *p == '\\' || *p == ' ' || *p == '"' || p - delimiter == 16)
+			return nullptr;
+
+		p++;
+	}
+
+	if (p == end)
+		return nullptr;
+
+	size_t n = p - delimiter;
+
+	for (p++; p != end; p++)
+		if (*p == ')' && size_t(end - p) > n + 1 && memcmp(p + 1, delimiter, n) == 0 && p[n + 1] == '"')
+			return p + n + 2;
+
+	return nullptr;
+}
+
+// RetokenizeSingle: if [data, data+n) is the spelling of exactly one
+// preprocessing-token, set `kind` to its kind and return true (used for
+// the result of ##, 16.3.3/3)
+inline bool RetokenizeSingle(const char* data, size_t n, EPPTokenKind& kind)
+{
+	const char* p = data;
+	const char* end = data + n;
+
+	if (n == 0)
+		return false;
+
+	// encoding-prefix of a character or string literal
+	const char* prefix_end = p;
+
+	if (end - p >= 2 && p[0] == 'u' && p[1] == '8')
+		prefix_end = p + 2;
+	else if (*p == 'u' || *p == 'U' || *p == 'L')
+		prefix_end = p + 1;
+
+	bool raw = prefix_end != end && *prefix_end == 'R';
+	const char* quote = raw ? prefix_end + 1 : prefix_end;
+
+	if (quote != end && (*quote == '"' || (*quote == '\'' && !raw && prefix_end - p < 2)))
+	{
+		bool string_literal = *quote == '"';
+		const char* q = raw ? SkipRawString(quote, end) : SkipQuoted(quote, end, *quote);
+
+		if (!q)
+			return false;
+
+		if (q == end)
+		{
+			kind = string_literal ? PP_STRING_LITERAL : PP_CHARACTER_LITERAL;
+			return true;
+		}
+
+		if (!IsIdentifierNondigit(*q) || SkipIdentifier(q, end) != end)
+			return false;
+
+		kind = string_literal ? PP_USER_DEFINED_STRING_LITERAL : PP_USER_DEFINED_CHARACTER_LITERAL;
+		return true;
+	}
+
+	if (IsIdentifierNondigit(*p))
+	{
+		kind = PP_IDENTIFIER;
+		return SkipIdentifier(p, end) == end;
+	}
+
+	if ((*p >= '0' && *p <= '9') || (*p == '.' && n > 1 && p[1] >= '0' && p[1] <= '9'))
+	{
+		for (p++; p != end; p++)
+			if (!IsIdentifierCodeUnit(*p) && *p != '.' && !((*p == '+' || *p == '-') && (p[-1] == 'e' || p[-1] == 'E')))
+				return false;
+
+		kind = PP_NUMBER;
+		return true;
+	}
+
+	ETokenType token_type;
+
+	if (LookupSimpleToken(data, n, token_type) ||
+		(n == 1 && *data == '#') || (n == 2 && memcmp(data, "##", 2) == 0) ||
+		(n == 2 && memcmp(data, "%:", 2) == 0) || (n == 4 && memcmp(data, "%:%:", 4) == 0))
+	{
+		kind = PP_OP_OR_PUNC;
+		return true;
+	}
+
+	return false;
+}
+
+// PasteSpellings: spelling id and kind of the preprocessing-token that
+// `left` ## `right` makes (16.3.3/3), or false if the two spellings together
+// are not exactly one preprocessing-token
+//
+// The spelling is written in place in the SpellingTable and retokenized
+// there, so a paste copies each byte once and allocates nothing unless its
+// result is a new spelling.
+inline bool PasteSpellings(SpellingTable& spellings, uint32_t left, uint32_t right, uint32_t& spelling, EPPTokenKind& kind)
+{
+	size_t nleft = spellings.spelling_size(left);
+	size_t nright = spellings.spelling_size(right);
+
+	char* out = spellings.open_spelling(nleft + nright);
+	memcpy(out, spellings.spelling_data(left), nleft);
+	memcpy(out + nleft, spellings.spelling_data(right), nright);
+
+	if (!RetokenizeSingle(out, nleft + nright, kind))
+	{
+		spellings.abandon_spelling();
+		return false;
+	}
+
+	spelling = spellings.close_spelling(nleft + nright);
+	return true;
+}
+
+// StringizeTokens: spelling id of the string-literal # makes of [begin, end)
+// (16.3.2/2), written in place in the SpellingTable
+inline uint32_t StringizeTokens(const PPToken* begin, const PPToken* end, SpellingTable& spellings)
+{
+	// quotes, a space before each token, and an escape for each byte at most
+	size_t max_nbytes = 2;
+
+	for (const PPToken* t = begin; t != end; t++)
+		max_nbytes += 1 + 2 * spellings.spelling_size(t->spelling);
+
+	char* out = spellings.open_spelling(max_nbytes);
+	char* q = out;
+
+	*q++ = '"';
+
+	for (const PPToken* t = begin; t != end; t++)
+	{
+		if (t != begin && t->space_before)
+			*q++ = ' ';
+
+		const char* s = spellings.spelling_data(t->spelling);
+		size_t n = spellings.spelling_size(t->spelling);
+
+		bool literal = t->kind == PP_STRING_LITERAL || t->kind == PP_USER_DEFINED_STRING_LITERAL ||
+			t->kind == PP_CHARACTER_LITERAL || t->kind == PP_USER_DEFINED_CHARACTER_LITERAL;
+
+		for (size_t i = 0; i < n; i++)
+		{
+			if (literal && (s[i] == '"' || s[i] == '\\'))
+				*q++ = '\\';
+
+			*q++ = s[i];
+		}
+	}
+
+	*q++ = '"';
+
+	return spellings.close_spelling(q - out);
+}
+
+// PasteTable: PasteSpellings memoized by operand spellings
+//
+// Code generators paste the same operands over and over (a prefix and the
+// names of a table, say); a repeated paste is then one probe of a flat
+// open-addressed table, as the operations of HideSetTable.  Invalid pastes
+// are not remembered: they end the expansion.
+struct PasteTable
+{
+	PasteTable()
+		: slots(1024, Slot{NoSpelling, 0, 0, PP_IDENTIFIER}), count(0)
+	{}
+
+	bool paste(SpellingTable& spellings, uint32_t left, uint32_t right, uint32_t& spelling, EPPTokenKind& kind)
+	{
+		Slot& slot = find(left, right);
+
+		if (slot.left != NoSpelling)
+		{
+			spelling = slot.result;
+			kind = slot.kind;
+			return true;
+		}
+
+		if (!PasteSpellings(spellings, left, right, spelling, kind))
+			return false;
+
+		slot = Slot{left, right, spelling, kind};
+
+		if (2 * ++count > slots.size())
+			grow();
+
+		return true;
+	}
+
+private:
+	// left is NoSpelling in an empty slot
+	struct Slot
+	{
+		uint32_t left;
+		uint32_t right;
+		uint32_t result;
+		EPPTokenKind kind;
+	};
+
+	vector<Slot> slots;
+	size_t count;
+
+	static size_t Hash(uint32_t left, uint32_t right)
+	{
+		uint64_t h = ((uint64_t(left) << 32) | right) * 0x9E3779B97F4A7C15ULL;
+		return h ^ (h >> 29);
+	}
+
+	Slot& find(uint32_t left, uint32_t right)
+	{
+		size_t mask = slots.size() - 1;
+
+		for (size_t i = Hash(left, right) & mask; ; i = (i + 1) & mask)
+		{
+			Slot& slot = slots[i];
+
+			if (slot.left == NoSpelling || (slot.left == left && slot.right == right))
+				return slot;
+		}
+	}
+
+	void grow()
+	{
+		vector<Slot> old(2 * slots.size(), Slot{NoSpelling, 0, 0, PP_IDENTIFIER});
+		old.swap(slots);
+
+		for (const Slot& slot : old)
+			if (slot.left != NoSpelling)
+				find(slot.left, slot.right) = slot;
+	}
+};
+
+// Frame::invocation of a frame over tokens
+constexpr uint32_t NoInvocation = 0xFFFFFFFF;
+
+// MacroExpander: macro replaced tokens of text-sequences from `Source`
+//
+// `Source` has a member bool next(PPToken& token), which returns false at
+// the end of the text-sequence, with new-lines folded into space_before.
+// After next() returns false the expander holds no state, so it can go on
+// with the next text-sequence of the same source once the directive in
+// between has been processed.
+//
+// Invocations are reported to `Profiler` (see MacroProfiler.h).  Arguments
+// are pre-expanded by a nested expander reading them through an
+// `ArgumentSource`.
+template<typename Source, typename Profiler = NullMacroProfiler, typename ArgumentSource = PPTokenSpanSource>
+struct MacroExpander
+{
+	MacroExpander(Source& source, const MacroTable& macros, HideSetTable& hide_sets, SpellingTable& spellings, Profiler profiler = Profiler())
+		: source(source), macros(macros), hide_sets(hide_sets), spellings(spellings), profiler(profiler),
+		has_pushback(false), ninvocations(0)
+	{}
+
+	// next token of the macro-replaced text-sequence, false at its end
+	bool next(PPToken& token)
+	{
+		typename Profiler::Running running(profiler);
+
+		if (!replace(token))
+			return false;
+
+		profiler.produced();
+		return true;
+	}
+
+	// bytes held for frames and arguments, including nested argument
+	// expansions (capacities, so this is the peak so far)
+	size_t memory() const
+	{
+		size_t n = frames.capacity() * sizeof(Frame) + arguments.capacity() * sizeof(PPToken) +
+			argument_starts.capacity() * sizeof(uint32_t);
+
+		for (const unique_ptr<Invocation>& invocation : invocations)
+			n += invocation->memory();
+
+		if (argument_expansion)
+			n += argument_expansion->expander.memory();
+
+		return n;
+	}
+
+private:
+	Source& source;
+	const MacroTable& macros;
+	HideSetTable& hide_sets;
+	SpellingTable& spellings;
+	Profiler profiler;
+
+	PasteTable pastes;
+
+	// Invocation: arguments of an invocation being substituted, and the
+	// results of ## in its replacement list
+	struct Invocation
+	{
+		// argument i is tokens[starts[i], starts[i + 1])
+		vector<PPToken> tokens;
+		vector<uint32_t> starts;
+
+		// macro replacement of argument i, if expanded[i]
+		vector<vector<PPToken>> replaced;
+		vector<bool> expanded;
+
+		// tokens of the ## expression being substituted
+		vector<PPToken> pasted;
+
+		size_t memory() const
+		{
+			size_t n = (tokens.capacity() + pasted.capacity()) * sizeof(PPToken) + starts.capacity() * sizeof(uint32_t);
+
+			for (const vector<PPToken>& r : replaced)
+				n += r.capacity() * sizeof(PPToken);
+
+			return n;
+		}
+	};
+
+	// Frame: cursor over the replacement list of an invocation (`macro`),
+	// or over tokens [token, tokens_end) (`macro` null)
+	struct Frame
+	{
+		const Macro* macro;
+		const ReplacementToken* element;
+		const PPToken* token;
+		const PPToken* tokens_end;
+
+		// hide set of the tokens produced: of the invocation, or for tokens
+		// substituted into one, added to their own
+		HideSet hide_set;
+
+		// arguments of `macro`, pasted tokens
+		uint32_t invocation;
+
+		// the first token produced takes `space_before`, from the macro name
+		// or from the parameter
+		bool first;
+		bool space_before;
+
+		bool exhausted() const
+		{
+			return macro ? element == macro->replacement.data() + macro->replacement.size() : token == tokens_end;
+		}
+	};
+
+	vector<Frame> frames;
+
+	// token pulled ahead and given back (looking for the ( of an invocation)
+	bool has_pushback;
+	PPToken pushback;
+
+	// invocations[i] is in use for i < ninvocations, owned by the frames in
+	// stack order and recycled with their buffers
+	vector<unique_ptr<Invocation>> invocations;
+	uint32_t ninvocations;
+
+	// arguments being collected, before they go to an Invocation
+	vector<PPToken> arguments;
+	vector<uint32_t> argument_starts;
+
+	// expander for pre-expanding arguments, as if they were the rest of the
+	// file (16.3.1/1)
+	struct ArgumentExpansion
+	{
+		ArgumentSource source;
+		MacroExpander<ArgumentSource, Profiler> expander;
+
+		ArgumentExpansion(const MacroTable& macros, HideSetTable& hide_sets, SpellingTable& spellings, Profiler profiler)
+			: source{nullptr, nullptr}, expander(source, macros, hide_sets, spellings, profiler)
+		{}
+	};
+
+	unique_ptr<ArgumentExpansion> argument_expansion;
+
+	// next macro replaced token
+	bool replace(PPToken& token)
+	{
+		for (;;)
+		{
+			if (!pull(token))
+				return false;
+
+			if (!token.is_identifier() || token.noninvokable)
+				return true;
+
+			const Macro* macro = macros.find(token.spelling);
+
+			if (!macro)
+				return true;
+
+			if (hide_sets.contains(token.hide_set, macro->name))
+			{
+				token.noninvokable = true;
+				return true;
+			}
+
+			if (!invoke(token, *macro))
+				return true;
+		}
+	}
+
+	// next token before macro replacement: from the top frame (substituting
+	// arguments and evaluating # and ##), or from the source
+	bool pull(PPToken& token)
+	{
+		if (has_pushback)
+		{
+			has_pushback = false;
+			token = pushback;
+			return true;
+		}
+
+		for (;;)
+		{
+			if (frames.empty())
+			{
+				if (!source.next(token))
+					return false;
+
+				// 16.3/5
+				if (token.is_identifier() && token.spelling == SP_VA_ARGS)
+					throw runtime_error("__VA_ARGS__ token in text-lines");
+
+				return true;
+			}
+
+			Frame& frame = frames.back();
+
+			if (frame.exhausted())
+			{
+				pop_frame();
+				continue;
+			}
+
+			if (!frame.macro)
+			{
+				token = *frame.token++;
+				token.hide_set = hide_sets.unite(token.hide_set, frame.hide_set);
+				take_space(frame, token);
+				return true;
+			}
+
+			const ReplacementToken& element = *frame.element;
+
+			if (element.paste_after)
+			{
+				paste();
+				continue;
+			}
+
+			frame.element++;
+
+			switch (element.kind)
+			{
+			case RK_TOKEN:
+				token = element.token;
+				token.hide_set = frame.hide_set;
+				take_space(frame, token);
+				return true;
+
+			case RK_STRINGIZE:
+				token = stringize(frame.invocation, element.parameter);
+				token.space_before = element.token.space_before;
+				take_space(frame, token);
+				return true;
+
+			case RK_ARGUMENT:
+				push_argument(replaced_argument(frame.invocation, element.parameter), element.token.space_before);
+				break;
+
+			case RK_RAW_ARGUMENT:
+				push_argument(raw_argument(frame.invocation, element.parameter), element.token.space_before);
+				break;
+			}
+		}
+	}
+
+	void take_space(Frame& frame, PPToken& token)
+	{
+		if (frame.first)
+		{
+			token.space_before = frame.space_before;
+			frame.first = false;
+		}
+	}
+
+	void pop_frame()
+	{
+		if (frames.back().invocation != NoInvocation)
+			ninvocations = frames.back().invocation;
+
+		if (frames.back().macro)
+			profiler.popped();
+
+		frames.pop_back();
+	}
+
+	// push a frame over `tokens`, from the replacement list on top
+	void push_argument(PPTokenSpanSource tokens, bool space_before)
+	{
+		Frame& parent = frames.back();
+
+		Frame frame = { nullptr, nullptr, tokens.p, tokens.end, parent.hide_set, NoInvocation, true, parent.first ? parent.space_before : space_before };
+
+		if (tokens.p != tokens.end)
+			parent.first = false;
+
+		frames.push_back(frame);
+	}
+
+	// substitute `macro` invoked by `name`: collect its arguments and push
+	// its replacement list
+	//
+	// returns false (leaving the input as it was) if `macro` is function-like
+	// and `name` is not followed by a (
+	bool invoke(const PPToken& name, const Macro& macro)
+	{
+		profiler.invoking();
+
+		if (macro.function_like)
+		{
+			PPToken lparen;
+
+			if (!pull(lparen))
+			{
+				profiler.not_invoked();
+				return false;
+			}
+
+			if (!lparen.is_op(SP_LPAREN))
+			{
+				has_pushback = true;
+				pushback = lparen;
+				profiler.not_invoked();
+				return false;
+			}
+
+			collect_arguments(macro);
+		}
+
+		// frames that are done do not need to wait for this one
+		while (!frames.empty() && frames.back().exhausted())
+			pop_frame();
+
+		if (ninvocations == invocations.size())
+			invocations.emplace_back(new Invocation);
+
+		Invocation& invocation = *invocations[ninvocations];
+
+		invocation.tokens.swap(arguments);
+		invocation.starts.swap(argument_starts);
+		invocation.expanded.assign(macro.parameters.size(), false);
+
+		if (invocation.replaced.size() < macro.parameters.size())
+			invocation.replaced.resize(macro.parameters.size());
+
+		Frame frame = { &macro, macro.replacement.data(), nullptr, nullptr,
+			hide_sets.insert(name.hide_set, macro.name), ninvocations++, true, name.space_before };
+
+		frames.push_back(frame);
+		profiler.invoked(macro);
+		return true;
+	}
+
+	// collect the arguments of an invocation of `macro`, after the (, into
+	// `arguments` and `argument_starts`
+	void collect_arguments(const Macro& macro)
+	{
+		size_t nparameters = macro.parameters.size();
+		size_t depth = 0;
+
+		arguments.clear();
+		argument_starts.assign(1, 0);
+
+		for (;;)
+		{
+			PPToken token;
+
+			if (!pull(token))
+				throw runtime_error("could not terminate function-like macro invocation");
+
+			if (depth == 0 && token.is_op(SP_RPAREN))
+				break;
+
+			// the commas of the variable arguments are part of them
+			if (depth == 0 && token.is_op(SP_COMMA) && !(macro.variadic && argument_starts.size() == nparameters))
+			{
+				argument_starts.push_back(arguments.size());
+				continue;
+			}
+
+			depth += token.is_op(SP_LPAREN);
+			depth -= token.is_op(SP_RPAREN);
+			arguments.push_back(token);
+		}
+
+		argument_starts.push_back(arguments.size());
+
+		// f() has no arguments if f has no parameters, else one empty one
+		if (nparameters == 0 && argument_starts.size() == 2 && arguments.empty())
+			argument_starts.pop_back();
+
+		if (argument_starts.size() - 1 != nparameters)
+			throw runtime_error("macro function-like invocation wrong num of params: " + spellings.str(macro.name));
+	}
+
+	PPTokenSpanSource raw_argument(uint32_t i, uint32_t parameter)
+	{
+		const Invocation& invocation = *invocations[i];
+		const PPToken* tokens = invocation.tokens.data();
+
+		return PPTokenSpanSource{tokens + invocation.starts[parameter], tokens + invocation.starts[parameter + 1]};
+	}
+
+	// the argument macro replaced, replacing it on first use
+	PPTokenSpanSource replaced_argument(uint32_t i, uint32_t parameter)
+	{
+		Invocation& invocation = *invocations[i];
+		vector<PPToken>& replaced = invocation.replaced[parameter];
+
+		if (!invocation.expanded[parameter])
+		{
+			if (!argument_expansion)
+				argument_expansion.reset(new ArgumentExpansion(macros, hide_sets, spellings, profiler.nested()));
+
+			argument_expansion->source = raw_argument(i, parameter);
+			replaced.clear();
+
+			PPToken token;
+
+			while (argument_expansion->expander.next(token))
+				replaced.push_back(token);
+
+			invocation.expanded[parameter] = true;
+		}
+
+		return PPTokenSpanSource{replaced.data(), replaced.data() + replaced.size()};
+	}
+
+	PPToken stringize(uint32_t i, uint32_t parameter)
+	{
+		PPTokenSpanSource argument = raw_argument(i, parameter);
+
+		return PPToken{PP_STRING_LITERAL, false, false, StringizeTokens(argument.p, argument.end, spellings), EmptyHideSet};
+	}
+
+	// evaluate the ## operators from the top frame's next element to the
+	// end of the expression, and push a frame over the resulting tokens
+	void paste()
+	{
+		Frame& frame = frames.back();
+		Invocation& invocation = *invocations[frame.invocation];
+		vector<PPToken>& pasted = invocation.pasted;
+
+		pasted.clear();
+
+		bool space_before = frame.element->token.space_before;
+
+		for (;;)
+		{
+			const ReplacementToken& element = *frame.element++;
+
+			PPToken token;
+			PPTokenSpanSource operand;
+
+			switch (element.kind)
+			{
+			case RK_TOKEN:
+				token = element.token;
+				token.hide_set = frame.hide_set;
+				operand = PPTokenSpanSource{&token, &token + 1};
+				break;
+
+			case RK_STRINGIZE:
+				token = stringize(frame.invocation, element.parameter);
+				token.space_before = element.token.space_before;
+				operand = PPTokenSpanSource{&token, &token + 1};
+				break;
+
+			default:
+				operand = raw_argument(frame.invocation, element.parameter);
+				break;
+			}
+
+			// an empty operand is a placemarker (16.3.3/3)
+			if (!pasted.empty() && operand.p != operand.end)
+				pasted.back() = paste_tokens(pasted.back(), *operand.p++, frame.hide_set);
+
+			pasted.insert(pasted.end(), operand.p, operand.end);
+
+			if (!element.paste_after)
+				break;
+		}
+
+		push_argument(PPTokenSpanSource{pasted.data(), pasted.data() + pasted.size()}, space_before);
+	}
+
+	PPToken paste_tokens(const PPToken& left, const PPToken& right, HideSet hide_set)
+	{
+		PPToken token = { PP_OP_OR_PUNC, left.space_before, false, 0, hide_set };
+
+		if (!pastes.paste(spellings, left.spelling, right.spelling, token.spelling, token.kind))
+			throw runtime_error("pasting " + spellings.str(left.spelling) + " and " + spellings.str(right.spelling) + " does not give a valid preprocessing token");
+
+		return token;
+	}
+};
@@ -0,0 +1,327 @@
+#pragma once
+
+#include "MacroTable.h"
+
+// Macro expansion profiles
+//
+// MacroExpander reports what it does to a `Profiler`, a template parameter
+// held by value.  The default, NullMacroProfiler, does nothing and its
+// calls compile away, so an expander that is not profiled is the same code
+// as one that had no profiling at all.  MacroProfiler records into a
+// MacroProfile, for each macro: the number of invocations, the tokens they
+// produced, the deepest they were nested, and the time spent expanding them
+// inclusive and exclusive of the invocations nested in them; and the same
+// exclusive times by stack of nested invocations, for a flame graph.
+//
+// Time is counted only while inside MacroExpander::next, so the consumer of
+// the tokens (the post-tokenizer) is not charged to the macros.
+//
+// An invocation is nested in the ones whose replacement its name came from:
+// the expander pops a replacement list once it is done, before collecting
+// an invocation at its end, but the profile keeps it open until the
+// invocation it led to is over.
+
+// NullMacroProfiler: Profiler that records nothing
+struct NullMacroProfiler
+{
+	// scope of a call of MacroExpander::next
+	struct Running
+	{
+		Running(NullMacroProfiler&) {}
+	};
+
+	// profiler for the expander of arguments
+	NullMacroProfiler nested() const { return *this; }
+
+	// an invocation is being collected
+	void invoking() {}
+
+	// ...and its replacement list pushed
+	void invoked(const Macro&) {}
+
+	// ...or it was a function-like macro name not followed by a (
+	void not_invoked() {}
+
+	// a replacement list was popped
+	void popped() {}
+
+	// a token was returned by MacroExpander::next
+	void produced() {}
+};
+
+// MacroProfile: what MacroProfiler records
+struct MacroProfile
+{
+	MacroProfile()
+		: elapsed_ns(0), running(0)
+	{
+		nodes.push_back(Node{0, NoSpelling, 0});
+	}
+
+	struct MacroStats
+	{
+		uint64_t invocations;
+
+		// tokens produced by the invocations, including those of nested
+		// invocations (but not those of the arguments' expansion, which are
+		// counted once the arguments are substituted)
+		uint64_t tokens;
+
+		// most invocations any one was nested in
+		uint32_t max_depth;
+
+		uint64_t inclusive_ns;
+		uint64_t exclusive_ns;
+	};
+
+	// by name spelling id
+	vector<MacroStats> macros;
+
+	// tree of nested invocations, nodes[0] being the root
+	struct Node
+	{
+		uint32_t parent;
+		uint32_t name;
+		uint64_t exclusive_ns;
+	};
+
+	vector<Node> nodes;
+
+	// child nodes by parent << 32 | name
+	unordered_map<uint64_t, uint32_t> children;
+
+	// Active: an invocation that has not ended
+	struct Active
+	{
+		uint32_t name;
+		uint32_t node;
+
+		// nesting of the expander it is in: 0 for the outermost one, 1 for
+		// the one expanding its arguments, ...
+		uint32_t level;
+
+		// invocations ended with this one (itself and those kept open for it)
+		uint32_t exits;
+
+		uint64_t start_ns;
+		uint64_t children_ns;
+		uint64_t tokens;
+	};
+
+	vector<Active> active;
+
+	// virtual clock: time spent inside MacroExpander::next
+	uint64_t elapsed_ns;
+	chrono::steady_clock::time_point resumed;
+	uint32_t running;
+
+	void resume()
+	{
+		if (running++ == 0)
+			resumed = chrono::steady_clock::now();
+	}
+
+	void suspend()
+	{
+		if (--running == 0)
+			elapsed_ns += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - resumed).count();
+	}
+
+	uint64_t now() const
+	{
+		if (running == 0)
+			return elapsed_ns;
+
+		return elapsed_ns + chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - resumed).count();
+	}
+
+	void enter(uint32_t name, uint32_t level, uint32_t exits)
+	{
+		if (name >= macros.size())
+			macros.resize(name + 1, MacroStats{0, 0, 0, 0, 0});
+
+		MacroStats& stats = macros[name];
+		stats.invocations++;
+		stats.max_depth = max<uint32_t>(stats.max_depth, active.size());
+
+		uint32_t parent = active.empty() ? 0 : active.back().node;
+		uint64_t key = uint64_t(parent) << 32 | name;
+		auto it = children.find(key);
+
+		if (it == children.end())
+		{
+			it = children.emplace(key, nodes.size()).first;
+			nodes.push_back(Node{parent, name, 0});
+		}
+
+		active.push_back(Active{name, it->second, level, exits, now(), 0, 0});
+	}
+
+	// end the innermost `n` active invocations
+	void exit(uint32_t n)
+	{
+		for (; n > 0; n--)
+		{
+			Active a = active.back();
+			active.pop_back();
+
+			uint64_t inclusive_ns = now() - a.start_ns;
+			uint64_t exclusive_ns = inclusive_ns - min(inclusive_ns, a.children_ns);
+
+			MacroStats& stats = macros[a.name];
+			stats.tokens += a.tokens;
+			stats.exclusive_ns += exclusive_ns;
+			nodes[a.node].exclusive_ns += exclusive_ns;
+
+			// an invocation nested in another of the same macro (through an
+			// argument) is already counted in the outer one
+			if (none_of(active.begin(), active.end(), [&](const Active& b) { return b.name == a.name; }))
+				stats.inclusive_ns += inclusive_ns;
+
+			if (!active.empty())
+			{
+				active.back().children_ns += inclusive_ns;
+
+				if (active.back().level == a.level)
+					active.back().tokens += a.tokens;
+			}
+		}
+	}
+
+	void produced(uint32_t level)
+	{
+		if (!active.empty() && active.back().level == level)
+			active.back().tokens++;
+	}
+
+	// {"macros": [{"name": ..., ...}, ...]}, by inclusive time, most first
+	void write_json(ostream& out, const SpellingTable& spellings) const
+	{
+		vector<uint32_t> names;
+
+		for (uint32_t name = 0; name < macros.size(); name++)
+			if (macros[name].invocations > 0)
+				names.push_back(name);
+
+		sort(names.begin(), names.end(), [&](uint32_t a, uint32_t b)
+		{
+			return macros[a].inclusive_ns > macros[b].inclusive_ns;
+		});
+
+		out << "{\"macros\": [";
+
+		for (size_t i = 0; i < names.size(); i++)
+		{
+			const MacroStats& stats = macros[names[i]];
+
+			out << (i == 0 ? "\n" : ",\n") << "\t{\"name\": \"" << spellings.str(names[i])
+				<< "\", \"invocations\": " << stats.invocations
+				<< ", \"tokens\": " << stats.tokens
+				<< ", \"max_depth\": " << stats.max_depth
+				<< ", \"inclusive_ns\": " << stats.inclusive_ns
+				<< ", \"exclusive_ns\": " << stats.exclusive_ns << "}";
+		}
+
+		out << "\n]}" << endl;
+	}
+
+	// one `outer;...;inner exclusive_ns` line per stack of nested invocations
+	// (the folded format of flamegraph.pl)
+	void write_folded(ostream& out, const SpellingTable& spellings) const
+	{
+		for (uint32_t i = 1; i < nodes.size(); i++)
+		{
+			if (nodes[i].exclusive_ns == 0)
+				continue;
+
+			vector<uint32_t> stack;
+
+			for (uint32_t n = i; n != 0; n = nodes[n].parent)
+				stack.push_back(nodes[n].name);
+
+			for (size_t j = stack.size(); j-- > 0; )
+				out << spellings.str(stack[j]) << (j == 0 ? ' ' : ';');
+
+			out << nodes[i].exclusive_ns << '\n';
+		}
+	}
+};
+
+// MacroProfiler: Profiler recording into a MacroProfile
+//
+// The MacroProfile is shared by the expander of a text and the expanders of
+// arguments nested in it; the state of the invocation being collected is
+// each one's own.
+struct MacroProfiler
+{
+	MacroProfiler(MacroProfile& profile)
+		: profile(&profile), level(0), deferring(false), pending(0)
+	{}
+
+	struct Running
+	{
+		MacroProfile& profile;
+
+		Running(MacroProfiler& profiler)
+			: profile(*profiler.profile)
+		{
+			profile.resume();
+		}
+
+		~Running()
+		{
+			profile.suspend();
+		}
+	};
+
+	MacroProfiler nested() const
+	{
+		MacroProfiler profiler(*profile);
+		profiler.level = level + 1;
+		return profiler;
+	}
+
+	void invoking()
+	{
+		deferring = true;
+		pending = 0;
+	}
+
+	void invoked(const Macro& macro)
+	{
+		deferring = false;
+		profile->enter(macro.name, level, 1 + pending);
+	}
+
+	void not_invoked()
+	{
+		deferring = false;
+		profile->exit(pending);
+	}
+
+	void popped()
+	{
+		const vector<MacroProfile::Active>& active = profile->active;
+
+		// keep it open, with any it was keeping open, for the invocation
+		// being collected
+		if (deferring)
+			pending += active[active.size() - 1 - pending].exits;
+		else
+			profile->exit(active.back().exits);
+	}
+
+	void produced()
+	{
+		profile->produced(level);
+	}
+
+private:
+	MacroProfile* profile;
+	uint32_t level;
+
+	// invoking() was called, and the innermost `pending` active invocations
+	// were popped since
+	bool deferring;
+	uint32_t pending;
+};
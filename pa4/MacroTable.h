@@ -0,0 +1,402 @@
+#pragma once
+
+#include "PPToken.h"
+
+// Macro definitions (16.3) and the table of currently defined macros
+//
+// A replacement list is classified once, when the macro is defined:
+// parameter names are resolved to indices, and each parameter occurrence
+// is marked with how its argument is substituted (16.3.1, 16.3.2, 16.3.3).
+// Expanding an invocation is then a walk over the classified list with no
+// name lookups.
+
+// EReplacementKind: how a replacement list element is substituted
+enum EReplacementKind : unsigned char
+{
+	// the token itself
+	RK_TOKEN,
+
+	// parameter: the fully macro-replaced argument (16.3.1)
+	RK_ARGUMENT,
+
+	// parameter that is an operand of ##: the argument as written (16.3.3/2)
+	RK_RAW_ARGUMENT,
+
+	// # parameter: the argument spelled as a string-literal (16.3.2)
+	RK_STRINGIZE
+};
+
+// ReplacementToken: element of a classified replacement list
+struct ReplacementToken
+{
+	// the token, the parameter name for RK_ARGUMENT and RK_RAW_ARGUMENT, or
+	// the `#` for RK_STRINGIZE (so space_before is always the element's)
+	PPToken token;
+
+	EReplacementKind kind;
+
+	// followed by a ## operator, which is not itself in the list
+	bool paste_after;
+
+	// index into Macro::parameters unless RK_TOKEN
+	uint32_t parameter;
+};
+
+// Macro: a macro definition
+struct Macro
+{
+	uint32_t name;
+	bool function_like;
+
+	// the last parameter is `...`, named __VA_ARGS__ in `parameters`
+	bool variadic;
+
+	// spellings of the parameter names
+	vector<uint32_t> parameters;
+
+	// the replacement list as written, compared on redefinition (16.3/2)
+	vector<PPToken> definition;
+
+	// the replacement list as classified
+	vector<ReplacementToken> replacement;
+};
+
+// index of the parameter `token` names, or NoSpelling
+inline uint32_t MacroParameterIndex(const Macro& macro, const PPToken& token)
+{
+	if (!macro.function_like || !token.is_identifier())
+		return NoSpelling;
+
+	for (size_t i = 0; i < macro.parameters.size(); i++)
+		if (macro.parameters[i] == token.spelling)
+			return i;
+
+	return NoSpelling;
+}
+
+// parse identifier-list of a function-like macro, after the `(`, up to and
+// including the `)`
+inline void ParseMacroParameters(const PPToken*& p, const PPToken* end, Macro& macro)
+{
+	if (p != end && p->is_op(SP_RPAREN))
+	{
+		p++;
+		return;
+	}
+
+	for (;;)
+	{
+		if (p != end && p->is_op(SP_ELLIPSIS))
+		{
+			p++;
+			macro.variadic = true;
+			macro.parameters.push_back(SP_VA_ARGS);
+
+			if (p == end || !p->is_op(SP_RPAREN))
+				throw runtime_error("expected rparen after dots");
+
+			p++;
+			return;
+		}
+
+		if (p == end || !p->is_identifier())
+			throw runtime_error("expected identifier");
+
+		if (p->spelling == SP_VA_ARGS)
+			throw runtime_error("__VA_ARGS__ in macro parameter list");
+
+		if (MacroParameterIndex(macro, *p) != NoSpelling)
+			throw runtime_error("duplicate parameter in macro definition");
+
+		macro.parameters.push_back(p->spelling);
+		p++;
+
+		if (p != end && p->is_op(SP_RPAREN))
+		{
+			p++;
+			return;
+		}
+
+		if (p == end || !p->is_op(SP_COMMA))
+			throw runtime_error("expected rparen");
+
+		p++;
+	}
+}
+
+// classify macro.definition into macro.replacement
+inline void ClassifyReplacementList(Macro& macro)
+{
+	const vector<PPToken>& tokens = macro.definition;
+
+	// the previous element is the left operand of a ##
+	bool paste_before = false;
+
+	for (size_t i = 0; i < tokens.size(); i++)
+	{
+		const PPToken& token = tokens[i];
+
+		if (token.is_hashhash())
+		{
+			if (i == 0 || i + 1 == tokens.size())
+				throw runtime_error("## at edge of replacement list");
+
+			ReplacementToken& left = macro.replacement.back();
+			left.paste_after = true;
+
+			if (left.kind == RK_ARGUMENT)
+				left.kind = RK_RAW_ARGUMENT;
+
+			paste_before = true;
+			continue;
+		}
+
+		ReplacementToken element = { token, RK_TOKEN, false, NoSpelling };
+
+		if (macro.function_like && token.is_hash())
+		{
+			if (i + 1 == tokens.size())
+				throw runtime_error("# at end of function-like macro replacement list");
+
+			element.parameter = MacroParameterIndex(macro, tokens[i + 1]);
+
+			if (element.parameter == NoSpelling)
+				throw runtime_error("# must be followed by parameter in function-like macro");
+
+			element.kind = RK_STRINGIZE;
+			i++;
+		}
+		else if (token.is_identifier())
+		{
+			element.parameter = MacroParameterIndex(macro, token);
+
+			if (element.parameter != NoSpelling)
+				element.kind = paste_before ? RK_RAW_ARGUMENT : RK_ARGUMENT;
+			else if (token.spelling == SP_VA_ARGS)
+				throw runtime_error("invalid __VA_ARGS__ use");
+		}
+
+		paste_before = false;
+		macro.replacement.push_back(element);
+	}
+}
+
+// ParseMacroDefinition: parse the tokens of a `# define` directive after
+// `define`, not including the new-line, into `macro` (whose storage is
+// reused)
+inline void ParseMacroDefinition(const PPToken* begin, const PPToken* end, Macro& macro)
+{
+	const PPToken* p = begin;
+
+	if (p == end || !p->is_identifier())
+		throw runtime_error("expected identifier");
+
+	if (p->spelling == SP_VA_ARGS)
+		throw runtime_error("invalid __VA_ARGS__ use");
+
+	macro.name = p->spelling;
+	p++;
+
+	// function-like iff the ( immediately follows the name (16.3/10)
+	macro.function_like = p != end && p->is_op(SP_LPAREN) && !p->space_before;
+	macro.variadic = false;
+	macro.parameters.clear();
+	macro.definition.clear();
+	macro.replacement.clear();
+
+	if (macro.function_like)
+		ParseMacroParameters(++p, end, macro);
+	else if (p != end && !p->space_before)
+		throw runtime_error("invalid macro definition");
+
+	macro.definition.assign(p, end);
+	ClassifyReplacementList(macro);
+}
+
+// ParseMacroUndef: name in the tokens of a `# undef` directive after
+// `undef`, not including the new-line
+inline uint32_t ParseMacroUndef(const PPToken* begin, const PPToken* end)
+{
+	if (begin == end || !begin->is_identifier())
+		throw runtime_error("expected identifier");
+
+	if (begin + 1 != end)
+		throw runtime_error("expected new line");
+
+	return begin->spelling;
+}
+
+// definitions are the same: same parameters, and replacement lists with the
+// same tokens and whitespace separation (16.3/2)
+inline bool SameMacroDefinition(const Macro& a, const Macro& b)
+{
+	if (a.function_like != b.function_like || a.variadic != b.variadic ||
+		a.parameters != b.parameters || a.definition.size() != b.definition.size())
+		return false;
+
+	for (size_t i = 0; i < a.definition.size(); i++)
+	{
+		const PPToken& x = a.definition[i];
+		const PPToken& y = b.definition[i];
+
+		if (x.kind != y.kind || x.spelling != y.spelling || (i > 0 && x.space_before != y.space_before))
+			return false;
+	}
+
+	return true;
+}
+
+// MacroTable: currently defined macros by name
+//
+// A flat open-addressed array of {name, macro index} slots, keyed by the
+// spelling id of the name.  Ids are dense, so the home slot is just the id
+// masked; the table is kept at most half full and #undef removes entries
+// by shifting the rest of their probe run back (no tombstones), so asking
+// whether an identifier is a macro is usually one load of the home slot
+// and one compare, however much #define and #undef churn it.
+//
+// Macro objects are recycled on #undef, so redefining reuses the vectors of
+// an earlier definition instead of allocating.
+struct MacroTable
+{
+	MacroTable()
+		: slots(256, Slot{NoSpelling, 0}), count(0), scratch()
+	{}
+
+	// number of macros defined
+	size_t size() const { return count; }
+
+	// the macro named `name`, or nullptr if it is not defined
+	//
+	// The pointer stays valid until that macro is undefined or redefined.
+	const Macro* find(uint32_t name) const
+	{
+		size_t mask = slots.size() - 1;
+
+		for (size_t i = name & mask; ; i = (i + 1) & mask)
+		{
+			const Slot& slot = slots[i];
+
+			if (slot.name == name)
+				return macros[slot.macro].get();
+
+			if (slot.name == NoSpelling)
+				return nullptr;
+		}
+	}
+
+	bool is_defined(uint32_t name) const
+	{
+		return find(name) != nullptr;
+	}
+
+	// define the macro of a `# define` directive (see ParseMacroDefinition)
+	//
+	// A redefinition must be the same as the existing definition.
+	void define(const PPToken* begin, const PPToken* end)
+	{
+		ParseMacroDefinition(begin, end, scratch);
+
+		size_t mask = slots.size() - 1;
+		size_t i = scratch.name & mask;
+
+		for (; slots[i].name != NoSpelling; i = (i + 1) & mask)
+		{
+			if (slots[i].name == scratch.name)
+			{
+				if (!SameMacroDefinition(*macros[slots[i].macro], scratch))
+					throw runtime_error("macro redefined");
+
+				return;
+			}
+		}
+
+		uint32_t index;
+
+		if (free_macros.empty())
+		{
+			index = macros.size();
+			macros.emplace_back(new Macro());
+		}
+		else
+		{
+			index = free_macros.back();
+			free_macros.pop_back();
+		}
+
+		// the recycled definition becomes the next scratch
+		swap(*macros[index], scratch);
+
+		slots[i] = Slot{macros[index]->name, index};
+		count++;
+
+		if (2 * count > slots.size())
+			grow();
+	}
+
+	// undefine the macro named `name`, if defined (16.3.5/2)
+	void undefine(uint32_t name)
+	{
+		size_t mask = slots.size() - 1;
+		size_t i = name & mask;
+
+		for (; slots[i].name != name; i = (i + 1) & mask)
+			if (slots[i].name == NoSpelling)
+				return;
+
+		free_macros.push_back(slots[i].macro);
+		count--;
+
+		// shift back later entries of the probe run that may not stay behind
+		// the hole (their home slot is not cyclically in (i, j])
+		for (size_t j = (i + 1) & mask; slots[j].name != NoSpelling; j = (j + 1) & mask)
+		{
+			size_t home = slots[j].name & mask;
+
+			if (((j - home) & mask) >= ((j - i) & mask))
+			{
+				slots[i] = slots[j];
+				i = j;
+			}
+		}
+
+		slots[i].name = NoSpelling;
+	}
+
+private:
+	struct Slot
+	{
+		uint32_t name;
+		uint32_t macro;
+	};
+
+	vector<Slot> slots;
+	size_t count;
+
+	// definitions by Slot::macro; undefined ones listed in free_macros
+	vector<unique_ptr<Macro>> macros;
+	vector<uint32_t> free_macros;
+
+	Macro scratch;
+
+	void grow()
+	{
+		vector<Slot> old(2 * slots.size(), Slot{NoSpelling, 0});
+		old.swap(slots);
+
+		size_t mask = slots.size() - 1;
+
+		for (const Slot& slot : old)
+		{
+			if (slot.name == NoSpelling)
+				continue;
+
+			size_t i = slot.name & mask;
+
+			while (slots[i].name != NoSpelling)
+				i = (i + 1) & mask;
+
+			slots[i] = slot;
+		}
+	}
+};
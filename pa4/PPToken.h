@@ -0,0 +1,63 @@
+#pragma once
+
+#include "SpellingTable.h"
+#include "HideSet.h"
+
+// EPPTokenKind: kinds of preprocessing-token (2.5), plus new-line, which
+// ends directives and separates lines of text
+enum EPPTokenKind : unsigned char
+{
+	PP_HEADER_NAME,
+	PP_IDENTIFIER,
+	PP_NUMBER,
+	PP_CHARACTER_LITERAL,
+	PP_USER_DEFINED_CHARACTER_LITERAL,
+	PP_STRING_LITERAL,
+	PP_USER_DEFINED_STRING_LITERAL,
+	PP_OP_OR_PUNC,
+	PP_NON_WHITESPACE_CHAR,
+	PP_NEW_LINE
+};
+
+// PPToken: preprocessing-token as the macro expander handles it
+//
+// Twelve bytes, copied by value.  The spelling is an id in the
+// SpellingTable the tokenizer interned it in; whitespace only matters as
+// far as whether a token is preceded by any (16.3/1 and 16.3.2/2).
+struct PPToken
+{
+	EPPTokenKind kind;
+	bool space_before;
+
+	// identifier that will never be replaced: it was found inside the
+	// replacement of the macro it names (16.3.4/2)
+	bool noninvokable;
+
+	uint32_t spelling;
+
+	// macros this token is nested in, an id in the expander's HideSetTable
+	// (EmptyHideSet for tokens from the source file)
+	HideSet hide_set;
+
+	bool is_identifier() const
+	{
+		return kind == PP_IDENTIFIER;
+	}
+
+	bool is_op(uint32_t s) const
+	{
+		return kind == PP_OP_OR_PUNC && spelling == s;
+	}
+
+	// `#` or `%:`
+	bool is_hash() const
+	{
+		return is_op(SP_HASH) || is_op(SP_HASH_DIGRAPH);
+	}
+
+	// `##` or `%:%:`
+	bool is_hashhash() const
+	{
+		return is_op(SP_HASHHASH) || is_op(SP_HASHHASH_DIGRAPH);
+	}
+};
@@ -0,0 +1,184 @@
+#pragma once
+
+// SpellingTable: interns preprocessing-token spellings to dense 32-bit ids
+//
+// Spellings are interned once, when the token is produced, so everything
+// after tokenization (macro lookup, parameter matching, hide sets,
+// redefinition checks) compares and hashes integers instead of strings.
+//
+// The spellings the preprocessor itself looks for are interned first, with
+// the fixed ids of EWellKnownSpelling.
+enum EWellKnownSpelling : uint32_t
+{
+	SP_LPAREN,
+	SP_RPAREN,
+	SP_COMMA,
+	SP_ELLIPSIS,
+	SP_HASH,
+	SP_HASH_DIGRAPH,
+	SP_HASHHASH,
+	SP_HASHHASH_DIGRAPH,
+	SP_VA_ARGS,
+	SP_DEFINE,
+	SP_UNDEF,
+	NumWellKnownSpellings
+};
+
+constexpr const char* WellKnownSpellings[] =
+{
+	"(", ")", ",", "...", "#", "%:", "##", "%:%:", "__VA_ARGS__", "define", "undef"
+};
+
+static_assert(sizeof(WellKnownSpellings) / sizeof(WellKnownSpellings[0]) == NumWellKnownSpellings, "WellKnownSpellings does not match EWellKnownSpelling");
+
+// id that no spelling is interned as
+constexpr uint32_t NoSpelling = 0xFFFFFFFF;
+
+// Open addressing over a power-of-two table of ids, as BinarySpellingTable
+// (PA1); the spellings themselves are stored back to back in `pool`.
+//
+// A spelling made by the preprocessor (by # and ##) can also be written in
+// place at the end of the pool, between open_spelling and close_spelling,
+// rather than built elsewhere and copied in: if it turns out to be interned
+// already, the pool is just cut back.
+struct SpellingTable
+{
+	SpellingTable()
+		: slots(1024, NoSpelling), starts(1, 0)
+	{
+		for (const char* spelling : WellKnownSpellings)
+			intern(spelling, strlen(spelling));
+	}
+
+	// number of distinct spellings interned so far
+	size_t size() const { return starts.size() - 1; }
+
+	// id of spelling [data, data+nbytes), interning it if new
+	uint32_t intern(const char* data, size_t nbytes)
+	{
+		size_t i = find_slot(data, nbytes);
+
+		if (slots[i] != NoSpelling)
+			return slots[i];
+
+		pool.append(data, nbytes);
+		return add(i);
+	}
+
+	uint32_t intern(const string& spelling)
+	{
+		return intern(spelling.data(), spelling.size());
+	}
+
+	// start a spelling of at most `max_nbytes` bytes at the end of the pool,
+	// returning where to write it
+	//
+	// Spellings of other ids stay readable meanwhile (spelling_data after this
+	// call), but nothing may be interned until close_spelling or
+	// abandon_spelling.
+	char* open_spelling(size_t max_nbytes)
+	{
+		pool.resize(starts.back() + max_nbytes);
+		return &pool[starts.back()];
+	}
+
+	// id of the first `nbytes` bytes written since open_spelling, interning
+	// it if new
+	uint32_t close_spelling(size_t nbytes)
+	{
+		pool.resize(starts.back() + nbytes);
+
+		size_t i = find_slot(pool.data() + starts.back(), nbytes);
+
+		if (slots[i] != NoSpelling)
+		{
+			pool.resize(starts.back());
+			return slots[i];
+		}
+
+		return add(i);
+	}
+
+	void abandon_spelling()
+	{
+		pool.resize(starts.back());
+	}
+
+	// spelling of `id`, valid until the next intern of a new spelling
+	const char* spelling_data(uint32_t id) const
+	{
+		return pool.data() + starts[id];
+	}
+
+	size_t spelling_size(uint32_t id) const
+	{
+		return starts[id + 1] - starts[id];
+	}
+
+	string str(uint32_t id) const
+	{
+		return string(spelling_data(id), spelling_size(id));
+	}
+
+private:
+	vector<uint32_t> slots;
+
+	// spelling id is pool[starts[id], starts[id + 1])
+	vector<size_t> starts;
+	string pool;
+
+	// FNV-1a
+	static size_t Hash(const char* data, size_t nbytes)
+	{
+		uint64_t h = 14695981039346656037ULL;
+
+		for (size_t i = 0; i < nbytes; i++)
+			h = (h ^ (unsigned char) data[i]) * 1099511628211ULL;
+
+		return h;
+	}
+
+	// slot of spelling [data, data+nbytes), or the empty slot it would go in
+	size_t find_slot(const char* data, size_t nbytes) const
+	{
+		size_t mask = slots.size() - 1;
+
+		for (size_t i = Hash(data, nbytes) & mask; ; i = (i + 1) & mask)
+		{
+			uint32_t id = slots[i];
+
+			if (id == NoSpelling || (spelling_size(id) == nbytes && memcmp(spelling_data(id), data, nbytes) == 0))
+				return i;
+		}
+	}
+
+	// intern the spelling at the end of the pool in empty slot i
+	uint32_t add(size_t i)
+	{
+		uint32_t id = size();
+		starts.push_back(pool.size());
+		slots[i] = id;
+
+		if (2 * size() > slots.size())
+			grow();
+
+		return id;
+	}
+
+	void grow()
+	{
+		slots.assign(2 * slots.size(), NoSpelling);
+
+		size_t mask = slots.size() - 1;
+
+		for (uint32_t id = 0; id < size(); id++)
+		{
+			size_t i = Hash(spelling_data(id), spelling_size(id)) & mask;
+
+			while (slots[i] != NoSpelling)
+				i = (i + 1) & mask;
+
+			slots[i] = id;
+		}
+	}
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+// Lex: small lexer for the benchmarks, enough for identifiers, pp-numbers
+// and the punctuators of the definitions they use (no literals, comments,
+// line splices or UCNs)
+
+inline bool IsIdentifierStart(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+inline bool IsIdentifierContinue(char c)
+{
+	return IsIdentifierStart(c) || (c >= '0' && c <= '9');
+}
+
+// tokenize one line
+inline vector<PPToken> Lex(SpellingTable& spellings, const string& line)
+{
+	static const char* const punctuators[] = { "%:%:", "...", "##", "%:", "->", "<<", ">>", "&&", "||", "==", "!=" };
+
+	vector<PPToken> tokens;
+	bool space_before = false;
+
+	for (size_t i = 0; i < line.size(); )
+	{
+		size_t start = i;
+		EPPTokenKind kind = PP_OP_OR_PUNC;
+
+		if (line[i] == ' ' || line[i] == '\t')
+		{
+			space_before = true;
+			i++;
+			continue;
+		}
+		else if (IsIdentifierStart(line[i]))
+		{
+			kind = PP_IDENTIFIER;
+
+			while (i < line.size() && IsIdentifierContinue(line[i]))
+				i++;
+		}
+		else if (line[i] >= '0' && line[i] <= '9')
+		{
+			kind = PP_NUMBER;
+
+			while (i < line.size() && (IsIdentifierContinue(line[i]) || line[i] == '.'))
+				i++;
+		}
+		else
+		{
+			i++;
+
+			for (const char* p : punctuators)
+			{
+				if (line.compare(start, strlen(p), p) == 0)
+				{
+					i = start + strlen(p);
+					break;
+				}
+			}
+		}
+
+		tokens.push_back(PPToken{kind, space_before, false, spellings.intern(line.data() + start, i - start), EmptyHideSet});
+		space_before = false;
+	}
+
+	return tokens;
+}
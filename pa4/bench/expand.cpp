@@ -0,0 +1,566 @@
+// expand: the pull-based MacroExpander checked on small programs, then run
+// over deep expansions to show its memory stays proportional to the
+// nesting depth, not to the number of tokens produced
+//
+// usage: bench/expand
+//        bench/expand --expand <file> [--macro-profile=<out.json>]
+//
+// --expand prints the spellings of the macro-replaced tokens of <file>, one
+// per line, for comparing with macro-ref.  --macro-profile writes a
+// MacroProfile of the expansion to <out.json>, and its stacks to <out>.folded
+// for flamegraph.pl.  PA4 has no PA1/PA2 front end yet,
+// so FileSource below is a small lexer of its own: line splices, comments,
+// literals (with prefixes and ud-suffixes), pp-numbers and punctuators, and
+// only the # define and # undef directives.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../MacroExpander.h"
+
+// FileSource: tokens of a whole file, as a MacroExpander source
+//
+// next() returns false at the end of the file and at the start of a
+// directive, which directive() then reads.
+struct FileSource
+{
+	FileSource(SpellingTable& spellings, const string& file)
+		: spellings(spellings), p(0), at_line_start(true)
+	{
+		// line splices (2.2/1 phase 2)
+		for (size_t i = 0; i < file.size(); i++)
+		{
+			if (file[i] == '\\' && i + 1 < file.size() && file[i + 1] == '\n')
+				i++;
+			else
+				text += file[i];
+		}
+	}
+
+	bool next(PPToken& token)
+	{
+		bool space_before = skip_whitespace(true);
+
+		if (p == text.size() || (at_line_start && is_hash()))
+			return false;
+
+		lex(token);
+		token.space_before = space_before;
+		at_line_start = false;
+		return true;
+	}
+
+	// at end of file
+	bool done()
+	{
+		skip_whitespace(true);
+		return p == text.size();
+	}
+
+	// tokens of the directive at the current position, after the #, up to
+	// but not including the new-line
+	void directive(vector<PPToken>& tokens)
+	{
+		tokens.clear();
+		p += text[p] == '#' ? 1 : 2;
+
+		for (;;)
+		{
+			bool space_before = skip_whitespace(false);
+
+			if (p == text.size() || text[p] == '\n')
+				break;
+
+			tokens.push_back(PPToken());
+			lex(tokens.back());
+			tokens.back().space_before = space_before;
+		}
+
+		at_line_start = true;
+	}
+
+private:
+	SpellingTable& spellings;
+	string text;
+	size_t p;
+	bool at_line_start;
+
+	bool is_hash() const
+	{
+		return text[p] == '#' || text.compare(p, 2, "%:") == 0;
+	}
+
+	// skip whitespace and comments, and new-lines if `newlines`, returning
+	// whether there was any
+	bool skip_whitespace(bool newlines)
+	{
+		size_t start = p;
+
+		while (p < text.size())
+		{
+			char c = text[p];
+
+			if (c == '\n' && newlines)
+			{
+				at_line_start = true;
+				p++;
+			}
+			else if (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f')
+				p++;
+			else if (text.compare(p, 2, "//") == 0)
+				p = min(text.find('\n', p), text.size());
+			else if (text.compare(p, 2, "/*") == 0)
+			{
+				size_t end = text.find("*/", p + 2);
+
+				if (end == string::npos)
+					throw runtime_error("partial comment");
+
+				p = end + 2;
+			}
+			else
+				break;
+		}
+
+		return p != start;
+	}
+
+	void lex(PPToken& token)
+	{
+		const char* begin = text.data() + p;
+		const char* end = text.data() + text.size();
+		const char* q = begin + 1;
+
+		token.kind = PP_NON_WHITESPACE_CHAR;
+		token.noninvokable = false;
+		token.hide_set = EmptyHideSet;
+
+		if (IsIdentifierNondigit(*begin))
+		{
+			q = SkipIdentifier(begin, end);
+			token.kind = PP_IDENTIFIER;
+
+			// encoding-prefix and R of a literal
+			string prefix(begin, q);
+			bool raw = !prefix.empty() && prefix.back() == 'R';
+
+			if (raw)
+				prefix.pop_back();
+
+			bool string_prefix = prefix.empty() || prefix == "u8" || prefix == "u" || prefix == "U" || prefix == "L";
+
+			if (q != end && string_prefix && (*q == '"' || (*q == '\'' && !raw && prefix != "u8")))
+			{
+				bool string_literal = *q == '"';
+				q = raw ? SkipRawString(q, end) : SkipQuoted(q, end, *q);
+
+				if (!q)
+					throw runtime_error("unterminated literal");
+
+				token.kind = string_literal ? PP_STRING_LITERAL : PP_CHARACTER_LITERAL;
+				q = suffix(q, end, token);
+			}
+		}
+		else if (*begin == '"' || *begin == '\'')
+		{
+			bool string_literal = *begin == '"';
+			q = SkipQuoted(begin, end, *begin);
+
+			if (!q)
+				throw runtime_error("unterminated literal");
+
+			token.kind = string_literal ? PP_STRING_LITERAL : PP_CHARACTER_LITERAL;
+			q = suffix(q, end, token);
+		}
+		else if ((*begin >= '0' && *begin <= '9') || (*begin == '.' && end - begin > 1 && begin[1] >= '0' && begin[1] <= '9'))
+		{
+			token.kind = PP_NUMBER;
+
+			while (q != end && (IsIdentifierCodeUnit(*q) || *q == '.' || ((*q == '+' || *q == '-') && (q[-1] == 'e' || q[-1] == 'E'))))
+				q++;
+		}
+		else
+		{
+			// longest punctuator
+			for (size_t n = min<size_t>(4, end - begin); n > 0; n--)
+			{
+				EPPTokenKind kind;
+
+				if (RetokenizeSingle(begin, n, kind) && kind == PP_OP_OR_PUNC)
+				{
+					token.kind = kind;
+					q = begin + n;
+					break;
+				}
+			}
+		}
+
+		token.spelling = spellings.intern(begin, q - begin);
+		p = q - text.data();
+	}
+
+	// skip the ud-suffix of a literal ending at q, if any
+	const char* suffix(const char* q, const char* end, PPToken& token)
+	{
+		if (q == end || !IsIdentifierNondigit(*q))
+			return q;
+
+		token.kind = token.kind == PP_STRING_LITERAL ? PP_USER_DEFINED_STRING_LITERAL : PP_USER_DEFINED_CHARACTER_LITERAL;
+		return SkipIdentifier(q, end);
+	}
+};
+
+// macro replace `file`, calling `output` with each token
+template<typename Profiler = NullMacroProfiler, typename Output>
+void ExpandFile(SpellingTable& spellings, const string& file, Output output, Profiler profiler = Profiler())
+{
+	MacroTable macros;
+	HideSetTable hide_sets;
+	FileSource source(spellings, file);
+	MacroExpander<FileSource, Profiler> expander(source, macros, hide_sets, spellings, profiler);
+
+	vector<PPToken> directive;
+
+	for (;;)
+	{
+		PPToken token;
+
+		while (expander.next(token))
+			output(token);
+
+		if (source.done())
+			break;
+
+		source.directive(directive);
+
+		if (directive.empty())
+			continue;
+
+		const PPToken* begin = directive.data() + 1;
+		const PPToken* end = directive.data() + directive.size();
+
+		if (directive[0].spelling == SP_DEFINE)
+			macros.define(begin, end);
+		else if (directive[0].spelling == SP_UNDEF)
+			macros.undefine(ParseMacroUndef(begin, end));
+		else
+			throw runtime_error("unsupported directive: " + spellings.str(directive[0].spelling));
+	}
+}
+
+// spellings of the macro replacement of `file`, space separated
+string Expand(const string& file)
+{
+	SpellingTable spellings;
+	string s;
+
+	ExpandFile(spellings, file, [&](const PPToken& token)
+	{
+		s += (s.empty() ? "" : " ") + spellings.str(token.spelling);
+	});
+
+	return s;
+}
+
+struct Example
+{
+	const char* file;
+
+	// as expanded by macro-ref, or the message of the error it reports
+	const char* expansion;
+};
+
+// 16.3.5 examples, and corner cases of the PA4 rules
+const Example Examples[] =
+{
+	{ "#define x 3\n#define f(a) f(x * (a))\n#undef x\n#define x 2\n#define g f\n#define z z[0]\n"
+		"#define h g(~\n#define m(a) a(w)\n#define w 0,1\n#define t(a) a\n#define p() int\n"
+		"#define q(x) x\n#define r(x,y) x ## y\n#define str(x) # x\n"
+		"f(y+1) + f(f(z)) % t(t(g)(0) + t)(1);\n"
+		"g(x+(3,4)-w) | h 5) & m\n(f)^m(m);\n"
+		"p() i[q()] = { q(1), r(2,3), r(4,), r(,5), r(,) };\n"
+		"char c[2][6] = { str(hello), str() };\n",
+		"f ( 2 * ( y + 1 ) ) + f ( 2 * ( f ( 2 * ( z [ 0 ] ) ) ) ) % f ( 2 * ( 0 ) ) + t ( 1 ) ; "
+		"f ( 2 * ( 2 + ( 3 , 4 ) - 0 , 1 ) ) | f ( 2 * ( ~ 5 ) ) & f ( 2 * ( 0 , 1 ) ) ^ m ( 0 , 1 ) ; "
+		"int i [ ] = { 1 , 23 , 4 , 5 , } ; "
+		"char c [ 2 ] [ 6 ] = { \"hello\" , \"\" } ;" },
+
+	{ "#define str(s) # s\n#define xstr(s) str(s)\n"
+		"#define debug(s, t) printf(\"x\" # s \"= %d, x\" # t \"= %s\", x ## s, x ## t)\n"
+		"#define INCFILE(n) vers ## n\n#define glue(a, b) a ## b\n#define xglue(a, b) glue(a, b)\n"
+		"#define HIGHLOW \"hello\"\n#define LOW LOW \", world\"\n"
+		"debug(1, 2);\n"
+		"fputs(str(strncmp(\"abc\\0d\", \"abc\", '\\4') // this goes away\n== 0) str(: @\\n), s);\n"
+		"xstr(INCFILE(2).h)\nglue(HIGH, LOW);\nxglue(HIGH, LOW)\n",
+		"printf ( \"x\" \"1\" \"= %d, x\" \"2\" \"= %s\" , x1 , x2 ) ; "
+		"fputs ( \"strncmp(\\\"abc\\\\0d\\\", \\\"abc\\\", '\\\\4') == 0\" \": @\\n\" , s ) ; "
+		"\"vers2.h\" \"hello\" ; \"hello\" \", world\"" },
+
+	{ "#define hash_hash # ## #\n#define mkstr(a) # a\n#define in_between(a) mkstr(a)\n"
+		"#define join(c, d) in_between(c hash_hash d)\nchar p[] = join(x, y);\n",
+		"char p [ ] = \"x ## y\" ;" },
+
+	{ "#define t(x,y,z) x ## y ## z\nt(1,2,3), t(,4,5), t(6,,7), t(8,9,), t(10,,), t(,11,), t(,,12), t(,,)\n",
+		"123 , 45 , 67 , 89 , 10 , 11 , 12 ," },
+
+	{ "#define OBJ_LIKE (1-1)\n#define OBJ_LIKE /* white space */ (1-1) /* other */\n"
+		"#define FUNC_LIKE(a) ( a )\n#define FUNC_LIKE( a )( /* note the white space */ \\\n a /* other stuff on this line\n */ )\n"
+		"OBJ_LIKE FUNC_LIKE(z)\n",
+		"( 1 - 1 ) ( z )" },
+
+	{ "#define showlist(...) puts(#__VA_ARGS__)\n#define report(test, ...) ((test)?puts(#test):printf(__VA_ARGS__))\n"
+		"showlist(The first, second, and third items.);\nreport(x>y, \"x is %d but y is %d\", x, y);\n",
+		"puts ( \"The first, second, and third items.\" ) ; "
+		"( ( x > y ) ? puts ( \"x>y\" ) : printf ( \"x is %d but y is %d\" , x , y ) ) ;" },
+
+	// a macro name in its own replacement stays unreplaced, even after its
+	// invocation has ended
+	{ "#define f(x) x f\nf(1)(2)\n", "1 f ( 2 )" },
+	{ "#define f(x) x\n#define g f(g)\ng\n", "g" },
+
+	// an invocation ends its text-sequence at a directive
+	{ "#define f(x) [x]\nf\n#define a 1\n(2) f(a)\n", "f ( 2 ) [ 1 ]" },
+
+	// the expansion of an argument is independent of what follows
+	{ "#define f(x) x(y)\n#define g(x) <x>\nf(g)\n", "< y >" },
+
+	{ "#define f(x) x\nf(1\n", "could not terminate function-like macro invocation" },
+	{ "#define f(x, y) x\nf(1)\n", "macro function-like invocation wrong num of params: f" },
+	{ "#define f(x, ...) x\nf(1)\n", "macro function-like invocation wrong num of params: f" },
+
+	// (where macro-ref drops the right operand)
+	{ "#define f(x, y) x ## y\nf(+, -)\n", "pasting + and - does not give a valid preprocessing token" },
+};
+
+void CheckExamples()
+{
+	for (const Example& example : Examples)
+	{
+		string s;
+
+		try
+		{
+			s = Expand(example.file);
+		}
+		catch (exception& e)
+		{
+			s = e.what();
+		}
+
+		if (s != example.expansion)
+			throw runtime_error("expansion of:\n" + string(example.file) + "is:\n" + s + "\nexpected:\n" + example.expansion);
+	}
+}
+
+// a depth-`depth` family with 2^depth tokens in its expansion: object-like
+// A_i -> A_{i-1} A_{i-1}, or function-like F_i(x) -> F_{i-1}(x) F_{i-1}(x)
+string DoublingFamily(bool function_like, int depth)
+{
+	string file = function_like ? "#define F0(x) x\n" : "#define A0 x\n";
+
+	for (int i = 1; i <= depth; i++)
+	{
+		string name = (function_like ? "F" : "A") + to_string(i);
+		string previous = (function_like ? "F" : "A") + to_string(i - 1);
+
+		if (function_like)
+			file += "#define " + name + "(x) " + previous + "(x) " + previous + "(x)\n";
+		else
+			file += "#define " + name + " " + previous + " " + previous + "\n";
+	}
+
+	return file + (function_like ? "F" + to_string(depth) + "(y)\n" : "A" + to_string(depth) + "\n");
+}
+
+// expand a doubling family, returning seconds taken and the peak bytes the
+// expander held
+template<typename Profiler = NullMacroProfiler>
+double ExpandDoublingFamily(SpellingTable& spellings, bool function_like, int depth, size_t& ntokens, size_t& peak, Profiler profiler = Profiler())
+{
+	MacroTable macros;
+	HideSetTable hide_sets;
+	FileSource source(spellings, DoublingFamily(function_like, depth));
+	MacroExpander<FileSource, Profiler> expander(source, macros, hide_sets, spellings, profiler);
+
+	vector<PPToken> directive;
+
+	ntokens = 0;
+	peak = 0;
+
+	auto start = chrono::steady_clock::now();
+
+	for (;;)
+	{
+		PPToken token;
+
+		while (expander.next(token))
+		{
+			if (ntokens++ % 4096 == 0)
+				peak = max(peak, expander.memory());
+		}
+
+		if (source.done())
+			break;
+
+		source.directive(directive);
+		macros.define(directive.data() + 1, directive.data() + directive.size());
+	}
+
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// profile the doubling families: A_i is invoked 2^(depth-i) times, nested
+// in depth-i others, and its invocations produce 2^depth tokens in all
+void CheckProfile()
+{
+	const int depth = 10;
+
+	for (bool function_like : { false, true })
+	{
+		SpellingTable spellings;
+		MacroProfile profile;
+		size_t ntokens, peak;
+
+		ExpandDoublingFamily(spellings, function_like, depth, ntokens, peak, MacroProfiler(profile));
+
+		uint64_t total_ns = 0;
+
+		for (const MacroProfile::Node& node : profile.nodes)
+			total_ns += node.exclusive_ns;
+
+		for (int i = 0; i <= depth; i++)
+		{
+			string name = (function_like ? "F" : "A") + to_string(i);
+			const MacroProfile::MacroStats& stats = profile.macros.at(spellings.intern(name));
+
+			if (stats.invocations != uint64_t(1) << (depth - i) || stats.tokens != uint64_t(1) << depth ||
+				stats.max_depth != uint32_t(depth - i) || stats.exclusive_ns > stats.inclusive_ns)
+				throw runtime_error("bad profile of " + name);
+
+			if (i == depth && stats.inclusive_ns != total_ns)
+				throw runtime_error("exclusive times do not add up");
+		}
+
+		// one stack per depth
+		ostringstream out;
+		profile.write_folded(out, spellings);
+
+		string folded = out.str();
+		string expected = function_like ? "F10;F9;F8;F7;F6;F5;F4;F3;F2;F1;F0 " : "A10;A9;A8;A7;A6;A5;A4;A3;A2;A1;A0 ";
+
+		if (count(folded.begin(), folded.end(), '\n') > depth + 1 || folded.find(expected) == string::npos)
+			throw runtime_error("bad folded stacks:\n" + folded);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		if ((argc == 3 || argc == 4) && string(argv[1]) == "--expand")
+		{
+			ifstream in(argv[2]);
+
+			if (!in)
+				throw runtime_error("cannot open " + string(argv[2]));
+
+			ostringstream file;
+			file << in.rdbuf();
+
+			SpellingTable spellings;
+
+			auto output = [&](const PPToken& token)
+			{
+				cout << spellings.str(token.spelling) << '\n';
+			};
+
+			if (argc == 3)
+			{
+				ExpandFile(spellings, file.str(), output);
+				return EXIT_SUCCESS;
+			}
+
+			string option = argv[3];
+			string prefix = "--macro-profile=";
+
+			if (option.compare(0, prefix.size(), prefix) != 0 || option.size() == prefix.size())
+				throw runtime_error("invalid usage");
+
+			string json_path = option.substr(prefix.size());
+			string folded_path = json_path;
+
+			if (folded_path.size() > 5 && folded_path.compare(folded_path.size() - 5, 5, ".json") == 0)
+				folded_path.resize(folded_path.size() - 5);
+
+			folded_path += ".folded";
+
+			MacroProfile profile;
+
+			ExpandFile(spellings, file.str(), output, MacroProfiler(profile));
+
+			ofstream json(json_path), folded(folded_path);
+
+			profile.write_json(json, spellings);
+			profile.write_folded(folded, spellings);
+
+			if (!json || !folded)
+				throw runtime_error("cannot write " + json_path + " and " + folded_path);
+
+			return EXIT_SUCCESS;
+		}
+
+		CheckExamples();
+		CheckProfile();
+
+		cout << "macro replacement and profiles check out" << endl;
+
+		// budgets: the expansion is 2^Depth tokens, what is held is O(Depth)
+		const int Depth = 22;
+		const double MaxSeconds = 2.0;
+		const size_t MaxPeakBytes = 64 * 1024;
+
+		for (bool function_like : { false, true })
+		{
+			SpellingTable spellings;
+			size_t ntokens, peak;
+			double seconds = ExpandDoublingFamily(spellings, function_like, Depth, ntokens, peak);
+
+			if (ntokens != size_t(1) << Depth)
+				throw runtime_error("doubling family expands to " + to_string(ntokens) + " tokens");
+
+			cout << (function_like ? "function" : "object") << "-like doubling family, depth " << Depth << ": "
+				<< ntokens << " tokens (" << ntokens * sizeof(PPToken) << " bytes materialized) in "
+				<< seconds << " s, " << ntokens / seconds / 1e6 << " M tokens/s, peak " << peak << " bytes held" << endl;
+
+			if (seconds > MaxSeconds)
+				throw runtime_error("doubling family over time budget");
+
+			if (peak > MaxPeakBytes)
+				throw runtime_error("expander memory grows with the expansion");
+
+			MacroProfile profile;
+			double profiled_seconds = ExpandDoublingFamily(spellings, function_like, Depth, ntokens, peak, MacroProfiler(profile));
+
+			cout << "  with --macro-profile: " << profiled_seconds << " s, " << ntokens / profiled_seconds / 1e6 << " M tokens/s" << endl;
+		}
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,388 @@
+// hide sets: HideSetTable checked against std::set, then a stress test
+// expanding a 10-level recursive macro family, with hash-consed hide sets
+// and with a set<string> copied per token
+//
+// usage: bench/hidesets
+//
+// The expansion is a simple model of the PA4 rescanning rules (README),
+// without # and ## which the family does not use: tokens of a replacement
+// list get the hide set of the macro name token plus the macro, tokens of
+// arguments keep their own, and a macro name found in its own hide set is
+// flagged noninvokable for good.
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../MacroTable.h"
+#include "Lex.h"
+
+struct Random
+{
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	uint64_t next()
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	size_t below(size_t n) { return next() % n; }
+};
+
+// random operations on random sets of a few names
+void CheckHideSetTable()
+{
+	HideSetTable table;
+	vector<HideSet> ids = { EmptyHideSet };
+	vector<set<uint32_t>> sets = { {} };
+	Random r;
+
+	for (size_t step = 0; step < 200000; step++)
+	{
+		size_t i = r.below(ids.size());
+		size_t j = r.below(ids.size());
+		HideSet x;
+		set<uint32_t> expected;
+
+		switch (r.below(3))
+		{
+		case 0:
+		{
+			uint32_t name = r.below(40);
+			x = table.insert(ids[i], name);
+			expected = sets[i];
+			expected.insert(name);
+			break;
+		}
+
+		case 1:
+			x = table.unite(ids[i], ids[j]);
+			set_union(sets[i].begin(), sets[i].end(), sets[j].begin(), sets[j].end(), inserter(expected, expected.end()));
+			break;
+
+		default:
+			x = table.intersect(ids[i], ids[j]);
+			set_intersection(sets[i].begin(), sets[i].end(), sets[j].begin(), sets[j].end(), inserter(expected, expected.end()));
+			break;
+		}
+
+		if (!equal(expected.begin(), expected.end(), table.begin(x)) || size_t(table.end(x) - table.begin(x)) != expected.size())
+			throw runtime_error("hide set mismatch");
+
+		for (size_t k = 0; k < ids.size(); k++)
+			if ((ids[k] == x) != (sets[k] == expected))
+				throw runtime_error("hide set not hash-consed");
+
+		if (ids.size() < 2000)
+		{
+			ids.push_back(x);
+			sets.push_back(expected);
+		}
+
+		uint32_t name = r.below(40);
+
+		if (table.contains(x, name) != (expected.count(name) != 0))
+			throw runtime_error("hide set contains mismatch");
+	}
+}
+
+// hash-consed: a token carries a HideSet id
+struct ConsedHideSets
+{
+	typedef HideSet Set;
+
+	HideSetTable table;
+
+	Set empty() { return EmptyHideSet; }
+	Set insert(const Set& s, uint32_t name, const SpellingTable&) { return table.insert(s, name); }
+	bool contains(const Set& s, uint32_t name, const SpellingTable&) { return table.contains(s, name); }
+};
+
+// naive: a token carries its own set of names
+struct CopiedHideSets
+{
+	typedef set<string> Set;
+
+	Set empty() { return Set(); }
+
+	Set insert(const Set& s, uint32_t name, const SpellingTable& spellings)
+	{
+		Set t = s;
+		t.insert(spellings.str(name));
+		return t;
+	}
+
+	bool contains(const Set& s, uint32_t name, const SpellingTable& spellings)
+	{
+		return s.count(spellings.str(name)) != 0;
+	}
+};
+
+// macro replacement of text-sequences, hide sets kept by `HideSets`
+template<typename HideSets>
+struct ModelExpander
+{
+	typedef typename HideSets::Set Set;
+
+	struct Token
+	{
+		PPToken token;
+		Set hide_set;
+		bool noninvokable;
+	};
+
+	const SpellingTable& spellings;
+	const MacroTable& macros;
+	HideSets hide_sets;
+
+	ModelExpander(const SpellingTable& spellings, const MacroTable& macros)
+		: spellings(spellings), macros(macros)
+	{}
+
+	// fully macro replace `input` into `output`
+	void expand(const vector<Token>& input, vector<Token>& output)
+	{
+		// the rest of the input, front on top
+		vector<Token> stack(input.rbegin(), input.rend());
+
+		while (!stack.empty())
+		{
+			Token t = move(stack.back());
+			stack.pop_back();
+
+			const Macro* macro = t.token.is_identifier() && !t.noninvokable ? macros.find(t.token.spelling) : nullptr;
+
+			if (macro && hide_sets.contains(t.hide_set, macro->name, spellings))
+			{
+				t.noninvokable = true;
+				macro = nullptr;
+			}
+
+			if (macro && macro->function_like && (stack.empty() || !stack.back().token.is_op(SP_LPAREN)))
+				macro = nullptr;
+
+			if (!macro)
+			{
+				output.push_back(move(t));
+				continue;
+			}
+
+			vector<vector<Token>> arguments;
+
+			if (macro->function_like)
+				arguments = collect_arguments(stack, *macro);
+
+			Set body_hide_set = hide_sets.insert(t.hide_set, macro->name, spellings);
+			vector<Token> replacement;
+
+			for (const ReplacementToken& r : macro->replacement)
+			{
+				switch (r.kind)
+				{
+				case RK_TOKEN:
+					replacement.push_back(Token{r.token, body_hide_set, false});
+					break;
+
+				case RK_ARGUMENT:
+					expand(arguments[r.parameter], replacement);
+					break;
+
+				case RK_RAW_ARGUMENT:
+					replacement.insert(replacement.end(), arguments[r.parameter].begin(), arguments[r.parameter].end());
+					break;
+
+				case RK_STRINGIZE:
+					throw runtime_error("# is not modelled");
+				}
+
+				if (r.paste_after)
+					throw runtime_error("## is not modelled");
+			}
+
+			stack.insert(stack.end(), replacement.rbegin(), replacement.rend());
+		}
+	}
+
+	// pop `( arguments )` off `stack`
+	vector<vector<Token>> collect_arguments(vector<Token>& stack, const Macro& macro)
+	{
+		vector<vector<Token>> arguments(1);
+		size_t depth = 0;
+
+		stack.pop_back();
+
+		for (;;)
+		{
+			if (stack.empty())
+				throw runtime_error("unterminated macro invocation");
+
+			Token t = move(stack.back());
+			stack.pop_back();
+
+			if (t.token.is_op(SP_RPAREN) && depth == 0)
+				break;
+
+			if (t.token.is_op(SP_COMMA) && depth == 0 && arguments.size() < macro.parameters.size())
+			{
+				if (!(macro.variadic && arguments.size() == macro.parameters.size()))
+				{
+					arguments.emplace_back();
+					continue;
+				}
+			}
+
+			depth += t.token.is_op(SP_LPAREN);
+			depth -= t.token.is_op(SP_RPAREN);
+			arguments.back().push_back(move(t));
+		}
+
+		if (macro.parameters.empty() && arguments.size() == 1 && arguments[0].empty())
+			arguments.clear();
+
+		if (arguments.size() != macro.parameters.size())
+			throw runtime_error("wrong number of macro arguments");
+
+		return arguments;
+	}
+};
+
+const int FamilyDepth = 10;
+
+// f0(x) -> f1(x f0) g0 -> ... -> f9(x) -> x f9 g9, with g_i -> f_i(g_i):
+// every level tries to invoke itself and all levels above it again
+void DefineFamily(SpellingTable& spellings, MacroTable& macros)
+{
+	for (int i = 0; i < FamilyDepth; i++)
+	{
+		string f = "f" + to_string(i);
+		string g = "g" + to_string(i);
+		string next = "f" + to_string(i + 1);
+
+		vector<string> definitions =
+		{
+			i + 1 < FamilyDepth ? f + "(x) " + next + "(x " + f + ") " + g : f + "(x) x " + f + " " + g,
+			g + " " + f + "(" + g + ")"
+		};
+
+		for (const string& definition : definitions)
+		{
+			vector<PPToken> tokens = Lex(spellings, definition);
+			macros.define(tokens.data(), tokens.data() + tokens.size());
+		}
+	}
+}
+
+// f0(a) as expanded by macro-ref
+const char* const FamilyExpansion =
+	"a f0 f1 f2 f3 f4 f5 f6 f7 f8 f9 f9 ( g9 ) f8 ( g8 ) f7 ( g7 ) f6 ( g6 ) f5 ( g5 ) "
+	"f4 ( g4 ) f3 ( g3 ) f2 ( g2 ) f1 ( g1 ) f0 ( g0 )";
+
+// expand `n` invocations f0(a_k), returning seconds taken and output tokens
+template<typename HideSets>
+double ExpandFamily(ModelExpander<HideSets>& expander, SpellingTable& spellings, size_t n, size_t& ntokens)
+{
+	typedef typename ModelExpander<HideSets>::Token Token;
+
+	vector<vector<Token>> invocations;
+
+	for (size_t k = 0; k < 1000; k++)
+	{
+		invocations.emplace_back();
+
+		for (const PPToken& token : Lex(spellings, "f0(a" + to_string(k) + ")"))
+			invocations.back().push_back(Token{token, expander.hide_sets.empty(), false});
+	}
+
+	vector<Token> output;
+	ntokens = 0;
+
+	auto start = chrono::steady_clock::now();
+
+	for (size_t i = 0; i < n; i++)
+	{
+		output.clear();
+		expander.expand(invocations[i % invocations.size()], output);
+		ntokens += output.size();
+	}
+
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	// check the last one
+	string s;
+
+	for (const Token& t : output)
+		s += (s.empty() ? "" : " ") + spellings.str(t.token.spelling);
+
+	string expected = FamilyExpansion;
+	expected.replace(0, 1, "a" + to_string((n - 1) % invocations.size()));
+
+	if (s != expected)
+		throw runtime_error("family expands to " + s);
+
+	return seconds;
+}
+
+int main()
+{
+	try
+	{
+		CheckHideSetTable();
+
+		cout << "hide set operations check out" << endl;
+
+		SpellingTable spellings;
+		MacroTable macros;
+		DefineFamily(spellings, macros);
+
+		const size_t NumInvocations = 100000;
+
+		// budgets for the hash-consed sets: the work per invocation is
+		// fixed, so is the number of distinct sets
+		const double MaxSeconds = 2.0;
+		const size_t MaxHideSetBytes = 64 * 1024;
+
+		ModelExpander<ConsedHideSets> consed(spellings, macros);
+		ModelExpander<CopiedHideSets> copied(spellings, macros);
+
+		// the copying model is far slower, so it only expands a tenth
+		size_t ntokens[2];
+		double seconds[2];
+
+		seconds[0] = ExpandFamily(consed, spellings, NumInvocations, ntokens[0]);
+		seconds[1] = ExpandFamily(copied, spellings, NumInvocations / 10, ntokens[1]);
+
+		if (ntokens[0] != 10 * ntokens[1])
+			throw runtime_error("expansion mismatch");
+
+		cout << NumInvocations << " invocations of a " << FamilyDepth << "-level recursive macro family (" << ntokens[0] << " tokens)" << endl;
+		cout << "  hash-consed hide sets: " << seconds[0] << " s, " << ntokens[0] / seconds[0] / 1e6 << " M tokens/s, "
+			<< consed.hide_sets.table.size() << " distinct sets in " << consed.hide_sets.table.memory() << " bytes" << endl;
+		cout << "  set<string> per token: " << ntokens[1] / seconds[1] / 1e6 << " M tokens/s" << endl;
+
+		if (seconds[0] > MaxSeconds)
+			throw runtime_error("hash-consed expansion over time budget");
+
+		if (consed.hide_sets.table.memory() > MaxHideSetBytes)
+			throw runtime_error("hide sets over memory budget");
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
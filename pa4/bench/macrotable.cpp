@@ -0,0 +1,288 @@
+// macro table: definitions and #undef churn checked against a reference
+// map, then identifier lookups timed against a table keyed by spelling
+//
+// usage: bench/macrotable
+//
+// Directives are tokenized by the small lexer of Lex.h.
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../MacroTable.h"
+#include "Lex.h"
+
+// `#define` with [line] after `define`, returning the error message or ""
+string Define(SpellingTable& spellings, MacroTable& macros, const string& line)
+{
+	vector<PPToken> tokens = Lex(spellings, line);
+
+	try
+	{
+		macros.define(tokens.data(), tokens.data() + tokens.size());
+		return "";
+	}
+	catch (exception& e)
+	{
+		return e.what();
+	}
+}
+
+void CheckDefinitions()
+{
+	struct { const char* definition; const char* error; } cases[] =
+	{
+		{ "A", "" },
+		{ "A ", "" },
+		{ "B 1 + 2", "" },
+		{ "A+", "invalid macro definition" },
+		{ "1", "expected identifier" },
+		{ "F(a,a) a", "duplicate parameter in macro definition" },
+		{ "F(a,) A", "expected identifier" },
+		{ "F(a,,b) B", "expected identifier" },
+		{ "F(x", "expected rparen" },
+		{ "F(x y) 1", "expected rparen" },
+		{ "F(...,x) x", "expected rparen after dots" },
+		{ "F(__VA_ARGS__) x", "__VA_ARGS__ in macro parameter list" },
+		{ "__VA_ARGS__ C", "invalid __VA_ARGS__ use" },
+		{ "V __VA_ARGS__", "invalid __VA_ARGS__ use" },
+		{ "F(x) __VA_ARGS__", "invalid __VA_ARGS__ use" },
+		{ "F(a) #b", "# must be followed by parameter in function-like macro" },
+		{ "F() #", "# at end of function-like macro replacement list" },
+		{ "x a ##", "## at edge of replacement list" },
+		{ "F(x) ## x", "## at edge of replacement list" },
+		{ "H # x", "" },
+		{ "G(x, ...) #x x ## __VA_ARGS__ %:%: x", "" },
+		{ "OBJ_LIKE (1-1)", "" },
+		{ "OBJ_LIKE   (1-1)  ", "" },
+		{ "OBJ_LIKE (0)", "macro redefined" },
+		{ "OBJ_LIKE (1 -1)", "macro redefined" },
+		{ "FUNC_LIKE(a) ( a )", "" },
+		{ "FUNC_LIKE( a )(  a )", "" },
+		{ "FUNC_LIKE(b) ( a )", "macro redefined" },
+		{ "FUNC_LIKE (a) ( a )", "macro redefined" },
+	};
+
+	SpellingTable spellings;
+	MacroTable macros;
+
+	for (auto& c : cases)
+	{
+		string error = Define(spellings, macros, c.definition);
+
+		if (error != c.error)
+			throw runtime_error(string("#define ") + c.definition + ": expected \"" + c.error + "\", got \"" + error + "\"");
+	}
+
+	// G(x, ...) #x x ## __VA_ARGS__ %:%: x
+	const Macro* g = macros.find(spellings.intern("G"));
+
+	EReplacementKind kinds[] = { RK_STRINGIZE, RK_RAW_ARGUMENT, RK_RAW_ARGUMENT, RK_RAW_ARGUMENT };
+	uint32_t parameters[] = { 0, 0, 1, 0 };
+	bool pastes[] = { false, true, true, false };
+
+	if (!g || !g->function_like || !g->variadic || g->parameters.size() != 2 || g->replacement.size() != 4)
+		throw runtime_error("G misclassified");
+
+	for (size_t i = 0; i < 4; i++)
+		if (g->replacement[i].kind != kinds[i] || g->replacement[i].parameter != parameters[i] || g->replacement[i].paste_after != pastes[i])
+			throw runtime_error("G misclassified");
+
+	// # is not an operator in object-like macros
+	const Macro* h = macros.find(spellings.intern("H"));
+
+	if (!h || h->replacement.size() != 2 || h->replacement[0].kind != RK_TOKEN || h->replacement[1].kind != RK_TOKEN)
+		throw runtime_error("H misclassified");
+}
+
+struct Random
+{
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	uint64_t next()
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	size_t below(size_t n) { return next() % n; }
+
+	// skewed towards small values, as identifier frequencies are
+	size_t skewed(size_t n) { return below(below(n) + 1); }
+};
+
+const size_t NumNames = 20000;
+const size_t NumTokens = 4000000;
+
+string Name(size_t i)
+{
+	return "name_" + to_string(i);
+}
+
+// random #define and #undef of the first NumNames / 8 names, with lookups
+// of any name in between, checked against a map
+void CheckChurn(SpellingTable& spellings)
+{
+	MacroTable macros;
+	unordered_map<uint32_t, size_t> expected;
+	Random r;
+
+	for (size_t step = 0; step < 1000000; step++)
+	{
+		size_t k = r.below(NumNames / 8);
+		uint32_t name = spellings.intern(Name(k));
+
+		switch (r.below(4))
+		{
+		case 0:
+		{
+			// redefined identically, so never an error
+			string definition = Name(k) + " " + to_string(k);
+			vector<PPToken> tokens = Lex(spellings, definition);
+			macros.define(tokens.data(), tokens.data() + tokens.size());
+			expected[name] = k;
+			break;
+		}
+
+		case 1:
+			macros.undefine(name);
+			expected.erase(name);
+			break;
+
+		default:
+		{
+			name = spellings.intern(Name(r.below(NumNames)));
+			const Macro* macro = macros.find(name);
+			auto it = expected.find(name);
+
+			if ((macro != nullptr) != (it != expected.end()) ||
+				(macro && (macro->name != name || spellings.str(macro->definition[0].spelling) != to_string(it->second))))
+				throw runtime_error("lookup mismatch after churn");
+		}
+		}
+
+		if (macros.size() != expected.size())
+			throw runtime_error("size mismatch after churn");
+	}
+}
+
+// the same definitions keyed by spelling
+struct StringMacro
+{
+	bool function_like;
+	vector<string> parameters;
+	vector<string> replacement;
+};
+
+int main()
+{
+	try
+	{
+		CheckDefinitions();
+
+		SpellingTable spellings;
+		CheckChurn(spellings);
+
+		cout << "macro definitions and #undef churn check out" << endl;
+
+		// identifier tokens of a text, every 64th replaced by a directive
+		// that redefines or undefines one of the macros
+		Random r;
+		vector<string> text;
+		vector<PPToken> tokens;
+
+		for (size_t i = 0; i < NumTokens; i++)
+		{
+			text.push_back(Name(r.skewed(NumNames)));
+			tokens.push_back(PPToken{PP_IDENTIFIER, true, false, spellings.intern(text.back()), EmptyHideSet});
+		}
+
+		double m = NumTokens / 1e6;
+		size_t hits[2] = { 0, 0 };
+		double seconds[2];
+
+		// keyed by spelling
+		{
+			unordered_map<string, StringMacro> macros;
+			Random d;
+
+			auto start = chrono::steady_clock::now();
+
+			for (size_t i = 0; i < text.size(); i++)
+			{
+				if (i % 64 == 0)
+				{
+					string name = Name(d.skewed(NumNames));
+
+					if (d.below(2))
+						macros[name] = StringMacro{false, {}, {"1", "+", name}};
+					else
+						macros.erase(name);
+				}
+
+				hits[0] += macros.count(text[i]);
+			}
+
+			seconds[0] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		}
+
+		// keyed by id
+		{
+			MacroTable macros;
+			Random d;
+			vector<vector<PPToken>> definitions(NumNames);
+			vector<uint32_t> names(NumNames);
+
+			// the directives, tokenized (and so interned) as the text is
+			for (size_t k = 0; k < NumNames; k++)
+			{
+				definitions[k] = Lex(spellings, Name(k) + " 1 + " + Name(k));
+				names[k] = definitions[k][0].spelling;
+			}
+
+			auto start = chrono::steady_clock::now();
+
+			for (size_t i = 0; i < tokens.size(); i++)
+			{
+				if (i % 64 == 0)
+				{
+					size_t k = d.skewed(NumNames);
+
+					if (d.below(2))
+						macros.define(definitions[k].data(), definitions[k].data() + definitions[k].size());
+					else
+						macros.undefine(names[k]);
+				}
+
+				hits[1] += macros.find(tokens[i].spelling) != nullptr;
+			}
+
+			seconds[1] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		}
+
+		if (hits[0] != hits[1])
+			throw runtime_error("lookup mismatch");
+
+		cout << "macro lookups of " << m << "M identifiers (" << hits[0] << " of them macros), #define or #undef every 64" << endl;
+		cout << "  keyed by spelling: " << seconds[0] << " s, " << m / seconds[0] << " M/s" << endl;
+		cout << "  keyed by id:       " << seconds[1] << " s, " << m / seconds[1] << " M/s" << endl;
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
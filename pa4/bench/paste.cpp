@@ -0,0 +1,382 @@
+// paste: ## and # building their spellings in place in the SpellingTable,
+// checked, then timed against building them in a std::string and interning
+// that, and over a generated header that does 1M pastes
+//
+// The header pastes the names of a 4096-entry table with 16 suffixes, so
+// each of its 65536 results is pasted 15 or 16 times, as in code generated
+// with X-macros.
+//
+// usage: bench/paste
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../MacroExpander.h"
+
+struct PasteCase
+{
+	const char* left;
+	const char* right;
+
+	// spelling and kind of the result, or nullptr if invalid
+	const char* result;
+	EPPTokenKind kind;
+};
+
+const PasteCase PasteCases[] =
+{
+	{ "x", "y", "xy", PP_IDENTIFIER },
+	{ "x", "1", "x1", PP_IDENTIFIER },
+	{ "1", "x", "1x", PP_NUMBER },
+	{ "1e", "+", "1e+", PP_NUMBER },
+	{ "1", "+", nullptr, PP_NUMBER },
+	{ "1", "e5", "1e5", PP_NUMBER },
+	{ ".", "5", ".5", PP_NUMBER },
+	{ "<", "<=", "<<=", PP_OP_OR_PUNC },
+	{ "-", ">", "->", PP_OP_OR_PUNC },
+	{ "#", "#", "##", PP_OP_OR_PUNC },
+	{ "%:", "%:", "%:%:", PP_OP_OR_PUNC },
+	{ "+", "-", nullptr, PP_OP_OR_PUNC },
+	{ "/", "/", nullptr, PP_OP_OR_PUNC },
+	{ "L", "\"x\"", "L\"x\"", PP_STRING_LITERAL },
+	{ "u8", "\"x\"", "u8\"x\"", PP_STRING_LITERAL },
+	{ "u8", "'x'", nullptr, PP_CHARACTER_LITERAL },
+	{ "U", "'x'", "U'x'", PP_CHARACTER_LITERAL },
+	{ "\"x\"", "_s", "\"x\"_s", PP_USER_DEFINED_STRING_LITERAL },
+	{ "'x'", "_c", "'x'_c", PP_USER_DEFINED_CHARACTER_LITERAL },
+	{ "\"x\"", "\"y\"", nullptr, PP_STRING_LITERAL },
+	{ "R", "\"d(x)d\"", "R\"d(x)d\"", PP_STRING_LITERAL },
+};
+
+void CheckPaste()
+{
+	SpellingTable spellings;
+
+	for (const PasteCase& c : PasteCases)
+	{
+		uint32_t left = spellings.intern(c.left, strlen(c.left));
+		uint32_t right = spellings.intern(c.right, strlen(c.right));
+
+		size_t size = spellings.size();
+		uint32_t spelling;
+		EPPTokenKind kind;
+
+		bool valid = PasteSpellings(spellings, left, right, spelling, kind);
+
+		if (valid != (c.result != nullptr) || (valid && (spellings.str(spelling) != c.result || kind != c.kind)))
+			throw runtime_error(string("bad paste of ") + c.left + " and " + c.right);
+
+		// a paste interns only its result, and once
+		if (spellings.size() != size + (valid && spelling == size))
+			throw runtime_error(string("paste of ") + c.left + " and " + c.right + " interned more than its result");
+
+		if (valid && (!PasteSpellings(spellings, left, right, spelling, kind) || spellings.size() != size + (spelling == size)))
+			throw runtime_error("repeated paste interned again");
+
+		// the table is intact after an abandoned paste
+		if (spellings.str(right) != c.right || spellings.intern(c.left, strlen(c.left)) != left)
+			throw runtime_error("paste damaged the spelling table");
+	}
+}
+
+// a definition of s on one line and an invocation, and the string-literal
+// it expands to
+const char* const StringizeCases[][2] =
+{
+	{ "#define s(x) #x\ns( a  +\tb )\n", "\"a + b\"" },
+	{ "#define s(x) #x\ns(\"a\\n\" 'b' '\\'')\n", "\"\\\"a\\\\n\\\" 'b' '\\\\''\"" },
+	{ "#define s(x) #x\ns()\n", "\"\"" },
+	{ "#define s(x) #x\ns(L\"x\" u8\"y\"_z)\n", "\"L\\\"x\\\" u8\\\"y\\\"_z\"" },
+};
+
+void CheckStringize()
+{
+	for (auto& c : StringizeCases)
+	{
+		SpellingTable spellings;
+		MacroTable macros;
+		HideSetTable hide_sets;
+
+		const char* text = strchr(c[0], '\n') + 1;
+		string definition(c[0] + strlen("#define "), text - 1);
+
+		vector<PPToken> tokens;
+		vector<PPToken> definition_tokens;
+
+		// longest spellings that are one token, which is enough for these
+		auto lex = [&](const string& s, vector<PPToken>& out)
+		{
+			for (size_t i = 0; i < s.size(); )
+			{
+				bool space = false;
+
+				while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\n'))
+					space = true, i++;
+
+				if (i == s.size())
+					break;
+
+				size_t n = 1;
+				EPPTokenKind kind = PP_NON_WHITESPACE_CHAR;
+
+				for (size_t m = s.size() - i; m > 0; m--)
+				{
+					if (RetokenizeSingle(s.data() + i, m, kind))
+					{
+						n = m;
+						break;
+					}
+				}
+
+				out.push_back(PPToken{kind, space, false, spellings.intern(s.data() + i, n), EmptyHideSet});
+				i += n;
+			}
+		};
+
+		lex(definition, definition_tokens);
+		lex(text, tokens);
+		macros.define(definition_tokens.data(), definition_tokens.data() + definition_tokens.size());
+
+		PPTokenSpanSource source = { tokens.data(), tokens.data() + tokens.size() };
+		MacroExpander<PPTokenSpanSource> expander(source, macros, hide_sets, spellings);
+
+		PPToken token;
+
+		if (!expander.next(token) || spellings.str(token.spelling) != c[1] || token.kind != PP_STRING_LITERAL || expander.next(token))
+			throw runtime_error(string("bad stringizing of:\n") + c[0]);
+	}
+}
+
+// ## as before: the spellings concatenated in a std::string, retokenized
+// there, and interned from it
+bool StringPaste(SpellingTable& spellings, uint32_t left, uint32_t right, string& scratch, uint32_t& spelling, EPPTokenKind& kind)
+{
+	scratch.assign(spellings.spelling_data(left), spellings.spelling_size(left));
+	scratch.append(spellings.spelling_data(right), spellings.spelling_size(right));
+
+	if (!RetokenizeSingle(scratch.data(), scratch.size(), kind))
+		return false;
+
+	spelling = spellings.intern(scratch);
+	return true;
+}
+
+// ## with a fresh std::string per paste (a new tokenizer per paste would be
+// slower still)
+bool FreshStringPaste(SpellingTable& spellings, uint32_t left, uint32_t right, uint32_t& spelling, EPPTokenKind& kind)
+{
+	string s = spellings.str(left) + spellings.str(right);
+
+	if (!RetokenizeSingle(s.data(), s.size(), kind))
+		return false;
+
+	spelling = spellings.intern(s);
+	return true;
+}
+
+const size_t NumPastes = 1000000;
+
+// operands of the generated header: a family of identifiers pasted with
+// numbers, then punctuators and literal prefixes
+const char* const Operands[][2] =
+{
+	{ "<", "<=" }, { "-", ">" }, { ">", ">=" }, { "&", "&" }, { "|", "=" }, { "#", "#" },
+	{ "L", "\"x\"" }, { "u8", "\"path\"" }, { "'c'", "_ch" }, { "1", "e5" }, { "0x", "1f" }, { ".", "5" },
+};
+
+const size_t NumOperands = sizeof(Operands) / sizeof(Operands[0]);
+
+// operands of the i-th line of the header
+string FamilyOperand(size_t i) { return "f" + to_string(i % 4096) + "_"; }
+string SuffixOperand(size_t i) { return to_string(i / 4096 % 16); }
+
+// a header of NumPastes / 2 lines `P(f<k>_, <j>) P(<left>, <right>)`
+string PasteHeader()
+{
+	string header = "#define P(a, b) a ## b\n";
+
+	for (size_t i = 0; i < NumPastes / 2; i++)
+	{
+		const char* const* operands = Operands[i % NumOperands];
+		header += "P(" + FamilyOperand(i) + ", " + SuffixOperand(i) + ") P(" + operands[0] + ", " + operands[1] + ")\n";
+	}
+
+	return header;
+}
+
+// tokens of `text`: the header has no comments or splices, and its
+// literals are never next to each other
+vector<PPToken> LexHeader(SpellingTable& spellings, const string& text)
+{
+	vector<PPToken> tokens;
+	bool space = false;
+
+	for (size_t i = 0; i < text.size(); )
+	{
+		if (text[i] == ' ' || text[i] == '\n')
+		{
+			space = true;
+			i++;
+			continue;
+		}
+
+		size_t n = 1;
+		EPPTokenKind kind = PP_NON_WHITESPACE_CHAR;
+
+		for (size_t m = min<size_t>(8, text.size() - i); m > 0; m--)
+		{
+			if (RetokenizeSingle(text.data() + i, m, kind))
+			{
+				n = m;
+				break;
+			}
+		}
+
+		tokens.push_back(PPToken{kind, space, false, spellings.intern(text.data() + i, n), EmptyHideSet});
+		space = false;
+		i += n;
+	}
+
+	return tokens;
+}
+
+template<typename Paste>
+double TimePastes(const vector<pair<uint32_t, uint32_t>>& pairs, uint64_t& checksum, Paste paste)
+{
+	auto start = chrono::steady_clock::now();
+
+	for (const pair<uint32_t, uint32_t>& p : pairs)
+	{
+		uint32_t spelling;
+		EPPTokenKind kind;
+
+		if (!paste(p.first, p.second, spelling, kind))
+			throw runtime_error("invalid paste");
+
+		checksum += spelling + kind;
+	}
+
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+	try
+	{
+		CheckPaste();
+		CheckStringize();
+
+		cout << "pastes and stringizing check out" << endl;
+
+		string header = PasteHeader();
+
+		// the operands of every ## of the header
+		SpellingTable spellings;
+		vector<pair<uint32_t, uint32_t>> pairs;
+
+		for (size_t i = 0; i < NumPastes / 2; i++)
+		{
+			const char* const* operands = Operands[i % NumOperands];
+
+			pairs.emplace_back(spellings.intern(FamilyOperand(i)), spellings.intern(SuffixOperand(i)));
+			pairs.emplace_back(spellings.intern(operands[0], strlen(operands[0])), spellings.intern(operands[1], strlen(operands[1])));
+		}
+
+		// the same pastes four ways, each into its own copy of the table
+		SpellingTable tables[4] = { spellings, spellings, spellings, spellings };
+		PasteTable pastes;
+		string scratch;
+
+		const char* const names[4] = { "PasteTable:           ", "in place:             ", "reused std::string:   ", "std::string per paste:" };
+		double seconds[4];
+		uint64_t checksums[4] = { 0, 0, 0, 0 };
+
+		seconds[0] = TimePastes(pairs, checksums[0], [&](uint32_t left, uint32_t right, uint32_t& spelling, EPPTokenKind& kind)
+		{
+			return pastes.paste(tables[0], left, right, spelling, kind);
+		});
+
+		seconds[1] = TimePastes(pairs, checksums[1], [&](uint32_t left, uint32_t right, uint32_t& spelling, EPPTokenKind& kind)
+		{
+			return PasteSpellings(tables[1], left, right, spelling, kind);
+		});
+
+		seconds[2] = TimePastes(pairs, checksums[2], [&](uint32_t left, uint32_t right, uint32_t& spelling, EPPTokenKind& kind)
+		{
+			return StringPaste(tables[2], left, right, scratch, spelling, kind);
+		});
+
+		seconds[3] = TimePastes(pairs, checksums[3], [&](uint32_t left, uint32_t right, uint32_t& spelling, EPPTokenKind& kind)
+		{
+			return FreshStringPaste(tables[3], left, right, spelling, kind);
+		});
+
+		if (count(checksums, checksums + 4, checksums[0]) != 4)
+			throw runtime_error("paste checksum mismatch");
+
+		cout << pairs.size() << " pastes, " << tables[0].size() - spellings.size() << " distinct results" << endl;
+
+		for (int i = 0; i < 4; i++)
+			cout << "  " << names[i] << " " << seconds[i] << " s, " << pairs.size() / seconds[i] / 1e6 << " M pastes/s" << endl;
+
+		// the header, end to end
+		SpellingTable header_spellings;
+		MacroTable macros;
+		HideSetTable hide_sets;
+
+		vector<PPToken> tokens = LexHeader(header_spellings, header.substr(header.find('\n') + 1));
+		vector<PPToken> definition = LexHeader(header_spellings, "P(a, b) a ## b");
+		macros.define(definition.data(), definition.data() + definition.size());
+
+		PPTokenSpanSource source = { tokens.data(), tokens.data() + tokens.size() };
+		MacroExpander<PPTokenSpanSource> expander(source, macros, hide_sets, header_spellings);
+
+		size_t ntokens = 0;
+		PPToken token;
+
+		auto start = chrono::steady_clock::now();
+
+		while (expander.next(token))
+		{
+			if (ntokens < 2 * NumOperands)
+			{
+				size_t i = ntokens / 2;
+				string expected = ntokens % 2 == 0 ? FamilyOperand(i) + SuffixOperand(i) : string(Operands[i][0]) + Operands[i][1];
+
+				if (header_spellings.str(token.spelling) != expected)
+					throw runtime_error("header expands to " + header_spellings.str(token.spelling) + ", expected " + expected);
+			}
+
+			ntokens++;
+		}
+
+		double header_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		if (ntokens != NumPastes)
+			throw runtime_error("header expands to " + to_string(ntokens) + " tokens");
+
+		const double MaxSeconds = 1.0;
+
+		cout << "header of " << NumPastes << " pastes expanded in " << header_seconds << " s, " << NumPastes / header_seconds / 1e6 << " M pastes/s" << endl;
+
+		if (header_seconds > MaxSeconds)
+			throw runtime_error("header over time budget");
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -1,7 +1,29 @@
 // (C) 2013 CPPGM Foundation www.cppgm.org.  All rights reserved.
 
+#include <string>
+#include <ostream>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <chrono>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+
+using namespace std;
+
+#include "MacroExpander.h"
+
 int main()
 {
 	// TODO: Implement macro as per PA4 assignment description
+	//
+	// Intern the spelling of every preprocessing token as it is produced
+	// (see SpellingTable.h), keep the defined macros in a MacroTable, and
+	// hand `# define` and `# undef` directives to MacroTable::define and
+	// MacroTable::undefine.  Pull the tokens of each text-sequence through a
+	// MacroExpander over the PA1 tokens and feed them one at a time to the
+	// PA2 post-tokenizer.
 }
-
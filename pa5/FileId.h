@@ -0,0 +1,87 @@
+#pragma once
+
+// bootstrap system call interface, used by PA5GetFileId
+extern "C" long int syscall(long int n, ...) throw ();
+
+// For pragma once implementation:
+// system-wide unique file id type `PA5FileId`
+typedef pair<unsigned long int, unsigned long int> PA5FileId;
+
+// PA5GetFileId returns true iff file found at path `path`.
+// out parameter `out_fileid` is set to file id
+inline bool PA5GetFileId(const string& path, PA5FileId& out_fileid)
+{
+	struct
+	{
+			unsigned long int dev;
+			unsigned long int ino;
+			long int unused[16];
+	} data;
+
+	int res = syscall(4, path.c_str(), &data);
+
+	out_fileid = make_pair(data.dev, data.ino);
+
+	return res == 0;
+}
+
+struct PA5FileIdHash
+{
+	size_t operator()(const PA5FileId& id) const
+	{
+		return (id.first * 0x9E3779B97F4A7C15ULL) ^ id.second;
+	}
+};
+
+// PA5FileStamp: a file and the version of its contents, as far as stat(2)
+// tells: it changes when the file is written (the size too, as mtime may
+// only have the resolution of a clock tick)
+struct PA5FileStamp
+{
+	PA5FileId id;
+	long int size;
+	long int mtime_sec;
+	long int mtime_nsec;
+
+	bool operator==(const PA5FileStamp& that) const
+	{
+		return id == that.id && size == that.size && mtime_sec == that.mtime_sec && mtime_nsec == that.mtime_nsec;
+	}
+
+	bool operator!=(const PA5FileStamp& that) const
+	{
+		return !(*this == that);
+	}
+};
+
+// PA5GetFileStamp returns true iff file found at path `path`.
+// out parameter `out_stamp` is set to its stamp
+inline bool PA5GetFileStamp(const string& path, PA5FileStamp& out_stamp)
+{
+	// struct stat of x86_64
+	struct
+	{
+		unsigned long int dev;
+		unsigned long int ino;
+		unsigned long int nlink;
+		unsigned int mode;
+		unsigned int uid;
+		unsigned int gid;
+		unsigned int pad;
+		unsigned long int rdev;
+		long int size;
+		long int blksize;
+		long int blocks;
+		long int atime_sec;
+		long int atime_nsec;
+		long int mtime_sec;
+		long int mtime_nsec;
+		long int unused[5];
+	} data;
+
+	if (syscall(/* stat */ 4, path.c_str(), &data) != 0)
+		return false;
+
+	out_stamp = PA5FileStamp{make_pair(data.dev, data.ino), data.size, data.mtime_sec, data.mtime_nsec};
+	return true;
+}
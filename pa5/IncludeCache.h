@@ -0,0 +1,86 @@
+#pragma once
+
+#include "FileId.h"
+
+// IncludeCache: source files after translation phases 1-3, by file
+//
+// One preproc run preprocesses many source files, which mostly include the
+// same headers.  The cache keeps each file's preprocessing tokens for the
+// rest of the run, keyed by PA5FileId, so a header included by 500 source
+// files (or by one, 500 times) is read and tokenized once.  The file is
+// stat(2)ed on every lookup, and tokenized again if its PA5FileStamp has
+// changed since.
+//
+// `Tokens` is what phases 1-3 make of a file.  Entries are shared_ptrs, so
+// tokens being preprocessed stay valid if their file is reloaded meanwhile.
+//
+// preproc reads the #include files of all its source files through one
+// cache, shared by the threads of `preproc -j`: lookups lock it, but
+// tokenizing does not, so two threads missing the same file at once may
+// both tokenize it (and both count a miss).
+template<typename Tokens>
+struct IncludeCache
+{
+	IncludeCache()
+		: hits(0), misses(0), reloads(0)
+	{}
+
+	// lookups answered from the cache
+	size_t hits;
+
+	// lookups that tokenized the file, of which `reloads` because it
+	// changed since it was cached
+	size_t misses;
+	size_t reloads;
+
+	// tokens of the file at `path`, from `tokenize(path)` unless cached
+	//
+	// Returns nullptr if there is no file at `path`.
+	template<typename Tokenize>
+	shared_ptr<const Tokens> get(const string& path, Tokenize tokenize)
+	{
+		PA5FileStamp stamp;
+
+		if (!PA5GetFileStamp(path, stamp))
+			return nullptr;
+
+		bool cached;
+
+		{
+			lock_guard<mutex> lock(entries_mutex);
+			auto it = entries.find(stamp.id);
+			cached = it != entries.end();
+
+			if (cached && it->second.stamp == stamp)
+			{
+				hits++;
+				return it->second.tokens;
+			}
+		}
+
+		shared_ptr<const Tokens> tokens = make_shared<const Tokens>(tokenize(path));
+
+		lock_guard<mutex> lock(entries_mutex);
+		misses++;
+		reloads += cached;
+		entries[stamp.id] = Entry{stamp, tokens};
+		return tokens;
+	}
+
+	// number of files cached
+	size_t size() const
+	{
+		lock_guard<mutex> lock(entries_mutex);
+		return entries.size();
+	}
+
+private:
+	struct Entry
+	{
+		PA5FileStamp stamp;
+		shared_ptr<const Tokens> tokens;
+	};
+
+	mutable mutex entries_mutex;
+	unordered_map<PA5FileId, Entry, PA5FileIdHash> entries;
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "FileId.h"
+
+// Multiple-include optimization
+//
+// Most headers are guarded:
+//
+//     #ifndef X
+//     #define X
+//     ...
+//     #endif
+//
+// and including one again while X is defined has no effect.  While a file
+// is preprocessed, an IncludeGuardDetector is told about its lines and
+// finds whether the whole file is one such group; if so the file's
+// controlling macro (X) is recorded in IncludeGuards under its PA5FileId,
+// and later #includes of the file are skipped without opening it while X
+// is defined.  `#if !defined X` and `#if !defined(X)` are guards too, and
+// so are files whose first inclusion found X defined already.
+
+// IncludeGuardDetector: finds the controlling macro of one file
+//
+// Every line of the file is reported, including those of skipped groups,
+// except empty lines and null directives, which do not affect the result:
+// #if, #ifdef and #ifndef to conditional(), #elif and #else to
+// alternative(), #endif to endif(), and any other line to other().
+struct IncludeGuardDetector
+{
+	IncludeGuardDetector()
+		: state(Start), depth(0)
+	{}
+
+	// `macro` is X for `#ifndef X` and `#if !defined X`, empty otherwise
+	void conditional(const string& macro)
+	{
+		if (state == Start && !macro.empty())
+		{
+			state = Guarded;
+			controlling_macro = macro;
+		}
+		else if (state != Guarded)
+			state = Invalid;
+
+		depth++;
+	}
+
+	void alternative()
+	{
+		if (state == Guarded && depth == 1)
+			state = Invalid;
+	}
+
+	void endif()
+	{
+		if (--depth == 0 && state == Guarded)
+			state = Closed;
+	}
+
+	void other()
+	{
+		if (depth == 0)
+			state = Invalid;
+	}
+
+	// the controlling macro at the end of the file, if it has one
+	const string* guard() const
+	{
+		return state == Closed ? &controlling_macro : nullptr;
+	}
+
+private:
+	enum
+	{
+		Start,      // nothing but empty lines so far
+		Guarded,    // in the group of the first conditional, an #ifndef
+		Closed,     // ...which has ended, with nothing but empty lines after
+		Invalid     // not a guarded file
+	} state;
+
+	size_t depth;
+	string controlling_macro;
+};
+
+// IncludeGuards: controlling macros of the files seen so far
+//
+// Whether a controlling macro is defined depends on the macros of one
+// source file, so like the macro table there is one IncludeGuards per
+// source file, consulted before an #include looks in the IncludeCache.
+struct IncludeGuards
+{
+	IncludeGuards()
+		: skips(0)
+	{}
+
+	// #includes skipped
+	size_t skips;
+
+	void record(const PA5FileId& file, const string& macro)
+	{
+		guards[file] = macro;
+	}
+
+	// true iff an #include of `file` can be skipped, `defined(name)` telling
+	// whether macro `name` is defined
+	template<typename Defined>
+	bool skip(const PA5FileId& file, Defined defined)
+	{
+		auto it = guards.find(file);
+
+		if (it == guards.end() || !defined(it->second))
+			return false;
+
+		skips++;
+		return true;
+	}
+
+	size_t size() const { return guards.size(); }
+
+private:
+	unordered_map<PA5FileId, string, PA5FileIdHash> guards;
+};
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "FileId.h"
+
+// Include file lookup
+//
+// An #include of `nextf` from a file in directory `dir` tries `dir` +
+// `nextf`, then `nextf`, then `nextf` in each of the search paths (with
+// --stdinc, PA5StdIncPaths), and takes the first that exists.  Probing each
+// candidate with a stat(2) costs a failing system call per directory tried
+// for most system headers, every time they are included.
+//
+// Instead each directory is listed once, with getdents64(2), into a hash
+// set of its entries, and a candidate is only stat(2)ed (for its
+// PA5FileId) if its directory has it.  Directories that cannot be opened
+// are remembered as empty.  The result of each (dir, nextf) lookup is
+// remembered too, so a header included by many files is looked up once.
+// Directories are assumed not to change during a run.
+
+// IncludeStats: system calls of include lookups
+struct IncludeStats
+{
+	// lookups, and those answered from the remembered results
+	size_t lookups;
+	size_t memoized;
+
+	// system calls made
+	size_t stat;
+	size_t open;
+	size_t getdents64;
+	size_t close;
+
+	// stat(2) calls probing every candidate of every lookup would have made
+	size_t probes;
+
+	size_t syscalls() const { return stat + open + getdents64 + close; }
+
+	void write(ostream& out) const
+	{
+		out << "include lookups: " << lookups << " (" << memoized << " memoized)" << endl;
+		out << "  system calls probing each candidate: " << probes << " stat" << endl;
+		out << "  system calls made: " << syscalls() << " (" << stat << " stat, " << open << " open, "
+			<< getdents64 << " getdents64, " << close << " close)" << endl;
+	}
+};
+
+// DirectoryCache: names in directories, each listed once
+struct DirectoryCache
+{
+	explicit DirectoryCache(IncludeStats& stats)
+		: stats(stats)
+	{}
+
+	// entries of directory `dir` ("" for the current directory), none if
+	// it cannot be opened
+	const unordered_set<string>& list(const string& dir)
+	{
+		auto it = directories.find(dir);
+
+		if (it != directories.end())
+			return it->second;
+
+		unordered_set<string>& entries = directories[dir];
+
+		stats.open++;
+		int fd = syscall(/* open */ 2, dir.empty() ? "." : dir.c_str(), /* O_RDONLY | O_DIRECTORY */ 0200000);
+
+		if (fd < 0)
+			return entries;
+
+		// struct linux_dirent64
+		struct Entry
+		{
+			uint64_t ino;
+			int64_t off;
+			unsigned short reclen;
+			unsigned char type;
+			char name[1];
+		};
+
+		alignas(8) char buffer[32 * 1024];
+
+		for (;;)
+		{
+			stats.getdents64++;
+			long int n = syscall(/* getdents64 */ 217, fd, buffer, sizeof buffer);
+
+			if (n <= 0)
+				break;
+
+			for (long int i = 0; i < n; )
+			{
+				const Entry* entry = (const Entry*) (buffer + i);
+				entries.insert(entry->name);
+				i += entry->reclen;
+			}
+		}
+
+		stats.close++;
+		syscall(/* close */ 3, fd);
+		return entries;
+	}
+
+	// true iff there may be a file at `path`: its directory lists it
+	bool has(const string& path)
+	{
+		size_t slash = path.rfind('/');
+
+		if (slash == string::npos)
+			return list("").count(path) != 0;
+
+		return list(path.substr(0, slash + 1)).count(path.substr(slash + 1)) != 0;
+	}
+
+private:
+	IncludeStats& stats;
+	unordered_map<string, unordered_set<string>> directories;
+};
+
+// IncludeResolver: include file lookup through a DirectoryCache
+//
+// preproc makes one resolver for the run, which #include directives of all
+// source files look up their files in.  It is shared by the threads of
+// `preproc -j`: lookups lock it.
+struct IncludeResolver
+{
+	explicit IncludeResolver(const vector<string>& search_paths)
+		: search_paths(search_paths), stats{0, 0, 0, 0, 0, 0, 0}, directory_cache(stats)
+	{}
+
+	vector<string> search_paths;
+	IncludeStats stats;
+
+	// look up `nextf` included from a file in `dir` ("" or ending in /)
+	//
+	// Returns true iff found, with `out_path` the path of the include file
+	// (the new __FILE__) and `out_fileid` its PA5FileId.
+	bool resolve(const string& dir, const string& nextf, string& out_path, PA5FileId& out_fileid)
+	{
+		lock_guard<mutex> lock(resolver_mutex);
+		stats.lookups++;
+
+		string key = dir + '\n' + nextf;
+		auto it = resolved.find(key);
+
+		if (it != resolved.end())
+		{
+			stats.memoized++;
+			stats.probes += it->second.probes;
+			out_path = it->second.path;
+			out_fileid = it->second.fileid;
+			return it->second.found;
+		}
+
+		Result& result = resolved[key] = Result{};
+
+		for (const string& candidate : candidates(dir, nextf))
+		{
+			result.probes++;
+
+			if (!directory_cache.has(candidate))
+				continue;
+
+			stats.stat++;
+
+			if (PA5GetFileId(candidate, result.fileid))
+			{
+				result.found = true;
+				result.path = candidate;
+				break;
+			}
+		}
+
+		stats.probes += result.probes;
+		out_path = result.path;
+		out_fileid = result.fileid;
+		return result.found;
+	}
+
+	// paths tried for `nextf` included from `dir`, in order
+	vector<string> candidates(const string& dir, const string& nextf) const
+	{
+		if (!nextf.empty() && nextf[0] == '/')
+			return { nextf };
+
+		vector<string> paths;
+
+		if (!dir.empty())
+			paths.push_back(dir + nextf);
+
+		paths.push_back(nextf);
+
+		for (const string& search_path : search_paths)
+			paths.push_back(search_path + nextf);
+
+		return paths;
+	}
+
+private:
+	struct Result
+	{
+		bool found;
+		string path;
+		PA5FileId fileid;
+		size_t probes;
+	};
+
+	mutex resolver_mutex;
+	DirectoryCache directory_cache;
+	unordered_map<string, Result> resolved;
+};
+
+// ResolveByProbing: IncludeResolver::resolve without the caches, making a
+// stat(2) per candidate
+inline bool ResolveByProbing(const IncludeResolver& resolver, const string& dir, const string& nextf, string& out_path, PA5FileId& out_fileid)
+{
+	for (const string& candidate : resolver.candidates(dir, nextf))
+	{
+		if (PA5GetFileId(candidate, out_fileid))
+		{
+			out_path = candidate;
+			return true;
+		}
+	}
+
+	return false;
+}
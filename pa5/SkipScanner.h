@@ -0,0 +1,243 @@
+#pragma once
+
+// Skip-mode scanning of inactive #if groups
+//
+// Inside an inactive group only the conditional directives matter: their
+// names are needed to find the end of the group and to check the nested
+// groups are ordered, and everything else is ignored.  Rather than running
+// the tokenizer over it, the scanner jumps from new-line to new-line with
+// memchr, and looks at the start of each line for a `#` (or `%:`).
+//
+// It must still step over what can hide a new-line or a `#` at the start of
+// a line: line splices, block comments, and raw string literals, and over
+// the other literals and // comments, which can hide the start of those.
+// A line with no `*` and no `"` (most lines) cannot start a block comment
+// or a raw string, so unless a splice continues it, it is skipped with
+// those two memchrs and one for the new-line; only the other lines are
+// scanned a character at a time.
+
+enum ESkipDirective
+{
+	SKIP_IF,        // #if, #ifdef or #ifndef
+	SKIP_ELIF,
+	SKIP_ELSE,
+	SKIP_ENDIF,
+	SKIP_END        // end of file
+};
+
+// position just past horizontal white space, line splices and comments
+// from `p`
+inline const char* SkipScanSpace(const char* p, const char* end)
+{
+	while (p != end)
+	{
+		if (*p == ' ' || *p == '\t' || *p == '\v' || *p == '\f' || *p == '\r')
+			p++;
+		else if (*p == '\\' && p + 1 != end && p[1] == '\n')
+			p += 2;
+		else if (*p == '/' && p + 1 != end && p[1] == '*')
+		{
+			const char* q = p + 2;
+
+			for (; q != end; q++)
+				if (*q == '/' && q[-1] == '*' && q - 2 != p)
+					break;
+
+			p = q == end ? end : q + 1;
+		}
+		else
+			break;
+	}
+
+	return p;
+}
+
+inline bool IsSkipIdentifierCharacter(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// true iff the `n` characters at `s` are R, u8R, uR, UR or LR
+inline bool IsRawStringPrefix(const char* s, size_t n)
+{
+	return (n == 1 && s[0] == 'R') ||
+		(n == 2 && s[1] == 'R' && (s[0] == 'u' || s[0] == 'U' || s[0] == 'L')) ||
+		(n == 3 && s[0] == 'u' && s[1] == '8' && s[2] == 'R');
+}
+
+// position just past the end of the logical line containing `p` (the
+// new-line ending it, or `end`), stepping over what spans new-lines
+inline const char* SkipScanLine(const char* p, const char* end)
+{
+	const char* nl = (const char*) memchr(p, '\n', end - p);
+	const char* line_end = nl ? nl : end;
+
+	// fast path: no comment or raw string can start on this line, and it is
+	// not continued by a splice (the next line could be the rest of a //
+	// comment, which the scan below has to know)
+	if (!memchr(p, '*', line_end - p) && !memchr(p, '"', line_end - p))
+	{
+		if (!nl)
+			return end;
+
+		if (nl == p || nl[-1] != '\\')
+			return nl + 1;
+	}
+
+	while (p != end)
+	{
+		char c = *p;
+
+		if (c == '\n')
+			return p + 1;
+
+		if (c == '\\' && p + 1 != end && p[1] == '\n')
+		{
+			p += 2;
+		}
+		else if (c == '/' && p + 1 != end && p[1] == '/')
+		{
+			// to the end of the line, which a splice continues
+			for (p += 2; p != end && !(*p == '\n' && p[-1] != '\\'); p++)
+				;
+		}
+		else if (c == '/' && p + 1 != end && p[1] == '*')
+		{
+			p = SkipScanSpace(p, end);
+		}
+		else if (IsSkipIdentifierCharacter(c))
+		{
+			const char* identifier = p;
+
+			while (p != end && IsSkipIdentifierCharacter(*p))
+				p++;
+
+			if (p == end || *p != '"' || !IsRawStringPrefix(identifier, p - identifier))
+				continue;
+
+			// raw string literal: R"delimiter( ... )delimiter"
+			const char* open = (const char*) memchr(p, '(', min<ptrdiff_t>(end - p, 18));
+
+			if (!open)
+				continue;
+
+			string close = ")" + string(p + 1, open) + "\"";
+			const char* q = search(open + 1, end, close.begin(), close.end());
+			p = q == end ? end : q + close.size();
+		}
+		else if (c == '"' || c == '\'')
+		{
+			// to the closing quote, or the end of the line if unterminated
+			for (p++; p != end && *p != c && *p != '\n'; p++)
+				if (*p == '\\' && p + 1 != end)
+					p++;
+
+			if (p != end && *p == c)
+				p++;
+		}
+		else
+			p++;
+	}
+
+	return end;
+}
+
+// SkipScanNext: the next conditional directive from the start of a line `p`
+//
+// Returns its kind, with `line` set to the start of its line, or SKIP_END
+// with `line` set to `end`.  `next` is set to the start of the line after.
+inline ESkipDirective SkipScanNext(const char* p, const char* end, const char*& line, const char*& next)
+{
+	while (p != end)
+	{
+		line = p;
+		const char* q = SkipScanSpace(p, end);
+
+		if (q != end && (*q == '#' || (*q == '%' && q + 1 != end && q[1] == ':')))
+		{
+			q = SkipScanSpace(q + (*q == '#' ? 1 : 2), end);
+
+			// the directive name, which splices may be in the middle of
+			char name[8];
+			size_t n = 0;
+
+			for (; q != end; q++)
+			{
+				if (*q == '\\' && q + 1 != end && q[1] == '\n')
+					q++;
+				else if (IsSkipIdentifierCharacter(*q) && n < sizeof name - 1)
+					name[n++] = *q;
+				else
+					break;
+			}
+
+			name[n] = '\0';
+			next = SkipScanLine(q, end);
+
+			if (strcmp(name, "if") == 0 || strcmp(name, "ifdef") == 0 || strcmp(name, "ifndef") == 0)
+				return SKIP_IF;
+			else if (strcmp(name, "elif") == 0)
+				return SKIP_ELIF;
+			else if (strcmp(name, "else") == 0)
+				return SKIP_ELSE;
+			else if (strcmp(name, "endif") == 0)
+				return SKIP_ENDIF;
+
+			p = next;
+		}
+		else
+			p = SkipScanLine(q, end);
+	}
+
+	line = next = end;
+	return SKIP_END;
+}
+
+// SkipGroup: skip an inactive group starting at the start of a line `p`
+//
+// Returns the directive ending it (#elif, #else or #endif, at the same
+// nesting as the group), with `line` set to the start of its line, or
+// SKIP_END.  `next` is set to the start of the line after.  Groups nested
+// in it are checked for an #elif or #else after their #else.
+//
+// The preprocessor calls it for each group whose condition is false (and
+// each group after a taken one), in place of the tokenizer.
+inline ESkipDirective SkipGroup(const char* p, const char* end, const char*& line, const char*& next)
+{
+	// for each nested group, whether its #else was seen
+	vector<bool> nested;
+
+	for (;;)
+	{
+		ESkipDirective directive = SkipScanNext(p, end, line, next);
+		p = next;
+
+		switch (directive)
+		{
+		case SKIP_IF:
+			nested.push_back(false);
+			break;
+
+		case SKIP_ELIF:
+		case SKIP_ELSE:
+			if (nested.empty())
+				return directive;
+
+			if (nested.back())
+				throw runtime_error(directive == SKIP_ELIF ? "#elif after #else" : "#else after #else");
+
+			nested.back() = directive == SKIP_ELSE;
+			break;
+
+		case SKIP_ENDIF:
+			if (nested.empty())
+				return directive;
+
+			nested.pop_back();
+			break;
+
+		case SKIP_END:
+			return directive;
+		}
+	}
+}
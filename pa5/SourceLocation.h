@@ -0,0 +1,188 @@
+#pragma once
+
+// Source locations
+//
+// __FILE__, __LINE__ and diagnostics need to know where each token came
+// from, and the tokens of a translation unit flow on through PA6-PA9, so
+// what a token carries for it is paid for a million times over.  Rather
+// than a file name and a line (or a file index, a line and a column), a
+// token carries a SourceLocation: a 32-bit offset into one address space
+// made of all the files loaded for the translation unit, one after the
+// other.  The SourceManager that loaded them resolves it back to a file,
+// line and column when (rarely) that is needed: a binary search for the
+// file, then one over the starts of its lines, found the first time a
+// location in the file is resolved.
+//
+// Tokens made by macro replacement take the location of the macro name
+// they replace (as __LINE__ must be that of the invocation).
+//
+// A SourceManager is per translation unit, made by the preprocessor when it
+// starts a source file, and every file it #includes is loaded through it;
+// with `preproc -j` each thread has its own, so it is not locked.
+typedef uint32_t SourceLocation;
+
+// no location (tokens made up rather than read from a file)
+constexpr SourceLocation NoSourceLocation = 0;
+
+// PresumedLocation: a location as __FILE__ and __LINE__ have it
+struct PresumedLocation
+{
+	// file name (after #line, the one it gave), empty for NoSourceLocation
+	const string* file;
+
+	// from 1, counting physical lines (#line renumbers them)
+	uint32_t line;
+
+	// from 1, in bytes of the physical line
+	uint32_t column;
+};
+
+// SourceManager: the files of a translation unit and their locations
+struct SourceManager
+{
+	SourceManager()
+		: next(NoSourceLocation + 1)
+	{}
+
+	SourceManager(const SourceManager&) = delete;
+	SourceManager& operator=(const SourceManager&) = delete;
+
+	// add the `size` bytes at `data`, the contents of file `name`, which
+	// must stay valid as long as the SourceManager, returning the location
+	// of the first (each file is added each time it is included, and the
+	// location one past its end is its end of file)
+	SourceLocation add(const string& name, const char* data, size_t size)
+	{
+		if (size >= UINT32_MAX - next)
+			throw runtime_error("source locations exhausted including " + name);
+
+		SourceLocation base = next;
+		files.push_back(File{intern(name), base, uint32_t(size), data, {}, {}});
+		next += size + 1;
+		return base;
+	}
+
+	// location of byte `offset` of the file added at `base`
+	static SourceLocation at(SourceLocation base, uint32_t offset)
+	{
+		return base + offset;
+	}
+
+	// `#line line file` (`file` empty if not given, keeping that of the
+	// #line before) on the physical line before the one at `next_line`
+	void line_directive(SourceLocation next_line, uint32_t line, const string& file)
+	{
+		File& f = find(next_line);
+		const string* name = file.empty() ? (f.line_directives.empty() ? nullptr : f.line_directives.back().file) : intern(file);
+		f.line_directives.push_back(LineDirective{next_line - f.base, line, name});
+	}
+
+	PresumedLocation resolve(SourceLocation location)
+	{
+		if (location == NoSourceLocation)
+			return PresumedLocation{&empty_name, 0, 0};
+
+		File& f = find(location);
+		uint32_t offset = location - f.base;
+
+		if (f.line_starts.empty())
+			index_lines(f);
+
+		// line and column of `offset`
+		auto physical = [&](uint32_t offset, uint32_t& column)
+		{
+			uint32_t line = upper_bound(f.line_starts.begin(), f.line_starts.end(), offset) - f.line_starts.begin();
+			column = offset - f.line_starts[line - 1] + 1;
+			return line;
+		};
+
+		uint32_t column;
+		uint32_t line = physical(offset, column);
+		const string* name = f.name;
+
+		// the last #line before it
+		auto it = upper_bound(f.line_directives.begin(), f.line_directives.end(), offset,
+			[](uint32_t offset, const LineDirective& d) { return offset < d.offset; });
+
+		if (it != f.line_directives.begin())
+		{
+			const LineDirective& d = *--it;
+			uint32_t directive_column;
+			line = d.line + (line - physical(d.offset, directive_column));
+
+			if (d.file)
+				name = d.file;
+		}
+
+		return PresumedLocation{name, line, column};
+	}
+
+	// number of files added, and bytes of line tables built
+	size_t nfiles() const { return files.size(); }
+
+	size_t line_table_bytes() const
+	{
+		size_t n = 0;
+
+		for (const File& f : files)
+			n += f.line_starts.capacity() * sizeof(uint32_t);
+
+		return n;
+	}
+
+private:
+	struct LineDirective
+	{
+		uint32_t offset;
+		uint32_t line;
+		const string* file;
+	};
+
+	struct File
+	{
+		const string* name;
+		SourceLocation base;
+		uint32_t size;
+		const char* data;
+
+		// offsets of the starts of lines, built lazily
+		vector<uint32_t> line_starts;
+
+		// in order of offset, as they are read
+		vector<LineDirective> line_directives;
+	};
+
+	SourceLocation next;
+	vector<File> files;
+
+	// file names, each stored once
+	unordered_set<string> names;
+	string empty_name;
+
+	const string* intern(const string& name)
+	{
+		return &*names.insert(name).first;
+	}
+
+	File& find(SourceLocation location)
+	{
+		auto it = upper_bound(files.begin(), files.end(), location,
+			[](SourceLocation location, const File& f) { return location < f.base; });
+
+		if (it == files.begin() || location - (it - 1)->base > (it - 1)->size)
+			throw logic_error("invalid source location " + to_string(location));
+
+		return *(it - 1);
+	}
+
+	void index_lines(File& f)
+	{
+		f.line_starts.push_back(0);
+
+		// (a mapped empty file has no data)
+		for (const char* p = f.data; f.size != 0 && (p = (const char*) memchr(p, '\n', f.data + f.size - p)); p++)
+			f.line_starts.push_back(p + 1 - f.data);
+
+		f.line_starts.shrink_to_fit();
+	}
+};
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "FileId.h"
+#include "SourceBuffer.h"
+
+// Token snapshots: preprocessed headers saved across preproc runs
+//
+// With `--pch-dir=DIR`, what preprocessing a header produced (its tokens
+// and the macro definitions it made) is written to a snapshot file in DIR,
+// and later runs map the snapshot instead of preprocessing the header
+// again.  A snapshot is one file:
+//
+//     SnapshotHeader
+//     macro table delta    (delta_size bytes, as the preprocessor wrote it)
+//     spelled text         (text_size bytes)
+//     tokens               (ntokens Tokens, 8-byte aligned)
+//
+// and holds tokens as slices of its text, so once mapped and checked they
+// are used in place, without parsing or copying.
+//
+// A snapshot is valid for the file that was preprocessed (PA5FileStamp),
+// with the contents it had then (a hash of them, so a file rewritten
+// within one mtime tick is not mistaken for the old one), preprocessed with
+// the same incoming macro state (`macro_state`, a hash of the definitions
+// the header's preprocessing depended on, computed by the preprocessor).
+// The name of a snapshot file is made of its PA5FileId and macro_state,
+// and loading checks the rest, so a stale snapshot is a miss and is
+// overwritten.
+//
+// `Token` must be trivially copyable, and holds the same when written and
+// read: the snapshot records its size, so a build with a different Token
+// layout does not read another's snapshots.
+
+// FNV-1a hash of `n` bytes at `data`
+inline uint64_t SnapshotHash(const char* data, size_t n, uint64_t h = 0xcbf29ce484222325ULL)
+{
+	for (size_t i = 0; i < n; i++)
+		h = (h ^ (unsigned char) data[i]) * 0x100000001b3ULL;
+
+	return h;
+}
+
+// SnapshotKey: what a snapshot is valid for
+struct SnapshotKey
+{
+	PA5FileStamp stamp;
+	uint64_t content_hash;
+	uint64_t macro_state;
+};
+
+// key of the file at `path`, preprocessed with `macro_state`
+//
+// Returns false iff there is no file at `path`.
+inline bool GetSnapshotKey(const string& path, uint64_t macro_state, SnapshotKey& out_key)
+{
+	if (!PA5GetFileStamp(path, out_key.stamp))
+		return false;
+
+	SourceBuffer contents(path);
+	out_key.content_hash = SnapshotHash(contents.begin(), contents.size());
+	out_key.macro_state = macro_state;
+	return true;
+}
+
+struct SnapshotHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t token_size;
+
+	uint64_t dev;
+	uint64_t ino;
+	int64_t size;
+	int64_t mtime_sec;
+	int64_t mtime_nsec;
+	uint64_t content_hash;
+	uint64_t macro_state;
+
+	uint64_t delta_size;
+	uint64_t text_size;
+	uint64_t ntokens;
+};
+
+constexpr char SnapshotMagic[8] = { 'P', 'A', '5', 'S', 'N', 'A', 'P', '\n' };
+constexpr uint32_t SnapshotVersion = 1;
+
+// offset of the tokens of a snapshot
+inline uint64_t SnapshotTokensOffset(const SnapshotHeader& header)
+{
+	return (sizeof(SnapshotHeader) + header.delta_size + header.text_size + 7) & ~uint64_t(7);
+}
+
+// TokenSnapshot: a mapped snapshot
+template<typename Token>
+struct TokenSnapshot
+{
+	explicit TokenSnapshot(const string& path)
+		: file(path)
+	{}
+
+	// the header's macro table delta
+	const char* delta() const { return file.begin() + sizeof(SnapshotHeader); }
+	size_t delta_size() const { return header().delta_size; }
+
+	// text the tokens are slices of
+	const char* text() const { return delta() + header().delta_size; }
+	size_t text_size() const { return header().text_size; }
+
+	const Token* tokens() const { return (const Token*) (file.begin() + SnapshotTokensOffset(header())); }
+	size_t ntokens() const { return header().ntokens; }
+
+	// true iff the file is a snapshot for `key`
+	bool valid(const SnapshotKey& key) const
+	{
+		if (file.size() < sizeof(SnapshotHeader))
+			return false;
+
+		const SnapshotHeader& h = header();
+
+		return memcmp(h.magic, SnapshotMagic, sizeof SnapshotMagic) == 0 &&
+			h.version == SnapshotVersion &&
+			h.token_size == sizeof(Token) &&
+			h.dev == key.stamp.id.first &&
+			h.ino == key.stamp.id.second &&
+			h.size == key.stamp.size &&
+			h.mtime_sec == key.stamp.mtime_sec &&
+			h.mtime_nsec == key.stamp.mtime_nsec &&
+			h.content_hash == key.content_hash &&
+			h.macro_state == key.macro_state &&
+			h.delta_size <= file.size() && h.text_size <= file.size() && h.ntokens <= file.size() &&
+			SnapshotTokensOffset(h) + h.ntokens * sizeof(Token) == file.size();
+	}
+
+private:
+	SourceBuffer file;
+
+	const SnapshotHeader& header() const { return *(const SnapshotHeader*) file.begin(); }
+};
+
+// SnapshotStore: the snapshots of a --pch-dir
+//
+// preproc makes one store for the run, shared by all source files (and the
+// threads of `preproc -j`), and splices a header's snapshot in where it is
+// #included, if it has one for the incoming macro state.
+template<typename Token>
+struct SnapshotStore
+{
+	explicit SnapshotStore(const string& dir)
+		: dir(dir), hits(0), misses(0), writes(0)
+	{}
+
+	string dir;
+
+	// loads that found a valid snapshot, and saves (counted atomically, as
+	// a store is shared by the threads of `preproc -j`)
+	atomic<size_t> hits;
+	atomic<size_t> misses;
+	atomic<size_t> writes;
+
+	// path of the snapshot for `key`
+	string path(const SnapshotKey& key) const
+	{
+		return dir + "/" + Hex(key.stamp.id.first) + "-" + Hex(key.stamp.id.second) + "-" + Hex(key.macro_state) + ".pch";
+	}
+
+	// the snapshot for `key`, or nullptr if there is none or it is stale
+	shared_ptr<const TokenSnapshot<Token>> load(const SnapshotKey& key)
+	{
+		string snapshot_path = path(key);
+		PA5FileId id;
+
+		if (PA5GetFileId(snapshot_path, id))
+		{
+			auto snapshot = make_shared<const TokenSnapshot<Token>>(snapshot_path);
+
+			if (snapshot->valid(key))
+			{
+				hits++;
+				return snapshot;
+			}
+		}
+
+		misses++;
+		return nullptr;
+	}
+
+	// write the snapshot for `key`
+	//
+	// It is written to a temporary file renamed into place, so concurrent
+	// runs read either no snapshot or a whole one.
+	void save(const SnapshotKey& key, const string& delta, const string& text, const vector<Token>& tokens)
+	{
+		SnapshotHeader header;
+		memset(&header, 0, sizeof header);
+		memcpy(header.magic, SnapshotMagic, sizeof SnapshotMagic);
+		header.version = SnapshotVersion;
+		header.token_size = sizeof(Token);
+		header.dev = key.stamp.id.first;
+		header.ino = key.stamp.id.second;
+		header.size = key.stamp.size;
+		header.mtime_sec = key.stamp.mtime_sec;
+		header.mtime_nsec = key.stamp.mtime_nsec;
+		header.content_hash = key.content_hash;
+		header.macro_state = key.macro_state;
+		header.delta_size = delta.size();
+		header.text_size = text.size();
+		header.ntokens = tokens.size();
+
+		string final_path = path(key);
+		string temporary_path = final_path + "." + to_string(syscall(/* getpid */ 39)) + "-" + to_string(syscall(/* gettid */ 186));
+
+		{
+			ofstream out(temporary_path, ios::binary);
+			out.write((const char*) &header, sizeof header);
+			out.write(delta.data(), delta.size());
+			out.write(text.data(), text.size());
+
+			static const char padding[8] = {};
+			out.write(padding, SnapshotTokensOffset(header) - (sizeof header + delta.size() + text.size()));
+			out.write((const char*) tokens.data(), tokens.size() * sizeof(Token));
+
+			if (!out)
+			{
+				syscall(/* unlink */ 87, temporary_path.c_str());
+				throw runtime_error("unable to write " + temporary_path);
+			}
+		}
+
+		if (syscall(/* rename */ 82, temporary_path.c_str(), final_path.c_str()) != 0)
+		{
+			syscall(/* unlink */ 87, temporary_path.c_str());
+			throw runtime_error("unable to write " + final_path);
+		}
+
+		writes++;
+	}
+
+private:
+	static string Hex(uint64_t x)
+	{
+		static const char digits[] = "0123456789abcdef";
+		string s;
+
+		do
+		{
+			s.insert(s.begin(), digits[x % 16]);
+			x /= 16;
+		}
+		while (x != 0);
+
+		return s;
+	}
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+// PreprocessInOrder: preprocess source files 0 to n-1 on `jobs` threads
+//
+// `preprocess(i, out)` writes the per-srcfile section of source file i to
+// `out`.  Source files are independent, so each one is preprocessed into a
+// buffer of its own by whichever thread is free, and the buffers are
+// written to `out` in order as soon as all before them are, so the output
+// is the same as that of preprocessing them one after the other.
+//
+// If preprocessing one throws, the output up to the exception is written,
+// no source file is started after it, and the exception is rethrown once
+// the threads are joined.  With `jobs` <= 1 it all happens on the calling
+// thread, directly into `out`.
+//
+// `preprocess` is called concurrently: its state that outlives a source
+// file (such as an IncludeCache) must be thread-safe, and the rest (the
+// macro table, IncludeGuards, ...) is made anew for each call.
+template<typename Preprocess>
+void PreprocessInOrder(size_t n, size_t jobs, Preprocess preprocess, ostream& out)
+{
+	if (jobs <= 1)
+	{
+		for (size_t i = 0; i < n; i++)
+			preprocess(i, out);
+
+		return;
+	}
+
+	struct Section
+	{
+		bool done;
+		string text;
+		exception_ptr error;
+	};
+
+	vector<Section> sections(n);
+	mutex sections_mutex;
+	condition_variable section_done;
+	atomic<size_t> next(0);
+	atomic<bool> stop(false);
+
+	auto work = [&]
+	{
+		for (size_t i; !stop && (i = next++) < n; )
+		{
+			ostringstream buffer;
+			exception_ptr error;
+
+			try
+			{
+				preprocess(i, buffer);
+			}
+			catch (...)
+			{
+				error = current_exception();
+				stop = true;
+			}
+
+			lock_guard<mutex> lock(sections_mutex);
+			sections[i] = Section{true, buffer.str(), error};
+			section_done.notify_one();
+		}
+	};
+
+	// joins the threads however the loop below ends
+	struct Threads
+	{
+		vector<thread> threads;
+		atomic<bool>& stop;
+
+		~Threads()
+		{
+			stop = true;
+
+			for (thread& t : threads)
+				t.join();
+		}
+	} threads{vector<thread>(), stop};
+
+	for (size_t j = 0; j < min(jobs, n); j++)
+		threads.threads.emplace_back(work);
+
+	for (size_t i = 0; i < n; i++)
+	{
+		Section section;
+
+		{
+			unique_lock<mutex> lock(sections_mutex);
+			section_done.wait(lock, [&] { return sections[i].done; });
+			section = move(sections[i]);
+		}
+
+		out << section.text;
+
+		if (section.error)
+			rethrow_exception(section.error);
+	}
+}
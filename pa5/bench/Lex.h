@@ -0,0 +1,165 @@
+#pragma once
+
+// Lex: small lexer for the benchmarks, standing in for phases 1-3 until PA5
+// has a PA1 tokenizer: line splices, comments, and pp-tokens as slices of
+// the spliced text (identifiers, pp-numbers, literals, punctuators), no
+// trigraphs or UCNs
+
+enum ETokenKind : unsigned char
+{
+	TK_IDENTIFIER,
+	TK_NUMBER,
+	TK_LITERAL,
+	TK_PUNCTUATOR,
+	TK_NEW_LINE
+};
+
+struct Token
+{
+	ETokenKind kind;
+	bool space_before;
+	uint32_t offset;
+	uint32_t size;
+};
+
+// PPTokens: a file after phases 1-3
+struct PPTokens
+{
+	// the file with line splices removed, which tokens are slices of
+	string text;
+	vector<Token> tokens;
+
+	// offsets in `text` of the removed line splices
+	vector<uint32_t> splices;
+
+	string spelling(const Token& token) const
+	{
+		return text.substr(token.offset, token.size);
+	}
+
+	// offset in the file of offset `offset` in `text`
+	uint32_t source_offset(uint32_t offset) const
+	{
+		return offset + 2 * (upper_bound(splices.begin(), splices.end(), offset) - splices.begin());
+	}
+};
+
+inline bool IsIdentifierCharacter(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+inline PPTokens Tokenize(const string& path)
+{
+	SourceBuffer source(path);
+	PPTokens result;
+
+	// phase 2
+	string& text = result.text;
+	text.reserve(source.size() + 1);
+
+	for (const char* p = source.begin(); p != source.end(); p++)
+	{
+		if (*p == '\\' && p + 1 != source.end() && p[1] == '\n')
+		{
+			result.splices.push_back(text.size());
+			p++;
+		}
+		else
+			text += *p;
+	}
+
+	if (!text.empty() && text.back() != '\n')
+		text += '\n';
+
+	// phase 3
+	static const char* const punctuators[] = { "...", "<<=", ">>=", "->*", "##", "::", "->", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||", "++", "--", "+=", "-=", "*=", "/=" };
+
+	bool space_before = false;
+
+	for (size_t i = 0; i < text.size(); )
+	{
+		size_t start = i;
+		char c = text[i];
+		ETokenKind kind = TK_PUNCTUATOR;
+
+		if (c == ' ' || c == '\t')
+		{
+			space_before = true;
+			i++;
+			continue;
+		}
+
+		if (c == '/' && text[i + 1] == '/')
+		{
+			i = text.find('\n', i);
+			space_before = true;
+			continue;
+		}
+
+		if (c == '/' && text[i + 1] == '*')
+		{
+			i = text.find("*/", i + 2);
+
+			if (i == string::npos)
+				throw runtime_error("partial comment in " + path);
+
+			i += 2;
+			space_before = true;
+			continue;
+		}
+
+		if (c == '\n')
+		{
+			kind = TK_NEW_LINE;
+			i++;
+		}
+		else if (c == '"' || c == '\'')
+		{
+			kind = TK_LITERAL;
+
+			for (i++; text[i] != c; i++)
+			{
+				if (text[i] == '\n')
+					throw runtime_error("unterminated literal in " + path);
+
+				if (text[i] == '\\')
+					i++;
+			}
+
+			i++;
+		}
+		else if (c >= '0' && c <= '9')
+		{
+			kind = TK_NUMBER;
+
+			while (IsIdentifierCharacter(text[i]) || text[i] == '.')
+				i++;
+		}
+		else if (IsIdentifierCharacter(c))
+		{
+			kind = TK_IDENTIFIER;
+
+			while (IsIdentifierCharacter(text[i]))
+				i++;
+		}
+		else
+		{
+			i++;
+
+			for (const char* punctuator : punctuators)
+			{
+				if (text.compare(start, strlen(punctuator), punctuator) == 0)
+				{
+					i = start + strlen(punctuator);
+					break;
+				}
+			}
+		}
+
+		result.tokens.push_back(Token{kind, space_before, uint32_t(start), uint32_t(i - start)});
+		space_before = false;
+	}
+
+	return result;
+}
@@ -0,0 +1,216 @@
+// includecache: a run over 500 generated source files that each include
+// the same 8 headers (which each include a common one), with and without
+// an IncludeCache, then a header modified between two source files
+//
+// usage: bench/includecache
+//
+// Only #include "..." is preprocessed.
+
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <chrono>
+#include <mutex>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../IncludeCache.h"
+#include "../SourceBuffer.h"
+#include "Lex.h"
+
+// preprocess `path`, returning the number of tokens of its text-lines and
+// those of the files it includes
+template<typename GetTokens>
+size_t Preprocess(const string& dir, const string& path, GetTokens get_tokens, int depth = 0)
+{
+	if (depth > 200)
+		throw runtime_error("#include nested too deeply");
+
+	shared_ptr<const PPTokens> file = get_tokens(path);
+
+	if (!file)
+		throw runtime_error("cannot open " + path);
+
+	const vector<Token>& tokens = file->tokens;
+	size_t ntokens = 0;
+
+	for (size_t i = 0; i < tokens.size(); i++)
+	{
+		bool line_start = i == 0 || tokens[i - 1].kind == TK_NEW_LINE;
+
+		if (line_start && i + 2 < tokens.size() && file->spelling(tokens[i]) == "#" &&
+			file->spelling(tokens[i + 1]) == "include" && tokens[i + 2].kind == TK_LITERAL)
+		{
+			string name = file->spelling(tokens[i + 2]);
+			ntokens += Preprocess(dir, dir + "/" + name.substr(1, name.size() - 2), get_tokens, depth + 1);
+
+			while (tokens[i].kind != TK_NEW_LINE)
+				i++;
+		}
+		else if (tokens[i].kind != TK_NEW_LINE)
+			ntokens++;
+	}
+
+	return ntokens;
+}
+
+const size_t NumSourceFiles = 500;
+const size_t NumHeaders = 8;
+
+void WriteFile(const string& path, const string& text)
+{
+	ofstream out(path);
+	out << text;
+
+	if (!out)
+		throw runtime_error("cannot write " + path);
+}
+
+// `n` lines of declarations, comments and a macro with line splices
+string Declarations(const string& prefix, size_t n)
+{
+	string text;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		string name = prefix + to_string(i);
+
+		switch (i % 4)
+		{
+		case 0: text += "/* " + name + ": a block\n   comment */ struct " + name + " { int x; long long y; };\n"; break;
+		case 1: text += "inline int " + name + "_f(int a, const char* s) { return a << 2 >= 0x1F ? s[0] : '\\n'; } // " + name + "\n"; break;
+		case 2: text += "#define " + name + "_M(a, b) \\\n\t((a) * (b) + 1.5e3)\n"; break;
+		case 3: text += "extern const char* const " + name + "_s = \"" + name + " \\\"quoted\\\"\";\n"; break;
+		}
+	}
+
+	return text;
+}
+
+// the source files and headers, in a new directory, returning its path
+string WriteTree(vector<string>& source_files)
+{
+	string dir = "/tmp/pa5-includecache-" + to_string(syscall(/* getpid */ 39));
+
+	if (syscall(/* mkdir */ 83, dir.c_str(), 0755) != 0)
+		throw runtime_error("cannot create " + dir);
+
+	WriteFile(dir + "/common.h", Declarations("common_", 400));
+
+	for (size_t h = 0; h < NumHeaders; h++)
+		WriteFile(dir + "/h" + to_string(h) + ".h", "#include \"common.h\"\n" + Declarations("h" + to_string(h) + "_", 100));
+
+	for (size_t i = 0; i < NumSourceFiles; i++)
+	{
+		string text;
+
+		for (size_t h = 0; h < NumHeaders; h++)
+			text += "#include \"h" + to_string(h) + ".h\"\n";
+
+		source_files.push_back(dir + "/tu" + to_string(i) + ".cpp");
+		WriteFile(source_files.back(), text + Declarations("tu" + to_string(i) + "_", 40));
+	}
+
+	return dir;
+}
+
+void RemoveTree(const string& dir, const vector<string>& source_files)
+{
+	vector<string> paths = source_files;
+	paths.push_back(dir + "/common.h");
+
+	for (size_t h = 0; h < NumHeaders; h++)
+		paths.push_back(dir + "/h" + to_string(h) + ".h");
+
+	for (const string& path : paths)
+		syscall(/* unlink */ 87, path.c_str());
+
+	syscall(/* rmdir */ 84, dir.c_str());
+}
+
+int main()
+{
+	vector<string> source_files;
+	string dir;
+
+	try
+	{
+		dir = WriteTree(source_files);
+
+		typedef IncludeCache<PPTokens> Cache;
+		Cache cache;
+
+		auto cached = [&](const string& path) { return cache.get(path, Tokenize); };
+
+		auto uncached = [](const string& path)
+		{
+			PA5FileStamp stamp;
+			return PA5GetFileStamp(path, stamp) ? make_shared<const PPTokens>(Tokenize(path)) : nullptr;
+		};
+
+		size_t ntokens[2] = { 0, 0 };
+		double seconds[2];
+
+		auto start = chrono::steady_clock::now();
+
+		for (const string& path : source_files)
+			ntokens[0] += Preprocess(dir, path, uncached);
+
+		seconds[0] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		start = chrono::steady_clock::now();
+
+		for (const string& path : source_files)
+			ntokens[1] += Preprocess(dir, path, cached);
+
+		seconds[1] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		if (ntokens[0] != ntokens[1])
+			throw runtime_error("cached run has different tokens");
+
+		// each source file is tokenized once, and so is each header
+		size_t lookups = NumSourceFiles * (1 + 2 * NumHeaders);
+
+		if (cache.misses != NumSourceFiles + NumHeaders + 1 || cache.hits != lookups - cache.misses || cache.reloads != 0)
+			throw runtime_error("unexpected cache hits and misses");
+
+		cout << NumSourceFiles << " source files including " << NumHeaders << " headers including one (" << ntokens[0] << " tokens)" << endl;
+		cout << "  tokenizing every #include: " << seconds[0] << " s" << endl;
+		cout << "  IncludeCache:              " << seconds[1] << " s, " << cache.hits << " hits, " << cache.misses << " misses, "
+			<< seconds[0] / seconds[1] << "x" << endl;
+
+		// a header edited between two source files is tokenized again
+		size_t before = Preprocess(dir, source_files[0], cached);
+		WriteFile(dir + "/h0.h", "#include \"common.h\"\n" + Declarations("h0_", 101));
+		size_t after = Preprocess(dir, source_files[0], cached);
+
+		if (cache.reloads != 1 || after <= before)
+			throw runtime_error("modified header not reloaded");
+
+		cout << "modified header reloaded" << endl;
+
+		const double MaxSeconds = 1.0;
+
+		if (seconds[1] > MaxSeconds)
+			throw runtime_error("cached run over time budget");
+
+		RemoveTree(dir, source_files);
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+
+		if (!dir.empty())
+			RemoveTree(dir, source_files);
+
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,302 @@
+// includeguard: checks of include guard detection, then 10k #includes of a
+// guarded header, with and without skipping it once guarded
+//
+// usage: bench/includeguard
+//
+// (run from pa5/, it includes tests/header-guarded.h)
+//
+// Preprocess below does #include "...", #define and #undef of names, and
+// #ifdef, #ifndef, #if [!]defined X, #else and #endif.
+
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../IncludeGuard.h"
+#include "../SourceBuffer.h"
+#include "Lex.h"
+
+struct Preprocessor
+{
+	Preprocessor(bool skip_guarded = true)
+		: skip_guarded(skip_guarded), opens(0), tokens(0)
+	{}
+
+	bool skip_guarded;
+	IncludeGuards guards;
+	unordered_set<string> macros;
+
+	// files read, and tokens of text-lines
+	size_t opens;
+	size_t tokens;
+
+	bool defined(const string& name) const
+	{
+		return macros.count(name) != 0;
+	}
+
+	void include(const string& path, int depth = 0)
+	{
+		if (depth > 200)
+			throw runtime_error("#include nested too deeply");
+
+		PA5FileId id;
+
+		if (!PA5GetFileId(path, id))
+			throw runtime_error("cannot open " + path);
+
+		if (skip_guarded && guards.skip(id, [&](const string& name) { return defined(name); }))
+			return;
+
+		opens++;
+		PPTokens file = Tokenize(path);
+		const vector<Token>& line = file.tokens;
+		IncludeGuardDetector detector;
+
+		struct Conditional
+		{
+			bool enclosing_skipped;
+			bool taken;
+		};
+
+		vector<Conditional> conditionals;
+		bool skipping = false;
+
+		for (size_t b = 0, e; b < line.size(); b = e + 1)
+		{
+			for (e = b; line[e].kind != TK_NEW_LINE; e++)
+				;
+
+			auto spelling = [&](size_t i) { return i < e ? file.spelling(line[i]) : string(); };
+
+			if (b == e || (spelling(b) == "#" && b + 1 == e))
+				continue;
+
+			string directive = spelling(b) == "#" ? spelling(b + 1) : string();
+
+			if (directive == "if" || directive == "ifdef" || directive == "ifndef")
+			{
+				bool value;
+				string guard;
+
+				if (directive == "if" && spelling(b + 2) == "!" && spelling(b + 3) == "defined")
+				{
+					guard = spelling(b + 4) == "(" ? spelling(b + 5) : spelling(b + 4);
+					value = !defined(guard);
+				}
+				else if (directive == "if" && spelling(b + 2) == "defined")
+					value = defined(spelling(b + 3) == "(" ? spelling(b + 4) : spelling(b + 3));
+				else if (directive == "if")
+					throw runtime_error("unsupported #if in " + path);
+				else if (directive == "ifdef")
+					value = defined(spelling(b + 2));
+				else
+				{
+					guard = spelling(b + 2);
+					value = !defined(guard);
+				}
+
+				detector.conditional(guard);
+				conditionals.push_back(Conditional{skipping, value});
+				skipping = skipping || !value;
+			}
+			else if (directive == "else")
+			{
+				if (conditionals.empty())
+					throw runtime_error("#else without #if in " + path);
+
+				detector.alternative();
+				skipping = conditionals.back().enclosing_skipped || conditionals.back().taken;
+				conditionals.back().taken = true;
+			}
+			else if (directive == "endif")
+			{
+				if (conditionals.empty())
+					throw runtime_error("#endif without #if in " + path);
+
+				detector.endif();
+				skipping = conditionals.back().enclosing_skipped;
+				conditionals.pop_back();
+			}
+			else
+			{
+				detector.other();
+
+				if (skipping)
+					continue;
+
+				if (directive == "define")
+					macros.insert(spelling(b + 2));
+				else if (directive == "undef")
+					macros.erase(spelling(b + 2));
+				else if (directive == "include")
+				{
+					string name = spelling(b + 2);
+					include(path.substr(0, path.rfind('/') + 1) + name.substr(1, name.size() - 2), depth + 1);
+				}
+				else if (directive.empty())
+					tokens += e - b;
+			}
+		}
+
+		if (!conditionals.empty())
+			throw runtime_error("unterminated conditional in " + path);
+
+		if (const string* guard = detector.guard())
+			guards.record(id, *guard);
+	}
+};
+
+void WriteFile(const string& path, const string& text)
+{
+	ofstream out(path);
+	out << text;
+
+	if (!out)
+		throw runtime_error("cannot write " + path);
+}
+
+const char* const IncludeThrice = "#include \"h.h\"\n#include \"h.h\"\n#include \"h.h\"\n";
+
+// a header `h.h` included by `source` (three times by default), which
+// should read the header `opens` times
+struct Case
+{
+	const char* header;
+	size_t opens;
+	const char* source;
+};
+
+const Case Cases[] =
+{
+	{ "#ifndef G\n#define G\nx\n#endif\n", 1, IncludeThrice },
+	{ "#if !defined G\n#define G\nx\n#endif\n", 1, IncludeThrice },
+	{ "#if !defined(G)\n#define G\nx\n#endif\n", 1, IncludeThrice },
+	{ "// before\n\n#ifndef G\n#define G\n#ifdef Y\ny\n#else\nz\n#endif\n#endif\n\n/* after */\n", 1, IncludeThrice },
+	{ "#\n#ifndef G\n#define G\n#\n#endif\n#\n", 1, IncludeThrice },
+
+	// G was defined before the first inclusion
+	{ "#ifndef G\n#define G\nx\n#endif\n", 1, "#define G\n#include \"h.h\"\n#include \"h.h\"\n" },
+
+	// ...or undefined between inclusions
+	{ "#ifndef G\n#define G\nx\n#endif\n", 2, "#include \"h.h\"\n#undef G\n#include \"h.h\"\n#include \"h.h\"\n" },
+
+	// not guarded: something outside the group, more than one group, an
+	// #else of the group, not an #ifndef
+	{ "x\n#ifndef G\n#define G\n#endif\n", 3, IncludeThrice },
+	{ "#ifndef G\n#define G\n#endif\nx\n", 3, IncludeThrice },
+	{ "#ifndef G\n#define G\n#endif\n#pragma once\n", 3, IncludeThrice },
+	{ "#ifndef G\n#define G\n#endif\n#ifndef H\n#define H\n#endif\n", 3, IncludeThrice },
+	{ "#ifndef G\n#define G\n#else\nx\n#endif\n", 3, IncludeThrice },
+	{ "#ifdef G\n#else\n#define G\n#endif\n", 3, IncludeThrice },
+	{ "#if defined G\n#else\n#define G\n#endif\n", 3, IncludeThrice },
+
+	// guarded, but by a macro it never defines
+	{ "#ifndef G\nx\n#endif\n", 3, IncludeThrice },
+};
+
+// the cases, with their files in `dir`
+void CheckCases(const string& dir)
+{
+	for (const Case& c : Cases)
+	{
+		WriteFile(dir + "/h.h", c.header);
+		WriteFile(dir + "/source.cpp", c.source);
+
+		Preprocessor preprocessor;
+		preprocessor.include(dir + "/source.cpp");
+
+		if (preprocessor.opens != 1 + c.opens)
+			throw runtime_error("header read " + to_string(preprocessor.opens - 1) + " times, not " + to_string(c.opens) + ":\n" + c.header);
+	}
+
+	syscall(/* unlink */ 87, (dir + "/h.h").c_str());
+	syscall(/* unlink */ 87, (dir + "/source.cpp").c_str());
+
+	cout << "include guards ok (" << sizeof Cases / sizeof Cases[0] << " cases)" << endl;
+}
+
+const size_t NumIncludes = 10000;
+
+int main()
+{
+	string dir = "/tmp/pa5-includeguard-" + to_string(syscall(/* getpid */ 39));
+	string header = dir + "/guarded.h";
+
+	try
+	{
+		if (syscall(/* mkdir */ 83, dir.c_str(), 0755) != 0)
+			throw runtime_error("cannot create " + dir);
+
+		CheckCases(dir);
+
+		// tests/header-guarded.h, 10k times
+		Preprocessor preprocessor;
+
+		for (size_t i = 0; i < NumIncludes; i++)
+			preprocessor.include("tests/header-guarded.h");
+
+		if (preprocessor.opens != 1 || preprocessor.guards.skips != NumIncludes - 1 || preprocessor.tokens != 1)
+			throw runtime_error("tests/header-guarded.h read " + to_string(preprocessor.opens) + " times");
+
+		cout << "tests/header-guarded.h included " << NumIncludes << " times, read " << preprocessor.opens
+			<< " time, skipped " << preprocessor.guards.skips << " times" << endl;
+
+		// a larger guarded header, 10k times
+		string text = "#ifndef GUARDED_H\n#define GUARDED_H\n";
+
+		for (size_t i = 0; i < 200; i++)
+			text += "extern const char* const guarded_" + to_string(i) + " = \"text\"; // comment\n";
+
+		WriteFile(header, text + "#endif\n");
+
+		double seconds[2];
+
+		for (int skip_guarded = 0; skip_guarded < 2; skip_guarded++)
+		{
+			Preprocessor preprocessor(skip_guarded);
+			auto start = chrono::steady_clock::now();
+
+			for (size_t i = 0; i < NumIncludes; i++)
+				preprocessor.include(header);
+
+			seconds[skip_guarded] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+			if (preprocessor.opens != (skip_guarded ? 1 : NumIncludes) || preprocessor.tokens != 200 * 9)
+				throw runtime_error("guarded.h read " + to_string(preprocessor.opens) + " times");
+		}
+
+		cout << "guarded.h (200 lines) included " << NumIncludes << " times:" << endl;
+		cout << "  reading every #include:   " << seconds[0] << " s" << endl;
+		cout << "  skipping guarded headers: " << seconds[1] << " s, " << seconds[0] / seconds[1] << "x" << endl;
+
+		const double MaxSeconds = 0.1;
+
+		if (seconds[1] > MaxSeconds)
+			throw runtime_error("skipping guarded headers over time budget");
+
+		syscall(/* unlink */ 87, header.c_str());
+		syscall(/* rmdir */ 84, dir.c_str());
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		syscall(/* unlink */ 87, header.c_str());
+		syscall(/* unlink */ 87, (dir + "/h.h").c_str());
+		syscall(/* unlink */ 87, (dir + "/source.cpp").c_str());
+		syscall(/* rmdir */ 84, dir.c_str());
+		return EXIT_FAILURE;
+	}
+}
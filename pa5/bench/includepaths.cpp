@@ -0,0 +1,227 @@
+// includepaths: gathers the #include lookups of a translation unit of
+// standard library headers (following every #include, whatever the #if
+// groups around it), then replays them for 200 translation units looking
+// up each file with --stdinc search paths by probing every candidate, and
+// through an IncludeResolver, checking both find the same files
+//
+// usage: bench/includepaths
+
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <set>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../IncludeResolver.h"
+#include "../SourceBuffer.h"
+#include "Lex.h"
+
+// PA5StdIncPaths, for the newest GCC installed rather than 4.7
+vector<string> StdIncPaths()
+{
+	IncludeStats stats = IncludeStats();
+	DirectoryCache directories(stats);
+
+	auto newest = [&](const string& dir)
+	{
+		string version;
+
+		for (const string& name : directories.list(dir))
+			if (name[0] >= '0' && name[0] <= '9' && (version.empty() || stoi(name) > stoi(version)))
+				version = name;
+
+		if (version.empty())
+			throw runtime_error("no GCC version in " + dir);
+
+		return version;
+	};
+
+	string cxx = newest("/usr/include/c++/");
+	string gcc = newest("/usr/lib/gcc/x86_64-linux-gnu/");
+
+	return
+	{
+		"/usr/include/c++/" + cxx + "/",
+		"/usr/include/x86_64-linux-gnu/c++/" + cxx + "/",
+		"/usr/include/c++/" + cxx + "/backward/",
+		"/usr/lib/gcc/x86_64-linux-gnu/" + gcc + "/include/",
+		"/usr/local/include/",
+		"/usr/lib/gcc/x86_64-linux-gnu/" + gcc + "/include-fixed/",
+		"/usr/include/x86_64-linux-gnu/",
+		"/usr/include/"
+	};
+}
+
+struct Lookup
+{
+	string dir;
+	string nextf;
+};
+
+// #include files named in `file`, not counting #include_next or computed
+// #includes
+vector<string> Includes(const PPTokens& file)
+{
+	const vector<Token>& tokens = file.tokens;
+	vector<string> names;
+
+	for (size_t i = 0; i + 2 < tokens.size(); i++)
+	{
+		if ((i != 0 && tokens[i - 1].kind != TK_NEW_LINE) || file.spelling(tokens[i]) != "#" ||
+			file.spelling(tokens[i + 1]) != "include")
+			continue;
+
+		const Token& name = tokens[i + 2];
+
+		if (name.kind == TK_LITERAL && file.text[name.offset] == '"')
+			names.push_back(file.text.substr(name.offset + 1, name.size - 2));
+		else if (file.spelling(name) == "<")
+		{
+			size_t close = file.text.find('>', name.offset);
+			size_t nl = file.text.find('\n', name.offset);
+
+			if (close < nl)
+				names.push_back(file.text.substr(name.offset + 1, close - name.offset - 1));
+		}
+	}
+
+	return names;
+}
+
+// the lookups of one translation unit including `roots`, in order
+vector<Lookup> GatherLookups(const IncludeResolver& resolver, const vector<string>& roots)
+{
+	vector<Lookup> lookups;
+	vector<Lookup> pending;
+	set<PA5FileId> seen;
+
+	for (size_t i = roots.size(); i-- > 0; )
+		pending.push_back(Lookup{"", roots[i]});
+
+	while (!pending.empty())
+	{
+		Lookup lookup = pending.back();
+		pending.pop_back();
+		lookups.push_back(lookup);
+
+		string path;
+		PA5FileId id;
+
+		if (!ResolveByProbing(resolver, lookup.dir, lookup.nextf, path, id) || !seen.insert(id).second)
+			continue;
+
+		vector<string> names;
+
+		try
+		{
+			names = Includes(Tokenize(path));
+		}
+		catch (exception&)
+		{
+			// not tokenizable by Lex (or a directory)
+			continue;
+		}
+
+		string dir = path.substr(0, path.rfind('/') + 1);
+
+		for (size_t i = names.size(); i-- > 0; )
+			pending.push_back(Lookup{dir, names[i]});
+	}
+
+	return lookups;
+}
+
+const size_t NumTranslationUnits = 200;
+
+int main()
+{
+	try
+	{
+		IncludeResolver resolver(StdIncPaths());
+
+		vector<Lookup> lookups = GatherLookups(resolver, { "vector", "string", "iostream", "map", "algorithm",
+			"memory", "unordered_map", "functional", "stdio.h", "stdlib.h", "no-such-header.h" });
+
+		// probing
+		IncludeStats probing = IncludeStats();
+		vector<pair<string, PA5FileId>> found;
+		auto start = chrono::steady_clock::now();
+
+		for (size_t tu = 0; tu < NumTranslationUnits; tu++)
+		{
+			for (const Lookup& lookup : lookups)
+			{
+				string path;
+				PA5FileId id;
+				bool ok = ResolveByProbing(resolver, lookup.dir, lookup.nextf, path, id);
+				probing.lookups++;
+
+				for (const string& candidate : resolver.candidates(lookup.dir, lookup.nextf))
+				{
+					probing.stat++;
+
+					if (ok && candidate == path)
+						break;
+				}
+
+				if (tu == 0)
+					found.push_back(ok ? make_pair(path, id) : make_pair(string(), PA5FileId()));
+			}
+		}
+
+		double probing_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		// IncludeResolver
+		start = chrono::steady_clock::now();
+
+		for (size_t tu = 0; tu < NumTranslationUnits; tu++)
+		{
+			for (size_t i = 0; i < lookups.size(); i++)
+			{
+				string path;
+				PA5FileId id;
+				bool ok = resolver.resolve(lookups[i].dir, lookups[i].nextf, path, id);
+
+				if (tu == 0 && (ok ? make_pair(path, id) : make_pair(string(), PA5FileId())) != found[i])
+					throw runtime_error("IncludeResolver and probing differ on " + lookups[i].dir + " " + lookups[i].nextf);
+			}
+		}
+
+		double resolver_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		if (resolver.stats.probes != probing.stat || resolver.stats.lookups != probing.lookups)
+			throw runtime_error("IncludeResolver counted other probes");
+
+		size_t nfound = 0;
+
+		for (const auto& file : found)
+			nfound += !file.first.empty();
+
+		cout << NumTranslationUnits << " translation units of " << lookups.size() << " #include lookups ("
+			<< nfound << " found):" << endl;
+		cout << "  probing:         " << probing.stat << " system calls, " << probing_seconds * 1000 << " ms" << endl;
+		cout << "  IncludeResolver: " << resolver.stats.syscalls() << " system calls, " << resolver_seconds * 1000 << " ms, "
+			<< probing_seconds / resolver_seconds << "x" << endl;
+		resolver.stats.write(cout);
+
+		if (resolver.stats.syscalls() * 10 > probing.stat)
+			throw runtime_error("IncludeResolver made over a tenth of the system calls of probing");
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
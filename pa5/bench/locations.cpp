@@ -0,0 +1,267 @@
+// locations: preprocesses a generated 1M-token translation unit (#include
+// and #line only), keeping the tokens with their file, line and column as
+// a file name and two ints, as a file index and two ints, and as a
+// SourceLocation, then checks every SourceLocation resolves to the same
+// file, line and column, and compares the token vectors' memory
+//
+// usage: bench/locations
+
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <utility>
+#include <memory>
+#include <unordered_set>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../FileId.h"
+#include "../SourceBuffer.h"
+#include "../SourceLocation.h"
+#include "Lex.h"
+
+// token with a file name
+struct NamedToken
+{
+	Token token;
+	string file;
+	uint32_t line;
+	uint32_t column;
+};
+
+// token with an index in a table of file names
+struct IndexedToken
+{
+	Token token;
+	uint32_t file;
+	uint32_t line;
+	uint32_t column;
+};
+
+// token with a SourceLocation
+struct LocatedToken
+{
+	Token token;
+	SourceLocation location;
+};
+
+struct Preprocessor
+{
+	SourceManager sources;
+
+	// files read, kept for `sources`
+	vector<unique_ptr<SourceBuffer>> buffers;
+
+	vector<string> file_names;
+	vector<NamedToken> named;
+	vector<IndexedToken> indexed;
+	vector<LocatedToken> located;
+
+	void include(const string& path)
+	{
+		buffers.emplace_back(new SourceBuffer(path));
+		const SourceBuffer& buffer = *buffers.back();
+		SourceLocation base = sources.add(path, buffer.begin(), buffer.size());
+
+		// line and column of each byte of the file, counted directly
+		vector<pair<uint32_t, uint32_t>> positions;
+		uint32_t line = 1, column = 1;
+
+		for (const char* p = buffer.begin(); p != buffer.end(); p++)
+		{
+			positions.emplace_back(line, column);
+			tie(line, column) = *p == '\n' ? make_pair(line + 1, 1u) : make_pair(line, column + 1);
+		}
+
+		positions.emplace_back(line, column);
+
+		PPTokens file = Tokenize(path);
+		const vector<Token>& tokens = file.tokens;
+		string file_name = path;
+		uint32_t file_index = file_names.size();
+		file_names.push_back(file_name);
+
+		// presumed line = physical line + renumbering, after a #line
+		int32_t renumbering = 0;
+
+		for (size_t i = 0; i < tokens.size(); i++)
+		{
+			bool line_start = i == 0 || tokens[i - 1].kind == TK_NEW_LINE;
+
+			if (line_start && file.spelling(tokens[i]) == "#" && i + 1 < tokens.size())
+			{
+				string directive = file.spelling(tokens[i + 1]);
+				size_t end = i;
+
+				while (tokens[end].kind != TK_NEW_LINE)
+					end++;
+
+				if (directive == "include")
+				{
+					string name = file.spelling(tokens[i + 2]);
+					include(path.substr(0, path.rfind('/') + 1) + name.substr(1, name.size() - 2));
+				}
+				else if (directive == "line")
+				{
+					uint32_t next_line = file.source_offset(tokens[end].offset) + 1;
+					uint32_t number = stoul(file.spelling(tokens[i + 2]));
+					string name = end > i + 3 ? file.spelling(tokens[i + 3]) : string();
+
+					if (!name.empty())
+					{
+						file_name = name.substr(1, name.size() - 2);
+						file_index = file_names.size();
+						file_names.push_back(file_name);
+					}
+
+					sources.line_directive(SourceManager::at(base, next_line), number, name.empty() ? string() : file_name);
+					renumbering = int32_t(number) - int32_t(positions[next_line].first);
+				}
+
+				i = end;
+				continue;
+			}
+
+			if (tokens[i].kind == TK_NEW_LINE)
+				continue;
+
+			uint32_t offset = file.source_offset(tokens[i].offset);
+			uint32_t presumed_line = positions[offset].first + renumbering;
+			uint32_t column = positions[offset].second;
+
+			named.push_back(NamedToken{tokens[i], file_name, presumed_line, column});
+			indexed.push_back(IndexedToken{tokens[i], file_index, presumed_line, column});
+			located.push_back(LocatedToken{tokens[i], SourceManager::at(base, offset)});
+		}
+	}
+};
+
+void WriteFile(const string& path, const string& text)
+{
+	ofstream out(path);
+	out << text;
+
+	if (!out)
+		throw runtime_error("cannot write " + path);
+}
+
+string Declarations(const string& prefix, size_t n)
+{
+	string text;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		string name = prefix + to_string(i);
+
+		switch (i % 3)
+		{
+		case 0: text += "/* " + name + ":\n   a block comment */ struct " + name + " { int x; long long y; };\n"; break;
+		case 1: text += "inline int " + name + "_f(int a, const char* s) \\\n{ return a << 2 >= 0x1F ? s[0] : '\\n'; } // " + name + "\n"; break;
+		case 2: text += "\textern const char* const " + name + "_s = \"" + name + "\";\n"; break;
+		}
+	}
+
+	return text;
+}
+
+const size_t NumHeaders = 10;
+const size_t NumInclusions = 4;
+const size_t TokensPerLine = 14;
+
+// bytes of `tokens`, with the heap memory of their file names
+size_t Bytes(const vector<NamedToken>& tokens)
+{
+	size_t n = tokens.capacity() * sizeof(NamedToken);
+
+	for (const NamedToken& token : tokens)
+		if (token.file.capacity() > 15)
+			n += token.file.capacity() + 1;
+
+	return n;
+}
+
+int main()
+{
+	string dir = "/tmp/pa5-locations-" + to_string(syscall(/* getpid */ 39));
+	vector<string> paths;
+
+	try
+	{
+		if (syscall(/* mkdir */ 83, dir.c_str(), 0755) != 0)
+			throw runtime_error("cannot create " + dir);
+
+		string source;
+
+		for (size_t h = 0; h < NumHeaders; h++)
+		{
+			paths.push_back(dir + "/header" + to_string(h) + ".h");
+			WriteFile(paths.back(), Declarations("h" + to_string(h) + "_", 1000000 / TokensPerLine / NumHeaders / NumInclusions));
+
+			for (size_t i = 0; i < NumInclusions; i++)
+				source += "#include \"header" + to_string(h) + ".h\"\n";
+		}
+
+		paths.push_back(dir + "/source.cpp");
+		WriteFile(paths.back(), source + Declarations("a_", 100) + "#line 1000\n" + Declarations("b_", 100) +
+			"#line 2000 \"renamed.cpp\"\n" + Declarations("c_", 100) + "#line 3000\n" + Declarations("d_", 100));
+
+		Preprocessor preprocessor;
+		preprocessor.include(paths.back());
+
+		const vector<LocatedToken>& located = preprocessor.located;
+		size_t ntokens = located.size();
+
+		auto start = chrono::steady_clock::now();
+
+		for (size_t i = 0; i < ntokens; i++)
+		{
+			PresumedLocation location = preprocessor.sources.resolve(located[i].location);
+			const IndexedToken& expected = preprocessor.indexed[i];
+
+			if (*location.file != preprocessor.file_names[expected.file] || location.line != expected.line || location.column != expected.column)
+				throw runtime_error("token " + to_string(i) + " resolved to " + *location.file + ":" + to_string(location.line) + ":" +
+					to_string(location.column) + ", not " + preprocessor.file_names[expected.file] + ":" + to_string(expected.line) + ":" + to_string(expected.column));
+		}
+
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		auto megabytes = [](size_t n) { return to_string(n / 1e6).substr(0, 5) + " MB"; };
+
+		cout << ntokens << " tokens from " << preprocessor.sources.nfiles() << " files, each resolved to its file, line and column ("
+			<< ntokens / seconds / 1e6 << " M/s)" << endl;
+		cout << "  with a file name:   " << sizeof(NamedToken) << " bytes per token, " << megabytes(Bytes(preprocessor.named)) << endl;
+		cout << "  with a file index:  " << sizeof(IndexedToken) << " bytes per token, "
+			<< megabytes(preprocessor.indexed.capacity() * sizeof(IndexedToken)) << endl;
+		cout << "  with a location:    " << sizeof(LocatedToken) << " bytes per token, "
+			<< megabytes(located.capacity() * sizeof(LocatedToken)) << " (+ " << megabytes(preprocessor.sources.line_table_bytes())
+			<< " of line tables once resolved)" << endl;
+
+		if (ntokens < 1000000)
+			throw runtime_error("under 1M tokens");
+
+		if (sizeof(LocatedToken) != sizeof(Token) + 4)
+			throw runtime_error("SourceLocation takes over 4 bytes of a token");
+
+		for (const string& path : paths)
+			syscall(/* unlink */ 87, path.c_str());
+
+		syscall(/* rmdir */ 84, dir.c_str());
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+
+		for (const string& path : paths)
+			syscall(/* unlink */ 87, path.c_str());
+
+		syscall(/* rmdir */ 84, dir.c_str());
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,211 @@
+// parallel: preprocesses 400 generated source files that include the same
+// headers, through one shared IncludeCache, on 1, 2, 4, ... threads up to
+// one per core, checking the output is the same each time
+//
+// usage: bench/parallel [max threads]
+//
+// Only #include "..." is preprocessed; the output is the spellings of the
+// tokens of each source file, one per line.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <exception>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../IncludeCache.h"
+#include "../SourceBuffer.h"
+#include "../TranslationUnits.h"
+#include "Lex.h"
+
+typedef IncludeCache<PPTokens> Cache;
+
+void Preprocess(Cache& cache, const string& path, ostream& out, int depth = 0)
+{
+	if (depth > 200)
+		throw runtime_error("#include nested too deeply");
+
+	shared_ptr<const PPTokens> file = cache.get(path, Tokenize);
+
+	if (!file)
+		throw runtime_error("cannot open " + path);
+
+	const vector<Token>& tokens = file->tokens;
+
+	for (size_t i = 0; i < tokens.size(); i++)
+	{
+		bool line_start = i == 0 || tokens[i - 1].kind == TK_NEW_LINE;
+
+		if (line_start && i + 2 < tokens.size() && file->spelling(tokens[i]) == "#" &&
+			file->spelling(tokens[i + 1]) == "include" && tokens[i + 2].kind == TK_LITERAL)
+		{
+			string name = file->spelling(tokens[i + 2]);
+			Preprocess(cache, path.substr(0, path.rfind('/') + 1) + name.substr(1, name.size() - 2), out, depth + 1);
+
+			while (tokens[i].kind != TK_NEW_LINE)
+				i++;
+		}
+		else if (tokens[i].kind != TK_NEW_LINE)
+			out.write(file->text.data() + tokens[i].offset, tokens[i].size) << '\n';
+	}
+}
+
+const size_t NumSourceFiles = 400;
+const size_t NumHeaders = 8;
+
+void WriteFile(const string& path, const string& text)
+{
+	ofstream out(path);
+	out << text;
+
+	if (!out)
+		throw runtime_error("cannot write " + path);
+}
+
+string Declarations(const string& prefix, size_t n)
+{
+	string text;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		string name = prefix + to_string(i);
+		text += "/* " + name + " */ inline int " + name + "(int a, const char* s) { return a << 2 >= 0x1F ? s[0] : '\\n'; }\n";
+	}
+
+	return text;
+}
+
+void RemoveFiles(const string& dir, const vector<string>& paths)
+{
+	for (const string& path : paths)
+		syscall(/* unlink */ 87, path.c_str());
+
+	syscall(/* rmdir */ 84, dir.c_str());
+}
+
+int main(int argc, char** argv)
+{
+	string dir = "/tmp/pa5-parallel-" + to_string(syscall(/* getpid */ 39));
+	vector<string> paths;
+
+	try
+	{
+		size_t max_jobs = argc > 1 ? stoul(argv[1]) : max(1u, thread::hardware_concurrency());
+
+		if (syscall(/* mkdir */ 83, dir.c_str(), 0755) != 0)
+			throw runtime_error("cannot create " + dir);
+
+		for (size_t h = 0; h < NumHeaders; h++)
+		{
+			paths.push_back(dir + "/h" + to_string(h) + ".h");
+			WriteFile(paths.back(), Declarations("h" + to_string(h) + "_", 100));
+		}
+
+		vector<string> source_files;
+
+		for (size_t i = 0; i < NumSourceFiles; i++)
+		{
+			string text;
+
+			for (size_t h = 0; h < NumHeaders; h++)
+				text += "#include \"h" + to_string(h) + ".h\"\n";
+
+			source_files.push_back(dir + "/tu" + to_string(i) + ".cpp");
+			paths.push_back(source_files.back());
+			WriteFile(source_files.back(), text + Declarations("tu" + to_string(i) + "_", 200));
+		}
+
+		string expected;
+		double one_thread = 0;
+
+		for (size_t jobs = 1; ; jobs = min(2 * jobs, max_jobs))
+		{
+			Cache cache;
+			ostringstream out;
+			auto start = chrono::steady_clock::now();
+
+			out << "preproc " << NumSourceFiles << endl;
+
+			PreprocessInOrder(NumSourceFiles, jobs, [&](size_t i, ostream& out)
+			{
+				out << "sof " << source_files[i] << endl;
+				Preprocess(cache, source_files[i], out);
+				out << "eof" << endl;
+			}, out);
+
+			double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+			if (jobs == 1)
+			{
+				expected = out.str();
+				one_thread = seconds;
+			}
+			else if (out.str() != expected)
+				throw runtime_error("output on " + to_string(jobs) + " threads differs from that on one");
+
+			if (cache.misses < NumSourceFiles + NumHeaders || cache.hits + cache.misses != NumSourceFiles * (1 + NumHeaders))
+				throw runtime_error("unexpected cache hits and misses");
+
+			cout << NumSourceFiles << " source files on " << jobs << " threads: " << seconds << " s, "
+				<< one_thread / seconds << "x, " << cache.misses << " misses" << endl;
+
+			if (jobs == max_jobs)
+				break;
+		}
+
+		// an error stops it, after the output of the source files before
+		syscall(/* unlink */ 87, source_files[NumSourceFiles / 2].c_str());
+
+		for (size_t jobs : { size_t(1), max(size_t(2), max_jobs) })
+		{
+			Cache cache;
+			ostringstream out;
+			string error;
+
+			try
+			{
+				PreprocessInOrder(NumSourceFiles, jobs, [&](size_t i, ostream& out)
+				{
+					out << "sof " << source_files[i] << endl;
+					Preprocess(cache, source_files[i], out);
+					out << "eof" << endl;
+				}, out);
+			}
+			catch (exception& e)
+			{
+				error = e.what();
+			}
+
+			string before = expected.substr(0, expected.find("sof " + source_files[NumSourceFiles / 2] + "\n"));
+
+			if (error != "cannot open " + source_files[NumSourceFiles / 2] || out.str() != before.substr(before.find('\n') + 1) + "sof " + source_files[NumSourceFiles / 2] + "\n")
+				throw runtime_error("unexpected output on error on " + to_string(jobs) + " threads");
+		}
+
+		cout << "error output ok" << endl;
+
+		RemoveFiles(dir, paths);
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		RemoveFiles(dir, paths);
+		return EXIT_FAILURE;
+	}
+}
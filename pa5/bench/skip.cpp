@@ -0,0 +1,257 @@
+// skip: checks of skip-mode scanning, and that it finds the conditional
+// directives the tokenizer does in system headers, then skips a 16 MB
+// inactive group made of them, against tokenizing it
+//
+// usage: bench/skip
+
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../FileId.h"
+#include "../SkipScanner.h"
+#include "../SourceBuffer.h"
+#include "Lex.h"
+
+// conditional directives found from the start of `text`, one letter each:
+// i for #if*, l for #elif, e for #else, d for #endif
+string Directives(const string& text)
+{
+	static const char letters[] = "iled";
+	const char* p = text.data();
+	const char* end = p + text.size();
+	const char* line;
+	string result;
+
+	for (ESkipDirective directive; (directive = SkipScanNext(p, end, line, p)) != SKIP_END; )
+		result += letters[directive];
+
+	return result;
+}
+
+struct ScanCase
+{
+	const char* text;
+	const char* directives;
+};
+
+const ScanCase ScanCases[] =
+{
+	{ "#if 0\n#ifdef X\n#ifndef Y\n#elif 1\n#else\n#endif\n", "iiiled" },
+	{ "  #  if\n\t#endif // x\n", "id" },
+	{ "%:if\n%: endif\n", "id" },
+	{ "/* c */ # /* c */ if\n/* a\n b */ #endif\n", "id" },
+	{ "x # if\n#define if\n#include <endif>\n#ifx\n#end\n#\n", "" },
+	{ "#e\\\nndif\n#\\\nif\n", "di" },
+	{ "x \\\n#if\n#endif\n", "d" },
+	{ "// x \\\n#if\n#endif\n", "d" },
+	{ "/* x\n#if\n*/\n#endif\n", "d" },
+	{ "x /* y */ /* z\n#if */\n#endif\n", "d" },
+	{ "\"/*\"\n#if\n'/*'\n#endif\n", "id" },
+	{ "\"\\\"/*\"\n#if\n#endif\n", "id" },
+	{ "don't\n#if\nit's \"/*\n#endif\n", "id" },
+	{ "R\"(\n#if\n)\"\n#endif\n", "d" },
+	{ "u8R\"x(\n#if\n)\"\n)x\"\n#else\n", "e" },
+	{ "LR\"(\n#if\n)\" #if\n#endif\n", "d" },
+	{ "xR\"(\n#if\n)\"\n#endif\n", "id" },
+	{ "/*/ #if\n#endif */\n#else\n", "e" },
+	{ "/**/#if\n#endif", "id" },
+	{ "#if", "i" },
+	{ "/* unterminated\n#if\n", "" },
+};
+
+struct GroupCase
+{
+	const char* text;
+	ESkipDirective directive;
+
+	// line of the directive, from 1
+	size_t line;
+};
+
+const GroupCase GroupCases[] =
+{
+	{ "x\n#endif\ny\n", SKIP_ENDIF, 2 },
+	{ "#if 0\n#else\n#endif\n#else\n", SKIP_ELSE, 4 },
+	{ "#if 0\n#elif 1\n#elif 2\n#else\n#endif\n#elif 3\n#endif\n", SKIP_ELIF, 6 },
+	{ "#ifdef X\n#if Y\n#endif\n#endif\nz\n", SKIP_END, 6 },
+	{ "#if foo bar baz\n#elif foo bar baz ... @\n#else @@@@@\n#endif @@@@@\n#else\nok\n#endif\n", SKIP_ELSE, 5 },
+	{ "// c \\\n/* x\n#endif\n", SKIP_ENDIF, 3 },
+	{ "// \"c \\\n/* x\n#endif\n", SKIP_ENDIF, 3 },
+};
+
+const char* const ErrorCases[] =
+{
+	"#if foo bar baz\n#else @@@@@\n#elif foo bar baz ... @\n#endif @@@@@\n#else\nok\n#endif\n",
+	"#if 0\n#else\n#else\n#endif\n#endif\n",
+};
+
+void CheckCases()
+{
+	for (const ScanCase& c : ScanCases)
+		if (Directives(c.text) != c.directives)
+			throw runtime_error("skip scan found \"" + Directives(c.text) + "\", not \"" + c.directives + "\", in:\n" + c.text);
+
+	for (const GroupCase& c : GroupCases)
+	{
+		string text = c.text;
+		const char* line;
+		const char* next;
+		ESkipDirective directive = SkipGroup(text.data(), text.data() + text.size(), line, next);
+
+		if (directive != c.directive || size_t(count(text.data(), line, '\n') + 1) != c.line)
+			throw runtime_error(string("group ended wrongly:\n") + c.text);
+	}
+
+	for (const char* text : ErrorCases)
+	{
+		const char* line;
+		const char* next;
+
+		try
+		{
+			SkipGroup(text, text + strlen(text), line, next);
+		}
+		catch (runtime_error&)
+		{
+			continue;
+		}
+
+		throw runtime_error(string("misordered group not diagnosed:\n") + text);
+	}
+
+	cout << "skip scanning ok (" << sizeof ScanCases / sizeof ScanCases[0] + sizeof GroupCases / sizeof GroupCases[0] +
+		sizeof ErrorCases / sizeof ErrorCases[0] << " cases)" << endl;
+}
+
+// conditional directives of `file`, from its tokens, as Directives does
+string TokenizedDirectives(const PPTokens& file)
+{
+	const vector<Token>& tokens = file.tokens;
+	string result;
+
+	for (size_t i = 0; i + 1 < tokens.size(); i++)
+	{
+		if ((i != 0 && tokens[i - 1].kind != TK_NEW_LINE) || file.spelling(tokens[i]) != "#")
+			continue;
+
+		string name = file.spelling(tokens[i + 1]);
+
+		if (name == "if" || name == "ifdef" || name == "ifndef")
+			result += 'i';
+		else if (name == "elif")
+			result += 'l';
+		else if (name == "else")
+			result += 'e';
+		else if (name == "endif")
+			result += 'd';
+	}
+
+	return result;
+}
+
+const char* const Headers[] =
+{
+	"assert.h", "ctype.h", "dirent.h", "errno.h", "fcntl.h", "glob.h", "inttypes.h", "limits.h",
+	"locale.h", "math.h", "netdb.h", "pthread.h", "regex.h", "sched.h", "search.h", "setjmp.h",
+	"signal.h", "stdint.h", "stdio.h", "stdlib.h", "string.h", "termios.h", "time.h", "unistd.h",
+	"wchar.h", "wctype.h", "x86_64-linux-gnu/bits/types.h", "x86_64-linux-gnu/sys/stat.h",
+	"x86_64-linux-gnu/sys/types.h", "x86_64-linux-gnu/bits/stdio.h", "x86_64-linux-gnu/bits/mathcalls.h"
+};
+
+int main()
+{
+	string path = "/tmp/pa5-skip-" + to_string(syscall(/* getpid */ 39)) + ".h";
+
+	try
+	{
+		CheckCases();
+
+		// system headers: the same directives as tokenized
+		string headers;
+		size_t nheaders = 0;
+
+		for (const char* name : Headers)
+		{
+			string header = string("/usr/include/") + name;
+			PA5FileId id;
+
+			if (!PA5GetFileId(header, id))
+				continue;
+
+			SourceBuffer contents(header);
+			string text(contents.begin(), contents.end());
+
+			if (Directives(text) != TokenizedDirectives(Tokenize(header)))
+				throw runtime_error("skip scan and tokenizer differ on " + header);
+
+			headers += text + "\n";
+			nheaders++;
+		}
+
+		if (nheaders == 0)
+			throw runtime_error("no headers in /usr/include");
+
+		cout << nheaders << " headers of /usr/include scanned as tokenized" << endl;
+
+		// an inactive group of them, 16 MB
+		const size_t GroupSize = 16 << 20;
+		{
+			string group;
+
+			while (group.size() < GroupSize)
+				group += headers;
+
+			ofstream out(path);
+			out << group << "#else\n";
+		}
+
+		SourceBuffer group(path);
+		size_t nbytes = group.size();
+		const size_t Runs = 10;
+
+		auto start = chrono::steady_clock::now();
+		size_t ntokens = Tokenize(path).tokens.size();
+		double tokenize_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		start = chrono::steady_clock::now();
+
+		for (size_t run = 0; run < Runs; run++)
+		{
+			const char* line;
+			const char* next;
+
+			if (SkipGroup(group.begin(), group.end(), line, next) != SKIP_ELSE || next != group.end())
+				throw runtime_error("inactive group ended wrongly");
+		}
+
+		double skip_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count() / Runs;
+
+		cout << "inactive group of " << nbytes << " bytes (" << ntokens << " tokens):" << endl;
+		cout << "  tokenizing: " << nbytes / tokenize_seconds / 1e6 << " MB/s" << endl;
+		cout << "  skipping:   " << nbytes / skip_seconds / 1e6 << " MB/s, " << tokenize_seconds / skip_seconds << "x" << endl;
+
+		syscall(/* unlink */ 87, path.c_str());
+
+		const double MinBytesPerSecond = 200e6;
+
+		if (nbytes / skip_seconds < MinBytesPerSecond)
+			throw runtime_error("skipping under 200 MB/s");
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		syscall(/* unlink */ 87, path.c_str());
+		return EXIT_FAILURE;
+	}
+}
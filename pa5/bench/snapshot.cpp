@@ -0,0 +1,252 @@
+// snapshot: tokenizes system headers from /usr/include cold, saving token
+// snapshots, then loads them warm, as a later run would, checking the
+// tokens are the same, and that stale snapshots are not used
+//
+// usage: bench/snapshot
+//
+// The macro table delta saved with a header here is the names of the
+// macros it #defines, one per line.
+
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "../TokenSnapshot.h"
+#include "Lex.h"
+
+const char* const Headers[] =
+{
+	"assert.h", "ctype.h", "dirent.h", "errno.h", "fcntl.h", "glob.h", "inttypes.h", "limits.h",
+	"locale.h", "math.h", "netdb.h", "pthread.h", "regex.h", "sched.h", "search.h", "setjmp.h",
+	"signal.h", "stdint.h", "stdio.h", "stdlib.h", "string.h", "termios.h", "time.h", "unistd.h",
+	"wchar.h", "wctype.h", "x86_64-linux-gnu/bits/types.h", "x86_64-linux-gnu/sys/stat.h",
+	"x86_64-linux-gnu/sys/types.h", "x86_64-linux-gnu/bits/stdio.h", "x86_64-linux-gnu/bits/mathcalls.h"
+};
+
+const uint64_t MacroState = 0x5eed;
+
+// macro table delta of a tokenized header
+string Delta(const PPTokens& file)
+{
+	const vector<Token>& tokens = file.tokens;
+	string delta;
+
+	for (size_t i = 0; i + 2 < tokens.size(); i++)
+	{
+		if ((i == 0 || tokens[i - 1].kind == TK_NEW_LINE) && file.spelling(tokens[i]) == "#" &&
+			file.spelling(tokens[i + 1]) == "define")
+			delta += file.spelling(tokens[i + 2]) + "\n";
+	}
+
+	return delta;
+}
+
+// hash of the spellings of `n` tokens that are slices of `text`
+uint64_t SpellingsHash(const char* text, const Token* tokens, size_t n)
+{
+	uint64_t h = SnapshotHash(nullptr, 0);
+
+	for (size_t i = 0; i < n; i++)
+		h = SnapshotHash(text + tokens[i].offset, tokens[i].size, h * 31 + tokens[i].kind);
+
+	return h;
+}
+
+struct Header
+{
+	string path;
+	size_t ntokens;
+	uint64_t hash;
+	string delta;
+};
+
+void WriteFile(const string& path, const string& text)
+{
+	ofstream out(path);
+	out << text;
+
+	if (!out)
+		throw runtime_error("cannot write " + path);
+}
+
+// a header rewritten with the same size and mtime is not taken from its
+// snapshot, and neither is one preprocessed with other macros
+void CheckStale(SnapshotStore<Token>& store, const string& path)
+{
+	struct
+	{
+		long int sec;
+		long int nsec;
+	} times[2] = { { 0, /* UTIME_OMIT */ (1l << 30) - 2 }, { 1000000000, 0 } };
+
+	WriteFile(path, "int a;\n");
+	syscall(/* utimensat */ 280, /* AT_FDCWD */ -100, path.c_str(), times, 0);
+
+	PPTokens file = Tokenize(path);
+	SnapshotKey key;
+	GetSnapshotKey(path, MacroState, key);
+	store.save(key, Delta(file), file.text, file.tokens);
+
+	SnapshotKey other_macros = key;
+	other_macros.macro_state++;
+
+	if (!store.load(key) || store.load(other_macros))
+		throw runtime_error("snapshot of " + path + " not used, or used with other macros");
+
+	WriteFile(path, "int b;\n");
+	syscall(/* utimensat */ 280, /* AT_FDCWD */ -100, path.c_str(), times, 0);
+
+	SnapshotKey rewritten;
+	GetSnapshotKey(path, MacroState, rewritten);
+
+	if (!(rewritten.stamp == key.stamp) || store.load(rewritten))
+		throw runtime_error("stale snapshot of " + path + " used");
+
+	syscall(/* unlink */ 87, store.path(key).c_str());
+	syscall(/* unlink */ 87, path.c_str());
+	cout << "stale snapshots ok" << endl;
+}
+
+int main()
+{
+	string dir = "/tmp/pa5-snapshot-" + to_string(syscall(/* getpid */ 39));
+	vector<Header> headers;
+
+	try
+	{
+		if (syscall(/* mkdir */ 83, dir.c_str(), 0755) != 0)
+			throw runtime_error("cannot create " + dir);
+
+		for (const char* name : Headers)
+		{
+			string path = string("/usr/include/") + name;
+			PA5FileId id;
+
+			if (!PA5GetFileId(path, id))
+				continue;
+
+			try
+			{
+				PPTokens file = Tokenize(path);
+				headers.push_back(Header{path, file.tokens.size(), SpellingsHash(file.text.data(), file.tokens.data(), file.tokens.size()), Delta(file)});
+			}
+			catch (exception& e)
+			{
+				// not tokenizable by Lex
+			}
+		}
+
+		if (headers.empty())
+			throw runtime_error("no headers in /usr/include");
+
+		size_t ntokens = 0;
+
+		for (const Header& header : headers)
+			ntokens += header.ntokens;
+
+		// cold: tokenize each header and save its snapshot
+		SnapshotStore<Token> cold(dir);
+		auto start = chrono::steady_clock::now();
+
+		for (const Header& header : headers)
+		{
+			SnapshotKey key;
+			GetSnapshotKey(header.path, MacroState, key);
+
+			if (cold.load(key))
+				throw runtime_error("snapshot before the cold run");
+
+			PPTokens file = Tokenize(header.path);
+			cold.save(key, Delta(file), file.text, file.tokens);
+		}
+
+		double cold_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		// warm: load each snapshot, as a later run (with a store of its own)
+		const size_t Runs = 20;
+		double tokenize_seconds = 0, warm_seconds = 0;
+		uint64_t sink = 0;
+
+		for (size_t run = 0; run < Runs; run++)
+		{
+			start = chrono::steady_clock::now();
+
+			for (const Header& header : headers)
+				sink += Tokenize(header.path).tokens.size();
+
+			tokenize_seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+			SnapshotStore<Token> warm(dir);
+			start = chrono::steady_clock::now();
+
+			for (const Header& header : headers)
+			{
+				SnapshotKey key;
+				GetSnapshotKey(header.path, MacroState, key);
+				auto snapshot = warm.load(key);
+
+				if (!snapshot)
+					throw runtime_error("no snapshot of " + header.path);
+
+				sink += snapshot->ntokens();
+			}
+
+			warm_seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+			if (warm.hits != headers.size() || warm.misses != 0)
+				throw runtime_error("unexpected snapshot misses");
+		}
+
+		// the snapshots' tokens and deltas are those of tokenizing
+		SnapshotStore<Token> check(dir);
+
+		for (const Header& header : headers)
+		{
+			SnapshotKey key;
+			GetSnapshotKey(header.path, MacroState, key);
+			auto snapshot = check.load(key);
+
+			if (snapshot->ntokens() != header.ntokens ||
+				SpellingsHash(snapshot->text(), snapshot->tokens(), snapshot->ntokens()) != header.hash ||
+				string(snapshot->delta(), snapshot->delta_size()) != header.delta)
+				throw runtime_error("snapshot of " + header.path + " differs");
+		}
+
+		cout << headers.size() << " headers of /usr/include (" << ntokens << " tokens):" << endl;
+		cout << "  cold (tokenize and save): " << cold_seconds * 1000 << " ms" << endl;
+		cout << "  tokenize:                 " << tokenize_seconds / Runs * 1000 << " ms" << endl;
+		cout << "  warm (map snapshots):     " << warm_seconds / Runs * 1000 << " ms, " << tokenize_seconds / warm_seconds << "x" << endl;
+
+		if (sink != 2 * Runs * ntokens)
+			throw runtime_error("unexpected token count");
+
+		CheckStale(check, dir + "/header.h");
+
+		for (const Header& header : headers)
+		{
+			SnapshotKey key;
+			GetSnapshotKey(header.path, MacroState, key);
+			syscall(/* unlink */ 87, cold.path(key).c_str());
+		}
+
+		if (syscall(/* rmdir */ 84, dir.c_str()) != 0)
+			throw runtime_error("files left in " + dir);
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -6,33 +6,22 @@
 #include <vector>
 #include <stdexcept>
 #include <fstream>
+#include <sstream>
+#include <memory>
+#include <unordered_map>
+#include <exception>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <unordered_set>
 
 using namespace std;
 
-// For pragma once implementation:
-// system-wide unique file id type `PA5FileId`
-typedef pair<unsigned long int, unsigned long int> PA5FileId;
-
-// bootstrap system call interface, used by PA5GetFileId
-extern "C" long int syscall(long int n, ...) throw ();
-
-// PA5GetFileId returns true iff file found at path `path`.
-// out parameter `out_fileid` is set to file id
-bool PA5GetFileId(const string& path, PA5FileId& out_fileid)
-{
-	struct
-	{
-			unsigned long int dev;
-			unsigned long int ino;
-			long int unused[16];
-	} data;
-
-	int res = syscall(4, path.c_str(), &data);
-
-	out_fileid = make_pair(data.dev, data.ino);
-
-	return res == 0;
-}
+#include "FileId.h"
+#include "SourceBuffer.h"
+#include "IncludeResolver.h"
+#include "TranslationUnits.h"
 
 // OPTIONAL: Also search `PA5StdIncPaths` on `--stdinc` command-line switch (not by default)
 vector<string> PA5StdIncPaths =
@@ -47,6 +36,20 @@ vector<string> PA5StdIncPaths =
     "/usr/include/"
 };
 
+// write the per-srcfile section of `srcfile` to `out`, looking up #include
+// files with `resolver`
+void PreprocessFile(const string& srcfile, IncludeResolver& resolver, ostream& out)
+{
+	out << "sof " << srcfile << endl;
+
+	SourceBuffer in(srcfile);
+
+	// TODO: implement `preproc` as per PA5 description
+	out << "not yet implemented" << endl;
+
+	out << "eof" << endl;
+}
+
 int main(int argc, char** argv)
 {
 	try
@@ -60,26 +63,66 @@ int main(int argc, char** argv)
 			throw logic_error("invalid usage");
 
 		string outfile = args[1];
-		size_t nsrcfiles = args.size() - 2;
+		args.erase(args.begin(), args.begin() + 2);
 
-		ofstream out(outfile);
+		// `-j N`: preprocess srcfiles on N threads (0: one per core)
+		size_t jobs = 1;
 
-		out << "preproc " << nsrcfiles << endl;
+		// `--stdinc`: also search PA5StdIncPaths for #include files
+		bool stdinc = false;
 
-		for (size_t i = 0; i < nsrcfiles; i++)
+		while (!args.empty() && args[0][0] == '-')
 		{
-			string srcfile = args[i+2];
+			if (args[0].compare(0, 2, "-j") == 0)
+			{
+				string n = args[0].size() > 2 ? args[0].substr(2) : args.size() > 1 ? args[1] : "";
+
+				if (n.empty() || n.find_first_not_of("0123456789") != string::npos)
+					throw logic_error("invalid usage: -j expects a number of threads");
+
+				args.erase(args.begin(), args.begin() + (args[0].size() > 2 ? 1 : 2));
+				jobs = stoul(n);
+
+				if (jobs == 0)
+					jobs = max(1u, thread::hardware_concurrency());
+			}
+			else if (args[0].compare(0, 10, "--pch-dir=") == 0)
+			{
+				// `--pch-dir=DIR`: read and write token snapshots of headers
+				// in DIR (see TokenSnapshot.h), once there are tokens to
+				// snapshot
+				throw logic_error("--pch-dir is not supported yet: preproc does not tokenize headers");
+			}
+			else if (args[0] == "--stdinc")
+			{
+				stdinc = true;
+				args.erase(args.begin());
+			}
+			else if (args[0] == "--stats")
+			{
+				// `--stats`: write the system calls of #include lookups to
+				// stderr (see IncludeStats), once #include is processed
+				throw logic_error("--stats is not supported yet: preproc does not process #include");
+			}
+			else
+				throw logic_error("invalid usage: unknown switch " + args[0]);
+		}
+
+		if (args.empty())
+			throw logic_error("invalid usage");
+
+		size_t nsrcfiles = args.size();
 
-			out << "sof " << srcfile << endl;
+		ofstream out(outfile);
 
-			ifstream in(srcfile);
+		out << "preproc " << nsrcfiles << endl;
 
-			// TODO: implement `preproc` as per PA5 description
-			out << "not yet implemented" << endl;
-	
-			out << "eof" << endl;
+		IncludeResolver resolver(stdinc ? PA5StdIncPaths : vector<string>());
 
-		}
+		PreprocessInOrder(nsrcfiles, jobs, [&](size_t i, ostream& out)
+		{
+			PreprocessFile(args[i], resolver, out);
+		}, out);
 	}
 	catch (exception& e)
 	{
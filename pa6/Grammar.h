@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ParseToken.h"
+
+// Compiled grammar
+//
+// llgen compiles pa6.gram into GrammarTables.h: each nonterminal's
+// alternatives as sequences of GrammarItems, its FIRST and FOLLOW sets,
+// and an LL(1) table giving, for each nonterminal and kind of lookahead
+// token, the alternatives that can start with it.  Where the grammar is
+// LL(1) that is at most one alternative; where it is not, the parser tries
+// each of them (see Parser.h).
+//
+// A GrammarItem repeats its symbol as the ?, * and + of pa6.gram; a
+// parenthesized group becomes a nonterminal of its own, named after the
+// nonterminal it is in (`pm-expression.1`).
+
+// repetition of an item
+enum ERepeat : uint8_t
+{
+	REPEAT_ONE,
+	REPEAT_OPTIONAL,
+	REPEAT_STAR,
+	REPEAT_PLUS
+};
+
+// bracket context an item is parsed in (14.2/3): between an OP_LT and the
+// close-angle-bracket that closes it, an OP_GT or ST_RSHIFT_1 is never an
+// operator, while inside (), [] and {} it can be again
+enum EItemContext : uint8_t
+{
+	CONTEXT_INHERIT,
+	CONTEXT_ANGLE,
+	CONTEXT_PLAIN
+};
+
+// KindSet: set of token kinds
+struct KindSet
+{
+	static constexpr int NumWords = (NumTokenKinds + 63) / 64;
+
+	uint64_t words[NumWords];
+
+	bool has(int kind) const
+	{
+		return words[kind / 64] >> (kind % 64) & 1;
+	}
+};
+
+struct GrammarItem
+{
+	// terminal, or NumTerminals + nonterminal
+	uint16_t symbol;
+
+	ERepeat repeat;
+	EItemContext context;
+
+	// an OP_GT or ST_RSHIFT_1 used as an operator, not matched inside angle
+	// brackets
+	bool operator_in_angle;
+
+	// KindSets: lookaheads that the symbol can start with (`take`), and,
+	// unless REPEAT_ONE, that can follow the item if it stops repeating
+	// (`skip`)
+	uint16_t take;
+	uint16_t skip;
+};
@@ -0,0 +1,4077 @@
+#pragma once
+
+// generated by llgen from pa6.gram, do not edit
+//
+// 226 nonterminals, 498 alternatives, 1094 items
+//
+// LL(1) conflicts, where the parser backtracks (155 nonterminals memoized):
+//
+//   type-name, on ST_CLASS_NAME ST_ENUM_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     class-name
+//     enum-name
+//     typedef-name
+//     simple-template-id
+//
+//   class-name, on ST_CLASS_NAME ST_TEMPLATE_NAME:
+//     TT_IDENTIFIER
+//     simple-template-id
+//
+//   id-expression, on TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     unqualified-id
+//     qualified-id
+//
+//   unqualified-id, on KW_OPERATOR OP_COMPL TT_IDENTIFIER ST_TEMPLATE_NAME:
+//     TT_IDENTIFIER
+//     operator-function-id
+//     conversion-function-id
+//     literal-operator-id
+//     OP_COMPL class-name
+//     OP_COMPL decltype-specifier
+//     template-id
+//
+//   nested-name-specifier-root, on ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     type-name OP_COLON2
+//     namespace-name OP_COLON2
+//
+//   nested-name-specifier-suffix, on TT_IDENTIFIER ST_TEMPLATE_NAME:
+//     TT_IDENTIFIER OP_COLON2
+//     KW_TEMPLATE? simple-template-id OP_COLON2
+//
+//   lambda-capture, on OP_AMP OP_ASS:
+//     capture-default
+//     capture-list
+//     capture-default OP_COMMA capture-list
+//
+//   postfix-root, on KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_DECLTYPE KW_DOUBLE KW_FLOAT KW_INT KW_LONG KW_SHORT KW_SIGNED KW_TYPEID KW_TYPENAME KW_UNSIGNED KW_VOID KW_WCHAR_T OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     primary-expression
+//     simple-type-specifier OP_LPAREN expression-list? OP_RPAREN
+//     typename-specifier OP_LPAREN expression-list? OP_RPAREN
+//     simple-type-specifier braced-init-list
+//     typename-specifier braced-init-list
+//     KW_TYPEID OP_LPAREN expression OP_RPAREN
+//     KW_TYPEID OP_LPAREN type-id OP_RPAREN
+//
+//   postfix-suffix, on OP_LSQUARE OP_DOT OP_ARROW:
+//     OP_LSQUARE expression OP_RSQUARE
+//     OP_LSQUARE braced-init-list OP_RSQUARE
+//     OP_DOT pseudo-destructor-name
+//     OP_DOT KW_TEMPLATE? id-expression
+//     OP_ARROW pseudo-destructor-name
+//     OP_ARROW KW_TEMPLATE? id-expression
+//
+//   pseudo-destructor-name, on OP_COMPL:
+//     nested-name-specifier? OP_COMPL type-name
+//     OP_COMPL decltype-specifier
+//
+//   unary-expression, on KW_SIZEOF OP_COMPL OP_COLON2:
+//     postfix-expression
+//     unary-operator cast-expression
+//     KW_SIZEOF unary-expression
+//     KW_SIZEOF OP_LPAREN type-id OP_RPAREN
+//     KW_SIZEOF OP_DOTS OP_LPAREN TT_IDENTIFIER OP_RPAREN
+//     new-expression
+//     delete-expression
+//
+//   new-expression, on KW_NEW OP_COLON2:
+//     OP_COLON2? KW_NEW new-placement? new-type-id new-initializer?
+//     OP_COLON2? KW_NEW new-placement? OP_LPAREN type-id OP_RPAREN new-initializer?
+//
+//   new-declarator, on KW_DECLTYPE OP_AMP OP_COLON2 OP_STAR OP_LAND ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     ptr-operator* noptr-new-declarator
+//     ptr-operator+
+//
+//   delete-expression, on KW_DELETE OP_COLON2:
+//     OP_COLON2? KW_DELETE cast-expression
+//     OP_COLON2? KW_DELETE OP_LSQUARE OP_RSQUARE cast-expression
+//
+//   cast-expression, on OP_LPAREN:
+//     unary-expression
+//     cast-operator cast-expression
+//
+//   assignment-expression, on KW_ALIGNOF KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_CONST_CAST KW_DECLTYPE KW_DELETE KW_DOUBLE KW_DYNAMIC_CAST KW_FALSE KW_FLOAT KW_INT KW_LONG KW_NEW KW_NOEXCEPT KW_NULLPTR KW_OPERATOR KW_REINTERPET_CAST KW_SHORT KW_SIGNED KW_SIZEOF KW_STATIC_CAST KW_THIS KW_TRUE KW_TYPEID KW_TYPENAME KW_UNSIGNED KW_VOID KW_WCHAR_T OP_LSQUARE OP_LPAREN OP_COMPL OP_AMP OP_LNOT OP_COLON2 OP_PLUS OP_MINUS OP_STAR OP_INC OP_DEC TT_IDENTIFIER TT_LITERAL ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     conditional-expression
+//     logical-or-expression assignment-operator initializer-clause
+//
+//   statement, on KW_ALIGNAS KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_DECLTYPE KW_DOUBLE KW_FLOAT KW_INT KW_LONG KW_SHORT KW_SIGNED KW_TYPENAME KW_UNSIGNED KW_VOID KW_WCHAR_T OP_LSQUARE OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     labeled-statement
+//     attribute-specifier* expression-statement
+//     attribute-specifier* compound-statement
+//     attribute-specifier* selection-statement
+//     attribute-specifier* iteration-statement
+//     attribute-specifier* jump-statement
+//     declaration-statement
+//     attribute-specifier* try-block
+//
+//   labeled-statement, on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* TT_IDENTIFIER OP_COLON statement
+//     attribute-specifier* KW_CASE constant-expression OP_COLON statement
+//     attribute-specifier* KW_DEFAULT OP_COLON statement
+//
+//   selection-statement, on KW_IF:
+//     KW_IF OP_LPAREN condition OP_RPAREN statement
+//     KW_IF OP_LPAREN condition OP_RPAREN statement KW_ELSE statement
+//
+//   condition-declaration, on KW_ALIGNAS KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_CLASS KW_CONST KW_CONSTEXPR KW_DECLTYPE KW_DOUBLE KW_ENUM KW_EXPLICIT KW_EXTERN KW_FLOAT KW_FRIEND KW_INLINE KW_INT KW_LONG KW_MUTABLE KW_REGISTER KW_SHORT KW_SIGNED KW_STATIC KW_STRUCT KW_THREAD_LOCAL KW_TYPEDEF KW_TYPENAME KW_UNION KW_UNSIGNED KW_VIRTUAL KW_VOID KW_VOLATILE KW_WCHAR_T OP_LSQUARE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     attribute-specifier* decl-specifier-seq declarator OP_ASS initializer-clause
+//     attribute-specifier* decl-specifier-seq declarator braced-init-list
+//
+//   condition, on KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_DECLTYPE KW_DOUBLE KW_FLOAT KW_INT KW_LONG KW_SHORT KW_SIGNED KW_TYPENAME KW_UNSIGNED KW_VOID KW_WCHAR_T OP_LSQUARE OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     condition-declaration
+//     expression
+//
+//   iteration-statement, on KW_FOR:
+//     KW_FOR OP_LPAREN for-init-statement condition? OP_SEMICOLON expression? OP_RPAREN statement
+//     KW_FOR OP_LPAREN for-range-declaration OP_COLON for-range-initializer OP_RPAREN statement
+//
+//   for-init-statement, on KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_DECLTYPE KW_DOUBLE KW_FLOAT KW_INT KW_LONG KW_SHORT KW_SIGNED KW_TYPENAME KW_UNSIGNED KW_VOID KW_WCHAR_T OP_LSQUARE OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     expression-statement
+//     simple-declaration
+//
+//   jump-statement, on KW_RETURN:
+//     KW_RETURN expression? OP_SEMICOLON
+//     KW_RETURN braced-init-list OP_SEMICOLON
+//
+//   declaration, on KW_ALIGNAS KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_CLASS KW_CONST KW_CONSTEXPR KW_DECLTYPE KW_DOUBLE KW_ENUM KW_EXPLICIT KW_EXTERN KW_FLOAT KW_FRIEND KW_INLINE KW_INT KW_LONG KW_MUTABLE KW_NAMESPACE KW_REGISTER KW_SHORT KW_SIGNED KW_STATIC KW_STRUCT KW_TEMPLATE KW_THREAD_LOCAL KW_TYPEDEF KW_TYPENAME KW_UNION KW_UNSIGNED KW_VIRTUAL KW_VOID KW_VOLATILE KW_WCHAR_T OP_LSQUARE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     block-declaration
+//     function-definition
+//     template-declaration
+//     explicit-instantiation
+//     explicit-specialization
+//     linkage-specification
+//     namespace-definition
+//     attribute-declaration
+//
+//   block-declaration, on KW_ALIGNAS KW_ENUM KW_USING OP_LSQUARE:
+//     simple-declaration
+//     using-declaration
+//     using-directive
+//     alias-declaration
+//     opaque-enum-declaration
+//
+//   type-specifier, on KW_CLASS KW_ENUM KW_STRUCT KW_UNION:
+//     trailing-type-specifier
+//     class-specifier
+//     enum-specifier
+//
+//   simple-type-specifier, on KW_DECLTYPE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? type-name
+//     nested-name-specifier KW_TEMPLATE simple-template-id
+//     decltype-specifier
+//
+//   elaborated-type-specifier, on KW_CLASS KW_STRUCT KW_UNION:
+//     class-key attribute-specifier* nested-name-specifier? TT_IDENTIFIER
+//     class-key nested-name-specifier? KW_TEMPLATE? simple-template-id
+//
+//   enum-specifier, on KW_ENUM:
+//     enum-head OP_LBRACE enumerator-list? OP_RBRACE
+//     enum-head OP_LBRACE enumerator-list OP_COMMA OP_RBRACE
+//
+//   enum-head, on KW_ENUM:
+//     enum-key attribute-specifier* TT_IDENTIFIER? enum-base?
+//     enum-key attribute-specifier* nested-name-specifier TT_IDENTIFIER enum-base?
+//
+//   enum-key, on KW_ENUM:
+//     KW_ENUM
+//     KW_ENUM KW_CLASS
+//     KW_ENUM KW_STRUCT
+//
+//   enumerator-definition, on TT_IDENTIFIER:
+//     enumerator
+//     enumerator OP_ASS constant-expression
+//
+//   using-declaration, on KW_USING:
+//     KW_USING KW_TYPENAME? nested-name-specifier unqualified-id OP_SEMICOLON
+//     KW_USING OP_COLON2 unqualified-id OP_SEMICOLON
+//
+//   linkage-specification, on KW_EXTERN:
+//     KW_EXTERN TT_LITERAL OP_LBRACE declaration* OP_RBRACE
+//     KW_EXTERN TT_LITERAL declaration
+//
+//   alignment-specifier, on KW_ALIGNAS:
+//     KW_ALIGNAS OP_LPAREN type-id OP_DOTS? OP_RPAREN
+//     KW_ALIGNAS OP_LPAREN assignment-expression OP_DOTS? OP_RPAREN
+//
+//   attribute-part, on TT_IDENTIFIER:
+//     attribute?
+//     attribute OP_DOTS
+//
+//   attribute-token, on TT_IDENTIFIER:
+//     TT_IDENTIFIER
+//     attribute-scoped-token
+//
+//   declarator, on KW_DECLTYPE KW_OPERATOR OP_LPAREN OP_COMPL OP_DOTS OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     ptr-declarator
+//     noptr-declarator trailing-return-type
+//
+//   abstract-declarator, on KW_DECLTYPE OP_LSQUARE OP_LPAREN OP_AMP OP_COLON2 OP_STAR OP_LAND ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     ptr-abstract-declarator
+//     noptr-abstract-declarator? trailing-return-type
+//     abstract-pack-declarator
+//
+//   ptr-abstract-declarator, on KW_DECLTYPE OP_AMP OP_COLON2 OP_STAR OP_LAND ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     ptr-operator* noptr-abstract-declarator
+//     ptr-operator+
+//
+//   noptr-abstract-declarator, on OP_LSQUARE OP_LPAREN:
+//     noptr-abstract-declarator-root noptr-declarator-suffix*
+//     noptr-declarator-suffix+
+//
+//   noptr-abstract-declarator-root, on OP_LPAREN:
+//     noptr-declarator-suffix
+//     OP_LPAREN ptr-abstract-declarator OP_RPAREN
+//
+//   parameter-declaration-clause, on KW_ALIGNAS KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_CLASS KW_CONST KW_CONSTEXPR KW_DECLTYPE KW_DOUBLE KW_ENUM KW_EXPLICIT KW_EXTERN KW_FLOAT KW_FRIEND KW_INLINE KW_INT KW_LONG KW_MUTABLE KW_REGISTER KW_SHORT KW_SIGNED KW_STATIC KW_STRUCT KW_THREAD_LOCAL KW_TYPEDEF KW_TYPENAME KW_UNION KW_UNSIGNED KW_VIRTUAL KW_VOID KW_VOLATILE KW_WCHAR_T OP_LSQUARE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     parameter-declaration-list? OP_DOTS?
+//     parameter-declaration-list OP_COMMA OP_DOTS
+//
+//   parameter-declaration, on KW_ALIGNAS KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_CLASS KW_CONST KW_CONSTEXPR KW_DECLTYPE KW_DOUBLE KW_ENUM KW_EXPLICIT KW_EXTERN KW_FLOAT KW_FRIEND KW_INLINE KW_INT KW_LONG KW_MUTABLE KW_REGISTER KW_SHORT KW_SIGNED KW_STATIC KW_STRUCT KW_THREAD_LOCAL KW_TYPEDEF KW_TYPENAME KW_UNION KW_UNSIGNED KW_VIRTUAL KW_VOID KW_VOLATILE KW_WCHAR_T OP_LSQUARE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     attribute-specifier* decl-specifier-seq declarator
+//     attribute-specifier* decl-specifier-seq declarator OP_ASS initializer-clause
+//     attribute-specifier* decl-specifier-seq abstract-declarator?
+//     attribute-specifier* decl-specifier-seq abstract-declarator? OP_ASS initializer-clause
+//
+//   function-body, on OP_ASS:
+//     OP_ASS KW_DEFAULT OP_SEMICOLON
+//     OP_ASS KW_DELETE OP_SEMICOLON
+//
+//   braced-init-list, on OP_LBRACE:
+//     OP_LBRACE initializer-list OP_COMMA? OP_RBRACE
+//     OP_LBRACE OP_RBRACE
+//
+//   class-head, on KW_CLASS KW_STRUCT KW_UNION:
+//     class-key attribute-specifier* class-head-name class-virt-specifier? base-clause?
+//     class-key attribute-specifier* base-clause?
+//
+//   member-declaration, on KW_ALIGNAS KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_CLASS KW_CONST KW_CONSTEXPR KW_DECLTYPE KW_DOUBLE KW_ENUM KW_EXPLICIT KW_EXTERN KW_FLOAT KW_FRIEND KW_INLINE KW_INT KW_LONG KW_MUTABLE KW_REGISTER KW_SHORT KW_SIGNED KW_STATIC KW_STRUCT KW_THREAD_LOCAL KW_TYPEDEF KW_TYPENAME KW_UNION KW_UNSIGNED KW_USING KW_VIRTUAL KW_VOID KW_VOLATILE KW_WCHAR_T OP_LSQUARE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     attribute-specifier* decl-specifier-seq member-declarator-list? OP_SEMICOLON
+//     function-definition OP_SEMICOLON?
+//     using-declaration
+//     alias-declaration
+//
+//   member-declarator, on KW_DECLTYPE KW_OPERATOR OP_LPAREN OP_COMPL OP_AMP OP_DOTS OP_COLON2 OP_STAR OP_LAND TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     declarator virt-specifier* pure-specifier?
+//     declarator brace-or-equal-initializer?
+//     TT_IDENTIFIER? attribute-specifier* OP_COLON constant-expression
+//
+//   base-specifier, on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* base-type-specifier
+//     attribute-specifier* KW_VIRTUAL access-specifier? base-type-specifier
+//     attribute-specifier* access-specifier KW_VIRTUAL? base-type-specifier
+//
+//   class-or-decltype, on KW_DECLTYPE:
+//     nested-name-specifier? class-name
+//     decltype-specifier
+//
+//   mem-initializer, on KW_DECLTYPE OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     mem-initializer-id OP_LPAREN expression-list? OP_RPAREN
+//     mem-initializer-id braced-init-list
+//
+//   mem-initializer-id, on TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     class-or-decltype
+//     TT_IDENTIFIER
+//
+//   operator-function-id, on KW_OPERATOR:
+//     KW_OPERATOR KW_NEW
+//     KW_OPERATOR KW_NEW OP_LSQUARE OP_RSQUARE
+//     KW_OPERATOR KW_DELETE
+//     KW_OPERATOR KW_DELETE OP_LSQUARE OP_RSQUARE
+//     KW_OPERATOR OP_PLUS
+//     KW_OPERATOR OP_MINUS
+//     KW_OPERATOR OP_STAR
+//     KW_OPERATOR OP_DIV
+//     KW_OPERATOR OP_MOD
+//     KW_OPERATOR OP_XOR
+//     KW_OPERATOR OP_AMP
+//     KW_OPERATOR OP_BOR
+//     KW_OPERATOR OP_COMPL
+//     KW_OPERATOR OP_LNOT
+//     KW_OPERATOR OP_ASS
+//     KW_OPERATOR OP_LT
+//     KW_OPERATOR OP_GT
+//     KW_OPERATOR OP_PLUSASS
+//     KW_OPERATOR OP_MINUSASS
+//     KW_OPERATOR OP_STARASS
+//     KW_OPERATOR OP_DIVASS
+//     KW_OPERATOR OP_MODASS
+//     KW_OPERATOR OP_XORASS
+//     KW_OPERATOR OP_BANDASS
+//     KW_OPERATOR OP_BORASS
+//     KW_OPERATOR OP_LSHIFT
+//     KW_OPERATOR ST_RSHIFT_1 ST_RSHIFT_2
+//     KW_OPERATOR OP_RSHIFTASS
+//     KW_OPERATOR OP_LSHIFTASS
+//     KW_OPERATOR OP_EQ
+//     KW_OPERATOR OP_NE
+//     KW_OPERATOR OP_LE
+//     KW_OPERATOR OP_GE
+//     KW_OPERATOR OP_LAND
+//     KW_OPERATOR OP_LOR
+//     KW_OPERATOR OP_INC
+//     KW_OPERATOR OP_DEC
+//     KW_OPERATOR OP_COMMA
+//     KW_OPERATOR OP_ARROWSTAR
+//     KW_OPERATOR OP_ARROW
+//     KW_OPERATOR OP_LPAREN OP_RPAREN
+//     KW_OPERATOR OP_LSQUARE OP_RSQUARE
+//
+//   template-parameter, on KW_CLASS KW_TYPENAME:
+//     type-parameter
+//     parameter-declaration
+//
+//   type-parameter, on KW_CLASS KW_TEMPLATE KW_TYPENAME:
+//     KW_CLASS OP_DOTS? TT_IDENTIFIER?
+//     KW_CLASS TT_IDENTIFIER? OP_ASS type-id
+//     KW_TYPENAME OP_DOTS? TT_IDENTIFIER?
+//     KW_TYPENAME TT_IDENTIFIER? OP_ASS type-id
+//     KW_TEMPLATE OP_LT template-parameter-list close-angle-bracket KW_CLASS OP_DOTS? TT_IDENTIFIER?
+//     KW_TEMPLATE OP_LT template-parameter-list close-angle-bracket KW_CLASS TT_IDENTIFIER? OP_ASS id-expression
+//
+//   template-id, on KW_OPERATOR:
+//     operator-function-id OP_LT template-argument-list? close-angle-bracket
+//     literal-operator-id OP_LT template-argument-list? close-angle-bracket
+//
+//   template-argument, on KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_DECLTYPE KW_DOUBLE KW_FLOAT KW_INT KW_LONG KW_OPERATOR KW_SHORT KW_SIGNED KW_TYPENAME KW_UNSIGNED KW_VOID KW_WCHAR_T OP_COMPL OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     constant-expression
+//     type-id
+//     id-expression
+//
+//   typename-specifier, on KW_TYPENAME:
+//     KW_TYPENAME nested-name-specifier TT_IDENTIFIER
+//     KW_TYPENAME nested-name-specifier KW_TEMPLATE? simple-template-id
+//
+//   exception-declaration, on KW_ALIGNAS KW_AUTO KW_BOOL KW_CHAR KW_CHAR16_T KW_CHAR32_T KW_CLASS KW_CONST KW_DECLTYPE KW_DOUBLE KW_ENUM KW_FLOAT KW_INT KW_LONG KW_SHORT KW_SIGNED KW_STRUCT KW_TYPENAME KW_UNION KW_UNSIGNED KW_VOID KW_VOLATILE KW_WCHAR_T OP_LSQUARE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     attribute-specifier* type-specifier+ attribute-specifier* declarator
+//     attribute-specifier* type-specifier+ attribute-specifier* abstract-declarator?
+//
+//   nested-name-specifier, repeat or stop on KW_TEMPLATE TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier-suffix* in nested-name-specifier-root nested-name-specifier-suffix*
+//
+//   new-expression, repeat or stop on OP_LPAREN:
+//     new-placement? in OP_COLON2? KW_NEW new-placement? OP_LPAREN type-id OP_RPAREN new-initializer?
+//
+//   new-type-id, repeat or stop on OP_AMP OP_STAR OP_LAND:
+//     new-declarator? in type-specifier-seq new-declarator?
+//
+//   new-declarator, repeat or stop on OP_AMP OP_STAR OP_LAND:
+//     ptr-operator+ in ptr-operator+
+//
+//   noptr-new-declarator.1, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in OP_LSQUARE constant-expression OP_RSQUARE attribute-specifier*
+//
+//   noptr-new-declarator, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in OP_LSQUARE expression OP_RSQUARE attribute-specifier* (OP_LSQUARE constant-expression OP_RSQUARE attribute-specifier*)*
+//
+//   shift-expression, repeat or stop on ST_RSHIFT_1:
+//     shift-expression.1* in additive-expression (shift-operator additive-expression)*
+//
+//   relational-expression, repeat or stop on OP_GT:
+//     relational-expression.1* in shift-expression (relational-operator shift-expression)*
+//
+//   statement, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in attribute-specifier* expression-statement
+//
+//   decl-specifier-seq, repeat or stop on KW_DECLTYPE OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     decl-specifier+ in decl-specifier+ attribute-specifier*
+//
+//   decl-specifier-seq, repeat or stop on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* in decl-specifier+ attribute-specifier*
+//
+//   type-specifier-seq, repeat or stop on KW_DECLTYPE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     type-specifier+ in type-specifier+ attribute-specifier*
+//
+//   type-specifier-seq, repeat or stop on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* in type-specifier+ attribute-specifier*
+//
+//   trailing-type-specifier-seq, repeat or stop on KW_DECLTYPE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     trailing-type-specifier+ in trailing-type-specifier+ attribute-specifier*
+//
+//   trailing-type-specifier-seq, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in trailing-type-specifier+ attribute-specifier*
+//
+//   simple-type-specifier, repeat or stop on ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in nested-name-specifier? type-name
+//
+//   elaborated-type-specifier, repeat or stop on TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in class-key attribute-specifier* nested-name-specifier? TT_IDENTIFIER
+//
+//   elaborated-type-specifier, repeat or stop on ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in class-key nested-name-specifier? KW_TEMPLATE? simple-template-id
+//
+//   elaborated-type-specifier, repeat or stop on TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in KW_ENUM nested-name-specifier? TT_IDENTIFIER
+//
+//   enumerator-list, repeat or stop on OP_COMMA:
+//     enumerator-list.1* in enumerator-definition (OP_COMMA enumerator-definition)*
+//
+//   qualified-namespace-specifier, repeat or stop on ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in nested-name-specifier? namespace-name
+//
+//   using-directive, repeat or stop on TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in attribute-specifier* KW_USING KW_NAMESPACE nested-name-specifier? TT_IDENTIFIER OP_SEMICOLON
+//
+//   ptr-declarator, repeat or stop on KW_DECLTYPE OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     ptr-operator* in ptr-operator* noptr-declarator
+//
+//   noptr-declarator, repeat or stop on OP_LPAREN:
+//     noptr-declarator.1* in noptr-declarator-root (noptr-declarator-suffix)*
+//
+//   noptr-declarator-root, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in declarator-id attribute-specifier*
+//
+//   noptr-declarator-suffix, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in OP_LSQUARE constant-expression? OP_RSQUARE attribute-specifier*
+//
+//   parameters-and-qualifiers, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in OP_LPAREN parameter-declaration-clause OP_RPAREN cv-qualifier* ref-qualifier? exception-specification? attribute-specifier*
+//
+//   trailing-return-type, repeat or stop on OP_LPAREN OP_DOTS:
+//     abstract-declarator? in OP_ARROW trailing-type-specifier-seq abstract-declarator?
+//
+//   ptr-operator, repeat or stop on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* in OP_STAR attribute-specifier* cv-qualifier*
+//
+//   ptr-operator, repeat or stop on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* in OP_AMP attribute-specifier*
+//
+//   ptr-operator, repeat or stop on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* in OP_LAND attribute-specifier*
+//
+//   ptr-operator, repeat or stop on KW_ALIGNAS OP_LSQUARE:
+//     attribute-specifier* in nested-name-specifier OP_STAR attribute-specifier* cv-qualifier*
+//
+//   type-id, repeat or stop on OP_DOTS:
+//     abstract-declarator? in type-specifier-seq abstract-declarator?
+//
+//   noptr-abstract-declarator, repeat or stop on OP_LPAREN:
+//     noptr-declarator-suffix* in noptr-abstract-declarator-root noptr-declarator-suffix*
+//
+//   noptr-abstract-declarator, repeat or stop on OP_LPAREN:
+//     noptr-declarator-suffix+ in noptr-declarator-suffix+
+//
+//   noptr-abstract-pack-declarator, repeat or stop on OP_LPAREN:
+//     noptr-declarator-suffix* in OP_DOTS noptr-declarator-suffix*
+//
+//   parameter-declaration-list, repeat or stop on OP_COMMA:
+//     parameter-declaration-list.1* in parameter-declaration (OP_COMMA parameter-declaration)*
+//
+//   parameter-declaration, repeat or stop on OP_DOTS:
+//     abstract-declarator? in attribute-specifier* decl-specifier-seq abstract-declarator?
+//
+//   initializer-list, repeat or stop on OP_COMMA:
+//     initializer-list.1* in initializer-clause-dots (OP_COMMA initializer-clause-dots)*
+//
+//   class-head-name, repeat or stop on ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in nested-name-specifier? class-name
+//
+//   class-or-decltype, repeat or stop on ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     nested-name-specifier? in nested-name-specifier? class-name
+//
+//   conversion-type-id, repeat or stop on OP_AMP OP_STAR OP_LAND:
+//     ptr-operator* in type-specifier-seq ptr-operator*
+//
+//   exception-declaration, repeat or stop on KW_DECLTYPE OP_COLON2 TT_IDENTIFIER ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     type-specifier+ in attribute-specifier* type-specifier+ attribute-specifier* declarator
+//
+//   exception-declaration, repeat or stop on KW_DECLTYPE OP_COLON2 ST_CLASS_NAME ST_ENUM_NAME ST_NAMESPACE_NAME ST_TEMPLATE_NAME ST_TYPEDEF_NAME:
+//     type-specifier+ in attribute-specifier* type-specifier+ attribute-specifier* abstract-declarator?
+//
+//   exception-declaration, repeat or stop on OP_LSQUARE:
+//     attribute-specifier* in attribute-specifier* type-specifier+ attribute-specifier* abstract-declarator?
+//
+//   noexcept-specification, repeat or stop on OP_LPAREN:
+//     noexcept-specification.1? in KW_NOEXCEPT (OP_LPAREN constant-expression OP_RPAREN)?
+
+enum ENonterminal : uint16_t
+{
+	NT_TRANSLATION_UNIT,
+	NT_PRIMARY_EXPRESSION,
+	NT_TYPE_NAME,
+	NT_CLASS_NAME,
+	NT_ENUM_NAME,
+	NT_NAMESPACE_NAME,
+	NT_TEMPLATE_NAME,
+	NT_TYPEDEF_NAME,
+	NT_SIMPLE_TEMPLATE_ID,
+	NT_ID_EXPRESSION,
+	NT_UNQUALIFIED_ID,
+	NT_QUALIFIED_ID,
+	NT_NESTED_NAME_SPECIFIER,
+	NT_NESTED_NAME_SPECIFIER_ROOT,
+	NT_NESTED_NAME_SPECIFIER_SUFFIX,
+	NT_LAMBDA_EXPRESSION,
+	NT_LAMBDA_INTRODUCER,
+	NT_LAMBDA_CAPTURE,
+	NT_CAPTURE_DEFAULT,
+	NT_CAPTURE_LIST,
+	NT_CAPTURE,
+	NT_LAMBDA_DECLARATOR,
+	NT_POSTFIX_EXPRESSION,
+	NT_POSTFIX_ROOT,
+	NT_POSTFIX_SUFFIX,
+	NT_EXPRESSION_LIST,
+	NT_PSEUDO_DESTRUCTOR_NAME,
+	NT_UNARY_EXPRESSION,
+	NT_UNARY_OPERATOR,
+	NT_NEW_EXPRESSION,
+	NT_NEW_PLACEMENT,
+	NT_NEW_TYPE_ID,
+	NT_NEW_DECLARATOR,
+	NT_NOPTR_NEW_DECLARATOR,
+	NT_NEW_INITIALIZER,
+	NT_DELETE_EXPRESSION,
+	NT_NOEXCEPT_EXPRESSION,
+	NT_CAST_EXPRESSION,
+	NT_CAST_OPERATOR,
+	NT_PM_EXPRESSION,
+	NT_PM_OPERATOR,
+	NT_MULTIPLICATIVE_EXPRESSION,
+	NT_MULTIPLICATIVE_OPERATOR,
+	NT_ADDITIVE_EXPRESSION,
+	NT_ADDITIVE_OPERATOR,
+	NT_SHIFT_EXPRESSION,
+	NT_SHIFT_OPERATOR,
+	NT_RELATIONAL_EXPRESSION,
+	NT_RELATIONAL_OPERATOR,
+	NT_EQUALITY_EXPRESSION,
+	NT_EQUALITY_OPERATOR,
+	NT_AND_EXPRESSION,
+	NT_EXCLUSIVE_OR_EXPRESSION,
+	NT_INCLUSIVE_OR_EXPRESSION,
+	NT_LOGICAL_AND_EXPRESSION,
+	NT_LOGICAL_OR_EXPRESSION,
+	NT_CONDITIONAL_EXPRESSION,
+	NT_ASSIGNMENT_EXPRESSION,
+	NT_ASSIGNMENT_OPERATOR,
+	NT_EXPRESSION,
+	NT_CONSTANT_EXPRESSION,
+	NT_STATEMENT,
+	NT_LABELED_STATEMENT,
+	NT_EXPRESSION_STATEMENT,
+	NT_COMPOUND_STATEMENT,
+	NT_SELECTION_STATEMENT,
+	NT_CONDITION_DECLARATION,
+	NT_CONDITION,
+	NT_ITERATION_STATEMENT,
+	NT_FOR_INIT_STATEMENT,
+	NT_FOR_RANGE_DECLARATION,
+	NT_FOR_RANGE_INITIALIZER,
+	NT_JUMP_STATEMENT,
+	NT_DECLARATION_STATEMENT,
+	NT_DECLARATION,
+	NT_BLOCK_DECLARATION,
+	NT_ALIAS_DECLARATION,
+	NT_SIMPLE_DECLARATION,
+	NT_STATIC_ASSERT_DECLARATION,
+	NT_EMPTY_DECLARATION,
+	NT_ATTRIBUTE_DECLARATION,
+	NT_DECL_SPECIFIER,
+	NT_DECL_SPECIFIER_SEQ,
+	NT_STORAGE_CLASS_SPECIFIER,
+	NT_FUNCTION_SPECIFIER,
+	NT_TYPE_SPECIFIER,
+	NT_TRAILING_TYPE_SPECIFIER,
+	NT_TYPE_SPECIFIER_SEQ,
+	NT_TRAILING_TYPE_SPECIFIER_SEQ,
+	NT_SIMPLE_TYPE_SPECIFIER,
+	NT_DECLTYPE_SPECIFIER,
+	NT_ELABORATED_TYPE_SPECIFIER,
+	NT_ENUM_SPECIFIER,
+	NT_ENUM_HEAD,
+	NT_OPAQUE_ENUM_DECLARATION,
+	NT_ENUM_KEY,
+	NT_ENUM_BASE,
+	NT_ENUMERATOR_LIST,
+	NT_ENUMERATOR_DEFINITION,
+	NT_ENUMERATOR,
+	NT_NAMESPACE_DEFINITION,
+	NT_NAMESPACE_BODY,
+	NT_NAMESPACE_ALIAS_DEFINITION,
+	NT_QUALIFIED_NAMESPACE_SPECIFIER,
+	NT_USING_DECLARATION,
+	NT_USING_DIRECTIVE,
+	NT_ASM_DEFINITION,
+	NT_LINKAGE_SPECIFICATION,
+	NT_ATTRIBUTE_SPECIFIER,
+	NT_ALIGNMENT_SPECIFIER,
+	NT_ATTRIBUTE_LIST,
+	NT_ATTRIBUTE_PART,
+	NT_ATTRIBUTE,
+	NT_ATTRIBUTE_TOKEN,
+	NT_ATTRIBUTE_SCOPED_TOKEN,
+	NT_ATTRIBUTE_NAMESPACE,
+	NT_ATTRIBUTE_ARGUMENT_CLAUSE,
+	NT_BALANCED_TOKEN,
+	NT_INIT_DECLARATOR_LIST,
+	NT_INIT_DECLARATOR,
+	NT_DECLARATOR,
+	NT_PTR_DECLARATOR,
+	NT_NOPTR_DECLARATOR,
+	NT_NOPTR_DECLARATOR_ROOT,
+	NT_NOPTR_DECLARATOR_SUFFIX,
+	NT_PARAMETERS_AND_QUALIFIERS,
+	NT_TRAILING_RETURN_TYPE,
+	NT_PTR_OPERATOR,
+	NT_CV_QUALIFIER,
+	NT_REF_QUALIFIER,
+	NT_DECLARATOR_ID,
+	NT_TYPE_ID,
+	NT_ABSTRACT_DECLARATOR,
+	NT_PTR_ABSTRACT_DECLARATOR,
+	NT_NOPTR_ABSTRACT_DECLARATOR,
+	NT_NOPTR_ABSTRACT_DECLARATOR_ROOT,
+	NT_ABSTRACT_PACK_DECLARATOR,
+	NT_NOPTR_ABSTRACT_PACK_DECLARATOR,
+	NT_PARAMETER_DECLARATION_CLAUSE,
+	NT_PARAMETER_DECLARATION_LIST,
+	NT_PARAMETER_DECLARATION,
+	NT_FUNCTION_DEFINITION,
+	NT_FUNCTION_BODY,
+	NT_INITIALIZER,
+	NT_BRACE_OR_EQUAL_INITIALIZER,
+	NT_INITIALIZER_CLAUSE,
+	NT_INITIALIZER_LIST,
+	NT_INITIALIZER_CLAUSE_DOTS,
+	NT_BRACED_INIT_LIST,
+	NT_CLASS_SPECIFIER,
+	NT_CLASS_HEAD,
+	NT_CLASS_HEAD_NAME,
+	NT_CLASS_VIRT_SPECIFIER,
+	NT_CLASS_KEY,
+	NT_MEMBER_SPECIFICATION,
+	NT_MEMBER_DECLARATION,
+	NT_MEMBER_DECLARATOR_LIST,
+	NT_MEMBER_DECLARATOR,
+	NT_VIRT_SPECIFIER,
+	NT_PURE_SPECIFIER,
+	NT_BASE_CLAUSE,
+	NT_BASE_SPECIFIER_LIST,
+	NT_BASE_SPECIFIER_DOTS,
+	NT_BASE_SPECIFIER,
+	NT_CLASS_OR_DECLTYPE,
+	NT_BASE_TYPE_SPECIFIER,
+	NT_ACCESS_SPECIFIER,
+	NT_CONVERSION_FUNCTION_ID,
+	NT_CONVERSION_TYPE_ID,
+	NT_CTOR_INITIALIZER,
+	NT_MEM_INITIALIZER_LIST,
+	NT_MEM_INITIALIZER_DOTS,
+	NT_MEM_INITIALIZER,
+	NT_MEM_INITIALIZER_ID,
+	NT_OPERATOR_FUNCTION_ID,
+	NT_LITERAL_OPERATOR_ID,
+	NT_TEMPLATE_DECLARATION,
+	NT_TEMPLATE_PARAMETER_LIST,
+	NT_TEMPLATE_PARAMETER,
+	NT_TYPE_PARAMETER,
+	NT_CLOSE_ANGLE_BRACKET,
+	NT_TEMPLATE_ID,
+	NT_TEMPLATE_ARGUMENT_LIST,
+	NT_TEMPLATE_ARGUMENT_DOTS,
+	NT_TEMPLATE_ARGUMENT,
+	NT_TYPENAME_SPECIFIER,
+	NT_EXPLICIT_INSTANTIATION,
+	NT_EXPLICIT_SPECIALIZATION,
+	NT_TRY_BLOCK,
+	NT_FUNCTION_TRY_BLOCK,
+	NT_HANDLER,
+	NT_EXCEPTION_DECLARATION,
+	NT_THROW_EXPRESSION,
+	NT_EXCEPTION_SPECIFICATION,
+	NT_DYNAMIC_EXCEPTION_SPECIFICATION,
+	NT_TYPE_ID_LIST,
+	NT_TYPE_ID_DOTS,
+	NT_NOEXCEPT_SPECIFICATION,
+	NT_CAPTURE_LIST_1,
+	NT_NOPTR_NEW_DECLARATOR_1,
+	NT_PM_EXPRESSION_1,
+	NT_MULTIPLICATIVE_EXPRESSION_1,
+	NT_ADDITIVE_EXPRESSION_1,
+	NT_SHIFT_EXPRESSION_1,
+	NT_RELATIONAL_EXPRESSION_1,
+	NT_EQUALITY_EXPRESSION_1,
+	NT_AND_EXPRESSION_1,
+	NT_EXCLUSIVE_OR_EXPRESSION_1,
+	NT_INCLUSIVE_OR_EXPRESSION_1,
+	NT_LOGICAL_AND_EXPRESSION_1,
+	NT_LOGICAL_OR_EXPRESSION_1,
+	NT_CONDITIONAL_EXPRESSION_1,
+	NT_EXPRESSION_1,
+	NT_ENUMERATOR_LIST_1,
+	NT_ATTRIBUTE_LIST_1,
+	NT_INIT_DECLARATOR_LIST_1,
+	NT_NOPTR_DECLARATOR_1,
+	NT_PARAMETER_DECLARATION_LIST_1,
+	NT_INITIALIZER_LIST_1,
+	NT_MEMBER_DECLARATOR_LIST_1,
+	NT_BASE_SPECIFIER_LIST_1,
+	NT_MEM_INITIALIZER_LIST_1,
+	NT_TEMPLATE_PARAMETER_LIST_1,
+	NT_TEMPLATE_ARGUMENT_LIST_1,
+	NT_TYPE_ID_LIST_1,
+	NT_NOEXCEPT_SPECIFICATION_1,
+	NumNonterminals
+};
+
+constexpr const char* NonterminalNames[NumNonterminals] =
+{
+	"translation-unit",
+	"primary-expression",
+	"type-name",
+	"class-name",
+	"enum-name",
+	"namespace-name",
+	"template-name",
+	"typedef-name",
+	"simple-template-id",
+	"id-expression",
+	"unqualified-id",
+	"qualified-id",
+	"nested-name-specifier",
+	"nested-name-specifier-root",
+	"nested-name-specifier-suffix",
+	"lambda-expression",
+	"lambda-introducer",
+	"lambda-capture",
+	"capture-default",
+	"capture-list",
+	"capture",
+	"lambda-declarator",
+	"postfix-expression",
+	"postfix-root",
+	"postfix-suffix",
+	"expression-list",
+	"pseudo-destructor-name",
+	"unary-expression",
+	"unary-operator",
+	"new-expression",
+	"new-placement",
+	"new-type-id",
+	"new-declarator",
+	"noptr-new-declarator",
+	"new-initializer",
+	"delete-expression",
+	"noexcept-expression",
+	"cast-expression",
+	"cast-operator",
+	"pm-expression",
+	"pm-operator",
+	"multiplicative-expression",
+	"multiplicative-operator",
+	"additive-expression",
+	"additive-operator",
+	"shift-expression",
+	"shift-operator",
+	"relational-expression",
+	"relational-operator",
+	"equality-expression",
+	"equality-operator",
+	"and-expression",
+	"exclusive-or-expression",
+	"inclusive-or-expression",
+	"logical-and-expression",
+	"logical-or-expression",
+	"conditional-expression",
+	"assignment-expression",
+	"assignment-operator",
+	"expression",
+	"constant-expression",
+	"statement",
+	"labeled-statement",
+	"expression-statement",
+	"compound-statement",
+	"selection-statement",
+	"condition-declaration",
+	"condition",
+	"iteration-statement",
+	"for-init-statement",
+	"for-range-declaration",
+	"for-range-initializer",
+	"jump-statement",
+	"declaration-statement",
+	"declaration",
+	"block-declaration",
+	"alias-declaration",
+	"simple-declaration",
+	"static_assert-declaration",
+	"empty-declaration",
+	"attribute-declaration",
+	"decl-specifier",
+	"decl-specifier-seq",
+	"storage-class-specifier",
+	"function-specifier",
+	"type-specifier",
+	"trailing-type-specifier",
+	"type-specifier-seq",
+	"trailing-type-specifier-seq",
+	"simple-type-specifier",
+	"decltype-specifier",
+	"elaborated-type-specifier",
+	"enum-specifier",
+	"enum-head",
+	"opaque-enum-declaration",
+	"enum-key",
+	"enum-base",
+	"enumerator-list",
+	"enumerator-definition",
+	"enumerator",
+	"namespace-definition",
+	"namespace-body",
+	"namespace-alias-definition",
+	"qualified-namespace-specifier",
+	"using-declaration",
+	"using-directive",
+	"asm-definition",
+	"linkage-specification",
+	"attribute-specifier",
+	"alignment-specifier",
+	"attribute-list",
+	"attribute-part",
+	"attribute",
+	"attribute-token",
+	"attribute-scoped-token",
+	"attribute-namespace",
+	"attribute-argument-clause",
+	"balanced-token",
+	"init-declarator-list",
+	"init-declarator",
+	"declarator",
+	"ptr-declarator",
+	"noptr-declarator",
+	"noptr-declarator-root",
+	"noptr-declarator-suffix",
+	"parameters-and-qualifiers",
+	"trailing-return-type",
+	"ptr-operator",
+	"cv-qualifier",
+	"ref-qualifier",
+	"declarator-id",
+	"type-id",
+	"abstract-declarator",
+	"ptr-abstract-declarator",
+	"noptr-abstract-declarator",
+	"noptr-abstract-declarator-root",
+	"abstract-pack-declarator",
+	"noptr-abstract-pack-declarator",
+	"parameter-declaration-clause",
+	"parameter-declaration-list",
+	"parameter-declaration",
+	"function-definition",
+	"function-body",
+	"initializer",
+	"brace-or-equal-initializer",
+	"initializer-clause",
+	"initializer-list",
+	"initializer-clause-dots",
+	"braced-init-list",
+	"class-specifier",
+	"class-head",
+	"class-head-name",
+	"class-virt-specifier",
+	"class-key",
+	"member-specification",
+	"member-declaration",
+	"member-declarator-list",
+	"member-declarator",
+	"virt-specifier",
+	"pure-specifier",
+	"base-clause",
+	"base-specifier-list",
+	"base-specifier-dots",
+	"base-specifier",
+	"class-or-decltype",
+	"base-type-specifier",
+	"access-specifier",
+	"conversion-function-id",
+	"conversion-type-id",
+	"ctor-initializer",
+	"mem-initializer-list",
+	"mem-initializer-dots",
+	"mem-initializer",
+	"mem-initializer-id",
+	"operator-function-id",
+	"literal-operator-id",
+	"template-declaration",
+	"template-parameter-list",
+	"template-parameter",
+	"type-parameter",
+	"close-angle-bracket",
+	"template-id",
+	"template-argument-list",
+	"template-argument-dots",
+	"template-argument",
+	"typename-specifier",
+	"explicit-instantiation",
+	"explicit-specialization",
+	"try-block",
+	"function-try-block",
+	"handler",
+	"exception-declaration",
+	"throw-expression",
+	"exception-specification",
+	"dynamic-exception-specification",
+	"type-id-list",
+	"type-id-dots",
+	"noexcept-specification",
+	"capture-list.1",
+	"noptr-new-declarator.1",
+	"pm-expression.1",
+	"multiplicative-expression.1",
+	"additive-expression.1",
+	"shift-expression.1",
+	"relational-expression.1",
+	"equality-expression.1",
+	"and-expression.1",
+	"exclusive-or-expression.1",
+	"inclusive-or-expression.1",
+	"logical-and-expression.1",
+	"logical-or-expression.1",
+	"conditional-expression.1",
+	"expression.1",
+	"enumerator-list.1",
+	"attribute-list.1",
+	"init-declarator-list.1",
+	"noptr-declarator.1",
+	"parameter-declaration-list.1",
+	"initializer-list.1",
+	"member-declarator-list.1",
+	"base-specifier-list.1",
+	"mem-initializer-list.1",
+	"template-parameter-list.1",
+	"template-argument-list.1",
+	"type-id-list.1",
+	"noexcept-specification.1"
+};
+
+constexpr bool Nullable[NumNonterminals] =
+{
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	true,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	true,
+	true,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	true,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false
+};
+
+constexpr TokenSet First[NumNonterminals] =
+{
+	{{0x455b203e55913f1dull, 0x20000000011008ffull, 0x1f0ull}}, // translation-unit
+	{{0x1200030008010000ull, 0xc00000001022800ull, 0x1f0ull}}, // primary-expression
+	{{0x0ull, 0x0ull, 0x1b0ull}}, // type-name
+	{{0x0ull, 0x0ull, 0x90ull}}, // class-name
+	{{0x0ull, 0x0ull, 0x20ull}}, // enum-name
+	{{0x0ull, 0x0ull, 0x40ull}}, // namespace-name
+	{{0x0ull, 0x0ull, 0x80ull}}, // template-name
+	{{0x0ull, 0x0ull, 0x100ull}}, // typedef-name
+	{{0x0ull, 0x0ull, 0x80ull}}, // simple-template-id
+	{{0x20000010000ull, 0x400000001020000ull, 0x1f0ull}}, // id-expression
+	{{0x20000000000ull, 0x400000000020000ull, 0x80ull}}, // unqualified-id
+	{{0x10000ull, 0x1000000ull, 0x1f0ull}}, // qualified-id
+	{{0x10000ull, 0x1000000ull, 0x1f0ull}}, // nested-name-specifier
+	{{0x10000ull, 0x1000000ull, 0x1f0ull}}, // nested-name-specifier-root
+	{{0x100000000000000ull, 0x400000000000000ull, 0x80ull}}, // nested-name-specifier-suffix
+	{{0x0ull, 0x800ull, 0x0ull}}, // lambda-expression
+	{{0x0ull, 0x800ull, 0x0ull}}, // lambda-introducer
+	{{0x200000000000000ull, 0x400000100040000ull, 0x0ull}}, // lambda-capture
+	{{0x0ull, 0x100040000ull, 0x0ull}}, // capture-default
+	{{0x200000000000000ull, 0x400000000040000ull, 0x0ull}}, // capture-list
+	{{0x200000000000000ull, 0x400000000040000ull, 0x0ull}}, // capture
+	{{0x0ull, 0x2000ull, 0x0ull}}, // lambda-declarator
+	{{0x9223430c18314718ull, 0xc000000010228a5ull, 0x1f0ull}}, // postfix-expression
+	{{0x9223430c18314718ull, 0xc000000010228a5ull, 0x1f0ull}}, // postfix-root
+	{{0x0ull, 0x260000002002800ull, 0x0ull}}, // postfix-suffix
+	{{0x9a2743cc1835471aull, 0xc600000390e2aa5ull, 0x1f0ull}}, // expression-list
+	{{0x10000ull, 0x1020000ull, 0x1f0ull}}, // pseudo-destructor-name
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // unary-expression
+	{{0x0ull, 0x600000380e0000ull, 0x0ull}}, // unary-operator
+	{{0x4000000000ull, 0x1000000ull, 0x0ull}}, // new-expression
+	{{0x0ull, 0x2000ull, 0x0ull}}, // new-placement
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // new-type-id
+	{{0x10000ull, 0x8000021040800ull, 0x1f0ull}}, // new-declarator
+	{{0x0ull, 0x800ull, 0x0ull}}, // noptr-new-declarator
+	{{0x0ull, 0x2200ull, 0x0ull}}, // new-initializer
+	{{0x40000ull, 0x1000000ull, 0x0ull}}, // delete-expression
+	{{0x8000000000ull, 0x0ull, 0x0ull}}, // noexcept-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // cast-expression
+	{{0x0ull, 0x2000ull, 0x0ull}}, // cast-operator
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // pm-expression
+	{{0x0ull, 0x100000004000000ull, 0x0ull}}, // pm-operator
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // multiplicative-expression
+	{{0x0ull, 0xe0000000ull, 0x0ull}}, // multiplicative-operator
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // additive-expression
+	{{0x0ull, 0x18000000ull, 0x0ull}}, // additive-operator
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // shift-expression
+	{{0x0ull, 0x80000000000ull, 0x2ull}}, // shift-operator
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // relational-expression
+	{{0x0ull, 0x6000600000000ull, 0x0ull}}, // relational-operator
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // equality-expression
+	{{0x0ull, 0x1800000000000ull, 0x0ull}}, // equality-operator
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // and-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // exclusive-or-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // inclusive-or-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // logical-and-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // logical-or-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // conditional-expression
+	{{0x9a2743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // assignment-expression
+	{{0x0ull, 0x67f900000000ull, 0x0ull}}, // assignment-operator
+	{{0x9a2743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // constant-expression
+	{{0xfeffe3fffdbfff7full, 0xc600000391e2bffull, 0x1f0ull}}, // statement
+	{{0x20041ull, 0x400000000000800ull, 0x0ull}}, // labeled-statement
+	{{0x9a2743cc1835471aull, 0xc600000391e28a5ull, 0x1f0ull}}, // expression-statement
+	{{0x0ull, 0x200ull, 0x0ull}}, // compound-statement
+	{{0x80000100000000ull, 0x0ull, 0x0ull}}, // selection-statement
+	{{0x444b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // condition-declaration
+	{{0xde6f63de5db57f1bull, 0xc600000390e28f7ull, 0x1f0ull}}, // condition
+	{{0x20080000ull, 0x100ull, 0x0ull}}, // iteration-statement
+	{{0xde6f63de5db57f1bull, 0xc600000391e28f7ull, 0x1f0ull}}, // for-init-statement
+	{{0x444b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // for-range-declaration
+	{{0x9a2743cc1835471aull, 0xc600000390e2aa5ull, 0x1f0ull}}, // for-range-initializer
+	{{0x800080008020ull, 0x0ull, 0x0ull}}, // jump-statement
+	{{0x445b203e55913f1dull, 0x10008ffull, 0x1f0ull}}, // declaration-statement
+	{{0x455b203e55913f1dull, 0x11008ffull, 0x1f0ull}}, // declaration
+	{{0x445b203e55913f1dull, 0x10008ffull, 0x1f0ull}}, // block-declaration
+	{{0x0ull, 0x8ull, 0x0ull}}, // alias-declaration
+	{{0x444b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // simple-declaration
+	{{0x10000000000000ull, 0x0ull, 0x0ull}}, // static_assert-declaration
+	{{0x0ull, 0x100000ull, 0x0ull}}, // empty-declaration
+	{{0x1ull, 0x800ull, 0x0ull}}, // attribute-declaration
+	{{0x444b201e55913f18ull, 0x10000f7ull, 0x1f0ull}}, // decl-specifier
+	{{0x444b201e55913f18ull, 0x10000f7ull, 0x1f0ull}}, // decl-specifier-seq
+	{{0x408201004000000ull, 0x0ull, 0x0ull}}, // storage-class-specifier
+	{{0x201000000ull, 0x10ull, 0x0ull}}, // function-specifier
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // type-specifier
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // trailing-type-specifier
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // type-specifier-seq
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // trailing-type-specifier-seq
+	{{0x3000c10110718ull, 0x10000a4ull, 0x1f0ull}}, // simple-type-specifier
+	{{0x10000ull, 0x0ull, 0x0ull}}, // decltype-specifier
+	{{0x40000000800800ull, 0x2ull, 0x0ull}}, // elaborated-type-specifier
+	{{0x800000ull, 0x0ull, 0x0ull}}, // enum-specifier
+	{{0x800000ull, 0x0ull, 0x0ull}}, // enum-head
+	{{0x800000ull, 0x0ull, 0x0ull}}, // opaque-enum-declaration
+	{{0x800000ull, 0x0ull, 0x0ull}}, // enum-key
+	{{0x0ull, 0x200000ull, 0x0ull}}, // enum-base
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // enumerator-list
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // enumerator-definition
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // enumerator
+	{{0x2200000000ull, 0x0ull, 0x0ull}}, // namespace-definition
+	{{0x455b203e55913f1dull, 0x11008ffull, 0x1f0ull}}, // namespace-body
+	{{0x2000000000ull, 0x0ull, 0x0ull}}, // namespace-alias-definition
+	{{0x10000ull, 0x1000000ull, 0x1f0ull}}, // qualified-namespace-specifier
+	{{0x0ull, 0x8ull, 0x0ull}}, // using-declaration
+	{{0x1ull, 0x808ull, 0x0ull}}, // using-directive
+	{{0x4ull, 0x0ull, 0x0ull}}, // asm-definition
+	{{0x4000000ull, 0x0ull, 0x0ull}}, // linkage-specification
+	{{0x1ull, 0x800ull, 0x0ull}}, // attribute-specifier
+	{{0x1ull, 0x0ull, 0x0ull}}, // alignment-specifier
+	{{0x0ull, 0x480000000000000ull, 0x0ull}}, // attribute-list
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // attribute-part
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // attribute
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // attribute-token
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // attribute-scoped-token
+	{{0x0ull, 0x400000000000000ull, 0x0ull}}, // attribute-namespace
+	{{0x0ull, 0x2000ull, 0x0ull}}, // attribute-argument-clause
+	{{0x0ull, 0x8000000000002a00ull, 0x0ull}}, // balanced-token
+	{{0x20000010000ull, 0x408000021462000ull, 0x1f0ull}}, // init-declarator-list
+	{{0x20000010000ull, 0x408000021462000ull, 0x1f0ull}}, // init-declarator
+	{{0x20000010000ull, 0x408000021462000ull, 0x1f0ull}}, // declarator
+	{{0x20000010000ull, 0x408000021462000ull, 0x1f0ull}}, // ptr-declarator
+	{{0x20000010000ull, 0x400000001422000ull, 0x1f0ull}}, // noptr-declarator
+	{{0x20000010000ull, 0x400000001422000ull, 0x1f0ull}}, // noptr-declarator-root
+	{{0x0ull, 0x2800ull, 0x0ull}}, // noptr-declarator-suffix
+	{{0x0ull, 0x2000ull, 0x0ull}}, // parameters-and-qualifiers
+	{{0x0ull, 0x200000000000000ull, 0x0ull}}, // trailing-return-type
+	{{0x10000ull, 0x8000021040000ull, 0x1f0ull}}, // ptr-operator
+	{{0x1000ull, 0x40ull, 0x0ull}}, // cv-qualifier
+	{{0x0ull, 0x8000000040000ull, 0x0ull}}, // ref-qualifier
+	{{0x20000010000ull, 0x400000001420000ull, 0x1f0ull}}, // declarator-id
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // type-id
+	{{0x10000ull, 0x208000021442800ull, 0x1f0ull}}, // abstract-declarator
+	{{0x10000ull, 0x8000021042800ull, 0x1f0ull}}, // ptr-abstract-declarator
+	{{0x0ull, 0x2800ull, 0x0ull}}, // noptr-abstract-declarator
+	{{0x0ull, 0x2800ull, 0x0ull}}, // noptr-abstract-declarator-root
+	{{0x10000ull, 0x8000021440000ull, 0x1f0ull}}, // abstract-pack-declarator
+	{{0x0ull, 0x400000ull, 0x0ull}}, // noptr-abstract-pack-declarator
+	{{0x444b201e55913f19ull, 0x14008f7ull, 0x1f0ull}}, // parameter-declaration-clause
+	{{0x444b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // parameter-declaration-list
+	{{0x444b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // parameter-declaration
+	{{0x444b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // function-definition
+	{{0x2000000000000000ull, 0x100200200ull, 0x0ull}}, // function-body
+	{{0x0ull, 0x100002200ull, 0x0ull}}, // initializer
+	{{0x0ull, 0x100000200ull, 0x0ull}}, // brace-or-equal-initializer
+	{{0x9a2743cc1835471aull, 0xc600000390e2aa5ull, 0x1f0ull}}, // initializer-clause
+	{{0x9a2743cc1835471aull, 0xc600000390e2aa5ull, 0x1f0ull}}, // initializer-list
+	{{0x9a2743cc1835471aull, 0xc600000390e2aa5ull, 0x1f0ull}}, // initializer-clause-dots
+	{{0x0ull, 0x200ull, 0x0ull}}, // braced-init-list
+	{{0x40000000000800ull, 0x2ull, 0x0ull}}, // class-specifier
+	{{0x40000000000800ull, 0x2ull, 0x0ull}}, // class-head
+	{{0x10000ull, 0x1000000ull, 0x1f0ull}}, // class-head-name
+	{{0x0ull, 0x4000000000000000ull, 0x0ull}}, // class-virt-specifier
+	{{0x40000000000800ull, 0x2ull, 0x0ull}}, // class-key
+	{{0x455b3c1e55913f19ull, 0x10008ffull, 0x1f0ull}}, // member-specification
+	{{0x455b201e55913f19ull, 0x10008ffull, 0x1f0ull}}, // member-declaration
+	{{0x20000010001ull, 0x408000021662800ull, 0x1f0ull}}, // member-declarator-list
+	{{0x20000010001ull, 0x408000021662800ull, 0x1f0ull}}, // member-declarator
+	{{0x0ull, 0x4000000000000000ull, 0x1ull}}, // virt-specifier
+	{{0x0ull, 0x100000000ull, 0x0ull}}, // pure-specifier
+	{{0x0ull, 0x200000ull, 0x0ull}}, // base-clause
+	{{0x1c0000010001ull, 0x1000810ull, 0x1f0ull}}, // base-specifier-list
+	{{0x1c0000010001ull, 0x1000810ull, 0x1f0ull}}, // base-specifier-dots
+	{{0x1c0000010001ull, 0x1000810ull, 0x1f0ull}}, // base-specifier
+	{{0x10000ull, 0x1000000ull, 0x1f0ull}}, // class-or-decltype
+	{{0x10000ull, 0x1000000ull, 0x1f0ull}}, // base-type-specifier
+	{{0x1c0000000000ull, 0x0ull, 0x0ull}}, // access-specifier
+	{{0x20000000000ull, 0x0ull, 0x0ull}}, // conversion-function-id
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // conversion-type-id
+	{{0x0ull, 0x200000ull, 0x0ull}}, // ctor-initializer
+	{{0x10000ull, 0x400000001000000ull, 0x1f0ull}}, // mem-initializer-list
+	{{0x10000ull, 0x400000001000000ull, 0x1f0ull}}, // mem-initializer-dots
+	{{0x10000ull, 0x400000001000000ull, 0x1f0ull}}, // mem-initializer
+	{{0x10000ull, 0x400000001000000ull, 0x1f0ull}}, // mem-initializer-id
+	{{0x20000000000ull, 0x0ull, 0x0ull}}, // operator-function-id
+	{{0x20000000000ull, 0x0ull, 0x0ull}}, // literal-operator-id
+	{{0x100000000000000ull, 0x0ull, 0x0ull}}, // template-declaration
+	{{0x454b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // template-parameter-list
+	{{0x454b201e55913f19ull, 0x10008f7ull, 0x1f0ull}}, // template-parameter
+	{{0x100000000000800ull, 0x1ull, 0x0ull}}, // type-parameter
+	{{0x0ull, 0x400000000ull, 0x6ull}}, // close-angle-bracket
+	{{0x20000000000ull, 0x0ull, 0x80ull}}, // template-id
+	{{0x926743cc18b55f1aull, 0xc600000390e28e7ull, 0x1f0ull}}, // template-argument-list
+	{{0x926743cc18b55f1aull, 0xc600000390e28e7ull, 0x1f0ull}}, // template-argument-dots
+	{{0x926743cc18b55f1aull, 0xc600000390e28e7ull, 0x1f0ull}}, // template-argument
+	{{0x0ull, 0x1ull, 0x0ull}}, // typename-specifier
+	{{0x100000004000000ull, 0x0ull, 0x0ull}}, // explicit-instantiation
+	{{0x100000000000000ull, 0x0ull, 0x0ull}}, // explicit-specialization
+	{{0x2000000000000000ull, 0x0ull, 0x0ull}}, // try-block
+	{{0x2000000000000000ull, 0x0ull, 0x0ull}}, // function-try-block
+	{{0x80ull, 0x0ull, 0x0ull}}, // handler
+	{{0x43000c10911f19ull, 0x14008e7ull, 0x1f0ull}}, // exception-declaration
+	{{0x800000000000000ull, 0x0ull, 0x0ull}}, // throw-expression
+	{{0x800008000000000ull, 0x0ull, 0x0ull}}, // exception-specification
+	{{0x800000000000000ull, 0x0ull, 0x0ull}}, // dynamic-exception-specification
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // type-id-list
+	{{0x43000c10911f18ull, 0x10000e7ull, 0x1f0ull}}, // type-id-dots
+	{{0x8000000000ull, 0x0ull, 0x0ull}}, // noexcept-specification
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // capture-list.1
+	{{0x0ull, 0x800ull, 0x0ull}}, // noptr-new-declarator.1
+	{{0x0ull, 0x100000004000000ull, 0x0ull}}, // pm-expression.1
+	{{0x0ull, 0xe0000000ull, 0x0ull}}, // multiplicative-expression.1
+	{{0x0ull, 0x18000000ull, 0x0ull}}, // additive-expression.1
+	{{0x0ull, 0x80000000000ull, 0x2ull}}, // shift-expression.1
+	{{0x0ull, 0x6000600000000ull, 0x0ull}}, // relational-expression.1
+	{{0x0ull, 0x1800000000000ull, 0x0ull}}, // equality-expression.1
+	{{0x0ull, 0x40000ull, 0x0ull}}, // and-expression.1
+	{{0x0ull, 0x10000ull, 0x0ull}}, // exclusive-or-expression.1
+	{{0x0ull, 0x8000ull, 0x0ull}}, // inclusive-or-expression.1
+	{{0x0ull, 0x8000000000000ull, 0x0ull}}, // logical-and-expression.1
+	{{0x0ull, 0x10000000000000ull, 0x0ull}}, // logical-or-expression.1
+	{{0x0ull, 0x800000ull, 0x0ull}}, // conditional-expression.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // expression.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // enumerator-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // attribute-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // init-declarator-list.1
+	{{0x0ull, 0x2800ull, 0x0ull}}, // noptr-declarator.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // parameter-declaration-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // initializer-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // member-declarator-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // base-specifier-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // mem-initializer-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // template-parameter-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // template-argument-list.1
+	{{0x0ull, 0x80000000000000ull, 0x0ull}}, // type-id-list.1
+	{{0x0ull, 0x2000ull, 0x0ull}} // noexcept-specification.1
+};
+
+constexpr TokenSet Follow[NumNonterminals] =
+{
+	{{0x0ull, 0x0ull, 0x0ull}}, // translation-unit
+	{{0x0ull, 0x3ffeffffef5fc00ull, 0x6ull}}, // primary-expression
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // type-name
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // class-name
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // enum-name
+	{{0x0ull, 0x1100000ull, 0x0ull}}, // namespace-name
+	{{0x0ull, 0x200000000ull, 0x0ull}}, // template-name
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // typedef-name
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // simple-template-id
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // id-expression
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // unqualified-id
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // qualified-id
+	{{0x100020000000000ull, 0x400000020020000ull, 0x1f0ull}}, // nested-name-specifier
+	{{0x100020000000000ull, 0x400000020020000ull, 0x1f0ull}}, // nested-name-specifier-root
+	{{0x100020000000000ull, 0x400000020020000ull, 0x1f0ull}}, // nested-name-specifier-suffix
+	{{0x0ull, 0x3ffeffffef5fc00ull, 0x6ull}}, // lambda-expression
+	{{0x0ull, 0x2200ull, 0x0ull}}, // lambda-introducer
+	{{0x0ull, 0x1000ull, 0x0ull}}, // lambda-capture
+	{{0x0ull, 0x80000000001000ull, 0x0ull}}, // capture-default
+	{{0x0ull, 0x1000ull, 0x0ull}}, // capture-list
+	{{0x0ull, 0x80000000401000ull, 0x0ull}}, // capture
+	{{0x0ull, 0x200ull, 0x0ull}}, // lambda-declarator
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // postfix-expression
+	{{0x0ull, 0x3ffeffffef5fc00ull, 0x6ull}}, // postfix-root
+	{{0x0ull, 0x3ffeffffef5fc00ull, 0x6ull}}, // postfix-suffix
+	{{0x0ull, 0x4000ull, 0x0ull}}, // expression-list
+	{{0x0ull, 0x3ffeffffef5fc00ull, 0x6ull}}, // pseudo-destructor-name
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // unary-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // unary-operator
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // new-expression
+	{{0x43000c10911f18ull, 0x10020e7ull, 0x1f0ull}}, // new-placement
+	{{0x0ull, 0x19feffffcf5f600ull, 0x6ull}}, // new-type-id
+	{{0x0ull, 0x19feffffcf5f600ull, 0x6ull}}, // new-declarator
+	{{0x0ull, 0x19feffffcf5f600ull, 0x6ull}}, // noptr-new-declarator
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // new-initializer
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // delete-expression
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // noexcept-expression
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // cast-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // cast-operator
+	{{0x0ull, 0x9feffff8f5d400ull, 0x6ull}}, // pm-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // pm-operator
+	{{0x0ull, 0x9fefff18f5d400ull, 0x6ull}}, // multiplicative-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // multiplicative-operator
+	{{0x0ull, 0x9fefff00f5d400ull, 0x6ull}}, // additive-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // additive-operator
+	{{0x0ull, 0x9fe7ff00f5d400ull, 0x6ull}}, // shift-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // shift-operator
+	{{0x0ull, 0x99e7fd00f5d400ull, 0x6ull}}, // relational-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // relational-operator
+	{{0x0ull, 0x9867fd00f5d400ull, 0x6ull}}, // equality-expression
+	{{0x922743cc1835471aull, 0xc600000390e28a5ull, 0x1f0ull}}, // equality-operator
+	{{0x0ull, 0x9867fd00f1d400ull, 0x6ull}}, // and-expression
+	{{0x0ull, 0x9867fd00f0d400ull, 0x6ull}}, // exclusive-or-expression
+	{{0x0ull, 0x9867fd00f05400ull, 0x6ull}}, // inclusive-or-expression
+	{{0x0ull, 0x9067fd00f05400ull, 0x6ull}}, // logical-and-expression
+	{{0x0ull, 0x8067fd00f05400ull, 0x6ull}}, // logical-or-expression
+	{{0x0ull, 0x80000400705400ull, 0x6ull}}, // conditional-expression
+	{{0x0ull, 0x80000400705400ull, 0x6ull}}, // assignment-expression
+	{{0x9a2743cc1835471aull, 0xc600000390e2aa5ull, 0x1f0ull}}, // assignment-operator
+	{{0x0ull, 0x305000ull, 0x0ull}}, // expression
+	{{0x0ull, 0x80000400705400ull, 0x6ull}}, // constant-expression
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // statement
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // labeled-statement
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // expression-statement
+	{{0xfffffffffdffffffull, 0x2fffefffffffffffull, 0x1f6ull}}, // compound-statement
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // selection-statement
+	{{0x0ull, 0x104000ull, 0x0ull}}, // condition-declaration
+	{{0x0ull, 0x104000ull, 0x0ull}}, // condition
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // iteration-statement
+	{{0xde6f63de5db57f1bull, 0xc600000391e28f7ull, 0x1f0ull}}, // for-init-statement
+	{{0x0ull, 0x200000ull, 0x0ull}}, // for-range-declaration
+	{{0x0ull, 0x4000ull, 0x0ull}}, // for-range-initializer
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // jump-statement
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // declaration-statement
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // declaration
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // block-declaration
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // alias-declaration
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // simple-declaration
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // static_assert-declaration
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // empty-declaration
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // attribute-declaration
+	{{0x444b221e55913f19ull, 0x6880005217668f7ull, 0x1f6ull}}, // decl-specifier
+	{{0x20000010001ull, 0x688000521766800ull, 0x1f6ull}}, // decl-specifier-seq
+	{{0x444b221e55913f19ull, 0x6880005217668f7ull, 0x1f6ull}}, // storage-class-specifier
+	{{0x444b221e55913f19ull, 0x6880005217668f7ull, 0x1f6ull}}, // function-specifier
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // type-specifier
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // trailing-type-specifier
+	{{0x2000000000010001ull, 0x43ffeffffff5fe00ull, 0x1f7ull}}, // type-specifier-seq
+	{{0x2000000000010000ull, 0x4288000521746a00ull, 0x1f7ull}}, // trailing-type-specifier-seq
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // simple-type-specifier
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // decltype-specifier
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // elaborated-type-specifier
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // enum-specifier
+	{{0x0ull, 0x200ull, 0x0ull}}, // enum-head
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // opaque-enum-declaration
+	{{0x10001ull, 0x400000001200a00ull, 0x1f0ull}}, // enum-key
+	{{0x0ull, 0x100200ull, 0x0ull}}, // enum-base
+	{{0x0ull, 0x80000000000400ull, 0x0ull}}, // enumerator-list
+	{{0x0ull, 0x80000000000400ull, 0x0ull}}, // enumerator-definition
+	{{0x0ull, 0x80000100000400ull, 0x0ull}}, // enumerator
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // namespace-definition
+	{{0x0ull, 0x400ull, 0x0ull}}, // namespace-body
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // namespace-alias-definition
+	{{0x0ull, 0x100000ull, 0x0ull}}, // qualified-namespace-specifier
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // using-declaration
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // using-directive
+	{{0xfffffffffdffff7full, 0x2c600000391e2fffull, 0x1f0ull}}, // asm-definition
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // linkage-specification
+	{{0xfeefffdffdbfff7bull, 0x4fffefffffffffffull, 0x1f7ull}}, // attribute-specifier
+	{{0xfeefffdffdbfff7bull, 0x4fffefffffffffffull, 0x1f7ull}}, // alignment-specifier
+	{{0x0ull, 0x1000ull, 0x0ull}}, // attribute-list
+	{{0x0ull, 0x80000000001000ull, 0x0ull}}, // attribute-part
+	{{0x0ull, 0x80000000401000ull, 0x0ull}}, // attribute
+	{{0x0ull, 0x80000000403000ull, 0x0ull}}, // attribute-token
+	{{0x0ull, 0x80000000403000ull, 0x0ull}}, // attribute-scoped-token
+	{{0x0ull, 0x1000000ull, 0x0ull}}, // attribute-namespace
+	{{0x0ull, 0x80000000401000ull, 0x0ull}}, // attribute-argument-clause
+	{{0x0ull, 0x8000000000007e00ull, 0x0ull}}, // balanced-token
+	{{0x0ull, 0x100000ull, 0x0ull}}, // init-declarator-list
+	{{0x0ull, 0x80000000100000ull, 0x0ull}}, // init-declarator
+	{{0x2000000000000000ull, 0x4080000500706200ull, 0x7ull}}, // declarator
+	{{0x2000000000000000ull, 0x4080000500706200ull, 0x7ull}}, // ptr-declarator
+	{{0x2000000000000000ull, 0x4280000500706200ull, 0x7ull}}, // noptr-declarator
+	{{0x2000000000000000ull, 0x4280000500706a00ull, 0x7ull}}, // noptr-declarator-root
+	{{0x2000000000000000ull, 0x4280000500706a00ull, 0x7ull}}, // noptr-declarator-suffix
+	{{0x2000000000000000ull, 0x4280000500706a00ull, 0x7ull}}, // parameters-and-qualifiers
+	{{0x2000000000000000ull, 0x4080000500706200ull, 0x7ull}}, // trailing-return-type
+	{{0x2000020000010001ull, 0x47ffeffffff7fe00ull, 0x1f7ull}}, // ptr-operator
+	{{0x6c4b229e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // cv-qualifier
+	{{0x2800008000000001ull, 0x4280000500706a00ull, 0x7ull}}, // ref-qualifier
+	{{0x2000000000000001ull, 0x4280000500706a00ull, 0x7ull}}, // declarator-id
+	{{0x0ull, 0x80000400504000ull, 0x6ull}}, // type-id
+	{{0x2000000000000000ull, 0x4080000500706200ull, 0x7ull}}, // abstract-declarator
+	{{0x2000000000000000ull, 0x4080000500706200ull, 0x7ull}}, // ptr-abstract-declarator
+	{{0x2000000000000000ull, 0x4280000500706200ull, 0x7ull}}, // noptr-abstract-declarator
+	{{0x2000000000000000ull, 0x4280000500706a00ull, 0x7ull}}, // noptr-abstract-declarator-root
+	{{0x2000000000000000ull, 0x4080000500706200ull, 0x7ull}}, // abstract-pack-declarator
+	{{0x2000000000000000ull, 0x4080000500706200ull, 0x7ull}}, // noptr-abstract-pack-declarator
+	{{0x0ull, 0x4000ull, 0x0ull}}, // parameter-declaration-clause
+	{{0x0ull, 0x80000000404000ull, 0x0ull}}, // parameter-declaration-list
+	{{0x0ull, 0x80000400404000ull, 0x6ull}}, // parameter-declaration
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // function-definition
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // function-body
+	{{0x0ull, 0x80000000100000ull, 0x0ull}}, // initializer
+	{{0x0ull, 0x80000000100000ull, 0x0ull}}, // brace-or-equal-initializer
+	{{0x0ull, 0x80000400705400ull, 0x6ull}}, // initializer-clause
+	{{0x0ull, 0x80000000004400ull, 0x0ull}}, // initializer-list
+	{{0x0ull, 0x80000000004400ull, 0x0ull}}, // initializer-clause-dots
+	{{0x0ull, 0x3ffeffffef5fe00ull, 0x6ull}}, // braced-init-list
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // class-specifier
+	{{0x0ull, 0x200ull, 0x0ull}}, // class-head
+	{{0x0ull, 0x4000000000200200ull, 0x0ull}}, // class-head-name
+	{{0x0ull, 0x200200ull, 0x0ull}}, // class-virt-specifier
+	{{0x100000000010001ull, 0x400000001200a00ull, 0x1f0ull}}, // class-key
+	{{0x455b3c1e55913f19ull, 0x1000cffull, 0x1f0ull}}, // member-specification
+	{{0x455b3c1e55913f19ull, 0x1000cffull, 0x1f0ull}}, // member-declaration
+	{{0x0ull, 0x100000ull, 0x0ull}}, // member-declarator-list
+	{{0x0ull, 0x80000000100000ull, 0x0ull}}, // member-declarator
+	{{0x2000000000000000ull, 0x4080000100300200ull, 0x1ull}}, // virt-specifier
+	{{0x0ull, 0x80000000100000ull, 0x0ull}}, // pure-specifier
+	{{0x0ull, 0x200ull, 0x0ull}}, // base-clause
+	{{0x0ull, 0x200ull, 0x0ull}}, // base-specifier-list
+	{{0x0ull, 0x80000000000200ull, 0x0ull}}, // base-specifier-dots
+	{{0x0ull, 0x80000000400200ull, 0x0ull}}, // base-specifier
+	{{0x0ull, 0x80000000402200ull, 0x0ull}}, // class-or-decltype
+	{{0x0ull, 0x80000000400200ull, 0x0ull}}, // base-type-specifier
+	{{0x10000ull, 0x1200010ull, 0x1f0ull}}, // access-specifier
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // conversion-function-id
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // conversion-type-id
+	{{0x0ull, 0x200ull, 0x0ull}}, // ctor-initializer
+	{{0x0ull, 0x200ull, 0x0ull}}, // mem-initializer-list
+	{{0x0ull, 0x80000000000200ull, 0x0ull}}, // mem-initializer-dots
+	{{0x0ull, 0x80000000400200ull, 0x0ull}}, // mem-initializer
+	{{0x0ull, 0x2200ull, 0x0ull}}, // mem-initializer-id
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // operator-function-id
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // literal-operator-id
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // template-declaration
+	{{0x0ull, 0x400000000ull, 0x6ull}}, // template-parameter-list
+	{{0x0ull, 0x80000400000000ull, 0x6ull}}, // template-parameter
+	{{0x0ull, 0x80000400000000ull, 0x6ull}}, // type-parameter
+	{{0x655b223e55913f1dull, 0x47ffeffffff7feffull, 0x1f7ull}}, // close-angle-bracket
+	{{0x2000000000000001ull, 0x43ffeffffef5fe00ull, 0x7ull}}, // template-id
+	{{0x0ull, 0x400000000ull, 0x6ull}}, // template-argument-list
+	{{0x0ull, 0x80000400000000ull, 0x6ull}}, // template-argument-dots
+	{{0x0ull, 0x80000400400000ull, 0x6ull}}, // template-argument
+	{{0x644b221e55913f19ull, 0x47ffeffffff7fef7ull, 0x1f7ull}}, // typename-specifier
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // explicit-instantiation
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // explicit-specialization
+	{{0xfeffe3fffdffff7full, 0xc600000391e2fffull, 0x1f0ull}}, // try-block
+	{{0x455b3c3e55913f1dull, 0x2000000001100cffull, 0x1f0ull}}, // function-try-block
+	{{0xfffffffffdffffffull, 0x2c600000391e2fffull, 0x1f0ull}}, // handler
+	{{0x0ull, 0x4000ull, 0x0ull}}, // exception-declaration
+	{{0x0ull, 0x80000400705400ull, 0x6ull}}, // throw-expression
+	{{0x2000000000000001ull, 0x4280000500706a00ull, 0x7ull}}, // exception-specification
+	{{0x2000000000000001ull, 0x4280000500706a00ull, 0x7ull}}, // dynamic-exception-specification
+	{{0x0ull, 0x4000ull, 0x0ull}}, // type-id-list
+	{{0x0ull, 0x80000000004000ull, 0x0ull}}, // type-id-dots
+	{{0x2000000000000001ull, 0x4280000500706a00ull, 0x7ull}}, // noexcept-specification
+	{{0x0ull, 0x80000000001000ull, 0x0ull}}, // capture-list.1
+	{{0x0ull, 0x19feffffcf5fe00ull, 0x6ull}}, // noptr-new-declarator.1
+	{{0x0ull, 0x19feffffcf5d400ull, 0x6ull}}, // pm-expression.1
+	{{0x0ull, 0x9feffff8f5d400ull, 0x6ull}}, // multiplicative-expression.1
+	{{0x0ull, 0x9fefff18f5d400ull, 0x6ull}}, // additive-expression.1
+	{{0x0ull, 0x9fefff00f5d400ull, 0x6ull}}, // shift-expression.1
+	{{0x0ull, 0x9fe7ff00f5d400ull, 0x6ull}}, // relational-expression.1
+	{{0x0ull, 0x99e7fd00f5d400ull, 0x6ull}}, // equality-expression.1
+	{{0x0ull, 0x9867fd00f5d400ull, 0x6ull}}, // and-expression.1
+	{{0x0ull, 0x9867fd00f1d400ull, 0x6ull}}, // exclusive-or-expression.1
+	{{0x0ull, 0x9867fd00f0d400ull, 0x6ull}}, // inclusive-or-expression.1
+	{{0x0ull, 0x9867fd00f05400ull, 0x6ull}}, // logical-and-expression.1
+	{{0x0ull, 0x9067fd00f05400ull, 0x6ull}}, // logical-or-expression.1
+	{{0x0ull, 0x80000400705400ull, 0x6ull}}, // conditional-expression.1
+	{{0x0ull, 0x80000000305000ull, 0x0ull}}, // expression.1
+	{{0x0ull, 0x80000000000400ull, 0x0ull}}, // enumerator-list.1
+	{{0x0ull, 0x80000000001000ull, 0x0ull}}, // attribute-list.1
+	{{0x0ull, 0x80000000100000ull, 0x0ull}}, // init-declarator-list.1
+	{{0x2000000000000000ull, 0x4280000500706a00ull, 0x7ull}}, // noptr-declarator.1
+	{{0x0ull, 0x80000000404000ull, 0x0ull}}, // parameter-declaration-list.1
+	{{0x0ull, 0x80000000004400ull, 0x0ull}}, // initializer-list.1
+	{{0x0ull, 0x80000000100000ull, 0x0ull}}, // member-declarator-list.1
+	{{0x0ull, 0x80000000000200ull, 0x0ull}}, // base-specifier-list.1
+	{{0x0ull, 0x80000000000200ull, 0x0ull}}, // mem-initializer-list.1
+	{{0x0ull, 0x80000400000000ull, 0x6ull}}, // template-parameter-list.1
+	{{0x0ull, 0x80000400000000ull, 0x6ull}}, // template-argument-list.1
+	{{0x0ull, 0x80000000004000ull, 0x0ull}}, // type-id-list.1
+	{{0x2000000000000001ull, 0x4280000500706a00ull, 0x7ull}} // noexcept-specification.1
+};
+
+constexpr bool Memoize[NumNonterminals] =
+{
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	true,
+	true,
+	false,
+	true,
+	true,
+	true,
+	false,
+	true,
+	true,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	true,
+	false,
+	true,
+	false,
+	true,
+	false,
+	true,
+	false,
+	true,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	true,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	false,
+	true,
+	true,
+	true,
+	true,
+	false,
+	false,
+	false,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	true,
+	true,
+	true,
+	false,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	false,
+	false,
+	true,
+	true,
+	true,
+	true,
+	false,
+	false,
+	false,
+	false,
+	false,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	true,
+	false,
+	false,
+	false,
+	true,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false,
+	false
+};
+
+constexpr KindSet KindSets[] =
+{
+	{{0x0ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x0ull, 0x100000000ull}},
+	{{0x455b203e55913f1dull, 0xf8000000011008ffull, 0x7ffffffull}},
+	{{0x1000000000000000ull, 0x0ull, 0x0ull}},
+	{{0x8000000ull, 0x0ull, 0x0ull}},
+	{{0x10000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x0ull, 0xe0000000ull}},
+	{{0x200000000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x2000ull, 0x0ull}},
+	{{0x9a2743cc1835471aull, 0xfc600000390e28a5ull, 0xffffffffull}},
+	{{0x0ull, 0x4000ull, 0x0ull}},
+	{{0x20000010000ull, 0xfc00000001020000ull, 0x1fffffffull}},
+	{{0x0ull, 0x800ull, 0x0ull}},
+	{{0x0ull, 0xa800000000000000ull, 0x7feabfeull}},
+	{{0x0ull, 0x3000000000000000ull, 0x3333333ull}},
+	{{0x0ull, 0x0ull, 0x3fffc00ull}},
+	{{0x0ull, 0x0ull, 0x7fc03fcull}},
+	{{0x0ull, 0xa800000000000000ull, 0x2aaaaaaull}},
+	{{0x0ull, 0xc000000000000000ull, 0x3c3c3c3ull}},
+	{{0x0ull, 0x200000000ull, 0x0ull}},
+	{{0x0ull, 0x400000000ull, 0x600000000ull}},
+	{{0x926743cc18b55f1aull, 0xfc600000390e28e7ull, 0xffffffffull}},
+	{{0x20000000000ull, 0xfc00000000020000ull, 0x1fffffffull}},
+	{{0x10000ull, 0xf800000001000000ull, 0x7ffffffull}},
+	{{0x0ull, 0xfc00000000000000ull, 0x1bffffffull}},
+	{{0x20000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x20000ull, 0x0ull}},
+	{{0x10000ull, 0x0ull, 0x0ull}},
+	{{0x20000000000ull, 0x0ull, 0x7fc03fcull}},
+	{{0x100000000000000ull, 0x0ull, 0x0ull}},
+	{{0x100020000000000ull, 0xfc00000020020000ull, 0x1fffffffull}},
+	{{0x100000000000000ull, 0xfc00000000000000ull, 0x1fffffffull}},
+	{{0x0ull, 0x1000000ull, 0x0ull}},
+	{{0x0ull, 0xb800000000000000ull, 0x7ffffffull}},
+	{{0x0ull, 0x200ull, 0x0ull}},
+	{{0x0ull, 0x1000ull, 0x0ull}},
+	{{0x200000000000000ull, 0xfc00000100040000ull, 0x1bffffffull}},
+	{{0x0ull, 0x100040000ull, 0x0ull}},
+	{{0x200000000000000ull, 0xfc00000000040000ull, 0x1bffffffull}},
+	{{0x0ull, 0x80000000000000ull, 0x0ull}},
+	{{0x0ull, 0x40000ull, 0x0ull}},
+	{{0x0ull, 0x100000000ull, 0x0ull}},
+	{{0x0ull, 0x80000000001000ull, 0x0ull}},
+	{{0x0ull, 0x400000ull, 0x0ull}},
+	{{0x444b201e55913f19ull, 0xf8000000014008f7ull, 0x7ffffffull}},
+	{{0x800008000000001ull, 0x200000000000a00ull, 0x0ull}},
+	{{0x1000000000ull, 0x0ull, 0x0ull}},
+	{{0x1ull, 0x200000000000a00ull, 0x0ull}},
+	{{0x800008000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x200000000000200ull, 0x0ull}},
+	{{0x1ull, 0x800ull, 0x0ull}},
+	{{0x0ull, 0x200000000000000ull, 0x0ull}},
+	{{0x9223430c18314718ull, 0xfc000000010228a5ull, 0xffffffffull}},
+	{{0x0ull, 0x19feffffcf5d400ull, 0x600000000ull}},
+	{{0x0ull, 0x260000002002800ull, 0x0ull}},
+	{{0x1200030008010000ull, 0xfc00000001022800ull, 0xffffffffull}},
+	{{0x3000c10110718ull, 0xf8000000010000a4ull, 0x7ffffffull}},
+	{{0x9a2743cc1835471aull, 0xfc600000390e2aa5ull, 0xffffffffull}},
+	{{0x0ull, 0x1ull, 0x0ull}},
+	{{0x200000ull, 0x0ull, 0x0ull}},
+	{{0x43000c10911f18ull, 0xf8000000010000e7ull, 0x7ffffffull}},
+	{{0x20000000000000ull, 0x0ull, 0x0ull}},
+	{{0x400000000000ull, 0x0ull, 0x0ull}},
+	{{0x4000ull, 0x0ull, 0x0ull}},
+	{{0x8000000000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x2000000ull, 0x0ull}},
+	{{0x10000ull, 0xf800000001020000ull, 0x7ffffffull}},
+	{{0x0ull, 0x20000000000000ull, 0x0ull}},
+	{{0x0ull, 0x40000000000000ull, 0x0ull}},
+	{{0x0ull, 0x600000380e0000ull, 0x0ull}},
+	{{0x922743cc1835471aull, 0xfc600000390e28a5ull, 0xffffffffull}},
+	{{0x4000000000000ull, 0x0ull, 0x0ull}},
+	{{0x2ull, 0x0ull, 0x0ull}},
+	{{0x8000000000ull, 0x0ull, 0x0ull}},
+	{{0x4000000000ull, 0x1000000ull, 0x0ull}},
+	{{0x40000ull, 0x1000000ull, 0x0ull}},
+	{{0x0ull, 0x20000000ull, 0x0ull}},
+	{{0x0ull, 0x8000000ull, 0x0ull}},
+	{{0x0ull, 0x10000000ull, 0x0ull}},
+	{{0x0ull, 0x80000ull, 0x0ull}},
+	{{0x4000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x2200ull, 0x0ull}},
+	{{0x0ull, 0x19feffffcf5f600ull, 0x600000000ull}},
+	{{0x10000ull, 0xf808000021040800ull, 0x7ffffffull}},
+	{{0x10000ull, 0xf808000021040000ull, 0x7ffffffull}},
+	{{0x0ull, 0x19feffffcf5fe00ull, 0x600000000ull}},
+	{{0x40000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x100000004000000ull, 0x0ull}},
+	{{0x0ull, 0x9feffff8f5d400ull, 0x600000000ull}},
+	{{0x0ull, 0x4000000ull, 0x0ull}},
+	{{0x0ull, 0x100000000000000ull, 0x0ull}},
+	{{0x0ull, 0xe0000000ull, 0x0ull}},
+	{{0x0ull, 0x9fefff18f5d400ull, 0x600000000ull}},
+	{{0x0ull, 0x40000000ull, 0x0ull}},
+	{{0x0ull, 0x80000000ull, 0x0ull}},
+	{{0x0ull, 0x18000000ull, 0x0ull}},
+	{{0x0ull, 0x9fefff00f5d400ull, 0x600000000ull}},
+	{{0x0ull, 0x80000000000ull, 0x200000000ull}},
+	{{0x0ull, 0x9fe7ff00f5d400ull, 0x600000000ull}},
+	{{0x0ull, 0x80000000000ull, 0x0ull}},
+	{{0x0ull, 0x0ull, 0x200000000ull}},
+	{{0x0ull, 0x0ull, 0x400000000ull}},
+	{{0x0ull, 0x6000600000000ull, 0x0ull}},
+	{{0x0ull, 0x99e7fd00f5d400ull, 0x600000000ull}},
+	{{0x0ull, 0x400000000ull, 0x0ull}},
+	{{0x0ull, 0x2000000000000ull, 0x0ull}},
+	{{0x0ull, 0x4000000000000ull, 0x0ull}},
+	{{0x0ull, 0x1800000000000ull, 0x0ull}},
+	{{0x0ull, 0x9867fd00f5d400ull, 0x600000000ull}},
+	{{0x0ull, 0x800000000000ull, 0x0ull}},
+	{{0x0ull, 0x1000000000000ull, 0x0ull}},
+	{{0x0ull, 0x9867fd00f1d400ull, 0x600000000ull}},
+	{{0x0ull, 0x10000ull, 0x0ull}},
+	{{0x0ull, 0x9867fd00f0d400ull, 0x600000000ull}},
+	{{0x0ull, 0x8000ull, 0x0ull}},
+	{{0x0ull, 0x9867fd00f05400ull, 0x600000000ull}},
+	{{0x0ull, 0x8000000000000ull, 0x0ull}},
+	{{0x0ull, 0x9067fd00f05400ull, 0x600000000ull}},
+	{{0x0ull, 0x10000000000000ull, 0x0ull}},
+	{{0x0ull, 0x8067fd00f05400ull, 0x600000000ull}},
+	{{0x0ull, 0x800000ull, 0x0ull}},
+	{{0x0ull, 0x200000ull, 0x0ull}},
+	{{0x0ull, 0x80000400705400ull, 0x600000000ull}},
+	{{0x0ull, 0x67f900000000ull, 0x0ull}},
+	{{0x800000000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x2000000000ull, 0x0ull}},
+	{{0x0ull, 0x4000000000ull, 0x0ull}},
+	{{0x0ull, 0x8000000000ull, 0x0ull}},
+	{{0x0ull, 0x800000000ull, 0x0ull}},
+	{{0x0ull, 0x1000000000ull, 0x0ull}},
+	{{0x0ull, 0x200000000000ull, 0x0ull}},
+	{{0x0ull, 0x400000000000ull, 0x0ull}},
+	{{0x0ull, 0x20000000000ull, 0x0ull}},
+	{{0x0ull, 0x10000000000ull, 0x0ull}},
+	{{0x0ull, 0x40000000000ull, 0x0ull}},
+	{{0x0ull, 0x305000ull, 0x0ull}},
+	{{0x20041ull, 0xfc00000000000800ull, 0x1bffffffull}},
+	{{0x9a2743cc1835471aull, 0xfc600000391e28a5ull, 0xffffffffull}},
+	{{0x80000100000000ull, 0x0ull, 0x0ull}},
+	{{0x20080000ull, 0x100ull, 0x0ull}},
+	{{0x800080008020ull, 0x0ull, 0x0ull}},
+	{{0x445b203e55913f1dull, 0xf8000000010008ffull, 0x7ffffffull}},
+	{{0x2000000000000000ull, 0x0ull, 0x0ull}},
+	{{0xfeffe3fffdbfff7full, 0xfc600000391e2bffull, 0xffffffffull}},
+	{{0x40ull, 0x0ull, 0x0ull}},
+	{{0x20000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x100000ull, 0x0ull}},
+	{{0x0ull, 0x400ull, 0x0ull}},
+	{{0x100000000ull, 0x0ull, 0x0ull}},
+	{{0xde6f63de5db57f1bull, 0xfc600000390e28f7ull, 0xffffffffull}},
+	{{0x400000ull, 0x0ull, 0x0ull}},
+	{{0x80000000000000ull, 0x0ull, 0x0ull}},
+	{{0x444b201e55913f18ull, 0xf8000000010000f7ull, 0x7ffffffull}},
+	{{0x20000010000ull, 0xfc08000021462000ull, 0x1fffffffull}},
+	{{0x444b201e55913f19ull, 0xf8000000010008f7ull, 0x7ffffffull}},
+	{{0x0ull, 0x100ull, 0x0ull}},
+	{{0x80000ull, 0x0ull, 0x0ull}},
+	{{0x20000000ull, 0x0ull, 0x0ull}},
+	{{0xde6f63de5db57f1bull, 0xfc600000391e28f7ull, 0xffffffffull}},
+	{{0x20ull, 0x0ull, 0x0ull}},
+	{{0x8000ull, 0x0ull, 0x0ull}},
+	{{0x800000000000ull, 0x0ull, 0x0ull}},
+	{{0x80000000ull, 0x0ull, 0x0ull}},
+	{{0x100000004000000ull, 0x0ull, 0x0ull}},
+	{{0x4000000ull, 0x0ull, 0x0ull}},
+	{{0x2200000000ull, 0x0ull, 0x0ull}},
+	{{0x4ull, 0x0ull, 0x0ull}},
+	{{0x2000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x8ull, 0x0ull}},
+	{{0x1ull, 0x808ull, 0x0ull}},
+	{{0x10000000000000ull, 0x0ull, 0x0ull}},
+	{{0x800000ull, 0x0ull, 0x0ull}},
+	{{0x408201004000000ull, 0x0ull, 0x0ull}},
+	{{0x201000000ull, 0x10ull, 0x0ull}},
+	{{0x40000000ull, 0x0ull, 0x0ull}},
+	{{0x4000000000000000ull, 0x0ull, 0x0ull}},
+	{{0x2000ull, 0x0ull, 0x0ull}},
+	{{0x20000010001ull, 0xfe88000521766800ull, 0x61fffffffull}},
+	{{0x200000000000ull, 0x0ull, 0x0ull}},
+	{{0x8000000000000ull, 0x0ull, 0x0ull}},
+	{{0x400000000000000ull, 0x0ull, 0x0ull}},
+	{{0x200000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x10ull, 0x0ull}},
+	{{0x1000000ull, 0x0ull, 0x0ull}},
+	{{0x40000000000800ull, 0x2ull, 0x0ull}},
+	{{0x40000000800800ull, 0x2ull, 0x0ull}},
+	{{0x1000ull, 0x40ull, 0x0ull}},
+	{{0x2000000000010001ull, 0xfbffeffffff5fe00ull, 0x61fffffffull}},
+	{{0x2000000000010001ull, 0xfa88000521746a00ull, 0x61fffffffull}},
+	{{0x2000000000010000ull, 0xfa88000521746a00ull, 0x61fffffffull}},
+	{{0x100ull, 0x0ull, 0x0ull}},
+	{{0x200ull, 0x0ull, 0x0ull}},
+	{{0x400ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x80ull, 0x0ull}},
+	{{0x10ull, 0x0ull, 0x0ull}},
+	{{0x1000000000000ull, 0x0ull, 0x0ull}},
+	{{0x400000000ull, 0x0ull, 0x0ull}},
+	{{0x800000000ull, 0x0ull, 0x0ull}},
+	{{0x2000000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x4ull, 0x0ull}},
+	{{0x10000000ull, 0x0ull, 0x0ull}},
+	{{0x100000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x20ull, 0x0ull}},
+	{{0x8ull, 0x0ull, 0x0ull}},
+	{{0x10000ull, 0xfc00000001000000ull, 0x1fffffffull}},
+	{{0x100000000000000ull, 0x0ull, 0x7fc03fcull}},
+	{{0x0ull, 0xfc00000000200200ull, 0x1bffffffull}},
+	{{0x0ull, 0x200200ull, 0x0ull}},
+	{{0x800ull, 0x0ull, 0x0ull}},
+	{{0x40000000000000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x80000000000400ull, 0x0ull}},
+	{{0x0ull, 0xfc80000000000000ull, 0x1bffffffull}},
+	{{0x1ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x80000000401000ull, 0x0ull}},
+	{{0xffffffffffffffffull, 0xffffefffffffabffull, 0x6ffffffffull}},
+	{{0xffffffffffffffffull, 0xffffefffffff81ffull, 0x6ffffffffull}},
+	{{0x0ull, 0x80000000100000ull, 0x0ull}},
+	{{0x0ull, 0x100002200ull, 0x0ull}},
+	{{0x20000010000ull, 0xfc00000001422000ull, 0x1fffffffull}},
+	{{0x0ull, 0x2800ull, 0x0ull}},
+	{{0x2000000000000000ull, 0x280000500706200ull, 0x618000000ull}},
+	{{0x20000010000ull, 0xfc00000001420000ull, 0x1fffffffull}},
+	{{0x2000000000000000ull, 0x280000500706a00ull, 0x618000000ull}},
+	{{0x2800008000000001ull, 0x288000500746a00ull, 0x618000000ull}},
+	{{0x2800008000000001ull, 0x280000500706a00ull, 0x618000000ull}},
+	{{0x0ull, 0x8000000040000ull, 0x0ull}},
+	{{0x2000000000000001ull, 0x280000500706a00ull, 0x618000000ull}},
+	{{0x2000000000000000ull, 0x80000500706200ull, 0x618000000ull}},
+	{{0x10000ull, 0xfa08000021442800ull, 0x7ffffffull}},
+	{{0x2000020000011001ull, 0xffffeffffff7fe40ull, 0x61fffffffull}},
+	{{0x2000020000010001ull, 0xffffeffffff7fe00ull, 0x61fffffffull}},
+	{{0x1000ull, 0x0ull, 0x0ull}},
+	{{0x0ull, 0x40ull, 0x0ull}},
+	{{0x0ull, 0x80000400504000ull, 0x600000000ull}},
+	{{0x10000ull, 0xf808000021042800ull, 0x7ffffffull}},
+	{{0x10000ull, 0xf808000021440000ull, 0x7ffffffull}},
+	{{0x0ull, 0x404000ull, 0x0ull}},
+	{{0x0ull, 0x80000000404000ull, 0x0ull}},
+	{{0x0ull, 0x80000400404000ull, 0x600000000ull}},
+	{{0x2000000000000000ull, 0x100200200ull, 0x0ull}},
+	{{0x0ull, 0x0ull, 0x18000000ull}},
+	{{0x0ull, 0x100000200ull, 0x0ull}},
+	{{0x0ull, 0x80000000004400ull, 0x0ull}},
+	{{0x455b3c1e55913f19ull, 0xf8000000010008ffull, 0x7ffffffull}},
+	{{0x0ull, 0x0ull, 0x10000000ull}},
+	{{0x0ull, 0x2ull, 0x0ull}},
+	{{0x455b201e55913f19ull, 0xf8000000010008ffull, 0x7ffffffull}},
+	{{0x1c0000000000ull, 0x0ull, 0x0ull}},
+	{{0x20000010001ull, 0xfc08000021662800ull, 0x1fffffffull}},
+	{{0x455b3c1e55913f19ull, 0xf800000001000cffull, 0x7ffffffull}},
+	{{0x0ull, 0x80000100100000ull, 0x0ull}},
+	{{0x1ull, 0x200800ull, 0x0ull}},
+	{{0x0ull, 0x0ull, 0x8000000ull}},
+	{{0x0ull, 0x0ull, 0x40000000ull}},
+	{{0x1c0000010001ull, 0xf800000001000810ull, 0x7ffffffull}},
+	{{0x0ull, 0x80000000000200ull, 0x0ull}},
+	{{0x40000000000ull, 0x0ull, 0x0ull}},
+	{{0x80000000000ull, 0x0ull, 0x0ull}},
+	{{0x100000000000ull, 0x0ull, 0x0ull}},
+	{{0x2000000000000001ull, 0x3ffeffffef5fe00ull, 0x618000000ull}},
+	{{0x0ull, 0x0ull, 0x80000000ull}},
+	{{0x454b201e55913f19ull, 0xf8000000010008f7ull, 0x7ffffffull}},
+	{{0x100000000000800ull, 0x1ull, 0x0ull}},
+	{{0x0ull, 0xfc80000400000000ull, 0x61bffffffull}},
+	{{0x0ull, 0x80000400000000ull, 0x600000000ull}},
+	{{0xfeffe3fffdffff7full, 0xfc600000391e2fffull, 0xffffffffull}},
+	{{0x80ull, 0x0ull, 0x0ull}},
+	{{0x455b3c3e55913f1dull, 0xf800000001100cffull, 0x107ffffffull}},
+	{{0x43000c10911f19ull, 0xf8000000014008e7ull, 0x7ffffffull}},
+	{{0x20000010001ull, 0xfc08000021462800ull, 0x1fffffffull}},
+	{{0x10001ull, 0xfa08000021446800ull, 0x7ffffffull}},
+	{{0x10000ull, 0xfa08000021446800ull, 0x7ffffffull}},
+	{{0x0ull, 0x80000000004000ull, 0x0ull}}
+};
+
+constexpr int NumAlternatives = 498;
+
+constexpr GrammarItem GrammarItems[] =
+{
+	// translation-unit: declaration* ST_EOF
+	{ NumTerminals + NT_DECLARATION, REPEAT_STAR, CONTEXT_INHERIT, false, 2, 1 },
+	{ ST_EOF, REPEAT_ONE, CONTEXT_INHERIT, false, 1, 0 },
+	// primary-expression: KW_TRUE
+	{ KW_TRUE, REPEAT_ONE, CONTEXT_INHERIT, false, 3, 0 },
+	// primary-expression: KW_FALSE
+	{ KW_FALSE, REPEAT_ONE, CONTEXT_INHERIT, false, 4, 0 },
+	// primary-expression: KW_NULLPTR
+	{ KW_NULLPTR, REPEAT_ONE, CONTEXT_INHERIT, false, 5, 0 },
+	// primary-expression: TT_LITERAL
+	{ TT_LITERAL, REPEAT_ONE, CONTEXT_INHERIT, false, 6, 0 },
+	// primary-expression: KW_THIS
+	{ KW_THIS, REPEAT_ONE, CONTEXT_INHERIT, false, 7, 0 },
+	// primary-expression: OP_LPAREN expression OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// primary-expression: id-expression
+	{ NumTerminals + NT_ID_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 11, 0 },
+	// primary-expression: lambda-expression
+	{ NumTerminals + NT_LAMBDA_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	// type-name: class-name
+	{ NumTerminals + NT_CLASS_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 13, 0 },
+	// type-name: enum-name
+	{ NumTerminals + NT_ENUM_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 14, 0 },
+	// type-name: typedef-name
+	{ NumTerminals + NT_TYPEDEF_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 15, 0 },
+	// type-name: simple-template-id
+	{ NumTerminals + NT_SIMPLE_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	// class-name: TT_IDENTIFIER
+	{ ST_CLASS_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 17, 0 },
+	// class-name: simple-template-id
+	{ NumTerminals + NT_SIMPLE_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	// enum-name: TT_IDENTIFIER
+	{ ST_ENUM_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 14, 0 },
+	// namespace-name: TT_IDENTIFIER
+	{ ST_NAMESPACE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 18, 0 },
+	// template-name: TT_IDENTIFIER
+	{ ST_TEMPLATE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	// typedef-name: TT_IDENTIFIER
+	{ ST_TYPEDEF_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 15, 0 },
+	// simple-template-id: template-name OP_LT template-argument-list? close-angle-bracket
+	{ NumTerminals + NT_TEMPLATE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TEMPLATE_ARGUMENT_LIST, REPEAT_OPTIONAL, CONTEXT_ANGLE, false, 21, 20 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	// id-expression: unqualified-id
+	{ NumTerminals + NT_UNQUALIFIED_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 22, 0 },
+	// id-expression: qualified-id
+	{ NumTerminals + NT_QUALIFIED_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	// unqualified-id: TT_IDENTIFIER
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// unqualified-id: operator-function-id
+	{ NumTerminals + NT_OPERATOR_FUNCTION_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	// unqualified-id: conversion-function-id
+	{ NumTerminals + NT_CONVERSION_FUNCTION_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	// unqualified-id: literal-operator-id
+	{ NumTerminals + NT_LITERAL_OPERATOR_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	// unqualified-id: OP_COMPL class-name
+	{ OP_COMPL, REPEAT_ONE, CONTEXT_INHERIT, false, 26, 0 },
+	{ NumTerminals + NT_CLASS_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 13, 0 },
+	// unqualified-id: OP_COMPL decltype-specifier
+	{ OP_COMPL, REPEAT_ONE, CONTEXT_INHERIT, false, 26, 0 },
+	{ NumTerminals + NT_DECLTYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 27, 0 },
+	// unqualified-id: template-id
+	{ NumTerminals + NT_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 28, 0 },
+	// qualified-id: nested-name-specifier KW_TEMPLATE? unqualified-id
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ KW_TEMPLATE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 29, 22 },
+	{ NumTerminals + NT_UNQUALIFIED_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 22, 0 },
+	// nested-name-specifier: nested-name-specifier-root nested-name-specifier-suffix*
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER_ROOT, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER_SUFFIX, REPEAT_STAR, CONTEXT_INHERIT, false, 31, 30 },
+	// nested-name-specifier-root: OP_COLON2
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	// nested-name-specifier-root: type-name OP_COLON2
+	{ NumTerminals + NT_TYPE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 33, 0 },
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	// nested-name-specifier-root: namespace-name OP_COLON2
+	{ NumTerminals + NT_NAMESPACE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 18, 0 },
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	// nested-name-specifier-root: decltype-specifier OP_COLON2
+	{ NumTerminals + NT_DECLTYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 27, 0 },
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	// nested-name-specifier-suffix: TT_IDENTIFIER OP_COLON2
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	// nested-name-specifier-suffix: KW_TEMPLATE? simple-template-id OP_COLON2
+	{ KW_TEMPLATE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 29, 16 },
+	{ NumTerminals + NT_SIMPLE_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	// lambda-expression: lambda-introducer lambda-declarator? compound-statement
+	{ NumTerminals + NT_LAMBDA_INTRODUCER, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_LAMBDA_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 8, 34 },
+	{ NumTerminals + NT_COMPOUND_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// lambda-introducer: OP_LSQUARE lambda-capture? OP_RSQUARE
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_LAMBDA_CAPTURE, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 36, 35 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// lambda-capture: capture-default
+	{ NumTerminals + NT_CAPTURE_DEFAULT, REPEAT_ONE, CONTEXT_INHERIT, false, 37, 0 },
+	// lambda-capture: capture-list
+	{ NumTerminals + NT_CAPTURE_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 38, 0 },
+	// lambda-capture: capture-default OP_COMMA capture-list
+	{ NumTerminals + NT_CAPTURE_DEFAULT, REPEAT_ONE, CONTEXT_INHERIT, false, 37, 0 },
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_CAPTURE_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 38, 0 },
+	// capture-default: OP_AMP
+	{ OP_AMP, REPEAT_ONE, CONTEXT_INHERIT, false, 40, 0 },
+	// capture-default: OP_ASS
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	// capture-list.1: OP_COMMA capture OP_DOTS?
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_CAPTURE, REPEAT_ONE, CONTEXT_INHERIT, false, 38, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 42 },
+	// capture-list: capture OP_DOTS? (OP_COMMA capture OP_DOTS?)*
+	{ NumTerminals + NT_CAPTURE, REPEAT_ONE, CONTEXT_INHERIT, false, 38, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 42 },
+	{ NumTerminals + NT_CAPTURE_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 35 },
+	// capture: TT_IDENTIFIER
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// capture: OP_AMP TT_IDENTIFIER
+	{ OP_AMP, REPEAT_ONE, CONTEXT_INHERIT, false, 40, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// capture: KW_THIS
+	{ KW_THIS, REPEAT_ONE, CONTEXT_INHERIT, false, 7, 0 },
+	// lambda-declarator: OP_LPAREN parameter-declaration-clause OP_RPAREN KW_MUTABLE? exception-specification? attribute-specifier* trailing-return-type?
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_PARAMETER_DECLARATION_CLAUSE, REPEAT_ONE, CONTEXT_PLAIN, false, 44, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ KW_MUTABLE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 46, 45 },
+	{ NumTerminals + NT_EXCEPTION_SPECIFICATION, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 48, 47 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 49 },
+	{ NumTerminals + NT_TRAILING_RETURN_TYPE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 51, 34 },
+	// postfix-expression: postfix-root postfix-suffix*
+	{ NumTerminals + NT_POSTFIX_ROOT, REPEAT_ONE, CONTEXT_INHERIT, false, 52, 0 },
+	{ NumTerminals + NT_POSTFIX_SUFFIX, REPEAT_STAR, CONTEXT_INHERIT, false, 54, 53 },
+	// postfix-root: primary-expression
+	{ NumTerminals + NT_PRIMARY_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 55, 0 },
+	// postfix-root: simple-type-specifier OP_LPAREN expression-list? OP_RPAREN
+	{ NumTerminals + NT_SIMPLE_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 56, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION_LIST, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 57, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-root: typename-specifier OP_LPAREN expression-list? OP_RPAREN
+	{ NumTerminals + NT_TYPENAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 58, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION_LIST, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 57, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-root: simple-type-specifier braced-init-list
+	{ NumTerminals + NT_SIMPLE_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 56, 0 },
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// postfix-root: typename-specifier braced-init-list
+	{ NumTerminals + NT_TYPENAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 58, 0 },
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// postfix-root: KW_DYNAMIC_CAST OP_LT type-id close-angle-bracket OP_LPAREN expression OP_RPAREN
+	{ KW_DYNAMIC_CAST, REPEAT_ONE, CONTEXT_INHERIT, false, 59, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_ANGLE, false, 60, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-root: KW_STATIC_CAST OP_LT type-id close-angle-bracket OP_LPAREN expression OP_RPAREN
+	{ KW_STATIC_CAST, REPEAT_ONE, CONTEXT_INHERIT, false, 61, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_ANGLE, false, 60, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-root: KW_REINTERPET_CAST OP_LT type-id close-angle-bracket OP_LPAREN expression OP_RPAREN
+	{ KW_REINTERPET_CAST, REPEAT_ONE, CONTEXT_INHERIT, false, 62, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_ANGLE, false, 60, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-root: KW_CONST_CAST OP_LT type-id close-angle-bracket OP_LPAREN expression OP_RPAREN
+	{ KW_CONST_CAST, REPEAT_ONE, CONTEXT_INHERIT, false, 63, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_ANGLE, false, 60, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-root: KW_TYPEID OP_LPAREN expression OP_RPAREN
+	{ KW_TYPEID, REPEAT_ONE, CONTEXT_INHERIT, false, 64, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-root: KW_TYPEID OP_LPAREN type-id OP_RPAREN
+	{ KW_TYPEID, REPEAT_ONE, CONTEXT_INHERIT, false, 64, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_PLAIN, false, 60, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-suffix: OP_LSQUARE expression OP_RSQUARE
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// postfix-suffix: OP_LSQUARE braced-init-list OP_RSQUARE
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_PLAIN, false, 34, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// postfix-suffix: OP_LPAREN expression-list? OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION_LIST, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 57, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// postfix-suffix: OP_DOT pseudo-destructor-name
+	{ OP_DOT, REPEAT_ONE, CONTEXT_INHERIT, false, 65, 0 },
+	{ NumTerminals + NT_PSEUDO_DESTRUCTOR_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 66, 0 },
+	// postfix-suffix: OP_DOT KW_TEMPLATE? id-expression
+	{ OP_DOT, REPEAT_ONE, CONTEXT_INHERIT, false, 65, 0 },
+	{ KW_TEMPLATE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 29, 11 },
+	{ NumTerminals + NT_ID_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 11, 0 },
+	// postfix-suffix: OP_ARROW pseudo-destructor-name
+	{ OP_ARROW, REPEAT_ONE, CONTEXT_INHERIT, false, 51, 0 },
+	{ NumTerminals + NT_PSEUDO_DESTRUCTOR_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 66, 0 },
+	// postfix-suffix: OP_ARROW KW_TEMPLATE? id-expression
+	{ OP_ARROW, REPEAT_ONE, CONTEXT_INHERIT, false, 51, 0 },
+	{ KW_TEMPLATE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 29, 11 },
+	{ NumTerminals + NT_ID_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 11, 0 },
+	// postfix-suffix: OP_INC
+	{ OP_INC, REPEAT_ONE, CONTEXT_INHERIT, false, 67, 0 },
+	// postfix-suffix: OP_DEC
+	{ OP_DEC, REPEAT_ONE, CONTEXT_INHERIT, false, 68, 0 },
+	// expression-list: initializer-list
+	{ NumTerminals + NT_INITIALIZER_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	// pseudo-destructor-name: nested-name-specifier? OP_COMPL type-name
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 26 },
+	{ OP_COMPL, REPEAT_ONE, CONTEXT_INHERIT, false, 26, 0 },
+	{ NumTerminals + NT_TYPE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 33, 0 },
+	// pseudo-destructor-name: OP_COMPL decltype-specifier
+	{ OP_COMPL, REPEAT_ONE, CONTEXT_INHERIT, false, 26, 0 },
+	{ NumTerminals + NT_DECLTYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 27, 0 },
+	// unary-expression: postfix-expression
+	{ NumTerminals + NT_POSTFIX_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 52, 0 },
+	// unary-expression: unary-operator cast-expression
+	{ NumTerminals + NT_UNARY_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 69, 0 },
+	{ NumTerminals + NT_CAST_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// unary-expression: KW_SIZEOF unary-expression
+	{ KW_SIZEOF, REPEAT_ONE, CONTEXT_INHERIT, false, 71, 0 },
+	{ NumTerminals + NT_UNARY_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// unary-expression: KW_SIZEOF OP_LPAREN type-id OP_RPAREN
+	{ KW_SIZEOF, REPEAT_ONE, CONTEXT_INHERIT, false, 71, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_PLAIN, false, 60, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// unary-expression: KW_SIZEOF OP_DOTS OP_LPAREN TT_IDENTIFIER OP_RPAREN
+	{ KW_SIZEOF, REPEAT_ONE, CONTEXT_INHERIT, false, 71, 0 },
+	{ OP_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 43, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_PLAIN, false, 24, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// unary-expression: KW_ALIGNOF OP_LPAREN type-id OP_RPAREN
+	{ KW_ALIGNOF, REPEAT_ONE, CONTEXT_INHERIT, false, 72, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_PLAIN, false, 60, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// unary-expression: noexcept-expression
+	{ NumTerminals + NT_NOEXCEPT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 73, 0 },
+	// unary-expression: new-expression
+	{ NumTerminals + NT_NEW_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 74, 0 },
+	// unary-expression: delete-expression
+	{ NumTerminals + NT_DELETE_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 75, 0 },
+	// unary-operator: OP_INC
+	{ OP_INC, REPEAT_ONE, CONTEXT_INHERIT, false, 67, 0 },
+	// unary-operator: OP_DEC
+	{ OP_DEC, REPEAT_ONE, CONTEXT_INHERIT, false, 68, 0 },
+	// unary-operator: OP_STAR
+	{ OP_STAR, REPEAT_ONE, CONTEXT_INHERIT, false, 76, 0 },
+	// unary-operator: OP_AMP
+	{ OP_AMP, REPEAT_ONE, CONTEXT_INHERIT, false, 40, 0 },
+	// unary-operator: OP_PLUS
+	{ OP_PLUS, REPEAT_ONE, CONTEXT_INHERIT, false, 77, 0 },
+	// unary-operator: OP_MINUS
+	{ OP_MINUS, REPEAT_ONE, CONTEXT_INHERIT, false, 78, 0 },
+	// unary-operator: OP_LNOT
+	{ OP_LNOT, REPEAT_ONE, CONTEXT_INHERIT, false, 79, 0 },
+	// unary-operator: OP_COMPL
+	{ OP_COMPL, REPEAT_ONE, CONTEXT_INHERIT, false, 26, 0 },
+	// new-expression: OP_COLON2? KW_NEW new-placement? new-type-id new-initializer?
+	{ OP_COLON2, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 32, 80 },
+	{ KW_NEW, REPEAT_ONE, CONTEXT_INHERIT, false, 80, 0 },
+	{ NumTerminals + NT_NEW_PLACEMENT, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 8, 60 },
+	{ NumTerminals + NT_NEW_TYPE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ NumTerminals + NT_NEW_INITIALIZER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 81, 53 },
+	// new-expression: OP_COLON2? KW_NEW new-placement? OP_LPAREN type-id OP_RPAREN new-initializer?
+	{ OP_COLON2, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 32, 80 },
+	{ KW_NEW, REPEAT_ONE, CONTEXT_INHERIT, false, 80, 0 },
+	{ NumTerminals + NT_NEW_PLACEMENT, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 8, 8 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_PLAIN, false, 60, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_NEW_INITIALIZER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 81, 53 },
+	// new-placement: OP_LPAREN expression-list OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION_LIST, REPEAT_ONE, CONTEXT_PLAIN, false, 57, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// new-type-id: type-specifier-seq new-declarator?
+	{ NumTerminals + NT_TYPE_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ NumTerminals + NT_NEW_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 83, 82 },
+	// new-declarator: ptr-operator* noptr-new-declarator
+	{ NumTerminals + NT_PTR_OPERATOR, REPEAT_STAR, CONTEXT_INHERIT, false, 84, 12 },
+	{ NumTerminals + NT_NOPTR_NEW_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	// new-declarator: ptr-operator+
+	{ NumTerminals + NT_PTR_OPERATOR, REPEAT_PLUS, CONTEXT_INHERIT, false, 84, 82 },
+	// noptr-new-declarator.1: OP_LSQUARE constant-expression OP_RSQUARE attribute-specifier*
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 70, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 85 },
+	// noptr-new-declarator: OP_LSQUARE expression OP_RSQUARE attribute-specifier* (OP_LSQUARE constant-expression OP_RSQUARE attribute-specifier*)*
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 85 },
+	{ NumTerminals + NT_NOPTR_NEW_DECLARATOR_1, REPEAT_STAR, CONTEXT_INHERIT, false, 12, 82 },
+	// new-initializer: OP_LPAREN expression-list? OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION_LIST, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 57, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// new-initializer: braced-init-list
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// delete-expression: OP_COLON2? KW_DELETE cast-expression
+	{ OP_COLON2, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 32, 86 },
+	{ KW_DELETE, REPEAT_ONE, CONTEXT_INHERIT, false, 86, 0 },
+	{ NumTerminals + NT_CAST_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// delete-expression: OP_COLON2? KW_DELETE OP_LSQUARE OP_RSQUARE cast-expression
+	{ OP_COLON2, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 32, 86 },
+	{ KW_DELETE, REPEAT_ONE, CONTEXT_INHERIT, false, 86, 0 },
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	{ NumTerminals + NT_CAST_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// noexcept-expression: KW_NOEXCEPT OP_LPAREN expression OP_RPAREN
+	{ KW_NOEXCEPT, REPEAT_ONE, CONTEXT_INHERIT, false, 73, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// cast-expression: unary-expression
+	{ NumTerminals + NT_UNARY_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// cast-expression: cast-operator cast-expression
+	{ NumTerminals + NT_CAST_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_CAST_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// cast-operator: OP_LPAREN type-id OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_PLAIN, false, 60, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// pm-expression.1: pm-operator cast-expression
+	{ NumTerminals + NT_PM_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 87, 0 },
+	{ NumTerminals + NT_CAST_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// pm-expression: cast-expression (pm-operator cast-expression)*
+	{ NumTerminals + NT_CAST_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_PM_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 87, 88 },
+	// pm-operator: OP_DOTSTAR
+	{ OP_DOTSTAR, REPEAT_ONE, CONTEXT_INHERIT, false, 89, 0 },
+	// pm-operator: OP_ARROWSTAR
+	{ OP_ARROWSTAR, REPEAT_ONE, CONTEXT_INHERIT, false, 90, 0 },
+	// multiplicative-expression.1: multiplicative-operator pm-expression
+	{ NumTerminals + NT_MULTIPLICATIVE_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 91, 0 },
+	{ NumTerminals + NT_PM_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// multiplicative-expression: pm-expression (multiplicative-operator pm-expression)*
+	{ NumTerminals + NT_PM_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_MULTIPLICATIVE_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 91, 92 },
+	// multiplicative-operator: OP_STAR
+	{ OP_STAR, REPEAT_ONE, CONTEXT_INHERIT, false, 76, 0 },
+	// multiplicative-operator: OP_DIV
+	{ OP_DIV, REPEAT_ONE, CONTEXT_INHERIT, false, 93, 0 },
+	// multiplicative-operator: OP_MOD
+	{ OP_MOD, REPEAT_ONE, CONTEXT_INHERIT, false, 94, 0 },
+	// additive-expression.1: additive-operator multiplicative-expression
+	{ NumTerminals + NT_ADDITIVE_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 95, 0 },
+	{ NumTerminals + NT_MULTIPLICATIVE_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// additive-expression: multiplicative-expression (additive-operator multiplicative-expression)*
+	{ NumTerminals + NT_MULTIPLICATIVE_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_ADDITIVE_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 95, 96 },
+	// additive-operator: OP_PLUS
+	{ OP_PLUS, REPEAT_ONE, CONTEXT_INHERIT, false, 77, 0 },
+	// additive-operator: OP_MINUS
+	{ OP_MINUS, REPEAT_ONE, CONTEXT_INHERIT, false, 78, 0 },
+	// shift-expression.1: shift-operator additive-expression
+	{ NumTerminals + NT_SHIFT_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 97, 0 },
+	{ NumTerminals + NT_ADDITIVE_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// shift-expression: additive-expression (shift-operator additive-expression)*
+	{ NumTerminals + NT_ADDITIVE_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_SHIFT_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 97, 98 },
+	// shift-operator: OP_LSHIFT
+	{ OP_LSHIFT, REPEAT_ONE, CONTEXT_INHERIT, false, 99, 0 },
+	// shift-operator: ST_RSHIFT_1 ST_RSHIFT_2
+	{ ST_RSHIFT_1, REPEAT_ONE, CONTEXT_INHERIT, true, 100, 0 },
+	{ ST_RSHIFT_2, REPEAT_ONE, CONTEXT_INHERIT, false, 101, 0 },
+	// relational-expression.1: relational-operator shift-expression
+	{ NumTerminals + NT_RELATIONAL_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 102, 0 },
+	{ NumTerminals + NT_SHIFT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// relational-expression: shift-expression (relational-operator shift-expression)*
+	{ NumTerminals + NT_SHIFT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_RELATIONAL_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 102, 103 },
+	// relational-operator: OP_LT
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	// relational-operator: OP_GT
+	{ OP_GT, REPEAT_ONE, CONTEXT_INHERIT, true, 104, 0 },
+	// relational-operator: OP_LE
+	{ OP_LE, REPEAT_ONE, CONTEXT_INHERIT, false, 105, 0 },
+	// relational-operator: OP_GE
+	{ OP_GE, REPEAT_ONE, CONTEXT_INHERIT, false, 106, 0 },
+	// equality-expression.1: equality-operator relational-expression
+	{ NumTerminals + NT_EQUALITY_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 107, 0 },
+	{ NumTerminals + NT_RELATIONAL_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// equality-expression: relational-expression (equality-operator relational-expression)*
+	{ NumTerminals + NT_RELATIONAL_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_EQUALITY_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 107, 108 },
+	// equality-operator: OP_EQ
+	{ OP_EQ, REPEAT_ONE, CONTEXT_INHERIT, false, 109, 0 },
+	// equality-operator: OP_NE
+	{ OP_NE, REPEAT_ONE, CONTEXT_INHERIT, false, 110, 0 },
+	// and-expression.1: OP_AMP equality-expression
+	{ OP_AMP, REPEAT_ONE, CONTEXT_INHERIT, false, 40, 0 },
+	{ NumTerminals + NT_EQUALITY_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// and-expression: equality-expression (OP_AMP equality-expression)*
+	{ NumTerminals + NT_EQUALITY_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_AND_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 40, 111 },
+	// exclusive-or-expression.1: OP_XOR and-expression
+	{ OP_XOR, REPEAT_ONE, CONTEXT_INHERIT, false, 112, 0 },
+	{ NumTerminals + NT_AND_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// exclusive-or-expression: and-expression (OP_XOR and-expression)*
+	{ NumTerminals + NT_AND_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_EXCLUSIVE_OR_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 112, 113 },
+	// inclusive-or-expression.1: OP_BOR exclusive-or-expression
+	{ OP_BOR, REPEAT_ONE, CONTEXT_INHERIT, false, 114, 0 },
+	{ NumTerminals + NT_EXCLUSIVE_OR_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// inclusive-or-expression: exclusive-or-expression (OP_BOR exclusive-or-expression)*
+	{ NumTerminals + NT_EXCLUSIVE_OR_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_INCLUSIVE_OR_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 114, 115 },
+	// logical-and-expression.1: OP_LAND inclusive-or-expression
+	{ OP_LAND, REPEAT_ONE, CONTEXT_INHERIT, false, 116, 0 },
+	{ NumTerminals + NT_INCLUSIVE_OR_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// logical-and-expression: inclusive-or-expression (OP_LAND inclusive-or-expression)*
+	{ NumTerminals + NT_INCLUSIVE_OR_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_LOGICAL_AND_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 116, 117 },
+	// logical-or-expression.1: OP_LOR logical-and-expression
+	{ OP_LOR, REPEAT_ONE, CONTEXT_INHERIT, false, 118, 0 },
+	{ NumTerminals + NT_LOGICAL_AND_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// logical-or-expression: logical-and-expression (OP_LOR logical-and-expression)*
+	{ NumTerminals + NT_LOGICAL_AND_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_LOGICAL_OR_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 118, 119 },
+	// conditional-expression.1: OP_QMARK expression OP_COLON assignment-expression
+	{ OP_QMARK, REPEAT_ONE, CONTEXT_INHERIT, false, 120, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 9, 0 },
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_ASSIGNMENT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 9, 0 },
+	// conditional-expression: logical-or-expression (OP_QMARK expression OP_COLON assignment-expression)?
+	{ NumTerminals + NT_LOGICAL_OR_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_CONDITIONAL_EXPRESSION_1, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 120, 122 },
+	// assignment-expression: conditional-expression
+	{ NumTerminals + NT_CONDITIONAL_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// assignment-expression: logical-or-expression assignment-operator initializer-clause
+	{ NumTerminals + NT_LOGICAL_OR_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ NumTerminals + NT_ASSIGNMENT_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 123, 0 },
+	{ NumTerminals + NT_INITIALIZER_CLAUSE, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	// assignment-expression: throw-expression
+	{ NumTerminals + NT_THROW_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 124, 0 },
+	// assignment-operator: OP_ASS
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	// assignment-operator: OP_STARASS
+	{ OP_STARASS, REPEAT_ONE, CONTEXT_INHERIT, false, 125, 0 },
+	// assignment-operator: OP_DIVASS
+	{ OP_DIVASS, REPEAT_ONE, CONTEXT_INHERIT, false, 126, 0 },
+	// assignment-operator: OP_MODASS
+	{ OP_MODASS, REPEAT_ONE, CONTEXT_INHERIT, false, 127, 0 },
+	// assignment-operator: OP_PLUSASS
+	{ OP_PLUSASS, REPEAT_ONE, CONTEXT_INHERIT, false, 128, 0 },
+	// assignment-operator: OP_MINUSASS
+	{ OP_MINUSASS, REPEAT_ONE, CONTEXT_INHERIT, false, 129, 0 },
+	// assignment-operator: OP_RSHIFTASS
+	{ OP_RSHIFTASS, REPEAT_ONE, CONTEXT_INHERIT, false, 130, 0 },
+	// assignment-operator: OP_LSHIFTASS
+	{ OP_LSHIFTASS, REPEAT_ONE, CONTEXT_INHERIT, false, 131, 0 },
+	// assignment-operator: OP_BANDASS
+	{ OP_BANDASS, REPEAT_ONE, CONTEXT_INHERIT, false, 132, 0 },
+	// assignment-operator: OP_XORASS
+	{ OP_XORASS, REPEAT_ONE, CONTEXT_INHERIT, false, 133, 0 },
+	// assignment-operator: OP_BORASS
+	{ OP_BORASS, REPEAT_ONE, CONTEXT_INHERIT, false, 134, 0 },
+	// expression.1: OP_COMMA assignment-expression
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_ASSIGNMENT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 9, 0 },
+	// expression: assignment-expression (OP_COMMA assignment-expression)*
+	{ NumTerminals + NT_ASSIGNMENT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 9, 0 },
+	{ NumTerminals + NT_EXPRESSION_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 135 },
+	// constant-expression: conditional-expression
+	{ NumTerminals + NT_CONDITIONAL_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// statement: labeled-statement
+	{ NumTerminals + NT_LABELED_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 136, 0 },
+	// statement: attribute-specifier* expression-statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 137 },
+	{ NumTerminals + NT_EXPRESSION_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 137, 0 },
+	// statement: attribute-specifier* compound-statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 34 },
+	{ NumTerminals + NT_COMPOUND_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// statement: attribute-specifier* selection-statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 138 },
+	{ NumTerminals + NT_SELECTION_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 138, 0 },
+	// statement: attribute-specifier* iteration-statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 139 },
+	{ NumTerminals + NT_ITERATION_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 139, 0 },
+	// statement: attribute-specifier* jump-statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 140 },
+	{ NumTerminals + NT_JUMP_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 140, 0 },
+	// statement: declaration-statement
+	{ NumTerminals + NT_DECLARATION_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 141, 0 },
+	// statement: attribute-specifier* try-block
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 142 },
+	{ NumTerminals + NT_TRY_BLOCK, REPEAT_ONE, CONTEXT_INHERIT, false, 142, 0 },
+	// labeled-statement: attribute-specifier* TT_IDENTIFIER OP_COLON statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 24 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// labeled-statement: attribute-specifier* KW_CASE constant-expression OP_COLON statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 144 },
+	{ KW_CASE, REPEAT_ONE, CONTEXT_INHERIT, false, 144, 0 },
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// labeled-statement: attribute-specifier* KW_DEFAULT OP_COLON statement
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 145 },
+	{ KW_DEFAULT, REPEAT_ONE, CONTEXT_INHERIT, false, 145, 0 },
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// expression-statement: expression? OP_SEMICOLON
+	{ NumTerminals + NT_EXPRESSION, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 9, 146 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// compound-statement: OP_LBRACE statement* OP_RBRACE
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_STAR, CONTEXT_PLAIN, false, 143, 147 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// selection-statement: KW_IF OP_LPAREN condition OP_RPAREN statement
+	{ KW_IF, REPEAT_ONE, CONTEXT_INHERIT, false, 148, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_CONDITION, REPEAT_ONE, CONTEXT_PLAIN, false, 149, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// selection-statement: KW_IF OP_LPAREN condition OP_RPAREN statement KW_ELSE statement
+	{ KW_IF, REPEAT_ONE, CONTEXT_INHERIT, false, 148, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_CONDITION, REPEAT_ONE, CONTEXT_PLAIN, false, 149, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	{ KW_ELSE, REPEAT_ONE, CONTEXT_INHERIT, false, 150, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// selection-statement: KW_SWITCH OP_LPAREN condition OP_RPAREN statement
+	{ KW_SWITCH, REPEAT_ONE, CONTEXT_INHERIT, false, 151, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_CONDITION, REPEAT_ONE, CONTEXT_PLAIN, false, 149, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// condition-declaration: attribute-specifier* decl-specifier-seq declarator OP_ASS initializer-clause
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_INITIALIZER_CLAUSE, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	// condition-declaration: attribute-specifier* decl-specifier-seq declarator braced-init-list
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// condition: condition-declaration
+	{ NumTerminals + NT_CONDITION_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	// condition: expression
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 9, 0 },
+	// iteration-statement: KW_WHILE OP_LPAREN condition OP_RPAREN statement
+	{ KW_WHILE, REPEAT_ONE, CONTEXT_INHERIT, false, 155, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_CONDITION, REPEAT_ONE, CONTEXT_PLAIN, false, 149, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// iteration-statement: KW_DO statement KW_WHILE OP_LPAREN expression OP_RPAREN OP_SEMICOLON
+	{ KW_DO, REPEAT_ONE, CONTEXT_INHERIT, false, 156, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	{ KW_WHILE, REPEAT_ONE, CONTEXT_INHERIT, false, 155, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// iteration-statement: KW_FOR OP_LPAREN for-init-statement condition? OP_SEMICOLON expression? OP_RPAREN statement
+	{ KW_FOR, REPEAT_ONE, CONTEXT_INHERIT, false, 157, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_FOR_INIT_STATEMENT, REPEAT_ONE, CONTEXT_PLAIN, false, 158, 0 },
+	{ NumTerminals + NT_CONDITION, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 149, 146 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_PLAIN, false, 146, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 9, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// iteration-statement: KW_FOR OP_LPAREN for-range-declaration OP_COLON for-range-initializer OP_RPAREN statement
+	{ KW_FOR, REPEAT_ONE, CONTEXT_INHERIT, false, 157, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_FOR_RANGE_DECLARATION, REPEAT_ONE, CONTEXT_PLAIN, false, 154, 0 },
+	{ OP_COLON, REPEAT_ONE, CONTEXT_PLAIN, false, 121, 0 },
+	{ NumTerminals + NT_FOR_RANGE_INITIALIZER, REPEAT_ONE, CONTEXT_PLAIN, false, 57, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 143, 0 },
+	// for-init-statement: expression-statement
+	{ NumTerminals + NT_EXPRESSION_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 137, 0 },
+	// for-init-statement: simple-declaration
+	{ NumTerminals + NT_SIMPLE_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	// for-range-declaration: attribute-specifier* decl-specifier-seq declarator
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	// for-range-initializer: expression
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 9, 0 },
+	// for-range-initializer: braced-init-list
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// jump-statement: KW_BREAK OP_SEMICOLON
+	{ KW_BREAK, REPEAT_ONE, CONTEXT_INHERIT, false, 159, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// jump-statement: KW_CONTINUE OP_SEMICOLON
+	{ KW_CONTINUE, REPEAT_ONE, CONTEXT_INHERIT, false, 160, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// jump-statement: KW_RETURN expression? OP_SEMICOLON
+	{ KW_RETURN, REPEAT_ONE, CONTEXT_INHERIT, false, 161, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 9, 146 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// jump-statement: KW_RETURN braced-init-list OP_SEMICOLON
+	{ KW_RETURN, REPEAT_ONE, CONTEXT_INHERIT, false, 161, 0 },
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// jump-statement: KW_GOTO TT_IDENTIFIER OP_SEMICOLON
+	{ KW_GOTO, REPEAT_ONE, CONTEXT_INHERIT, false, 162, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// declaration-statement: block-declaration
+	{ NumTerminals + NT_BLOCK_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 141, 0 },
+	// declaration: block-declaration
+	{ NumTerminals + NT_BLOCK_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 141, 0 },
+	// declaration: function-definition
+	{ NumTerminals + NT_FUNCTION_DEFINITION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	// declaration: template-declaration
+	{ NumTerminals + NT_TEMPLATE_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	// declaration: explicit-instantiation
+	{ NumTerminals + NT_EXPLICIT_INSTANTIATION, REPEAT_ONE, CONTEXT_INHERIT, false, 163, 0 },
+	// declaration: explicit-specialization
+	{ NumTerminals + NT_EXPLICIT_SPECIALIZATION, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	// declaration: linkage-specification
+	{ NumTerminals + NT_LINKAGE_SPECIFICATION, REPEAT_ONE, CONTEXT_INHERIT, false, 164, 0 },
+	// declaration: namespace-definition
+	{ NumTerminals + NT_NAMESPACE_DEFINITION, REPEAT_ONE, CONTEXT_INHERIT, false, 165, 0 },
+	// declaration: empty-declaration
+	{ NumTerminals + NT_EMPTY_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// declaration: attribute-declaration
+	{ NumTerminals + NT_ATTRIBUTE_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 50, 0 },
+	// block-declaration: simple-declaration
+	{ NumTerminals + NT_SIMPLE_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	// block-declaration: asm-definition
+	{ NumTerminals + NT_ASM_DEFINITION, REPEAT_ONE, CONTEXT_INHERIT, false, 166, 0 },
+	// block-declaration: namespace-alias-definition
+	{ NumTerminals + NT_NAMESPACE_ALIAS_DEFINITION, REPEAT_ONE, CONTEXT_INHERIT, false, 167, 0 },
+	// block-declaration: using-declaration
+	{ NumTerminals + NT_USING_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	// block-declaration: using-directive
+	{ NumTerminals + NT_USING_DIRECTIVE, REPEAT_ONE, CONTEXT_INHERIT, false, 169, 0 },
+	// block-declaration: static_assert-declaration
+	{ NumTerminals + NT_STATIC_ASSERT_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 170, 0 },
+	// block-declaration: alias-declaration
+	{ NumTerminals + NT_ALIAS_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	// block-declaration: opaque-enum-declaration
+	{ NumTerminals + NT_OPAQUE_ENUM_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	// alias-declaration: KW_USING TT_IDENTIFIER attribute-specifier* OP_ASS type-id OP_SEMICOLON
+	{ KW_USING, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 41 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// simple-declaration: attribute-specifier* decl-specifier-seq init-declarator-list? OP_SEMICOLON
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_INIT_DECLARATOR_LIST, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 153, 146 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// static_assert-declaration: KW_STATIC_ASSERT OP_LPAREN constant-expression OP_COMMA TT_LITERAL OP_RPAREN OP_SEMICOLON
+	{ KW_STATIC_ASSERT, REPEAT_ONE, CONTEXT_INHERIT, false, 170, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 70, 0 },
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_PLAIN, false, 39, 0 },
+	{ TT_LITERAL, REPEAT_ONE, CONTEXT_PLAIN, false, 6, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// empty-declaration: OP_SEMICOLON
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// attribute-declaration: attribute-specifier+ OP_SEMICOLON
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_PLUS, CONTEXT_INHERIT, false, 50, 146 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// decl-specifier: storage-class-specifier
+	{ NumTerminals + NT_STORAGE_CLASS_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 172, 0 },
+	// decl-specifier: type-specifier
+	{ NumTerminals + NT_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// decl-specifier: function-specifier
+	{ NumTerminals + NT_FUNCTION_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 173, 0 },
+	// decl-specifier: KW_FRIEND
+	{ KW_FRIEND, REPEAT_ONE, CONTEXT_INHERIT, false, 174, 0 },
+	// decl-specifier: KW_TYPEDEF
+	{ KW_TYPEDEF, REPEAT_ONE, CONTEXT_INHERIT, false, 175, 0 },
+	// decl-specifier: KW_CONSTEXPR
+	{ KW_CONSTEXPR, REPEAT_ONE, CONTEXT_INHERIT, false, 176, 0 },
+	// decl-specifier-seq: decl-specifier+ attribute-specifier*
+	{ NumTerminals + NT_DECL_SPECIFIER, REPEAT_PLUS, CONTEXT_INHERIT, false, 152, 177 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 177 },
+	// storage-class-specifier: KW_REGISTER
+	{ KW_REGISTER, REPEAT_ONE, CONTEXT_INHERIT, false, 178, 0 },
+	// storage-class-specifier: KW_STATIC
+	{ KW_STATIC, REPEAT_ONE, CONTEXT_INHERIT, false, 179, 0 },
+	// storage-class-specifier: KW_THREAD_LOCAL
+	{ KW_THREAD_LOCAL, REPEAT_ONE, CONTEXT_INHERIT, false, 180, 0 },
+	// storage-class-specifier: KW_EXTERN
+	{ KW_EXTERN, REPEAT_ONE, CONTEXT_INHERIT, false, 164, 0 },
+	// storage-class-specifier: KW_MUTABLE
+	{ KW_MUTABLE, REPEAT_ONE, CONTEXT_INHERIT, false, 46, 0 },
+	// function-specifier: KW_INLINE
+	{ KW_INLINE, REPEAT_ONE, CONTEXT_INHERIT, false, 181, 0 },
+	// function-specifier: KW_VIRTUAL
+	{ KW_VIRTUAL, REPEAT_ONE, CONTEXT_INHERIT, false, 182, 0 },
+	// function-specifier: KW_EXPLICIT
+	{ KW_EXPLICIT, REPEAT_ONE, CONTEXT_INHERIT, false, 183, 0 },
+	// type-specifier: trailing-type-specifier
+	{ NumTerminals + NT_TRAILING_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// type-specifier: class-specifier
+	{ NumTerminals + NT_CLASS_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 184, 0 },
+	// type-specifier: enum-specifier
+	{ NumTerminals + NT_ENUM_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	// trailing-type-specifier: simple-type-specifier
+	{ NumTerminals + NT_SIMPLE_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 56, 0 },
+	// trailing-type-specifier: elaborated-type-specifier
+	{ NumTerminals + NT_ELABORATED_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 185, 0 },
+	// trailing-type-specifier: typename-specifier
+	{ NumTerminals + NT_TYPENAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 58, 0 },
+	// trailing-type-specifier: cv-qualifier
+	{ NumTerminals + NT_CV_QUALIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 186, 0 },
+	// type-specifier-seq: type-specifier+ attribute-specifier*
+	{ NumTerminals + NT_TYPE_SPECIFIER, REPEAT_PLUS, CONTEXT_INHERIT, false, 60, 187 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 187 },
+	// trailing-type-specifier-seq: trailing-type-specifier+ attribute-specifier*
+	{ NumTerminals + NT_TRAILING_TYPE_SPECIFIER, REPEAT_PLUS, CONTEXT_INHERIT, false, 60, 188 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 189 },
+	// simple-type-specifier: KW_CHAR
+	{ KW_CHAR, REPEAT_ONE, CONTEXT_INHERIT, false, 190, 0 },
+	// simple-type-specifier: KW_CHAR16_T
+	{ KW_CHAR16_T, REPEAT_ONE, CONTEXT_INHERIT, false, 191, 0 },
+	// simple-type-specifier: KW_CHAR32_T
+	{ KW_CHAR32_T, REPEAT_ONE, CONTEXT_INHERIT, false, 192, 0 },
+	// simple-type-specifier: KW_WCHAR_T
+	{ KW_WCHAR_T, REPEAT_ONE, CONTEXT_INHERIT, false, 193, 0 },
+	// simple-type-specifier: KW_BOOL
+	{ KW_BOOL, REPEAT_ONE, CONTEXT_INHERIT, false, 194, 0 },
+	// simple-type-specifier: KW_SHORT
+	{ KW_SHORT, REPEAT_ONE, CONTEXT_INHERIT, false, 195, 0 },
+	// simple-type-specifier: KW_INT
+	{ KW_INT, REPEAT_ONE, CONTEXT_INHERIT, false, 196, 0 },
+	// simple-type-specifier: KW_LONG
+	{ KW_LONG, REPEAT_ONE, CONTEXT_INHERIT, false, 197, 0 },
+	// simple-type-specifier: KW_SIGNED
+	{ KW_SIGNED, REPEAT_ONE, CONTEXT_INHERIT, false, 198, 0 },
+	// simple-type-specifier: KW_UNSIGNED
+	{ KW_UNSIGNED, REPEAT_ONE, CONTEXT_INHERIT, false, 199, 0 },
+	// simple-type-specifier: KW_FLOAT
+	{ KW_FLOAT, REPEAT_ONE, CONTEXT_INHERIT, false, 200, 0 },
+	// simple-type-specifier: KW_DOUBLE
+	{ KW_DOUBLE, REPEAT_ONE, CONTEXT_INHERIT, false, 201, 0 },
+	// simple-type-specifier: KW_VOID
+	{ KW_VOID, REPEAT_ONE, CONTEXT_INHERIT, false, 202, 0 },
+	// simple-type-specifier: KW_AUTO
+	{ KW_AUTO, REPEAT_ONE, CONTEXT_INHERIT, false, 203, 0 },
+	// simple-type-specifier: nested-name-specifier? type-name
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 33 },
+	{ NumTerminals + NT_TYPE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 33, 0 },
+	// simple-type-specifier: nested-name-specifier KW_TEMPLATE simple-template-id
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ KW_TEMPLATE, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	{ NumTerminals + NT_SIMPLE_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	// simple-type-specifier: decltype-specifier
+	{ NumTerminals + NT_DECLTYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 27, 0 },
+	// decltype-specifier: KW_DECLTYPE OP_LPAREN expression OP_RPAREN
+	{ KW_DECLTYPE, REPEAT_ONE, CONTEXT_INHERIT, false, 27, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// elaborated-type-specifier: class-key attribute-specifier* nested-name-specifier? TT_IDENTIFIER
+	{ NumTerminals + NT_CLASS_KEY, REPEAT_ONE, CONTEXT_INHERIT, false, 184, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 204 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 24 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// elaborated-type-specifier: class-key nested-name-specifier? KW_TEMPLATE? simple-template-id
+	{ NumTerminals + NT_CLASS_KEY, REPEAT_ONE, CONTEXT_INHERIT, false, 184, 0 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 205 },
+	{ KW_TEMPLATE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 29, 16 },
+	{ NumTerminals + NT_SIMPLE_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	// elaborated-type-specifier: KW_ENUM nested-name-specifier? TT_IDENTIFIER
+	{ KW_ENUM, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 24 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// enum-specifier: enum-head OP_LBRACE enumerator-list? OP_RBRACE
+	{ NumTerminals + NT_ENUM_HEAD, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_ENUMERATOR_LIST, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 24, 147 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// enum-specifier: enum-head OP_LBRACE enumerator-list OP_COMMA OP_RBRACE
+	{ NumTerminals + NT_ENUM_HEAD, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_ENUMERATOR_LIST, REPEAT_ONE, CONTEXT_PLAIN, false, 24, 0 },
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_PLAIN, false, 39, 0 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// enum-head: enum-key attribute-specifier* TT_IDENTIFIER? enum-base?
+	{ NumTerminals + NT_ENUM_KEY, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 206 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 207 },
+	{ NumTerminals + NT_ENUM_BASE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 121, 34 },
+	// enum-head: enum-key attribute-specifier* nested-name-specifier TT_IDENTIFIER enum-base?
+	{ NumTerminals + NT_ENUM_KEY, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 23 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ NumTerminals + NT_ENUM_BASE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 121, 34 },
+	// opaque-enum-declaration: enum-key attribute-specifier* TT_IDENTIFIER enum-base? OP_SEMICOLON
+	{ NumTerminals + NT_ENUM_KEY, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 24 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ NumTerminals + NT_ENUM_BASE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 121, 146 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// enum-key: KW_ENUM
+	{ KW_ENUM, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	// enum-key: KW_ENUM KW_CLASS
+	{ KW_ENUM, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ KW_CLASS, REPEAT_ONE, CONTEXT_INHERIT, false, 208, 0 },
+	// enum-key: KW_ENUM KW_STRUCT
+	{ KW_ENUM, REPEAT_ONE, CONTEXT_INHERIT, false, 171, 0 },
+	{ KW_STRUCT, REPEAT_ONE, CONTEXT_INHERIT, false, 209, 0 },
+	// enum-base: OP_COLON type-specifier-seq
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_TYPE_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// enumerator-list.1: OP_COMMA enumerator-definition
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_ENUMERATOR_DEFINITION, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// enumerator-list: enumerator-definition (OP_COMMA enumerator-definition)*
+	{ NumTerminals + NT_ENUMERATOR_DEFINITION, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ NumTerminals + NT_ENUMERATOR_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 210 },
+	// enumerator-definition: enumerator
+	{ NumTerminals + NT_ENUMERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// enumerator-definition: enumerator OP_ASS constant-expression
+	{ NumTerminals + NT_ENUMERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// enumerator: TT_IDENTIFIER
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// namespace-definition: KW_INLINE? KW_NAMESPACE TT_IDENTIFIER? OP_LBRACE namespace-body OP_RBRACE
+	{ KW_INLINE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 181, 167 },
+	{ KW_NAMESPACE, REPEAT_ONE, CONTEXT_INHERIT, false, 167, 0 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 34 },
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_NAMESPACE_BODY, REPEAT_ONE, CONTEXT_PLAIN, false, 2, 0 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// namespace-body: declaration*
+	{ NumTerminals + NT_DECLARATION, REPEAT_STAR, CONTEXT_INHERIT, false, 2, 147 },
+	// namespace-alias-definition: KW_NAMESPACE TT_IDENTIFIER OP_ASS qualified-namespace-specifier OP_SEMICOLON
+	{ KW_NAMESPACE, REPEAT_ONE, CONTEXT_INHERIT, false, 167, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_QUALIFIED_NAMESPACE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// qualified-namespace-specifier: nested-name-specifier? namespace-name
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 18 },
+	{ NumTerminals + NT_NAMESPACE_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 18, 0 },
+	// using-declaration: KW_USING KW_TYPENAME? nested-name-specifier unqualified-id OP_SEMICOLON
+	{ KW_USING, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	{ KW_TYPENAME, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 58, 23 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ NumTerminals + NT_UNQUALIFIED_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 22, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// using-declaration: KW_USING OP_COLON2 unqualified-id OP_SEMICOLON
+	{ KW_USING, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	{ NumTerminals + NT_UNQUALIFIED_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 22, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// using-directive: attribute-specifier* KW_USING KW_NAMESPACE nested-name-specifier? TT_IDENTIFIER OP_SEMICOLON
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 168 },
+	{ KW_USING, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	{ KW_NAMESPACE, REPEAT_ONE, CONTEXT_INHERIT, false, 167, 0 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 24 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// asm-definition: KW_ASM OP_LPAREN TT_LITERAL OP_RPAREN OP_SEMICOLON
+	{ KW_ASM, REPEAT_ONE, CONTEXT_INHERIT, false, 166, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ TT_LITERAL, REPEAT_ONE, CONTEXT_PLAIN, false, 6, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// linkage-specification: KW_EXTERN TT_LITERAL OP_LBRACE declaration* OP_RBRACE
+	{ KW_EXTERN, REPEAT_ONE, CONTEXT_INHERIT, false, 164, 0 },
+	{ TT_LITERAL, REPEAT_ONE, CONTEXT_INHERIT, false, 6, 0 },
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_DECLARATION, REPEAT_STAR, CONTEXT_PLAIN, false, 2, 147 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// linkage-specification: KW_EXTERN TT_LITERAL declaration
+	{ KW_EXTERN, REPEAT_ONE, CONTEXT_INHERIT, false, 164, 0 },
+	{ TT_LITERAL, REPEAT_ONE, CONTEXT_INHERIT, false, 6, 0 },
+	{ NumTerminals + NT_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 2, 0 },
+	// attribute-specifier: OP_LSQUARE OP_LSQUARE attribute-list OP_RSQUARE OP_RSQUARE
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_PLAIN, false, 12, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_LIST, REPEAT_ONE, CONTEXT_PLAIN, false, 211, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_PLAIN, false, 35, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// attribute-specifier: alignment-specifier
+	{ NumTerminals + NT_ALIGNMENT_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 212, 0 },
+	// alignment-specifier: KW_ALIGNAS OP_LPAREN type-id OP_DOTS? OP_RPAREN
+	{ KW_ALIGNAS, REPEAT_ONE, CONTEXT_INHERIT, false, 212, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_PLAIN, false, 60, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 43, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// alignment-specifier: KW_ALIGNAS OP_LPAREN assignment-expression OP_DOTS? OP_RPAREN
+	{ KW_ALIGNAS, REPEAT_ONE, CONTEXT_INHERIT, false, 212, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_ASSIGNMENT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 9, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 43, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// attribute-list.1: OP_COMMA attribute-part
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_PART, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// attribute-list: attribute-part (OP_COMMA attribute-part)*
+	{ NumTerminals + NT_ATTRIBUTE_PART, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 35 },
+	// attribute-part: attribute?
+	{ NumTerminals + NT_ATTRIBUTE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 42 },
+	// attribute-part: attribute OP_DOTS
+	{ NumTerminals + NT_ATTRIBUTE, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 43, 0 },
+	// attribute: attribute-token attribute-argument-clause?
+	{ NumTerminals + NT_ATTRIBUTE_TOKEN, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_ARGUMENT_CLAUSE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 8, 213 },
+	// attribute-token: TT_IDENTIFIER
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// attribute-token: attribute-scoped-token
+	{ NumTerminals + NT_ATTRIBUTE_SCOPED_TOKEN, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// attribute-scoped-token: attribute-namespace OP_COLON2 TT_IDENTIFIER
+	{ NumTerminals + NT_ATTRIBUTE_NAMESPACE, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	{ OP_COLON2, REPEAT_ONE, CONTEXT_INHERIT, false, 32, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// attribute-namespace: TT_IDENTIFIER
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// attribute-argument-clause: OP_LPAREN balanced-token* OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_BALANCED_TOKEN, REPEAT_STAR, CONTEXT_PLAIN, false, 214, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// balanced-token: OP_LPAREN balanced-token* OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_BALANCED_TOKEN, REPEAT_STAR, CONTEXT_PLAIN, false, 214, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// balanced-token: OP_LSQUARE balanced-token* OP_RSQUARE
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_BALANCED_TOKEN, REPEAT_STAR, CONTEXT_PLAIN, false, 214, 35 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// balanced-token: OP_LBRACE balanced-token* OP_RBRACE
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_BALANCED_TOKEN, REPEAT_STAR, CONTEXT_PLAIN, false, 214, 147 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// balanced-token: ST_NONPAREN
+	{ ST_NONPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 215, 0 },
+	// init-declarator-list.1: OP_COMMA init-declarator
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_INIT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	// init-declarator-list: init-declarator (OP_COMMA init-declarator)*
+	{ NumTerminals + NT_INIT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ NumTerminals + NT_INIT_DECLARATOR_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 146 },
+	// init-declarator: declarator initializer?
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ NumTerminals + NT_INITIALIZER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 217, 216 },
+	// declarator: ptr-declarator
+	{ NumTerminals + NT_PTR_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	// declarator: noptr-declarator trailing-return-type
+	{ NumTerminals + NT_NOPTR_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 218, 0 },
+	{ NumTerminals + NT_TRAILING_RETURN_TYPE, REPEAT_ONE, CONTEXT_INHERIT, false, 51, 0 },
+	// ptr-declarator: ptr-operator* noptr-declarator
+	{ NumTerminals + NT_PTR_OPERATOR, REPEAT_STAR, CONTEXT_INHERIT, false, 84, 218 },
+	{ NumTerminals + NT_NOPTR_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 218, 0 },
+	// noptr-declarator.1: noptr-declarator-suffix
+	{ NumTerminals + NT_NOPTR_DECLARATOR_SUFFIX, REPEAT_ONE, CONTEXT_INHERIT, false, 219, 0 },
+	// noptr-declarator: noptr-declarator-root (noptr-declarator-suffix)*
+	{ NumTerminals + NT_NOPTR_DECLARATOR_ROOT, REPEAT_ONE, CONTEXT_INHERIT, false, 218, 0 },
+	{ NumTerminals + NT_NOPTR_DECLARATOR_1, REPEAT_STAR, CONTEXT_INHERIT, false, 219, 220 },
+	// noptr-declarator-root: declarator-id attribute-specifier*
+	{ NumTerminals + NT_DECLARATOR_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 221, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 222 },
+	// noptr-declarator-root: OP_LPAREN ptr-declarator OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_PTR_DECLARATOR, REPEAT_ONE, CONTEXT_PLAIN, false, 153, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// noptr-declarator-suffix: parameters-and-qualifiers
+	{ NumTerminals + NT_PARAMETERS_AND_QUALIFIERS, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	// noptr-declarator-suffix: OP_LSQUARE constant-expression? OP_RSQUARE attribute-specifier*
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 70, 35 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 222 },
+	// parameters-and-qualifiers: OP_LPAREN parameter-declaration-clause OP_RPAREN cv-qualifier* ref-qualifier? exception-specification? attribute-specifier*
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_PARAMETER_DECLARATION_CLAUSE, REPEAT_ONE, CONTEXT_PLAIN, false, 44, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_CV_QUALIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 186, 223 },
+	{ NumTerminals + NT_REF_QUALIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 225, 224 },
+	{ NumTerminals + NT_EXCEPTION_SPECIFICATION, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 48, 226 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 222 },
+	// trailing-return-type: OP_ARROW trailing-type-specifier-seq abstract-declarator?
+	{ OP_ARROW, REPEAT_ONE, CONTEXT_INHERIT, false, 51, 0 },
+	{ NumTerminals + NT_TRAILING_TYPE_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ NumTerminals + NT_ABSTRACT_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 228, 227 },
+	// ptr-operator: OP_STAR attribute-specifier* cv-qualifier*
+	{ OP_STAR, REPEAT_ONE, CONTEXT_INHERIT, false, 76, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 229 },
+	{ NumTerminals + NT_CV_QUALIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 186, 230 },
+	// ptr-operator: OP_AMP attribute-specifier*
+	{ OP_AMP, REPEAT_ONE, CONTEXT_INHERIT, false, 40, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 230 },
+	// ptr-operator: OP_LAND attribute-specifier*
+	{ OP_LAND, REPEAT_ONE, CONTEXT_INHERIT, false, 116, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 230 },
+	// ptr-operator: nested-name-specifier OP_STAR attribute-specifier* cv-qualifier*
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ OP_STAR, REPEAT_ONE, CONTEXT_INHERIT, false, 76, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 229 },
+	{ NumTerminals + NT_CV_QUALIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 186, 230 },
+	// cv-qualifier: KW_CONST
+	{ KW_CONST, REPEAT_ONE, CONTEXT_INHERIT, false, 231, 0 },
+	// cv-qualifier: KW_VOLATILE
+	{ KW_VOLATILE, REPEAT_ONE, CONTEXT_INHERIT, false, 232, 0 },
+	// ref-qualifier: OP_AMP
+	{ OP_AMP, REPEAT_ONE, CONTEXT_INHERIT, false, 40, 0 },
+	// ref-qualifier: OP_LAND
+	{ OP_LAND, REPEAT_ONE, CONTEXT_INHERIT, false, 116, 0 },
+	// declarator-id: OP_DOTS? id-expression
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 11 },
+	{ NumTerminals + NT_ID_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 11, 0 },
+	// type-id: type-specifier-seq abstract-declarator?
+	{ NumTerminals + NT_TYPE_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ NumTerminals + NT_ABSTRACT_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 228, 233 },
+	// abstract-declarator: ptr-abstract-declarator
+	{ NumTerminals + NT_PTR_ABSTRACT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 234, 0 },
+	// abstract-declarator: noptr-abstract-declarator? trailing-return-type
+	{ NumTerminals + NT_NOPTR_ABSTRACT_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 219, 51 },
+	{ NumTerminals + NT_TRAILING_RETURN_TYPE, REPEAT_ONE, CONTEXT_INHERIT, false, 51, 0 },
+	// abstract-declarator: abstract-pack-declarator
+	{ NumTerminals + NT_ABSTRACT_PACK_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 235, 0 },
+	// ptr-abstract-declarator: ptr-operator* noptr-abstract-declarator
+	{ NumTerminals + NT_PTR_OPERATOR, REPEAT_STAR, CONTEXT_INHERIT, false, 84, 219 },
+	{ NumTerminals + NT_NOPTR_ABSTRACT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 219, 0 },
+	// ptr-abstract-declarator: ptr-operator+
+	{ NumTerminals + NT_PTR_OPERATOR, REPEAT_PLUS, CONTEXT_INHERIT, false, 84, 227 },
+	// noptr-abstract-declarator: noptr-abstract-declarator-root noptr-declarator-suffix*
+	{ NumTerminals + NT_NOPTR_ABSTRACT_DECLARATOR_ROOT, REPEAT_ONE, CONTEXT_INHERIT, false, 219, 0 },
+	{ NumTerminals + NT_NOPTR_DECLARATOR_SUFFIX, REPEAT_STAR, CONTEXT_INHERIT, false, 219, 220 },
+	// noptr-abstract-declarator: noptr-declarator-suffix+
+	{ NumTerminals + NT_NOPTR_DECLARATOR_SUFFIX, REPEAT_PLUS, CONTEXT_INHERIT, false, 219, 220 },
+	// noptr-abstract-declarator-root: noptr-declarator-suffix
+	{ NumTerminals + NT_NOPTR_DECLARATOR_SUFFIX, REPEAT_ONE, CONTEXT_INHERIT, false, 219, 0 },
+	// noptr-abstract-declarator-root: OP_LPAREN ptr-abstract-declarator OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_PTR_ABSTRACT_DECLARATOR, REPEAT_ONE, CONTEXT_PLAIN, false, 234, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// abstract-pack-declarator: ptr-operator* noptr-abstract-pack-declarator
+	{ NumTerminals + NT_PTR_OPERATOR, REPEAT_STAR, CONTEXT_INHERIT, false, 84, 43 },
+	{ NumTerminals + NT_NOPTR_ABSTRACT_PACK_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 43, 0 },
+	// noptr-abstract-pack-declarator: OP_DOTS noptr-declarator-suffix*
+	{ OP_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 43, 0 },
+	{ NumTerminals + NT_NOPTR_DECLARATOR_SUFFIX, REPEAT_STAR, CONTEXT_INHERIT, false, 219, 227 },
+	// parameter-declaration-clause: parameter-declaration-list? OP_DOTS?
+	{ NumTerminals + NT_PARAMETER_DECLARATION_LIST, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 154, 236 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 10 },
+	// parameter-declaration-clause: parameter-declaration-list OP_COMMA OP_DOTS
+	{ NumTerminals + NT_PARAMETER_DECLARATION_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ OP_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 43, 0 },
+	// parameter-declaration-list.1: OP_COMMA parameter-declaration
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_PARAMETER_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	// parameter-declaration-list: parameter-declaration (OP_COMMA parameter-declaration)*
+	{ NumTerminals + NT_PARAMETER_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	{ NumTerminals + NT_PARAMETER_DECLARATION_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 237 },
+	// parameter-declaration: attribute-specifier* decl-specifier-seq declarator
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	// parameter-declaration: attribute-specifier* decl-specifier-seq declarator OP_ASS initializer-clause
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_INITIALIZER_CLAUSE, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	// parameter-declaration: attribute-specifier* decl-specifier-seq abstract-declarator?
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_ABSTRACT_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 228, 238 },
+	// parameter-declaration: attribute-specifier* decl-specifier-seq abstract-declarator? OP_ASS initializer-clause
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_ABSTRACT_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 228, 41 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_INITIALIZER_CLAUSE, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	// function-definition: attribute-specifier* decl-specifier-seq declarator virt-specifier* function-body
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ NumTerminals + NT_VIRT_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 240, 239 },
+	{ NumTerminals + NT_FUNCTION_BODY, REPEAT_ONE, CONTEXT_INHERIT, false, 239, 0 },
+	// function-body: ctor-initializer? compound-statement
+	{ NumTerminals + NT_CTOR_INITIALIZER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 121, 34 },
+	{ NumTerminals + NT_COMPOUND_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// function-body: function-try-block
+	{ NumTerminals + NT_FUNCTION_TRY_BLOCK, REPEAT_ONE, CONTEXT_INHERIT, false, 142, 0 },
+	// function-body: OP_ASS KW_DEFAULT OP_SEMICOLON
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ KW_DEFAULT, REPEAT_ONE, CONTEXT_INHERIT, false, 145, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// function-body: OP_ASS KW_DELETE OP_SEMICOLON
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ KW_DELETE, REPEAT_ONE, CONTEXT_INHERIT, false, 86, 0 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// initializer: brace-or-equal-initializer
+	{ NumTerminals + NT_BRACE_OR_EQUAL_INITIALIZER, REPEAT_ONE, CONTEXT_INHERIT, false, 241, 0 },
+	// initializer: OP_LPAREN expression-list OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION_LIST, REPEAT_ONE, CONTEXT_PLAIN, false, 57, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// brace-or-equal-initializer: OP_ASS initializer-clause
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_INITIALIZER_CLAUSE, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	// brace-or-equal-initializer: braced-init-list
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// initializer-clause: assignment-expression
+	{ NumTerminals + NT_ASSIGNMENT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 9, 0 },
+	// initializer-clause: braced-init-list
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// initializer-list.1: OP_COMMA initializer-clause-dots
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_INITIALIZER_CLAUSE_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	// initializer-list: initializer-clause-dots (OP_COMMA initializer-clause-dots)*
+	{ NumTerminals + NT_INITIALIZER_CLAUSE_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	{ NumTerminals + NT_INITIALIZER_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 242 },
+	// initializer-clause-dots: initializer-clause OP_DOTS?
+	{ NumTerminals + NT_INITIALIZER_CLAUSE, REPEAT_ONE, CONTEXT_INHERIT, false, 57, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 242 },
+	// braced-init-list: OP_LBRACE initializer-list OP_COMMA? OP_RBRACE
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_INITIALIZER_LIST, REPEAT_ONE, CONTEXT_PLAIN, false, 57, 0 },
+	{ OP_COMMA, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 39, 147 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// braced-init-list: OP_LBRACE OP_RBRACE
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// class-specifier: class-head OP_LBRACE member-specification* OP_RBRACE
+	{ NumTerminals + NT_CLASS_HEAD, REPEAT_ONE, CONTEXT_INHERIT, false, 184, 0 },
+	{ OP_LBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_MEMBER_SPECIFICATION, REPEAT_STAR, CONTEXT_PLAIN, false, 243, 147 },
+	{ OP_RBRACE, REPEAT_ONE, CONTEXT_INHERIT, false, 147, 0 },
+	// class-head: class-key attribute-specifier* class-head-name class-virt-specifier? base-clause?
+	{ NumTerminals + NT_CLASS_KEY, REPEAT_ONE, CONTEXT_INHERIT, false, 184, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 23 },
+	{ NumTerminals + NT_CLASS_HEAD_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ NumTerminals + NT_CLASS_VIRT_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 244, 207 },
+	{ NumTerminals + NT_BASE_CLAUSE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 121, 34 },
+	// class-head: class-key attribute-specifier* base-clause?
+	{ NumTerminals + NT_CLASS_KEY, REPEAT_ONE, CONTEXT_INHERIT, false, 184, 0 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 207 },
+	{ NumTerminals + NT_BASE_CLAUSE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 121, 34 },
+	// class-head-name: nested-name-specifier? class-name
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 13 },
+	{ NumTerminals + NT_CLASS_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 13, 0 },
+	// class-virt-specifier: ST_FINAL
+	{ ST_FINAL, REPEAT_ONE, CONTEXT_INHERIT, false, 244, 0 },
+	// class-key: KW_CLASS
+	{ KW_CLASS, REPEAT_ONE, CONTEXT_INHERIT, false, 208, 0 },
+	// class-key: KW_STRUCT
+	{ KW_STRUCT, REPEAT_ONE, CONTEXT_INHERIT, false, 209, 0 },
+	// class-key: KW_UNION
+	{ KW_UNION, REPEAT_ONE, CONTEXT_INHERIT, false, 245, 0 },
+	// member-specification: member-declaration
+	{ NumTerminals + NT_MEMBER_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 246, 0 },
+	// member-specification: access-specifier OP_COLON
+	{ NumTerminals + NT_ACCESS_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 247, 0 },
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	// member-declaration: attribute-specifier* decl-specifier-seq member-declarator-list? OP_SEMICOLON
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 152 },
+	{ NumTerminals + NT_DECL_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 152, 0 },
+	{ NumTerminals + NT_MEMBER_DECLARATOR_LIST, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 248, 146 },
+	{ OP_SEMICOLON, REPEAT_ONE, CONTEXT_INHERIT, false, 146, 0 },
+	// member-declaration: function-definition OP_SEMICOLON?
+	{ NumTerminals + NT_FUNCTION_DEFINITION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	{ OP_SEMICOLON, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 146, 249 },
+	// member-declaration: using-declaration
+	{ NumTerminals + NT_USING_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	// member-declaration: static_assert-declaration
+	{ NumTerminals + NT_STATIC_ASSERT_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 170, 0 },
+	// member-declaration: template-declaration
+	{ NumTerminals + NT_TEMPLATE_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	// member-declaration: alias-declaration
+	{ NumTerminals + NT_ALIAS_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 168, 0 },
+	// member-declarator-list.1: OP_COMMA member-declarator
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_MEMBER_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 248, 0 },
+	// member-declarator-list: member-declarator (OP_COMMA member-declarator)*
+	{ NumTerminals + NT_MEMBER_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 248, 0 },
+	{ NumTerminals + NT_MEMBER_DECLARATOR_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 146 },
+	// member-declarator: declarator virt-specifier* pure-specifier?
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ NumTerminals + NT_VIRT_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 240, 250 },
+	{ NumTerminals + NT_PURE_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 41, 216 },
+	// member-declarator: declarator brace-or-equal-initializer?
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	{ NumTerminals + NT_BRACE_OR_EQUAL_INITIALIZER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 241, 216 },
+	// member-declarator: TT_IDENTIFIER? attribute-specifier* OP_COLON constant-expression
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 251 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 121 },
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// virt-specifier: ST_OVERRIDE
+	{ ST_OVERRIDE, REPEAT_ONE, CONTEXT_INHERIT, false, 252, 0 },
+	// virt-specifier: ST_FINAL
+	{ ST_FINAL, REPEAT_ONE, CONTEXT_INHERIT, false, 244, 0 },
+	// pure-specifier: OP_ASS ST_ZERO
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ ST_ZERO, REPEAT_ONE, CONTEXT_INHERIT, false, 253, 0 },
+	// base-clause: OP_COLON base-specifier-list
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_BASE_SPECIFIER_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 254, 0 },
+	// base-specifier-list.1: OP_COMMA base-specifier-dots
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_BASE_SPECIFIER_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 254, 0 },
+	// base-specifier-list: base-specifier-dots (OP_COMMA base-specifier-dots)*
+	{ NumTerminals + NT_BASE_SPECIFIER_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 254, 0 },
+	{ NumTerminals + NT_BASE_SPECIFIER_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 34 },
+	// base-specifier-dots: base-specifier OP_DOTS?
+	{ NumTerminals + NT_BASE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 254, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 255 },
+	// base-specifier: attribute-specifier* base-type-specifier
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 23 },
+	{ NumTerminals + NT_BASE_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	// base-specifier: attribute-specifier* KW_VIRTUAL access-specifier? base-type-specifier
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 182 },
+	{ KW_VIRTUAL, REPEAT_ONE, CONTEXT_INHERIT, false, 182, 0 },
+	{ NumTerminals + NT_ACCESS_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 247, 23 },
+	{ NumTerminals + NT_BASE_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	// base-specifier: attribute-specifier* access-specifier KW_VIRTUAL? base-type-specifier
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 247 },
+	{ NumTerminals + NT_ACCESS_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 247, 0 },
+	{ KW_VIRTUAL, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 182, 23 },
+	{ NumTerminals + NT_BASE_TYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	// class-or-decltype: nested-name-specifier? class-name
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 23, 13 },
+	{ NumTerminals + NT_CLASS_NAME, REPEAT_ONE, CONTEXT_INHERIT, false, 13, 0 },
+	// class-or-decltype: decltype-specifier
+	{ NumTerminals + NT_DECLTYPE_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 27, 0 },
+	// base-type-specifier: class-or-decltype
+	{ NumTerminals + NT_CLASS_OR_DECLTYPE, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	// access-specifier: KW_PRIVATE
+	{ KW_PRIVATE, REPEAT_ONE, CONTEXT_INHERIT, false, 256, 0 },
+	// access-specifier: KW_PROTECTED
+	{ KW_PROTECTED, REPEAT_ONE, CONTEXT_INHERIT, false, 257, 0 },
+	// access-specifier: KW_PUBLIC
+	{ KW_PUBLIC, REPEAT_ONE, CONTEXT_INHERIT, false, 258, 0 },
+	// conversion-function-id: KW_OPERATOR conversion-type-id
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ NumTerminals + NT_CONVERSION_TYPE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// conversion-type-id: type-specifier-seq ptr-operator*
+	{ NumTerminals + NT_TYPE_SPECIFIER_SEQ, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ NumTerminals + NT_PTR_OPERATOR, REPEAT_STAR, CONTEXT_INHERIT, false, 84, 259 },
+	// ctor-initializer: OP_COLON mem-initializer-list
+	{ OP_COLON, REPEAT_ONE, CONTEXT_INHERIT, false, 121, 0 },
+	{ NumTerminals + NT_MEM_INITIALIZER_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 204, 0 },
+	// mem-initializer-list.1: OP_COMMA mem-initializer-dots
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_MEM_INITIALIZER_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 204, 0 },
+	// mem-initializer-list: mem-initializer-dots (OP_COMMA mem-initializer-dots)*
+	{ NumTerminals + NT_MEM_INITIALIZER_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 204, 0 },
+	{ NumTerminals + NT_MEM_INITIALIZER_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 34 },
+	// mem-initializer-dots: mem-initializer OP_DOTS?
+	{ NumTerminals + NT_MEM_INITIALIZER, REPEAT_ONE, CONTEXT_INHERIT, false, 204, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 255 },
+	// mem-initializer: mem-initializer-id OP_LPAREN expression-list? OP_RPAREN
+	{ NumTerminals + NT_MEM_INITIALIZER_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 204, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXPRESSION_LIST, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 57, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// mem-initializer: mem-initializer-id braced-init-list
+	{ NumTerminals + NT_MEM_INITIALIZER_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 204, 0 },
+	{ NumTerminals + NT_BRACED_INIT_LIST, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// mem-initializer-id: class-or-decltype
+	{ NumTerminals + NT_CLASS_OR_DECLTYPE, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	// mem-initializer-id: TT_IDENTIFIER
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// operator-function-id: KW_OPERATOR KW_NEW
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ KW_NEW, REPEAT_ONE, CONTEXT_INHERIT, false, 80, 0 },
+	// operator-function-id: KW_OPERATOR KW_NEW OP_LSQUARE OP_RSQUARE
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ KW_NEW, REPEAT_ONE, CONTEXT_INHERIT, false, 80, 0 },
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// operator-function-id: KW_OPERATOR KW_DELETE
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ KW_DELETE, REPEAT_ONE, CONTEXT_INHERIT, false, 86, 0 },
+	// operator-function-id: KW_OPERATOR KW_DELETE OP_LSQUARE OP_RSQUARE
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ KW_DELETE, REPEAT_ONE, CONTEXT_INHERIT, false, 86, 0 },
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// operator-function-id: KW_OPERATOR OP_PLUS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_PLUS, REPEAT_ONE, CONTEXT_INHERIT, false, 77, 0 },
+	// operator-function-id: KW_OPERATOR OP_MINUS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_MINUS, REPEAT_ONE, CONTEXT_INHERIT, false, 78, 0 },
+	// operator-function-id: KW_OPERATOR OP_STAR
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_STAR, REPEAT_ONE, CONTEXT_INHERIT, false, 76, 0 },
+	// operator-function-id: KW_OPERATOR OP_DIV
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_DIV, REPEAT_ONE, CONTEXT_INHERIT, false, 93, 0 },
+	// operator-function-id: KW_OPERATOR OP_MOD
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_MOD, REPEAT_ONE, CONTEXT_INHERIT, false, 94, 0 },
+	// operator-function-id: KW_OPERATOR OP_XOR
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_XOR, REPEAT_ONE, CONTEXT_INHERIT, false, 112, 0 },
+	// operator-function-id: KW_OPERATOR OP_AMP
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_AMP, REPEAT_ONE, CONTEXT_INHERIT, false, 40, 0 },
+	// operator-function-id: KW_OPERATOR OP_BOR
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_BOR, REPEAT_ONE, CONTEXT_INHERIT, false, 114, 0 },
+	// operator-function-id: KW_OPERATOR OP_COMPL
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_COMPL, REPEAT_ONE, CONTEXT_INHERIT, false, 26, 0 },
+	// operator-function-id: KW_OPERATOR OP_LNOT
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LNOT, REPEAT_ONE, CONTEXT_INHERIT, false, 79, 0 },
+	// operator-function-id: KW_OPERATOR OP_ASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	// operator-function-id: KW_OPERATOR OP_LT
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	// operator-function-id: KW_OPERATOR OP_GT
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_GT, REPEAT_ONE, CONTEXT_INHERIT, true, 104, 0 },
+	// operator-function-id: KW_OPERATOR OP_PLUSASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_PLUSASS, REPEAT_ONE, CONTEXT_INHERIT, false, 128, 0 },
+	// operator-function-id: KW_OPERATOR OP_MINUSASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_MINUSASS, REPEAT_ONE, CONTEXT_INHERIT, false, 129, 0 },
+	// operator-function-id: KW_OPERATOR OP_STARASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_STARASS, REPEAT_ONE, CONTEXT_INHERIT, false, 125, 0 },
+	// operator-function-id: KW_OPERATOR OP_DIVASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_DIVASS, REPEAT_ONE, CONTEXT_INHERIT, false, 126, 0 },
+	// operator-function-id: KW_OPERATOR OP_MODASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_MODASS, REPEAT_ONE, CONTEXT_INHERIT, false, 127, 0 },
+	// operator-function-id: KW_OPERATOR OP_XORASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_XORASS, REPEAT_ONE, CONTEXT_INHERIT, false, 133, 0 },
+	// operator-function-id: KW_OPERATOR OP_BANDASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_BANDASS, REPEAT_ONE, CONTEXT_INHERIT, false, 132, 0 },
+	// operator-function-id: KW_OPERATOR OP_BORASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_BORASS, REPEAT_ONE, CONTEXT_INHERIT, false, 134, 0 },
+	// operator-function-id: KW_OPERATOR OP_LSHIFT
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LSHIFT, REPEAT_ONE, CONTEXT_INHERIT, false, 99, 0 },
+	// operator-function-id: KW_OPERATOR ST_RSHIFT_1 ST_RSHIFT_2
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ ST_RSHIFT_1, REPEAT_ONE, CONTEXT_INHERIT, true, 100, 0 },
+	{ ST_RSHIFT_2, REPEAT_ONE, CONTEXT_INHERIT, false, 101, 0 },
+	// operator-function-id: KW_OPERATOR OP_RSHIFTASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_RSHIFTASS, REPEAT_ONE, CONTEXT_INHERIT, false, 130, 0 },
+	// operator-function-id: KW_OPERATOR OP_LSHIFTASS
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LSHIFTASS, REPEAT_ONE, CONTEXT_INHERIT, false, 131, 0 },
+	// operator-function-id: KW_OPERATOR OP_EQ
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_EQ, REPEAT_ONE, CONTEXT_INHERIT, false, 109, 0 },
+	// operator-function-id: KW_OPERATOR OP_NE
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_NE, REPEAT_ONE, CONTEXT_INHERIT, false, 110, 0 },
+	// operator-function-id: KW_OPERATOR OP_LE
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LE, REPEAT_ONE, CONTEXT_INHERIT, false, 105, 0 },
+	// operator-function-id: KW_OPERATOR OP_GE
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_GE, REPEAT_ONE, CONTEXT_INHERIT, false, 106, 0 },
+	// operator-function-id: KW_OPERATOR OP_LAND
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LAND, REPEAT_ONE, CONTEXT_INHERIT, false, 116, 0 },
+	// operator-function-id: KW_OPERATOR OP_LOR
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LOR, REPEAT_ONE, CONTEXT_INHERIT, false, 118, 0 },
+	// operator-function-id: KW_OPERATOR OP_INC
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_INC, REPEAT_ONE, CONTEXT_INHERIT, false, 67, 0 },
+	// operator-function-id: KW_OPERATOR OP_DEC
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_DEC, REPEAT_ONE, CONTEXT_INHERIT, false, 68, 0 },
+	// operator-function-id: KW_OPERATOR OP_COMMA
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	// operator-function-id: KW_OPERATOR OP_ARROWSTAR
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_ARROWSTAR, REPEAT_ONE, CONTEXT_INHERIT, false, 90, 0 },
+	// operator-function-id: KW_OPERATOR OP_ARROW
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_ARROW, REPEAT_ONE, CONTEXT_INHERIT, false, 51, 0 },
+	// operator-function-id: KW_OPERATOR OP_LPAREN OP_RPAREN
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// operator-function-id: KW_OPERATOR OP_LSQUARE OP_RSQUARE
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 12, 0 },
+	{ OP_RSQUARE, REPEAT_ONE, CONTEXT_INHERIT, false, 35, 0 },
+	// literal-operator-id: KW_OPERATOR ST_EMPTYSTR TT_IDENTIFIER
+	{ KW_OPERATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ ST_EMPTYSTR, REPEAT_ONE, CONTEXT_INHERIT, false, 260, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// template-declaration: KW_TEMPLATE OP_LT template-parameter-list close-angle-bracket declaration
+	{ KW_TEMPLATE, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TEMPLATE_PARAMETER_LIST, REPEAT_ONE, CONTEXT_ANGLE, false, 261, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ NumTerminals + NT_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 2, 0 },
+	// template-parameter-list.1: OP_COMMA template-parameter
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_TEMPLATE_PARAMETER, REPEAT_ONE, CONTEXT_INHERIT, false, 261, 0 },
+	// template-parameter-list: template-parameter (OP_COMMA template-parameter)*
+	{ NumTerminals + NT_TEMPLATE_PARAMETER, REPEAT_ONE, CONTEXT_INHERIT, false, 261, 0 },
+	{ NumTerminals + NT_TEMPLATE_PARAMETER_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 20 },
+	// template-parameter: type-parameter
+	{ NumTerminals + NT_TYPE_PARAMETER, REPEAT_ONE, CONTEXT_INHERIT, false, 262, 0 },
+	// template-parameter: parameter-declaration
+	{ NumTerminals + NT_PARAMETER_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 154, 0 },
+	// type-parameter: KW_CLASS OP_DOTS? TT_IDENTIFIER?
+	{ KW_CLASS, REPEAT_ONE, CONTEXT_INHERIT, false, 208, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 263 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 264 },
+	// type-parameter: KW_CLASS TT_IDENTIFIER? OP_ASS type-id
+	{ KW_CLASS, REPEAT_ONE, CONTEXT_INHERIT, false, 208, 0 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 41 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// type-parameter: KW_TYPENAME OP_DOTS? TT_IDENTIFIER?
+	{ KW_TYPENAME, REPEAT_ONE, CONTEXT_INHERIT, false, 58, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 263 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 264 },
+	// type-parameter: KW_TYPENAME TT_IDENTIFIER? OP_ASS type-id
+	{ KW_TYPENAME, REPEAT_ONE, CONTEXT_INHERIT, false, 58, 0 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 41 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// type-parameter: KW_TEMPLATE OP_LT template-parameter-list close-angle-bracket KW_CLASS OP_DOTS? TT_IDENTIFIER?
+	{ KW_TEMPLATE, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TEMPLATE_PARAMETER_LIST, REPEAT_ONE, CONTEXT_ANGLE, false, 261, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ KW_CLASS, REPEAT_ONE, CONTEXT_INHERIT, false, 208, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 263 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 264 },
+	// type-parameter: KW_TEMPLATE OP_LT template-parameter-list close-angle-bracket KW_CLASS TT_IDENTIFIER? OP_ASS id-expression
+	{ KW_TEMPLATE, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TEMPLATE_PARAMETER_LIST, REPEAT_ONE, CONTEXT_ANGLE, false, 261, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ KW_CLASS, REPEAT_ONE, CONTEXT_INHERIT, false, 208, 0 },
+	{ TT_IDENTIFIER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 24, 41 },
+	{ OP_ASS, REPEAT_ONE, CONTEXT_INHERIT, false, 41, 0 },
+	{ NumTerminals + NT_ID_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 11, 0 },
+	// close-angle-bracket: OP_GT
+	{ OP_GT, REPEAT_ONE, CONTEXT_INHERIT, false, 104, 0 },
+	// close-angle-bracket: ST_RSHIFT_1
+	{ ST_RSHIFT_1, REPEAT_ONE, CONTEXT_INHERIT, false, 100, 0 },
+	// close-angle-bracket: ST_RSHIFT_2
+	{ ST_RSHIFT_2, REPEAT_ONE, CONTEXT_INHERIT, false, 101, 0 },
+	// template-id: simple-template-id
+	{ NumTerminals + NT_SIMPLE_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	// template-id: operator-function-id OP_LT template-argument-list? close-angle-bracket
+	{ NumTerminals + NT_OPERATOR_FUNCTION_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TEMPLATE_ARGUMENT_LIST, REPEAT_OPTIONAL, CONTEXT_ANGLE, false, 21, 20 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	// template-id: literal-operator-id OP_LT template-argument-list? close-angle-bracket
+	{ NumTerminals + NT_LITERAL_OPERATOR_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 25, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_TEMPLATE_ARGUMENT_LIST, REPEAT_OPTIONAL, CONTEXT_ANGLE, false, 21, 20 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	// template-argument-list.1: OP_COMMA template-argument-dots
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_TEMPLATE_ARGUMENT_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 21, 0 },
+	// template-argument-list: template-argument-dots (OP_COMMA template-argument-dots)*
+	{ NumTerminals + NT_TEMPLATE_ARGUMENT_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 21, 0 },
+	{ NumTerminals + NT_TEMPLATE_ARGUMENT_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 20 },
+	// template-argument-dots: template-argument OP_DOTS?
+	{ NumTerminals + NT_TEMPLATE_ARGUMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 21, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 264 },
+	// template-argument: constant-expression
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 70, 0 },
+	// template-argument: type-id
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// template-argument: id-expression
+	{ NumTerminals + NT_ID_EXPRESSION, REPEAT_ONE, CONTEXT_INHERIT, false, 11, 0 },
+	// typename-specifier: KW_TYPENAME nested-name-specifier TT_IDENTIFIER
+	{ KW_TYPENAME, REPEAT_ONE, CONTEXT_INHERIT, false, 58, 0 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ TT_IDENTIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 24, 0 },
+	// typename-specifier: KW_TYPENAME nested-name-specifier KW_TEMPLATE? simple-template-id
+	{ KW_TYPENAME, REPEAT_ONE, CONTEXT_INHERIT, false, 58, 0 },
+	{ NumTerminals + NT_NESTED_NAME_SPECIFIER, REPEAT_ONE, CONTEXT_INHERIT, false, 23, 0 },
+	{ KW_TEMPLATE, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 29, 16 },
+	{ NumTerminals + NT_SIMPLE_TEMPLATE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 16, 0 },
+	// explicit-instantiation: KW_EXTERN? KW_TEMPLATE declaration
+	{ KW_EXTERN, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 164, 29 },
+	{ KW_TEMPLATE, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	{ NumTerminals + NT_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 2, 0 },
+	// explicit-specialization: KW_TEMPLATE OP_LT close-angle-bracket declaration
+	{ KW_TEMPLATE, REPEAT_ONE, CONTEXT_INHERIT, false, 29, 0 },
+	{ OP_LT, REPEAT_ONE, CONTEXT_INHERIT, false, 19, 0 },
+	{ NumTerminals + NT_CLOSE_ANGLE_BRACKET, REPEAT_ONE, CONTEXT_INHERIT, false, 20, 0 },
+	{ NumTerminals + NT_DECLARATION, REPEAT_ONE, CONTEXT_INHERIT, false, 2, 0 },
+	// try-block: KW_TRY compound-statement handler+
+	{ KW_TRY, REPEAT_ONE, CONTEXT_INHERIT, false, 142, 0 },
+	{ NumTerminals + NT_COMPOUND_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_HANDLER, REPEAT_PLUS, CONTEXT_INHERIT, false, 266, 265 },
+	// function-try-block: KW_TRY ctor-initializer? compound-statement handler+
+	{ KW_TRY, REPEAT_ONE, CONTEXT_INHERIT, false, 142, 0 },
+	{ NumTerminals + NT_CTOR_INITIALIZER, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 121, 34 },
+	{ NumTerminals + NT_COMPOUND_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	{ NumTerminals + NT_HANDLER, REPEAT_PLUS, CONTEXT_INHERIT, false, 266, 267 },
+	// handler: KW_CATCH OP_LPAREN exception-declaration OP_RPAREN compound-statement
+	{ KW_CATCH, REPEAT_ONE, CONTEXT_INHERIT, false, 266, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_EXCEPTION_DECLARATION, REPEAT_ONE, CONTEXT_PLAIN, false, 268, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	{ NumTerminals + NT_COMPOUND_STATEMENT, REPEAT_ONE, CONTEXT_INHERIT, false, 34, 0 },
+	// exception-declaration: attribute-specifier* type-specifier+ attribute-specifier* declarator
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 60 },
+	{ NumTerminals + NT_TYPE_SPECIFIER, REPEAT_PLUS, CONTEXT_INHERIT, false, 60, 269 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 153 },
+	{ NumTerminals + NT_DECLARATOR, REPEAT_ONE, CONTEXT_INHERIT, false, 153, 0 },
+	// exception-declaration: attribute-specifier* type-specifier+ attribute-specifier* abstract-declarator?
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 60 },
+	{ NumTerminals + NT_TYPE_SPECIFIER, REPEAT_PLUS, CONTEXT_INHERIT, false, 60, 270 },
+	{ NumTerminals + NT_ATTRIBUTE_SPECIFIER, REPEAT_STAR, CONTEXT_INHERIT, false, 50, 271 },
+	{ NumTerminals + NT_ABSTRACT_DECLARATOR, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 228, 10 },
+	// exception-declaration: OP_DOTS
+	{ OP_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 43, 0 },
+	// throw-expression: KW_THROW assignment-expression?
+	{ KW_THROW, REPEAT_ONE, CONTEXT_INHERIT, false, 124, 0 },
+	{ NumTerminals + NT_ASSIGNMENT_EXPRESSION, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 9, 122 },
+	// exception-specification: dynamic-exception-specification
+	{ NumTerminals + NT_DYNAMIC_EXCEPTION_SPECIFICATION, REPEAT_ONE, CONTEXT_INHERIT, false, 124, 0 },
+	// exception-specification: noexcept-specification
+	{ NumTerminals + NT_NOEXCEPT_SPECIFICATION, REPEAT_ONE, CONTEXT_INHERIT, false, 73, 0 },
+	// dynamic-exception-specification: KW_THROW OP_LPAREN type-id-list? OP_RPAREN
+	{ KW_THROW, REPEAT_ONE, CONTEXT_INHERIT, false, 124, 0 },
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_TYPE_ID_LIST, REPEAT_OPTIONAL, CONTEXT_PLAIN, false, 60, 10 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// type-id-list.1: OP_COMMA type-id-dots
+	{ OP_COMMA, REPEAT_ONE, CONTEXT_INHERIT, false, 39, 0 },
+	{ NumTerminals + NT_TYPE_ID_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	// type-id-list: type-id-dots (OP_COMMA type-id-dots)*
+	{ NumTerminals + NT_TYPE_ID_DOTS, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ NumTerminals + NT_TYPE_ID_LIST_1, REPEAT_STAR, CONTEXT_INHERIT, false, 39, 10 },
+	// type-id-dots: type-id OP_DOTS?
+	{ NumTerminals + NT_TYPE_ID, REPEAT_ONE, CONTEXT_INHERIT, false, 60, 0 },
+	{ OP_DOTS, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 43, 272 },
+	// noexcept-specification.1: OP_LPAREN constant-expression OP_RPAREN
+	{ OP_LPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 8, 0 },
+	{ NumTerminals + NT_CONSTANT_EXPRESSION, REPEAT_ONE, CONTEXT_PLAIN, false, 70, 0 },
+	{ OP_RPAREN, REPEAT_ONE, CONTEXT_INHERIT, false, 10, 0 },
+	// noexcept-specification: KW_NOEXCEPT (OP_LPAREN constant-expression OP_RPAREN)?
+	{ KW_NOEXCEPT, REPEAT_ONE, CONTEXT_INHERIT, false, 73, 0 },
+	{ NumTerminals + NT_NOEXCEPT_SPECIFICATION_1, REPEAT_OPTIONAL, CONTEXT_INHERIT, false, 8, 226 },
+};
+
+// GrammarItems[AlternativeItems[a], AlternativeItems[a + 1]): items of alternative a
+constexpr uint16_t AlternativeItems[NumAlternatives + 1] =
+{
+	0, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+	19, 20, 21, 22, 26, 27, 28, 29, 30, 31, 32, 34, 36, 37, 40, 42,
+	43, 45, 47, 49, 51, 54, 57, 60, 61, 62, 65, 66, 67, 70, 73, 74,
+	76, 77, 84, 86, 87, 91, 95, 97, 99, 106, 113, 120, 127, 131, 135, 138,
+	141, 144, 146, 149, 151, 154, 155, 156, 157, 160, 162, 163, 165, 167, 171, 176,
+	180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 196, 203, 206, 208,
+	210, 211, 215, 220, 223, 224, 227, 232, 236, 237, 239, 242, 244, 246, 247, 248,
+	250, 252, 253, 254, 255, 257, 259, 260, 261, 263, 265, 266, 268, 270, 272, 273,
+	274, 275, 276, 278, 280, 281, 282, 284, 286, 288, 290, 292, 294, 296, 298, 300,
+	302, 306, 308, 309, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323,
+	324, 326, 328, 329, 330, 332, 334, 336, 338, 340, 341, 343, 347, 352, 356, 358,
+	361, 366, 373, 378, 383, 387, 388, 389, 394, 401, 409, 416, 417, 418, 421, 422,
+	423, 425, 427, 430, 433, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+	447, 448, 449, 450, 451, 452, 453, 454, 460, 464, 471, 472, 474, 475, 476, 477,
+	478, 479, 480, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+	495, 496, 497, 499, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512,
+	513, 514, 515, 517, 520, 521, 525, 529, 533, 536, 540, 545, 549, 554, 559, 560,
+	562, 564, 566, 568, 570, 571, 574, 575, 581, 582, 587, 589, 594, 598, 604, 609,
+	614, 617, 622, 623, 628, 633, 635, 637, 638, 640, 642, 643, 644, 647, 648, 651,
+	654, 657, 660, 661, 663, 665, 667, 668, 670, 672, 673, 675, 677, 680, 681, 685,
+	692, 695, 698, 700, 702, 706, 707, 708, 709, 710, 712, 714, 715, 717, 718, 720,
+	721, 723, 724, 725, 728, 730, 732, 734, 737, 739, 741, 744, 749, 752, 757, 762,
+	764, 765, 768, 771, 772, 775, 777, 778, 779, 780, 782, 784, 786, 790, 792, 796,
+	801, 804, 806, 807, 808, 809, 810, 811, 813, 817, 819, 820, 821, 822, 823, 825,
+	827, 830, 832, 836, 837, 838, 840, 842, 844, 846, 848, 850, 854, 858, 860, 861,
+	862, 863, 864, 865, 867, 869, 871, 873, 875, 877, 881, 883, 884, 885, 887, 891,
+	893, 897, 899, 901, 903, 905, 907, 909, 911, 913, 915, 917, 919, 921, 923, 925,
+	927, 929, 931, 933, 935, 937, 939, 941, 944, 946, 948, 950, 952, 954, 956, 958,
+	960, 962, 964, 966, 968, 970, 973, 976, 979, 984, 986, 988, 989, 990, 993, 997,
+	1000, 1004, 1011, 1019, 1020, 1021, 1022, 1023, 1027, 1031, 1033, 1035, 1037, 1038, 1039, 1040,
+	1043, 1047, 1050, 1054, 1057, 1061, 1066, 1070, 1074, 1075, 1077, 1078, 1079, 1083, 1085, 1087,
+	1089, 1092, 1094
+};
+
+// AlternativeLists[Dispatch[nt][kind]]: number of alternatives of nt that a
+// token of kind `kind` can start, followed by them
+constexpr uint16_t AlternativeLists[] =
+{
+	0, 1, 0, 1, 7, 1, 2, 1, 3, 1, 5, 1, 1, 1, 8, 1,
+	6, 1, 4, 1, 9, 1, 10, 2, 9, 10, 2, 9, 12, 3, 9, 10,
+	12, 1, 11, 2, 9, 11, 2, 10, 11, 3, 9, 10, 11, 3, 9, 11,
+	12, 4, 9, 10, 11, 12, 1, 13, 1, 14, 2, 13, 14, 1, 15, 1,
+	16, 1, 17, 1, 18, 1, 19, 1, 21, 1, 20, 2, 20, 21, 4, 23,
+	24, 25, 28, 2, 26, 27, 1, 22, 2, 22, 28, 1, 28, 1, 29, 1,
+	30, 1, 34, 1, 31, 1, 32, 1, 33, 2, 32, 33, 1, 36, 1, 35,
+	2, 35, 36, 1, 37, 1, 38, 1, 40, 3, 39, 40, 41, 2, 39, 41,
+	1, 42, 1, 43, 1, 45, 1, 48, 1, 47, 1, 46, 1, 49, 1, 50,
+	2, 52, 54, 1, 59, 3, 51, 52, 54, 1, 56, 1, 51, 1, 58, 1,
+	57, 2, 60, 61, 2, 53, 55, 2, 62, 63, 1, 64, 2, 65, 66, 1,
+	69, 1, 70, 2, 67, 68, 1, 71, 1, 72, 2, 72, 73, 1, 79, 1,
+	74, 1, 82, 1, 81, 1, 80, 3, 76, 77, 78, 2, 74, 75, 1, 75,
+	3, 74, 81, 82, 1, 90, 1, 86, 1, 89, 1, 87, 1, 88, 1, 85,
+	1, 83, 1, 84, 2, 91, 92, 1, 93, 1, 94, 2, 95, 96, 1, 95,
+	1, 98, 1, 100, 1, 99, 2, 101, 102, 1, 103, 1, 104, 2, 104, 105,
+	1, 106, 1, 108, 1, 109, 1, 110, 1, 112, 1, 113, 1, 114, 1, 115,
+	1, 117, 1, 118, 1, 119, 1, 121, 1, 122, 1, 123, 1, 125, 1, 126,
+	1, 127, 1, 128, 1, 129, 1, 131, 1, 132, 1, 133, 1, 135, 1, 137,
+	1, 139, 1, 141, 1, 143, 1, 145, 2, 146, 147, 1, 148, 1, 149, 1,
+	153, 1, 154, 1, 150, 1, 151, 1, 152, 1, 158, 1, 157, 1, 159, 1,
+	155, 1, 156, 1, 161, 1, 162, 8, 163, 164, 165, 166, 167, 168, 169, 170,
+	1, 164, 1, 169, 2, 164, 169, 1, 168, 1, 163, 1, 167, 1, 166, 1,
+	170, 1, 165, 2, 163, 164, 3, 163, 164, 169, 3, 171, 172, 173, 1, 172,
+	1, 173, 1, 171, 1, 174, 1, 175, 2, 176, 177, 1, 178, 2, 179, 180,
+	1, 181, 1, 182, 2, 181, 182, 1, 184, 2, 185, 186, 1, 183, 1, 188,
+	1, 187, 2, 187, 188, 1, 189, 1, 190, 1, 191, 1, 192, 1, 193, 1,
+	196, 2, 194, 195, 1, 197, 3, 198, 199, 206, 1, 198, 2, 198, 199, 4,
+	198, 199, 201, 203, 3, 198, 199, 204, 2, 198, 204, 3, 200, 201, 202, 1,
+	205, 2, 207, 211, 1, 208, 1, 207, 2, 207, 214, 1, 209, 1, 212, 3,
+	210, 211, 213, 1, 215, 1, 216, 1, 217, 1, 218, 1, 219, 1, 221, 1,
+	225, 1, 222, 1, 220, 1, 223, 1, 224, 1, 226, 1, 230, 1, 231, 1,
+	227, 1, 228, 1, 229, 1, 234, 1, 232, 1, 233, 1, 235, 2, 235, 236,
+	2, 235, 237, 1, 238, 1, 239, 1, 241, 1, 240, 1, 242, 1, 243, 1,
+	257, 1, 248, 1, 244, 1, 245, 1, 246, 3, 258, 259, 260, 1, 255, 1,
+	254, 1, 250, 1, 251, 1, 249, 1, 252, 1, 253, 1, 256, 1, 247, 2,
+	258, 259, 1, 261, 2, 262, 263, 1, 264, 2, 265, 266, 2, 267, 268, 1,
+	269, 3, 270, 271, 272, 1, 273, 1, 275, 2, 276, 277, 1, 278, 1, 279,
+	1, 280, 1, 281, 1, 282, 2, 283, 284, 1, 285, 1, 286, 2, 287, 288,
+	1, 290, 1, 289, 2, 291, 292, 1, 294, 1, 295, 2, 295, 296, 1, 297,
+	2, 298, 299, 1, 300, 1, 301, 1, 302, 1, 306, 1, 305, 1, 304, 1,
+	303, 1, 308, 1, 309, 2, 310, 311, 1, 310, 1, 312, 1, 314, 1, 315,
+	1, 316, 1, 318, 1, 317, 1, 319, 1, 320, 1, 324, 1, 322, 1, 321,
+	1, 323, 1, 325, 1, 326, 1, 327, 1, 328, 1, 329, 1, 330, 2, 331,
+	333, 2, 331, 332, 1, 333, 1, 332, 2, 334, 335, 1, 334, 2, 336, 337,
+	1, 338, 2, 338, 339, 1, 340, 1, 341, 2, 342, 343, 1, 342, 1, 345,
+	4, 346, 347, 348, 349, 1, 350, 1, 352, 1, 351, 2, 353, 354, 1, 355,
+	1, 356, 1, 358, 1, 357, 1, 359, 1, 360, 1, 362, 1, 363, 2, 364,
+	365, 1, 366, 2, 367, 368, 1, 369, 1, 370, 1, 371, 1, 372, 1, 373,
+	1, 374, 1, 375, 2, 376, 377, 1, 379, 1, 380, 2, 378, 381, 1, 383,
+	1, 386, 2, 384, 385, 3, 384, 385, 386, 1, 387, 1, 388, 1, 389, 1,
+	390, 1, 392, 1, 393, 3, 394, 395, 396, 1, 394, 1, 396, 1, 395, 2,
+	397, 398, 1, 397, 1, 399, 1, 400, 1, 401, 1, 402, 1, 403, 1, 404,
+	1, 405, 1, 407, 1, 408, 2, 409, 410, 1, 411, 1, 412, 2, 411, 412,
+	42, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+	428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+	444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 1, 455, 1, 456, 1,
+	458, 1, 460, 2, 459, 460, 1, 459, 2, 461, 462, 2, 465, 466, 2, 463,
+	464, 1, 467, 1, 468, 1, 469, 2, 471, 472, 1, 470, 1, 474, 1, 475,
+	1, 476, 2, 476, 477, 1, 477, 3, 476, 477, 478, 2, 476, 478, 2, 479,
+	480, 1, 481, 1, 482, 1, 483, 1, 484, 1, 485, 2, 486, 487, 1, 488,
+	1, 489, 1, 491, 1, 490, 1, 492, 1, 494, 1, 495, 1, 497, 1, 44,
+	1, 97, 1, 107, 1, 111, 1, 116, 1, 120, 1, 124, 1, 130, 1, 134,
+	1, 136, 1, 138, 1, 140, 1, 142, 1, 144, 1, 160, 1, 274, 1, 293,
+	1, 307, 1, 313, 1, 344, 1, 361, 1, 382, 1, 391, 1, 406, 1, 457,
+	1, 473, 1, 493, 1, 496
+};
+
+constexpr uint16_t Dispatch[NumNonterminals][NumTokenKinds] =
+{
+	{ 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0 }, // translation-unit
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 15, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 17, 17, 17, 0, 0, 0 }, // primary-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 21, 23, 0, 19, 21, 23, 26, 26, 29, 29, 26, 26, 29, 29, 33, 35, 38, 41, 33, 35, 38, 41, 45, 45, 49, 49, 45, 45, 49, 49, 26, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-name
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 54, 0, 54, 0, 54, 56, 58, 56, 58, 56, 58, 56, 58, 0, 54, 0, 54, 0, 54, 0, 54, 56, 58, 56, 58, 56, 58, 56, 58, 56, 0, 0, 0, 0, 0, 0, 0, 0 }, // class-name
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 61, 0, 0, 61, 61, 0, 0, 61, 61, 0, 0, 61, 61, 0, 0, 61, 61, 0, 0, 61, 61, 0, 0, 61, 61, 0, 0, 61, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // enum-name
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 63, 63, 63, 0, 0, 0, 0, 63, 63, 63, 63, 0, 0, 0, 0, 63, 63, 63, 63, 0, 0, 0, 0, 63, 63, 63, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // namespace-name
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 0, 0, 0, 0, 0, 0 }, // template-name
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // typedef-name
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 69, 69, 69, 69, 69, 69, 0, 0, 0, 0, 0, 0, 0, 0, 69, 69, 69, 69, 69, 69, 69, 69, 69, 0, 0, 0, 0, 0, 0, 0, 0 }, // simple-template-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 73, 73, 0, 0, 0, 0, 0, 0 }, // id-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 86, 86, 86, 86, 86, 86, 86, 88, 88, 88, 88, 88, 88, 88, 88, 86, 86, 86, 86, 86, 86, 86, 86, 88, 88, 88, 88, 88, 88, 88, 88, 91, 86, 86, 0, 0, 0, 0, 0, 0 }, // unqualified-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 0, 0, 0, 0, 0, 0, 0, 0 }, // qualified-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 0, 0, 0, 0, 0, 0, 0, 0 }, // nested-name-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101, 101, 103, 105, 105, 105, 101, 101, 101, 101, 105, 105, 105, 105, 101, 101, 101, 101, 105, 105, 105, 105, 101, 101, 101, 101, 105, 105, 105, 105, 101, 0, 0, 0, 0, 0, 0, 0, 0 }, // nested-name-specifier-root
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 110, 110, 110, 110, 110, 110, 110, 112, 112, 112, 112, 112, 112, 112, 112, 110, 110, 110, 110, 110, 110, 110, 110, 112, 112, 112, 112, 112, 112, 112, 112, 108, 110, 110, 0, 0, 0, 0, 0, 0 }, // nested-name-specifier-suffix
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // lambda-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // lambda-introducer
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 0, 119, 119, 0, 0, 0, 0, 0, 0 }, // lambda-capture
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // capture-default
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0, 132, 132, 0, 0, 0, 0, 0, 0 }, // capture-list
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 0, 138, 138, 0, 0, 0, 0, 0, 0 }, // capture
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // lambda-declarator
+	{ 0, 0, 0, 142, 142, 0, 0, 0, 142, 142, 142, 0, 0, 0, 142, 0, 142, 0, 0, 0, 142, 142, 0, 0, 0, 0, 0, 142, 142, 0, 0, 0, 0, 0, 142, 142, 0, 0, 0, 0, 142, 142, 0, 0, 0, 0, 142, 0, 142, 142, 0, 0, 0, 142, 0, 0, 0, 142, 0, 0, 142, 0, 0, 142, 142, 0, 142, 0, 0, 142, 0, 142, 0, 0, 0, 142, 0, 142, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 0, 0, 0 }, // postfix-expression
+	{ 0, 0, 0, 144, 144, 0, 0, 0, 144, 144, 144, 0, 0, 0, 147, 0, 149, 0, 0, 0, 144, 153, 0, 0, 0, 0, 0, 155, 144, 0, 0, 0, 0, 0, 144, 144, 0, 0, 0, 0, 155, 155, 0, 0, 0, 0, 157, 0, 144, 144, 0, 0, 0, 159, 0, 0, 0, 155, 0, 0, 155, 0, 0, 161, 164, 0, 144, 0, 0, 144, 0, 144, 0, 0, 0, 155, 0, 155, 0, 0, 0, 155, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 155, 155, 155, 155, 155, 0, 0, 0 }, // postfix-root
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 177, 0, 0, 179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // postfix-suffix
+	{ 0, 182, 0, 182, 182, 0, 0, 0, 182, 182, 182, 0, 0, 0, 182, 0, 182, 0, 182, 0, 182, 182, 0, 0, 0, 0, 0, 182, 182, 0, 0, 0, 0, 0, 182, 182, 0, 0, 182, 182, 182, 182, 0, 0, 0, 0, 182, 0, 182, 182, 182, 0, 0, 182, 0, 0, 0, 182, 0, 182, 182, 0, 0, 182, 182, 0, 182, 0, 0, 182, 0, 182, 0, 182, 0, 182, 0, 182, 0, 0, 0, 182, 182, 182, 0, 0, 0, 0, 182, 0, 0, 182, 182, 182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 182, 182, 0, 0, 0, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 0, 0, 0 }, // expression-list
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 0, 0, 0, 0, 0, 0, 0, 0 }, // pseudo-destructor-name
+	{ 0, 189, 0, 191, 191, 0, 0, 0, 191, 191, 191, 0, 0, 0, 191, 0, 191, 0, 193, 0, 191, 191, 0, 0, 0, 0, 0, 191, 191, 0, 0, 0, 0, 0, 191, 191, 0, 0, 195, 197, 191, 191, 0, 0, 0, 0, 191, 0, 191, 191, 199, 0, 0, 191, 0, 0, 0, 191, 0, 0, 191, 0, 0, 191, 191, 0, 191, 0, 0, 191, 0, 191, 0, 0, 0, 191, 0, 191, 0, 0, 0, 203, 206, 206, 0, 0, 0, 0, 208, 0, 0, 206, 206, 206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 206, 0, 0, 0, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 0, 0, 0 }, // unary-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 212, 214, 216, 0, 0, 0, 0, 0, 0, 0, 218, 220, 222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // unary-operator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // new-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 231, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // new-placement
+	{ 0, 0, 0, 233, 233, 0, 0, 0, 233, 233, 233, 233, 233, 0, 0, 0, 233, 0, 0, 0, 233, 0, 0, 233, 0, 0, 0, 0, 233, 0, 0, 0, 0, 0, 233, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 233, 233, 0, 0, 0, 0, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 233, 233, 233, 0, 0, 233, 233, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 0, 0, 0, 0, 0, 0, 0, 0 }, // new-type-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0, 0, 235, 0, 0, 0, 0, 0, 235, 0, 0, 0, 0, 235, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 0, 0, 0, 0, 0, 0, 0, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 0, 0, 0, 0, 0, 0, 0, 0 }, // new-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noptr-new-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 242, 0, 0, 0, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // new-initializer
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // delete-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noexcept-expression
+	{ 0, 251, 0, 251, 251, 0, 0, 0, 251, 251, 251, 0, 0, 0, 251, 0, 251, 0, 251, 0, 251, 251, 0, 0, 0, 0, 0, 251, 251, 0, 0, 0, 0, 0, 251, 251, 0, 0, 251, 251, 251, 251, 0, 0, 0, 0, 251, 0, 251, 251, 251, 0, 0, 251, 0, 0, 0, 251, 0, 0, 251, 0, 0, 251, 251, 0, 251, 0, 0, 251, 0, 251, 0, 0, 0, 251, 0, 253, 0, 0, 0, 251, 251, 251, 0, 0, 0, 0, 251, 0, 0, 251, 251, 251, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 251, 0, 0, 0, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 0, 0, 0 }, // cast-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // cast-operator
+	{ 0, 258, 0, 258, 258, 0, 0, 0, 258, 258, 258, 0, 0, 0, 258, 0, 258, 0, 258, 0, 258, 258, 0, 0, 0, 0, 0, 258, 258, 0, 0, 0, 0, 0, 258, 258, 0, 0, 258, 258, 258, 258, 0, 0, 0, 0, 258, 0, 258, 258, 258, 0, 0, 258, 0, 0, 0, 258, 0, 0, 258, 0, 0, 258, 258, 0, 258, 0, 0, 258, 0, 258, 0, 0, 0, 258, 0, 258, 0, 0, 0, 258, 258, 258, 0, 0, 0, 0, 258, 0, 0, 258, 258, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 258, 258, 0, 0, 0, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 0, 0, 0 }, // pm-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 262, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // pm-operator
+	{ 0, 264, 0, 264, 264, 0, 0, 0, 264, 264, 264, 0, 0, 0, 264, 0, 264, 0, 264, 0, 264, 264, 0, 0, 0, 0, 0, 264, 264, 0, 0, 0, 0, 0, 264, 264, 0, 0, 264, 264, 264, 264, 0, 0, 0, 0, 264, 0, 264, 264, 264, 0, 0, 264, 0, 0, 0, 264, 0, 0, 264, 0, 0, 264, 264, 0, 264, 0, 0, 264, 0, 264, 0, 0, 0, 264, 0, 264, 0, 0, 0, 264, 264, 264, 0, 0, 0, 0, 264, 0, 0, 264, 264, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 264, 264, 0, 0, 0, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 0, 0, 0 }, // multiplicative-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 266, 268, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // multiplicative-operator
+	{ 0, 272, 0, 272, 272, 0, 0, 0, 272, 272, 272, 0, 0, 0, 272, 0, 272, 0, 272, 0, 272, 272, 0, 0, 0, 0, 0, 272, 272, 0, 0, 0, 0, 0, 272, 272, 0, 0, 272, 272, 272, 272, 0, 0, 0, 0, 272, 0, 272, 272, 272, 0, 0, 272, 0, 0, 0, 272, 0, 0, 272, 0, 0, 272, 272, 0, 272, 0, 0, 272, 0, 272, 0, 0, 0, 272, 0, 272, 0, 0, 0, 272, 272, 272, 0, 0, 0, 0, 272, 0, 0, 272, 272, 272, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 272, 272, 0, 0, 0, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 0, 0, 0 }, // additive-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 274, 276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // additive-operator
+	{ 0, 278, 0, 278, 278, 0, 0, 0, 278, 278, 278, 0, 0, 0, 278, 0, 278, 0, 278, 0, 278, 278, 0, 0, 0, 0, 0, 278, 278, 0, 0, 0, 0, 0, 278, 278, 0, 0, 278, 278, 278, 278, 0, 0, 0, 0, 278, 0, 278, 278, 278, 0, 0, 278, 0, 0, 0, 278, 0, 0, 278, 0, 0, 278, 278, 0, 278, 0, 0, 278, 0, 278, 0, 0, 0, 278, 0, 278, 0, 0, 0, 278, 278, 278, 0, 0, 0, 0, 278, 0, 0, 278, 278, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 278, 278, 0, 0, 0, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 0, 0, 0 }, // shift-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 0 }, // shift-operator
+	{ 0, 284, 0, 284, 284, 0, 0, 0, 284, 284, 284, 0, 0, 0, 284, 0, 284, 0, 284, 0, 284, 284, 0, 0, 0, 0, 0, 284, 284, 0, 0, 0, 0, 0, 284, 284, 0, 0, 284, 284, 284, 284, 0, 0, 0, 0, 284, 0, 284, 284, 284, 0, 0, 284, 0, 0, 0, 284, 0, 0, 284, 0, 0, 284, 284, 0, 284, 0, 0, 284, 0, 284, 0, 0, 0, 284, 0, 284, 0, 0, 0, 284, 284, 284, 0, 0, 0, 0, 284, 0, 0, 284, 284, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 284, 284, 0, 0, 0, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 0, 0, 0 }, // relational-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 286, 288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 290, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // relational-operator
+	{ 0, 294, 0, 294, 294, 0, 0, 0, 294, 294, 294, 0, 0, 0, 294, 0, 294, 0, 294, 0, 294, 294, 0, 0, 0, 0, 0, 294, 294, 0, 0, 0, 0, 0, 294, 294, 0, 0, 294, 294, 294, 294, 0, 0, 0, 0, 294, 0, 294, 294, 294, 0, 0, 294, 0, 0, 0, 294, 0, 0, 294, 0, 0, 294, 294, 0, 294, 0, 0, 294, 0, 294, 0, 0, 0, 294, 0, 294, 0, 0, 0, 294, 294, 294, 0, 0, 0, 0, 294, 0, 0, 294, 294, 294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 294, 294, 0, 0, 0, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 0, 0, 0 }, // equality-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 296, 298, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // equality-operator
+	{ 0, 300, 0, 300, 300, 0, 0, 0, 300, 300, 300, 0, 0, 0, 300, 0, 300, 0, 300, 0, 300, 300, 0, 0, 0, 0, 0, 300, 300, 0, 0, 0, 0, 0, 300, 300, 0, 0, 300, 300, 300, 300, 0, 0, 0, 0, 300, 0, 300, 300, 300, 0, 0, 300, 0, 0, 0, 300, 0, 0, 300, 0, 0, 300, 300, 0, 300, 0, 0, 300, 0, 300, 0, 0, 0, 300, 0, 300, 0, 0, 0, 300, 300, 300, 0, 0, 0, 0, 300, 0, 0, 300, 300, 300, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 300, 300, 0, 0, 0, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 0, 0, 0 }, // and-expression
+	{ 0, 302, 0, 302, 302, 0, 0, 0, 302, 302, 302, 0, 0, 0, 302, 0, 302, 0, 302, 0, 302, 302, 0, 0, 0, 0, 0, 302, 302, 0, 0, 0, 0, 0, 302, 302, 0, 0, 302, 302, 302, 302, 0, 0, 0, 0, 302, 0, 302, 302, 302, 0, 0, 302, 0, 0, 0, 302, 0, 0, 302, 0, 0, 302, 302, 0, 302, 0, 0, 302, 0, 302, 0, 0, 0, 302, 0, 302, 0, 0, 0, 302, 302, 302, 0, 0, 0, 0, 302, 0, 0, 302, 302, 302, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 302, 302, 0, 0, 0, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 0, 0, 0 }, // exclusive-or-expression
+	{ 0, 304, 0, 304, 304, 0, 0, 0, 304, 304, 304, 0, 0, 0, 304, 0, 304, 0, 304, 0, 304, 304, 0, 0, 0, 0, 0, 304, 304, 0, 0, 0, 0, 0, 304, 304, 0, 0, 304, 304, 304, 304, 0, 0, 0, 0, 304, 0, 304, 304, 304, 0, 0, 304, 0, 0, 0, 304, 0, 0, 304, 0, 0, 304, 304, 0, 304, 0, 0, 304, 0, 304, 0, 0, 0, 304, 0, 304, 0, 0, 0, 304, 304, 304, 0, 0, 0, 0, 304, 0, 0, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 0, 0, 0 }, // inclusive-or-expression
+	{ 0, 306, 0, 306, 306, 0, 0, 0, 306, 306, 306, 0, 0, 0, 306, 0, 306, 0, 306, 0, 306, 306, 0, 0, 0, 0, 0, 306, 306, 0, 0, 0, 0, 0, 306, 306, 0, 0, 306, 306, 306, 306, 0, 0, 0, 0, 306, 0, 306, 306, 306, 0, 0, 306, 0, 0, 0, 306, 0, 0, 306, 0, 0, 306, 306, 0, 306, 0, 0, 306, 0, 306, 0, 0, 0, 306, 0, 306, 0, 0, 0, 306, 306, 306, 0, 0, 0, 0, 306, 0, 0, 306, 306, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 306, 306, 0, 0, 0, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 0, 0, 0 }, // logical-and-expression
+	{ 0, 308, 0, 308, 308, 0, 0, 0, 308, 308, 308, 0, 0, 0, 308, 0, 308, 0, 308, 0, 308, 308, 0, 0, 0, 0, 0, 308, 308, 0, 0, 0, 0, 0, 308, 308, 0, 0, 308, 308, 308, 308, 0, 0, 0, 0, 308, 0, 308, 308, 308, 0, 0, 308, 0, 0, 0, 308, 0, 0, 308, 0, 0, 308, 308, 0, 308, 0, 0, 308, 0, 308, 0, 0, 0, 308, 0, 308, 0, 0, 0, 308, 308, 308, 0, 0, 0, 0, 308, 0, 0, 308, 308, 308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 308, 308, 0, 0, 0, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 0, 0, 0 }, // logical-or-expression
+	{ 0, 310, 0, 310, 310, 0, 0, 0, 310, 310, 310, 0, 0, 0, 310, 0, 310, 0, 310, 0, 310, 310, 0, 0, 0, 0, 0, 310, 310, 0, 0, 0, 0, 0, 310, 310, 0, 0, 310, 310, 310, 310, 0, 0, 0, 0, 310, 0, 310, 310, 310, 0, 0, 310, 0, 0, 0, 310, 0, 0, 310, 0, 0, 310, 310, 0, 310, 0, 0, 310, 0, 310, 0, 0, 0, 310, 0, 310, 0, 0, 0, 310, 310, 310, 0, 0, 0, 0, 310, 0, 0, 310, 310, 310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 310, 310, 0, 0, 0, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 0, 0, 0 }, // conditional-expression
+	{ 0, 312, 0, 312, 312, 0, 0, 0, 312, 312, 312, 0, 0, 0, 312, 0, 312, 0, 312, 0, 312, 312, 0, 0, 0, 0, 0, 312, 312, 0, 0, 0, 0, 0, 312, 312, 0, 0, 312, 312, 312, 312, 0, 0, 0, 0, 312, 0, 312, 312, 312, 0, 0, 312, 0, 0, 0, 312, 0, 315, 312, 0, 0, 312, 312, 0, 312, 0, 0, 312, 0, 312, 0, 0, 0, 312, 0, 312, 0, 0, 0, 312, 312, 312, 0, 0, 0, 0, 312, 0, 0, 312, 312, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 312, 0, 0, 0, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 0, 0, 0 }, // assignment-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 0, 0, 319, 321, 323, 325, 327, 329, 331, 333, 0, 0, 335, 337, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // assignment-operator
+	{ 0, 339, 0, 339, 339, 0, 0, 0, 339, 339, 339, 0, 0, 0, 339, 0, 339, 0, 339, 0, 339, 339, 0, 0, 0, 0, 0, 339, 339, 0, 0, 0, 0, 0, 339, 339, 0, 0, 339, 339, 339, 339, 0, 0, 0, 0, 339, 0, 339, 339, 339, 0, 0, 339, 0, 0, 0, 339, 0, 339, 339, 0, 0, 339, 339, 0, 339, 0, 0, 339, 0, 339, 0, 0, 0, 339, 0, 339, 0, 0, 0, 339, 339, 339, 0, 0, 0, 0, 339, 0, 0, 339, 339, 339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 339, 339, 0, 0, 0, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 339, 0, 0, 0 }, // expression
+	{ 0, 341, 0, 341, 341, 0, 0, 0, 341, 341, 341, 0, 0, 0, 341, 0, 341, 0, 341, 0, 341, 341, 0, 0, 0, 0, 0, 341, 341, 0, 0, 0, 0, 0, 341, 341, 0, 0, 341, 341, 341, 341, 0, 0, 0, 0, 341, 0, 341, 341, 341, 0, 0, 341, 0, 0, 0, 341, 0, 0, 341, 0, 0, 341, 341, 0, 341, 0, 0, 341, 0, 341, 0, 0, 0, 341, 0, 341, 0, 0, 0, 341, 341, 341, 0, 0, 0, 0, 341, 0, 0, 341, 341, 341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 341, 0, 0, 0, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 341, 0, 0, 0 }, // constant-expression
+	{ 343, 352, 354, 356, 356, 359, 361, 0, 356, 356, 356, 354, 354, 354, 352, 359, 356, 361, 352, 363, 356, 352, 0, 354, 354, 0, 354, 352, 356, 363, 354, 359, 365, 354, 356, 356, 354, 354, 352, 352, 352, 352, 0, 0, 0, 354, 352, 359, 356, 356, 352, 354, 354, 352, 354, 365, 0, 352, 354, 352, 352, 367, 354, 352, 356, 354, 356, 354, 354, 356, 354, 356, 363, 369, 0, 343, 0, 352, 0, 0, 0, 352, 352, 352, 352, 0, 0, 0, 356, 0, 0, 352, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352, 0, 0, 0, 371, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 356, 371, 371, 352, 352, 352, 0, 0, 0 }, // statement
+	{ 378, 0, 0, 0, 0, 0, 382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 0, 386, 386, 0, 0, 0, 0, 0, 0 }, // labeled-statement
+	{ 0, 388, 0, 388, 388, 0, 0, 0, 388, 388, 388, 0, 0, 0, 388, 0, 388, 0, 388, 0, 388, 388, 0, 0, 0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 388, 388, 0, 0, 388, 388, 388, 388, 0, 0, 0, 0, 388, 0, 388, 388, 388, 0, 0, 388, 0, 0, 0, 388, 0, 388, 388, 0, 0, 388, 388, 0, 388, 0, 0, 388, 0, 388, 0, 0, 0, 388, 0, 388, 0, 0, 0, 388, 388, 388, 388, 0, 0, 0, 388, 0, 0, 388, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 0, 0, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 0, 0, 0 }, // expression-statement
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // compound-statement
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 392, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // selection-statement
+	{ 397, 0, 0, 397, 397, 0, 0, 0, 397, 397, 397, 397, 397, 397, 0, 0, 397, 0, 0, 0, 397, 0, 0, 397, 397, 0, 397, 0, 397, 0, 397, 0, 0, 397, 397, 397, 397, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 397, 397, 0, 397, 0, 0, 397, 0, 0, 0, 397, 0, 0, 0, 397, 0, 397, 397, 397, 0, 397, 397, 397, 397, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 0, 0, 0, 0, 0, 0, 0, 0 }, // condition-declaration
+	{ 400, 402, 0, 404, 404, 0, 0, 0, 404, 404, 404, 400, 400, 400, 402, 0, 404, 0, 402, 0, 404, 402, 0, 400, 400, 0, 400, 402, 404, 0, 400, 0, 0, 400, 404, 404, 400, 0, 402, 402, 402, 402, 0, 0, 0, 400, 402, 0, 404, 404, 402, 400, 0, 402, 400, 0, 0, 402, 400, 402, 402, 0, 400, 402, 404, 400, 404, 0, 400, 404, 400, 404, 0, 0, 0, 404, 0, 402, 0, 0, 0, 402, 402, 402, 0, 0, 0, 0, 404, 0, 0, 402, 402, 402, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 402, 402, 0, 0, 0, 402, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 402, 402, 402, 402, 402, 0, 0, 0 }, // condition
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // iteration-statement
+	{ 414, 416, 0, 418, 418, 0, 0, 0, 418, 418, 418, 414, 414, 414, 416, 0, 418, 0, 416, 0, 418, 416, 0, 414, 414, 0, 414, 416, 418, 0, 414, 0, 0, 414, 418, 418, 414, 0, 416, 416, 416, 416, 0, 0, 0, 414, 416, 0, 418, 418, 416, 414, 0, 416, 414, 0, 0, 416, 414, 416, 416, 0, 414, 416, 418, 414, 418, 0, 414, 418, 414, 418, 0, 0, 0, 418, 0, 416, 0, 0, 0, 416, 416, 416, 416, 0, 0, 0, 418, 0, 0, 416, 416, 416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 416, 416, 0, 0, 0, 416, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 416, 416, 416, 416, 416, 0, 0, 0 }, // for-init-statement
+	{ 421, 0, 0, 421, 421, 0, 0, 0, 421, 421, 421, 421, 421, 421, 0, 0, 421, 0, 0, 0, 421, 0, 0, 421, 421, 0, 421, 0, 421, 0, 421, 0, 0, 421, 421, 421, 421, 0, 0, 0, 0, 0, 0, 0, 0, 421, 0, 0, 421, 421, 0, 421, 0, 0, 421, 0, 0, 0, 421, 0, 0, 0, 421, 0, 421, 421, 421, 0, 421, 421, 421, 421, 0, 0, 0, 421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 421, 0, 0, 0, 0, 0, 0, 0, 0 }, // for-range-declaration
+	{ 0, 423, 0, 423, 423, 0, 0, 0, 423, 423, 423, 0, 0, 0, 423, 0, 423, 0, 423, 0, 423, 423, 0, 0, 0, 0, 0, 423, 423, 0, 0, 0, 0, 0, 423, 423, 0, 0, 423, 423, 423, 423, 0, 0, 0, 0, 423, 0, 423, 423, 423, 0, 0, 423, 0, 0, 0, 423, 0, 423, 423, 0, 0, 423, 423, 0, 423, 0, 0, 423, 0, 423, 0, 425, 0, 423, 0, 423, 0, 0, 0, 423, 423, 423, 0, 0, 0, 0, 423, 0, 0, 423, 423, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 423, 0, 0, 0, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 0, 0, 0 }, // for-range-initializer
+	{ 0, 0, 0, 0, 0, 427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 429, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // jump-statement
+	{ 436, 0, 436, 436, 436, 0, 0, 0, 436, 436, 436, 436, 436, 436, 0, 0, 436, 0, 0, 0, 436, 0, 0, 436, 436, 0, 436, 0, 436, 0, 436, 0, 0, 436, 436, 436, 436, 436, 0, 0, 0, 0, 0, 0, 0, 436, 0, 0, 436, 436, 0, 436, 436, 0, 436, 0, 0, 0, 436, 0, 0, 0, 436, 0, 436, 436, 436, 436, 436, 436, 436, 436, 0, 0, 0, 436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 0, 0, 0, 0, 0, 0, 0, 0 }, // declaration-statement
+	{ 438, 0, 442, 444, 444, 0, 0, 0, 444, 444, 444, 444, 444, 444, 0, 0, 444, 0, 0, 0, 444, 0, 0, 444, 444, 0, 447, 0, 444, 0, 444, 0, 0, 452, 444, 444, 444, 456, 0, 0, 0, 0, 0, 0, 0, 444, 0, 0, 444, 444, 0, 444, 442, 0, 444, 0, 459, 0, 444, 0, 0, 0, 444, 0, 444, 444, 444, 442, 444, 444, 444, 444, 0, 0, 0, 438, 0, 0, 0, 0, 0, 0, 0, 0, 463, 0, 0, 0, 444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 0, 0, 0, 0, 0, 0, 0, 0 }, // declaration
+	{ 465, 0, 468, 470, 470, 0, 0, 0, 470, 470, 470, 470, 470, 470, 0, 0, 470, 0, 0, 0, 470, 0, 0, 472, 470, 0, 470, 0, 470, 0, 470, 0, 0, 470, 470, 470, 470, 475, 0, 0, 0, 0, 0, 0, 0, 470, 0, 0, 470, 470, 0, 470, 477, 0, 470, 0, 0, 0, 470, 0, 0, 0, 470, 0, 470, 470, 470, 479, 470, 470, 470, 470, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 470, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 0, 0, 0, 0, 0, 0, 0, 0 }, // block-declaration
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // alias-declaration
+	{ 485, 0, 0, 485, 485, 0, 0, 0, 485, 485, 485, 485, 485, 485, 0, 0, 485, 0, 0, 0, 485, 0, 0, 485, 485, 0, 485, 0, 485, 0, 485, 0, 0, 485, 485, 485, 485, 0, 0, 0, 0, 0, 0, 0, 0, 485, 0, 0, 485, 485, 0, 485, 0, 0, 485, 0, 0, 0, 485, 0, 0, 0, 485, 0, 485, 485, 485, 0, 485, 485, 485, 485, 0, 0, 0, 485, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 0, 0, 0, 0, 0, 0, 0, 0 }, // simple-declaration
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // static_assert-declaration
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // empty-declaration
+	{ 491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // attribute-declaration
+	{ 0, 0, 0, 493, 493, 0, 0, 0, 493, 493, 493, 493, 493, 495, 0, 0, 493, 0, 0, 0, 493, 0, 0, 493, 497, 0, 499, 0, 493, 0, 501, 0, 0, 497, 493, 493, 499, 0, 0, 0, 0, 0, 0, 0, 0, 499, 0, 0, 493, 493, 0, 499, 0, 0, 493, 0, 0, 0, 499, 0, 0, 0, 503, 0, 493, 493, 493, 0, 497, 493, 493, 493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 0, 0, 0, 0, 0, 0, 0, 0 }, // decl-specifier
+	{ 0, 0, 0, 505, 505, 0, 0, 0, 505, 505, 505, 505, 505, 505, 0, 0, 505, 0, 0, 0, 505, 0, 0, 505, 505, 0, 505, 0, 505, 0, 505, 0, 0, 505, 505, 505, 505, 0, 0, 0, 0, 0, 0, 0, 0, 505, 0, 0, 505, 505, 0, 505, 0, 0, 505, 0, 0, 0, 505, 0, 0, 0, 505, 0, 505, 505, 505, 0, 505, 505, 505, 505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 0, 0, 0, 0, 0, 0, 0, 0 }, // decl-specifier-seq
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 509, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 513, 0, 0, 0, 0, 0, 0, 515, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // storage-class-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0, 0, 0, 0, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // function-specifier
+	{ 0, 0, 0, 523, 523, 0, 0, 0, 523, 523, 523, 525, 523, 0, 0, 0, 523, 0, 0, 0, 523, 0, 0, 528, 0, 0, 0, 0, 523, 0, 0, 0, 0, 0, 523, 523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 523, 523, 0, 0, 0, 0, 525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 523, 525, 523, 0, 0, 523, 523, 523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-specifier
+	{ 0, 0, 0, 531, 531, 0, 0, 0, 531, 531, 531, 533, 535, 0, 0, 0, 531, 0, 0, 0, 531, 0, 0, 533, 0, 0, 0, 0, 531, 0, 0, 0, 0, 0, 531, 531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 531, 531, 0, 0, 0, 0, 533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537, 533, 531, 0, 0, 531, 535, 531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 531, 0, 0, 0, 0, 0, 0, 0, 0 }, // trailing-type-specifier
+	{ 0, 0, 0, 539, 539, 0, 0, 0, 539, 539, 539, 539, 539, 0, 0, 0, 539, 0, 0, 0, 539, 0, 0, 539, 0, 0, 0, 0, 539, 0, 0, 0, 0, 0, 539, 539, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 539, 0, 0, 0, 0, 539, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 539, 539, 0, 0, 539, 539, 539, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-specifier-seq
+	{ 0, 0, 0, 541, 541, 0, 0, 0, 541, 541, 541, 541, 541, 0, 0, 0, 541, 0, 0, 0, 541, 0, 0, 541, 0, 0, 0, 0, 541, 0, 0, 0, 0, 0, 541, 541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541, 541, 0, 0, 0, 0, 541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541, 541, 541, 0, 0, 541, 541, 541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 541, 0, 0, 0, 0, 0, 0, 0, 0 }, // trailing-type-specifier-seq
+	{ 0, 0, 0, 543, 545, 0, 0, 0, 547, 549, 551, 0, 0, 0, 0, 0, 553, 0, 0, 0, 557, 0, 0, 0, 0, 0, 0, 0, 559, 0, 0, 0, 0, 0, 561, 563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 565, 567, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 569, 0, 0, 571, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 575, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 0, 0, 0, 0, 0, 0, 0, 0 }, // simple-type-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 578, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // decltype-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 580, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 580, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 580, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // elaborated-type-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // enum-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 588, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // enum-head
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // opaque-enum-declaration
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // enum-key
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 597, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // enum-base
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 0, 599, 599, 0, 0, 0, 0, 0, 0 }, // enumerator-list
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 0, 601, 601, 0, 0, 0, 0, 0, 0 }, // enumerator-definition
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 604, 0, 604, 604, 0, 0, 0, 0, 0, 0 }, // enumerator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 606, 0, 0, 0, 606, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // namespace-definition
+	{ 608, 0, 608, 608, 608, 0, 0, 0, 608, 608, 608, 608, 608, 608, 0, 0, 608, 0, 0, 0, 608, 0, 0, 608, 608, 0, 608, 0, 608, 0, 608, 0, 0, 608, 608, 608, 608, 608, 0, 0, 0, 0, 0, 0, 0, 608, 0, 0, 608, 608, 0, 608, 608, 0, 608, 0, 608, 0, 608, 0, 0, 0, 608, 0, 608, 608, 608, 608, 608, 608, 608, 608, 0, 0, 608, 608, 0, 0, 0, 0, 0, 0, 0, 0, 608, 0, 0, 0, 608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 608, 0, 0, 0, 0, 0, 0, 0, 0 }, // namespace-body
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // namespace-alias-definition
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 612, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 612, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 0, 0, 0, 0, 0, 0, 0, 0 }, // qualified-namespace-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 614, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // using-declaration
+	{ 617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 617, 0, 0, 0, 0, 0, 0, 0, 617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // using-directive
+	{ 0, 0, 619, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // asm-definition
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 621, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // linkage-specification
+	{ 624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // attribute-specifier
+	{ 628, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // alignment-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 631, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 631, 0, 0, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 0, 631, 631, 0, 0, 0, 0, 0, 0 }, // attribute-list
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 633, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 633, 0, 0, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 0, 635, 635, 0, 0, 0, 0, 0, 0 }, // attribute-part
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 0, 638, 638, 0, 0, 0, 0, 0, 0 }, // attribute
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 0, 640, 640, 0, 0, 0, 0, 0, 0 }, // attribute-token
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 0, 643, 643, 0, 0, 0, 0, 0, 0 }, // attribute-scoped-token
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 0, 645, 645, 0, 0, 0, 0, 0, 0 }, // attribute-namespace
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // attribute-argument-clause
+	{ 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 651, 0, 653, 0, 655, 0, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 0, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 0, 649, 649 }, // balanced-token
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 657, 0, 0, 0, 657, 657, 0, 0, 0, 657, 0, 657, 0, 0, 0, 0, 657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 657, 0, 0, 0, 0, 0, 0, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 657, 0, 0, 0, 0, 0, 0 }, // init-declarator-list
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 659, 0, 0, 0, 659, 659, 0, 0, 0, 659, 0, 659, 0, 0, 0, 0, 659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 659, 0, 0, 0, 0, 0, 0, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 659, 0, 0, 0, 0, 0, 0 }, // init-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 661, 0, 0, 0, 661, 664, 0, 0, 0, 661, 0, 661, 0, 0, 0, 0, 664, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 664, 0, 0, 0, 0, 0, 0, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 661, 0, 0, 0, 0, 0, 0 }, // declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 666, 0, 0, 0, 666, 666, 0, 0, 0, 666, 0, 666, 0, 0, 0, 0, 666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 666, 0, 0, 0, 0, 0, 0, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 0, 0, 0, 0, 0, 0 }, // ptr-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 0, 0, 0, 668, 0, 0, 0, 0, 668, 0, 668, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 0, 0, 0, 0, 0, 0 }, // noptr-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 672, 0, 0, 0, 670, 0, 0, 0, 0, 670, 0, 670, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 670, 0, 0, 0, 0, 0, 0 }, // noptr-declarator-root
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 674, 0, 676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noptr-declarator-suffix
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // parameters-and-qualifiers
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // trailing-return-type
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 684, 0, 0, 0, 0, 0, 682, 0, 0, 0, 0, 686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 688, 0, 0, 0, 0, 0, 0, 0, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 0, 0, 0, 0, 0, 0, 0, 0 }, // ptr-operator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 692, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // cv-qualifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 696, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // ref-qualifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 698, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 698, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 698, 0, 0, 0, 0, 698, 0, 698, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 0, 0, 0, 0, 0, 0 }, // declarator-id
+	{ 0, 0, 0, 700, 700, 0, 0, 0, 700, 700, 700, 700, 700, 0, 0, 0, 700, 0, 0, 0, 700, 0, 0, 700, 0, 0, 0, 0, 700, 0, 0, 0, 0, 0, 700, 700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 700, 700, 0, 0, 0, 0, 700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 700, 700, 700, 0, 0, 700, 700, 700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 700, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 702, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 705, 0, 705, 0, 0, 0, 0, 702, 0, 0, 0, 708, 0, 702, 0, 0, 0, 0, 702, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 702, 0, 0, 0, 0, 0, 710, 0, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 0, 0, 0, 0, 0, 0, 0, 0 }, // abstract-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 715, 0, 715, 0, 0, 0, 0, 712, 0, 0, 0, 0, 0, 712, 0, 0, 0, 0, 712, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 712, 0, 0, 0, 0, 0, 0, 0, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 712, 0, 0, 0, 0, 0, 0, 0, 0 }, // ptr-abstract-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 717, 0, 717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noptr-abstract-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 0, 722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noptr-abstract-declarator-root
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 725, 0, 0, 0, 725, 0, 725, 0, 0, 0, 0, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 725, 0, 0, 0, 0, 0, 0, 0, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 0, 0, 0, 0, 0, 0, 0, 0 }, // abstract-pack-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 727, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noptr-abstract-pack-declarator
+	{ 729, 0, 0, 729, 729, 0, 0, 0, 729, 729, 729, 729, 729, 729, 0, 0, 729, 0, 0, 0, 729, 0, 0, 729, 729, 0, 729, 0, 729, 0, 729, 0, 0, 729, 729, 729, 729, 0, 0, 0, 0, 0, 0, 0, 0, 729, 0, 0, 729, 729, 0, 729, 0, 0, 729, 0, 0, 0, 729, 0, 0, 0, 729, 0, 729, 729, 729, 0, 729, 729, 729, 729, 0, 0, 0, 729, 0, 0, 732, 0, 0, 0, 0, 0, 0, 0, 732, 0, 729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 729, 0, 0, 0, 0, 0, 0, 0, 0 }, // parameter-declaration-clause
+	{ 734, 0, 0, 734, 734, 0, 0, 0, 734, 734, 734, 734, 734, 734, 0, 0, 734, 0, 0, 0, 734, 0, 0, 734, 734, 0, 734, 0, 734, 0, 734, 0, 0, 734, 734, 734, 734, 0, 0, 0, 0, 0, 0, 0, 0, 734, 0, 0, 734, 734, 0, 734, 0, 0, 734, 0, 0, 0, 734, 0, 0, 0, 734, 0, 734, 734, 734, 0, 734, 734, 734, 734, 0, 0, 0, 734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 734, 0, 0, 0, 0, 0, 0, 0, 0 }, // parameter-declaration-list
+	{ 736, 0, 0, 736, 736, 0, 0, 0, 736, 736, 736, 736, 736, 736, 0, 0, 736, 0, 0, 0, 736, 0, 0, 736, 736, 0, 736, 0, 736, 0, 736, 0, 0, 736, 736, 736, 736, 0, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 736, 736, 0, 736, 0, 0, 736, 0, 0, 0, 736, 0, 0, 0, 736, 0, 736, 736, 736, 0, 736, 736, 736, 736, 0, 0, 0, 736, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 736, 0, 0, 0, 0, 0, 0, 0, 0 }, // parameter-declaration
+	{ 741, 0, 0, 741, 741, 0, 0, 0, 741, 741, 741, 741, 741, 741, 0, 0, 741, 0, 0, 0, 741, 0, 0, 741, 741, 0, 741, 0, 741, 0, 741, 0, 0, 741, 741, 741, 741, 0, 0, 0, 0, 0, 0, 0, 0, 741, 0, 0, 741, 741, 0, 741, 0, 0, 741, 0, 0, 0, 741, 0, 0, 0, 741, 0, 741, 741, 741, 0, 741, 741, 741, 741, 0, 0, 0, 741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 741, 0, 0, 0, 0, 0, 0, 0, 0 }, // function-definition
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 743, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 747, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // function-body
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // initializer
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // brace-or-equal-initializer
+	{ 0, 758, 0, 758, 758, 0, 0, 0, 758, 758, 758, 0, 0, 0, 758, 0, 758, 0, 758, 0, 758, 758, 0, 0, 0, 0, 0, 758, 758, 0, 0, 0, 0, 0, 758, 758, 0, 0, 758, 758, 758, 758, 0, 0, 0, 0, 758, 0, 758, 758, 758, 0, 0, 758, 0, 0, 0, 758, 0, 758, 758, 0, 0, 758, 758, 0, 758, 0, 0, 758, 0, 758, 0, 760, 0, 758, 0, 758, 0, 0, 0, 758, 758, 758, 0, 0, 0, 0, 758, 0, 0, 758, 758, 758, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 758, 758, 0, 0, 0, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 0, 0, 0 }, // initializer-clause
+	{ 0, 762, 0, 762, 762, 0, 0, 0, 762, 762, 762, 0, 0, 0, 762, 0, 762, 0, 762, 0, 762, 762, 0, 0, 0, 0, 0, 762, 762, 0, 0, 0, 0, 0, 762, 762, 0, 0, 762, 762, 762, 762, 0, 0, 0, 0, 762, 0, 762, 762, 762, 0, 0, 762, 0, 0, 0, 762, 0, 762, 762, 0, 0, 762, 762, 0, 762, 0, 0, 762, 0, 762, 0, 762, 0, 762, 0, 762, 0, 0, 0, 762, 762, 762, 0, 0, 0, 0, 762, 0, 0, 762, 762, 762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 762, 762, 0, 0, 0, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 0, 0, 0 }, // initializer-list
+	{ 0, 764, 0, 764, 764, 0, 0, 0, 764, 764, 764, 0, 0, 0, 764, 0, 764, 0, 764, 0, 764, 764, 0, 0, 0, 0, 0, 764, 764, 0, 0, 0, 0, 0, 764, 764, 0, 0, 764, 764, 764, 764, 0, 0, 0, 0, 764, 0, 764, 764, 764, 0, 0, 764, 0, 0, 0, 764, 0, 764, 764, 0, 0, 764, 764, 0, 764, 0, 0, 764, 0, 764, 0, 764, 0, 764, 0, 764, 0, 0, 0, 764, 764, 764, 0, 0, 0, 0, 764, 0, 0, 764, 764, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 764, 764, 0, 0, 0, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 764, 0, 0, 0 }, // initializer-clause-dots
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 766, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // braced-init-list
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // class-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // class-head
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 774, 0, 0, 0, 0, 0, 0, 0, 0 }, // class-head-name
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 776, 0, 0, 0, 0, 0, 0 }, // class-virt-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 782, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // class-key
+	{ 784, 0, 0, 784, 784, 0, 0, 0, 784, 784, 784, 784, 784, 784, 0, 0, 784, 0, 0, 0, 784, 0, 0, 784, 784, 0, 784, 0, 784, 0, 784, 0, 0, 784, 784, 784, 784, 0, 0, 0, 0, 0, 786, 786, 786, 784, 0, 0, 784, 784, 0, 784, 784, 0, 784, 0, 784, 0, 784, 0, 0, 0, 784, 0, 784, 784, 784, 784, 784, 784, 784, 784, 0, 0, 0, 784, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 784, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 784, 0, 0, 0, 0, 0, 0, 0, 0 }, // member-specification
+	{ 788, 0, 0, 788, 788, 0, 0, 0, 788, 788, 788, 788, 788, 788, 0, 0, 788, 0, 0, 0, 788, 0, 0, 788, 788, 0, 788, 0, 788, 0, 788, 0, 0, 788, 788, 788, 788, 0, 0, 0, 0, 0, 0, 0, 0, 788, 0, 0, 788, 788, 0, 788, 791, 0, 788, 0, 793, 0, 788, 0, 0, 0, 788, 0, 788, 788, 788, 795, 788, 788, 788, 788, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 0, 0, 0, 0, 0, 0, 0, 0 }, // member-declaration
+	{ 798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 798, 0, 798, 0, 0, 0, 798, 798, 0, 0, 798, 798, 0, 798, 0, 0, 0, 0, 798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 798, 0, 0, 0, 0, 0, 0, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 798, 0, 0, 0, 0, 0, 0 }, // member-declarator-list
+	{ 800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 0, 802, 0, 0, 0, 802, 802, 0, 0, 800, 802, 0, 802, 0, 0, 0, 0, 802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 802, 0, 0, 0, 0, 0, 0, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 805, 802, 805, 805, 0, 0, 0, 0, 0, 0 }, // member-declarator
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 809, 811, 0, 0, 0, 0, 0, 0 }, // virt-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // pure-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // base-clause
+	{ 817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 817, 817, 817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 817, 0, 0, 0, 0, 0, 0, 817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 0, 0, 0, 0, 0, 0, 0, 0 }, // base-specifier-list
+	{ 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 819, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 0, 0, 0, 0, 0, 0, 0, 0 }, // base-specifier-dots
+	{ 821, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 827, 827, 827, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 829, 0, 0, 0, 0, 0, 0, 821, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 825, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 825, 0, 0, 0, 0, 0, 0, 0, 0 }, // base-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834, 0, 0, 0, 0, 0, 0, 0, 0 }, // class-or-decltype
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 836, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 836, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 836, 0, 0, 0, 0, 0, 0, 0, 0 }, // base-type-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 838, 840, 842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // access-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 844, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // conversion-function-id
+	{ 0, 0, 0, 846, 846, 0, 0, 0, 846, 846, 846, 846, 846, 0, 0, 0, 846, 0, 0, 0, 846, 0, 0, 846, 0, 0, 0, 0, 846, 0, 0, 0, 0, 0, 846, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 846, 846, 0, 0, 0, 0, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 846, 846, 846, 0, 0, 846, 846, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 0, 0, 0, 0, 0, 0, 0, 0 }, // conversion-type-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // ctor-initializer
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0 }, // mem-initializer-list
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 852, 0, 0, 0, 0, 0, 0 }, // mem-initializer-dots
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 0, 0, 0, 0, 0, 0 }, // mem-initializer
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 859, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 857, 859, 859, 0, 0, 0, 0, 0, 0 }, // mem-initializer-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // operator-function-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 907, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // literal-operator-id
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // template-declaration
+	{ 911, 0, 0, 911, 911, 0, 0, 0, 911, 911, 911, 911, 911, 911, 0, 0, 911, 0, 0, 0, 911, 0, 0, 911, 911, 0, 911, 0, 911, 0, 911, 0, 0, 911, 911, 911, 911, 0, 0, 0, 0, 0, 0, 0, 0, 911, 0, 0, 911, 911, 0, 911, 0, 0, 911, 0, 911, 0, 911, 0, 0, 0, 911, 0, 911, 911, 911, 0, 911, 911, 911, 911, 0, 0, 0, 911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 911, 0, 0, 0, 0, 0, 0, 0, 0 }, // template-parameter-list
+	{ 913, 0, 0, 913, 913, 0, 0, 0, 913, 913, 913, 915, 913, 913, 0, 0, 913, 0, 0, 0, 913, 0, 0, 913, 913, 0, 913, 0, 913, 0, 913, 0, 0, 913, 913, 913, 913, 0, 0, 0, 0, 0, 0, 0, 0, 913, 0, 0, 913, 913, 0, 913, 0, 0, 913, 0, 918, 0, 913, 0, 0, 0, 913, 0, 915, 913, 913, 0, 913, 913, 913, 913, 0, 0, 0, 913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 0, 0, 0, 0, 0, 0, 0, 0 }, // template-parameter
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 923, 0, 0, 0, 0, 0, 0, 0, 926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-parameter
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 929, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931, 933 }, // close-angle-bracket
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 938, 938, 938, 938, 938, 938, 938, 938, 0, 0, 0, 0, 0, 0, 0, 0, 938, 938, 938, 938, 938, 938, 938, 938, 938, 0, 0, 0, 0, 0, 0, 0, 0 }, // template-id
+	{ 0, 940, 0, 940, 940, 0, 0, 0, 940, 940, 940, 940, 940, 0, 940, 0, 940, 0, 940, 0, 940, 940, 0, 940, 0, 0, 0, 940, 940, 0, 0, 0, 0, 0, 940, 940, 0, 0, 940, 940, 940, 940, 0, 0, 0, 0, 940, 0, 940, 940, 940, 0, 0, 940, 940, 0, 0, 940, 0, 0, 940, 0, 0, 940, 940, 940, 940, 0, 0, 940, 940, 940, 0, 0, 0, 940, 0, 940, 0, 0, 0, 940, 940, 940, 0, 0, 0, 0, 940, 0, 0, 940, 940, 940, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 940, 940, 0, 0, 0, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 0, 0, 0 }, // template-argument-list
+	{ 0, 942, 0, 942, 942, 0, 0, 0, 942, 942, 942, 942, 942, 0, 942, 0, 942, 0, 942, 0, 942, 942, 0, 942, 0, 0, 0, 942, 942, 0, 0, 0, 0, 0, 942, 942, 0, 0, 942, 942, 942, 942, 0, 0, 0, 0, 942, 0, 942, 942, 942, 0, 0, 942, 942, 0, 0, 942, 0, 0, 942, 0, 0, 942, 942, 942, 942, 0, 0, 942, 942, 942, 0, 0, 0, 942, 0, 942, 0, 0, 0, 942, 942, 942, 0, 0, 0, 0, 942, 0, 0, 942, 942, 942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 942, 942, 0, 0, 0, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 942, 0, 0, 0 }, // template-argument-dots
+	{ 0, 944, 0, 946, 946, 0, 0, 0, 946, 946, 946, 949, 949, 0, 944, 0, 951, 0, 944, 0, 946, 944, 0, 949, 0, 0, 0, 944, 946, 0, 0, 0, 0, 0, 946, 946, 0, 0, 944, 944, 944, 955, 0, 0, 0, 0, 944, 0, 946, 946, 944, 0, 0, 944, 949, 0, 0, 944, 0, 0, 944, 0, 0, 944, 946, 949, 946, 0, 0, 946, 949, 946, 0, 0, 0, 944, 0, 944, 0, 0, 0, 955, 944, 944, 0, 0, 0, 0, 951, 0, 0, 944, 944, 944, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 944, 944, 0, 0, 0, 955, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 955, 955, 944, 944, 944, 0, 0, 0 }, // template-argument
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // typename-specifier
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // explicit-instantiation
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 963, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // explicit-specialization
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // try-block
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // function-try-block
+	{ 0, 0, 0, 0, 0, 0, 0, 969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // handler
+	{ 971, 0, 0, 971, 971, 0, 0, 0, 971, 971, 971, 971, 971, 0, 0, 0, 971, 0, 0, 0, 971, 0, 0, 971, 0, 0, 0, 0, 971, 0, 0, 0, 0, 0, 971, 971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 971, 971, 0, 0, 0, 0, 971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 971, 971, 971, 0, 0, 971, 971, 971, 0, 0, 0, 971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 974, 0, 971, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 0, 0, 0, 0, 0, 0, 0, 0 }, // exception-declaration
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // throw-expression
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // exception-specification
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // dynamic-exception-specification
+	{ 0, 0, 0, 984, 984, 0, 0, 0, 984, 984, 984, 984, 984, 0, 0, 0, 984, 0, 0, 0, 984, 0, 0, 984, 0, 0, 0, 0, 984, 0, 0, 0, 0, 0, 984, 984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 984, 984, 0, 0, 0, 0, 984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 984, 984, 984, 0, 0, 984, 984, 984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-id-list
+	{ 0, 0, 0, 986, 986, 0, 0, 0, 986, 986, 986, 986, 986, 0, 0, 0, 986, 0, 0, 0, 986, 0, 0, 986, 0, 0, 0, 0, 986, 0, 0, 0, 0, 0, 986, 986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 986, 986, 0, 0, 0, 0, 986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 986, 986, 986, 0, 0, 986, 986, 986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-id-dots
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noexcept-specification
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 990, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // capture-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 992, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noptr-new-declarator.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 994, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 994, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // pm-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 996, 996, 996, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // multiplicative-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 998, 998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // additive-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1000, 0 }, // shift-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1002, 1002, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1002, 1002, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // relational-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1004, 1004, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // equality-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1006, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // and-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1008, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // exclusive-or-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1010, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // inclusive-or-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1012, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // logical-and-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // logical-or-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1016, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // conditional-expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1018, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // expression.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1020, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // enumerator-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // attribute-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // init-declarator-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1026, 0, 1026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // noptr-declarator.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // parameter-declaration-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1030, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // initializer-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1032, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // member-declarator-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1034, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // base-specifier-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1036, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // mem-initializer-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1038, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // template-parameter-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1040, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // template-argument-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, // type-id-list.1
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } // noexcept-specification.1
+};
@@ -0,0 +1,258 @@
+#pragma once
+
+#include "ParseToken.h"
+
+// Lex: tokenizer of recog, standing in for PA5 until recog links a
+// preprocessor
+//
+// Phases 1-3 (line splices, comments and pp-tokens, but no trigraphs or
+// UCNs), then what phases 6 and 7 do that the parser sees: adjacent string
+// literals become one literal, identifiers are looked up as keywords, and
+// pp-numbers and character and string literals (with encoding prefixes,
+// raw strings and ud-suffixes) become TT_LITERALs, not checked further.
+// OP_RSHIFT is split into ST_RSHIFT_1 ST_RSHIFT_2, a template-name followed
+// by < becomes a TemplateNameKind token, and an ST_EOF token ends the
+// tokens.  A preprocessing directive is an error.
+
+// LexedFile: a source file as the parser reads it
+struct LexedFile
+{
+	// the file with line splices removed, which tokens are slices of
+	string text;
+	vector<ParseToken> tokens;
+
+	string spelling(const ParseToken& token) const
+	{
+		return text.substr(token.offset, token.size);
+	}
+
+	// line of `token`, counting spliced lines as one
+	size_t line(const ParseToken& token) const
+	{
+		return count(text.begin(), text.begin() + token.offset, '\n') + 1;
+	}
+};
+
+inline bool IsLexIdentifierStart(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (unsigned char) c >= 0x80;
+}
+
+inline bool IsLexIdentifierCharacter(char c)
+{
+	return IsLexIdentifierStart(c) || (c >= '0' && c <= '9');
+}
+
+// Lex [begin, end), `categories(spelling)` giving the ENameCategory bits of
+// an identifier (mock name lookup)
+template<typename NameCategories>
+LexedFile Lex(const char* begin, const char* end, NameCategories categories)
+{
+	LexedFile file;
+	string& text = file.text;
+	text.reserve(end - begin + 1);
+
+	// phase 2
+	for (const char* p = begin; p != end; p++)
+	{
+		if (*p == '\\' && p + 1 != end && p[1] == '\n')
+			p++;
+		else
+			text += *p;
+	}
+
+	// (a NUL past the end stops every scan below)
+	size_t size = text.size();
+	text += '\0';
+
+	vector<ParseToken>& tokens = file.tokens;
+
+	// string literals so far of a group of adjacent ones
+	size_t nstrings = 0;
+
+	auto add = [&](int kind, size_t offset, size_t size)
+	{
+		tokens.push_back(ParseToken{uint8_t(kind), uint32_t(offset), uint32_t(size)});
+	};
+
+	auto error = [&](const string& message, size_t offset)
+	{
+		size_t line = count(text.begin(), text.begin() + offset, '\n') + 1;
+		return runtime_error("line " + to_string(line) + ": " + message);
+	};
+
+	for (size_t i = 0; i < size; )
+	{
+		size_t start = i;
+		char c = text[i];
+
+		if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f')
+		{
+			i++;
+			continue;
+		}
+
+		if (c == '/' && text[i + 1] == '/')
+		{
+			while (i < size && text[i] != '\n')
+				i++;
+
+			continue;
+		}
+
+		if (c == '/' && text[i + 1] == '*')
+		{
+			i = text.find("*/", i + 2);
+
+			if (i == string::npos || i >= size)
+				throw error("partial comment", start);
+
+			i += 2;
+			continue;
+		}
+
+		bool string_literal = false;
+
+		// identifier, or encoding prefix
+		if (IsLexIdentifierStart(c))
+		{
+			while (IsLexIdentifierCharacter(text[i]))
+				i++;
+
+			string prefix = text.substr(start, i - start);
+			bool raw = !prefix.empty() && prefix.back() == 'R';
+
+			if (raw)
+				prefix.pop_back();
+
+			if (!(prefix.empty() || prefix == "u8" || prefix == "u" || prefix == "U" || prefix == "L") ||
+				(text[i] != '"' && (text[i] != '\'' || raw || prefix == "u8")))
+			{
+				string spelling = text.substr(start, i - start);
+				ETokenType token_type;
+				nstrings = 0;
+
+				if (LookupSimpleToken(spelling, token_type))
+					add(token_type, start, i - start);
+				else if (spelling == "override" || spelling == "final")
+					add(spelling == "override" ? OverrideKind : FinalKind, start, i - start);
+				else
+					add(IdentifierKind + categories(spelling), start, i - start);
+
+				continue;
+			}
+
+			c = text[i];
+
+			if (raw)
+			{
+				size_t open = text.find('(', i + 1);
+
+				if (open == string::npos || open >= size || open - i - 1 > 16)
+					throw error("invalid raw string delimiter", start);
+
+				string close = ")" + text.substr(i + 1, open - i - 1) + "\"";
+				i = text.find(close, open + 1);
+
+				if (i == string::npos || i >= size)
+					throw error("unterminated raw string literal", start);
+
+				i += close.size();
+				string_literal = true;
+			}
+		}
+
+		// pp-number
+		if ((c >= '0' && c <= '9') || (c == '.' && text[i + 1] >= '0' && text[i + 1] <= '9'))
+		{
+			while (IsLexIdentifierCharacter(text[i]) || text[i] == '.' ||
+				((text[i] == '+' || text[i] == '-') && (text[i - 1] == 'e' || text[i - 1] == 'E')))
+				i++;
+
+			nstrings = 0;
+			add(i - start == 1 && c == '0' ? ZeroKind : LiteralKind, start, i - start);
+			continue;
+		}
+
+		// character or string literal, then its ud-suffix
+		if ((c == '"' || c == '\'') && !string_literal)
+		{
+			for (i++; text[i] != c; i++)
+			{
+				if (text[i] == '\n' || i >= size)
+					throw error("unterminated literal", start);
+
+				if (text[i] == '\\' && i + 1 < size)
+					i++;
+			}
+
+			i++;
+			string_literal = c == '"';
+		}
+
+		if (i > start)
+		{
+			if (IsLexIdentifierStart(text[i]))
+				while (IsLexIdentifierCharacter(text[i]))
+					i++;
+
+			if (!string_literal)
+			{
+				nstrings = 0;
+				add(LiteralKind, start, i - start);
+			}
+			else if (nstrings++ == 0)
+				add(i - start == 2 && text[start] == '"' ? EmptyStringKind : LiteralKind, start, i - start);
+			else
+			{
+				// phase 6: concatenated with the string literals before
+				tokens.back().kind = LiteralKind;
+				tokens.back().size = i - tokens.back().offset;
+			}
+
+			continue;
+		}
+
+		// operator or punctuator, the longest simple token spelling
+		ETokenType token_type;
+		size_t length = 4;
+
+		while (length > 0 && (start + length > size || !LookupSimpleToken(text.data() + start, length, token_type)))
+			length--;
+
+		if (length == 0)
+		{
+			if (c == '#' || (c == '%' && text[i + 1] == ':'))
+				throw error("preprocessing directives not supported", start);
+
+			throw error("stray " + string(1, c), start);
+		}
+
+		// <:: is < :: unless followed by : or > (2.5/3)
+		if (token_type == OP_LSQUARE && text.compare(start, 3, "<::") == 0 && text[start + 3] != ':' && text[start + 3] != '>')
+		{
+			token_type = OP_LT;
+			length = 1;
+		}
+
+		nstrings = 0;
+
+		if (token_type == OP_RSHIFT)
+		{
+			add(RShift1Kind, start, 1);
+			add(RShift2Kind, start + 1, 1);
+		}
+		else
+			add(token_type, start, length);
+
+		if (token_type == OP_LT && tokens.size() > 1 && tokens[tokens.size() - 2].kind >= IdentifierKind &&
+			tokens[tokens.size() - 2].kind < TemplateNameKind && ((tokens[tokens.size() - 2].kind - IdentifierKind) & NC_TEMPLATE))
+			tokens[tokens.size() - 2].kind = TemplateNameKind;
+
+		i = start + length;
+	}
+
+	add(EofKind, size, 0);
+	text.pop_back();
+	return file;
+}
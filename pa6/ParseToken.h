@@ -0,0 +1,202 @@
+#pragma once
+
+#include "SimpleTokens.h"
+
+// Terminals of pa6.gram and the tokens the parser reads
+//
+// The terminals are the ETokenTypes (but OP_RSHIFT, which is split into
+// ST_RSHIFT_1 ST_RSHIFT_2), TT_IDENTIFIER, TT_LITERAL and the special ST_*
+// tokens, and, for mock name lookup, one ST_*_NAME terminal per name
+// category.  llgen makes class-name, enum-name, namespace-name,
+// template-name and typedef-name match those in place of TT_IDENTIFIER.
+//
+// A token can match several terminals: `0` is a TT_LITERAL and an ST_ZERO,
+// and TC1 is a TT_IDENTIFIER, an ST_CLASS_NAME and an ST_TEMPLATE_NAME.
+// So the parser reads tokens by kind, each kind matching a fixed set of
+// terminals (KindTerminals), and the parse tables are indexed by kind.
+
+// terminals after the ETokenTypes
+enum ESpecialTokenType
+{
+	TT_IDENTIFIER = OP_ARROW + 1,
+	TT_LITERAL,
+	ST_EMPTYSTR,
+	ST_EOF,
+	ST_FINAL,
+	ST_NONPAREN,
+	ST_OVERRIDE,
+	ST_RSHIFT_1,
+	ST_RSHIFT_2,
+	ST_ZERO,
+
+	// mock name lookup
+	ST_CLASS_NAME,
+	ST_ENUM_NAME,
+	ST_NAMESPACE_NAME,
+	ST_TEMPLATE_NAME,
+	ST_TYPEDEF_NAME,
+
+	NumTerminals
+};
+
+constexpr const char* SpecialTokenTypeToStringTable[] =
+{
+	"TT_IDENTIFIER",
+	"TT_LITERAL",
+	"ST_EMPTYSTR",
+	"ST_EOF",
+	"ST_FINAL",
+	"ST_NONPAREN",
+	"ST_OVERRIDE",
+	"ST_RSHIFT_1",
+	"ST_RSHIFT_2",
+	"ST_ZERO",
+	"ST_CLASS_NAME",
+	"ST_ENUM_NAME",
+	"ST_NAMESPACE_NAME",
+	"ST_TEMPLATE_NAME",
+	"ST_TYPEDEF_NAME"
+};
+
+static_assert(sizeof(SpecialTokenTypeToStringTable) / sizeof(SpecialTokenTypeToStringTable[0]) == NumTerminals - TT_IDENTIFIER,
+	"SpecialTokenTypeToStringTable must have one entry per ESpecialTokenType");
+
+inline const char* TerminalToString(int terminal)
+{
+	return terminal < TT_IDENTIFIER ? TokenTypeToString(ETokenType(terminal)) : SpecialTokenTypeToStringTable[terminal - TT_IDENTIFIER];
+}
+
+// TokenSet: set of terminals
+struct TokenSet
+{
+	static constexpr int NumWords = (NumTerminals + 63) / 64;
+
+	uint64_t words[NumWords];
+
+	bool has(int terminal) const
+	{
+		return words[terminal / 64] >> (terminal % 64) & 1;
+	}
+
+	void add(int terminal)
+	{
+		words[terminal / 64] |= uint64_t(1) << (terminal % 64);
+	}
+
+	// add the terminals of `set`, returning whether any were new
+	bool add(const TokenSet& set)
+	{
+		bool added = false;
+
+		for (int i = 0; i < NumWords; i++)
+		{
+			added |= (set.words[i] & ~words[i]) != 0;
+			words[i] |= set.words[i];
+		}
+
+		return added;
+	}
+
+	bool intersects(const TokenSet& set) const
+	{
+		for (int i = 0; i < NumWords; i++)
+			if (words[i] & set.words[i])
+				return true;
+
+		return false;
+	}
+
+	bool operator==(const TokenSet& set) const
+	{
+		return memcmp(words, set.words, sizeof(words)) == 0;
+	}
+};
+
+// name categories of an identifier, as bits
+enum ENameCategory
+{
+	NC_CLASS = 1,
+	NC_ENUM = 2,
+	NC_NAMESPACE = 4,
+	NC_TEMPLATE = 8,
+	NC_TYPEDEF = 16
+};
+
+constexpr int NumNameCategorySets = 32;
+
+// Token kinds: the ETokenTypes, then identifiers (one kind per set of name
+// categories), a template-name followed by <, override, final, literals,
+// 0, "", end of file and the two halves of >>
+//
+// A template-name followed by < is only ever a template-name, the < the
+// start of its template arguments (14.2/3).
+constexpr int IdentifierKind = OP_ARROW + 1;
+constexpr int TemplateNameKind = IdentifierKind + NumNameCategorySets;
+constexpr int OverrideKind = TemplateNameKind + 1;
+constexpr int FinalKind = OverrideKind + 1;
+constexpr int LiteralKind = FinalKind + 1;
+constexpr int ZeroKind = LiteralKind + 1;
+constexpr int EmptyStringKind = ZeroKind + 1;
+constexpr int EofKind = EmptyStringKind + 1;
+constexpr int RShift1Kind = EofKind + 1;
+constexpr int RShift2Kind = RShift1Kind + 1;
+constexpr int NumTokenKinds = RShift2Kind + 1;
+
+static_assert(NumTokenKinds <= 256, "token kinds must fit a byte");
+
+// KindTerminals: terminals a token of kind `kind` matches
+inline TokenSet KindTerminals(int kind)
+{
+	TokenSet set = TokenSet();
+
+	if (kind < IdentifierKind)
+		set.add(kind);
+	else if (kind < TemplateNameKind)
+	{
+		set.add(TT_IDENTIFIER);
+
+		static const int name_terminals[] = { ST_CLASS_NAME, ST_ENUM_NAME, ST_NAMESPACE_NAME, ST_TEMPLATE_NAME, ST_TYPEDEF_NAME };
+
+		for (int i = 0; i < 5; i++)
+			if ((kind - IdentifierKind) >> i & 1)
+				set.add(name_terminals[i]);
+	}
+	else if (kind == TemplateNameKind)
+		set.add(ST_TEMPLATE_NAME);
+	else if (kind == OverrideKind || kind == FinalKind)
+	{
+		set.add(TT_IDENTIFIER);
+		set.add(kind == OverrideKind ? ST_OVERRIDE : ST_FINAL);
+	}
+	else if (kind == LiteralKind || kind == ZeroKind || kind == EmptyStringKind)
+	{
+		set.add(TT_LITERAL);
+
+		if (kind != LiteralKind)
+			set.add(kind == ZeroKind ? ST_ZERO : ST_EMPTYSTR);
+	}
+	else
+		set.add(kind == EofKind ? ST_EOF : kind == RShift1Kind ? ST_RSHIFT_1 : ST_RSHIFT_2);
+
+	switch (kind)
+	{
+	case OP_LPAREN: case OP_RPAREN: case OP_LSQUARE: case OP_RSQUARE: case OP_LBRACE: case OP_RBRACE: case EofKind:
+		break;
+
+	default:
+		set.add(ST_NONPAREN);
+	}
+
+	return set;
+}
+
+// ParseToken: token of a translation unit, as the parser reads it
+struct ParseToken
+{
+	// token kind
+	uint8_t kind;
+
+	// spelling in the source file, for messages
+	uint32_t offset;
+	uint32_t size;
+};
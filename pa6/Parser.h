@@ -0,0 +1,360 @@
+#pragma once
+
+#include "Grammar.h"
+#include "GrammarTables.h"
+
+// Parser: table-driven recognizer of pa6.gram
+//
+// A symbol parsed at a token ends at a set of tokens: none if it does not
+// match there, one where the grammar is LL(1), several where the grammar
+// is ambiguous, as it is on declarations and expressions that look the
+// same (6.8, 8.2), until more of the tokens tell them apart.  The tokens
+// match translation-unit if it ends at the end of them.
+//
+// A nonterminal is parsed by the alternatives the LL(1) table gives for
+// its lookahead token, and the next item of a repetition only if the
+// lookahead can start it; the repetition stops only if the lookahead can
+// follow it.  Where the table gives one alternative, and a repetition
+// either continues or stops, nothing is tried that can not match.
+// Elsewhere - the LL(1) conflicts llgen lists - each possibility is tried,
+// and what these can parse more than once at the same token is memoized
+// by the token, nonterminal and bracket context.  So no nonterminal is
+// parsed twice at the same token in the same context, and a translation
+// unit is parsed in time linear in its tokens times the number of ways
+// its prefixes can end, which only ambiguities nest.  Nothing is parsed
+// again at a token before the next top-level declaration, so the memo is
+// emptied of those tokens as each one starts, and stays the size of what
+// the parse is in the middle of.
+//
+// Two rules of PA6 are not in the grammar: the close-angle-bracket rule
+// (14.2/3), through the bracket contexts of GrammarItems, and the rule on
+// type-names in a decl-specifier-seq (7.1/3), in parse_decl_specifier_seq.
+struct Parser
+{
+	Parser(const vector<ParseToken>& tokens)
+		: furthest(0), expected(TokenSet()), ncalls(0), nmemoized(0), nbacktracks(0), tokens(tokens)
+	{
+		for (int kind = 0; kind < NumTokenKinds; kind++)
+			kind_terminals[kind] = KindTerminals(kind);
+
+		// decl-specifiers that are not type-specifiers, and tokens that
+		// can start a type-name (possibly qualified)
+		nontype_specifiers = First[NT_STORAGE_CLASS_SPECIFIER];
+		nontype_specifiers.add(First[NT_FUNCTION_SPECIFIER]);
+		nontype_specifiers.add(First[NT_CV_QUALIFIER]);
+		nontype_specifiers.add(KW_FRIEND);
+		nontype_specifiers.add(KW_TYPEDEF);
+		nontype_specifiers.add(KW_CONSTEXPR);
+
+		type_name_starts = First[NT_TYPE_NAME];
+		type_name_starts.add(First[NT_NESTED_NAME_SPECIFIER]);
+
+		// translation-unit: declaration* ST_EOF
+		declarations = &GrammarItems[AlternativeItems[AlternativeLists[Dispatch[NT_TRANSLATION_UNIT][EofKind] + 1]]];
+	}
+
+	Parser(const Parser&) = delete;
+	Parser& operator=(const Parser&) = delete;
+
+	// whether the tokens, ending with ST_EOF, match translation-unit
+	bool parse()
+	{
+		Positions& ends = scratch(0);
+		parse_nonterminal(NT_TRANSLATION_UNIT, 0, false, ends);
+		return find(ends.begin(), ends.end(), tokens.size()) != ends.end();
+	}
+
+	// unless parse() matched, the furthest token reached, and the
+	// terminals that were expected there
+	size_t furthest;
+	TokenSet expected;
+
+	// nonterminals parsed, and of them taken from the memo, and parsed at
+	// an LL(1) conflict (trying more than one alternative)
+	size_t ncalls;
+	size_t nmemoized;
+	size_t nbacktracks;
+
+private:
+	typedef vector<uint32_t> Positions;
+
+	const vector<ParseToken>& tokens;
+
+	TokenSet kind_terminals[NumTokenKinds];
+	TokenSet nontype_specifiers;
+	TokenSet type_name_starts;
+
+	// the declaration* of translation-unit
+	const GrammarItem* declarations;
+
+	// ends of the memoized nonterminals by token, nonterminal and
+	// context, as slices of memo_ends
+	unordered_map<uint64_t, pair<uint32_t, uint32_t>> memo;
+	Positions memo_ends;
+
+	// drop the memo entries of tokens before `pos`
+	void forget_before(uint32_t pos)
+	{
+		Positions kept;
+
+		for (auto it = memo.begin(); it != memo.end(); )
+		{
+			if (it->first >> 16 < pos)
+				it = memo.erase(it);
+			else
+			{
+				uint32_t begin = it->second.first;
+				it->second.first = kept.size();
+				kept.insert(kept.end(), memo_ends.begin() + begin, memo_ends.begin() + begin + it->second.second);
+				++it;
+			}
+		}
+
+		memo_ends.swap(kept);
+	}
+
+	// position sets of the parse_* calls on the stack, by depth (a deque,
+	// so that growing it leaves the sets in use where they are)
+	deque<Positions> scratch_sets;
+	size_t depth = 1;
+
+	Positions& scratch(size_t i)
+	{
+		while (scratch_sets.size() <= i)
+			scratch_sets.emplace_back();
+
+		scratch_sets[i].clear();
+		return scratch_sets[i];
+	}
+
+	struct Frame
+	{
+		Frame(size_t& depth) : depth(depth) { depth += 2; }
+		~Frame() { depth -= 2; }
+
+		size_t& depth;
+	};
+
+	void expect(uint32_t pos, const TokenSet& terminals)
+	{
+		if (pos > furthest)
+		{
+			furthest = pos;
+			expected = TokenSet();
+		}
+
+		if (pos == furthest)
+			expected.add(terminals);
+	}
+
+	// sort and deduplicate ends[begin, end)
+	static void normalize(Positions& ends, size_t begin)
+	{
+		if (ends.size() - begin > 1)
+		{
+			sort(ends.begin() + begin, ends.end());
+			ends.erase(unique(ends.begin() + begin, ends.end()), ends.end());
+		}
+	}
+
+	// parse nonterminal `nt` at token `pos`, adding the tokens it can end at
+	// to `ends`; `angle` is whether the innermost bracket is an angle bracket
+	void parse_nonterminal(int nt, uint32_t pos, bool angle, Positions& ends)
+	{
+		ncalls++;
+
+		uint64_t key = uint64_t(pos) << 16 | nt << 1 | angle;
+
+		if (Memoize[nt])
+		{
+			auto it = memo.find(key);
+
+			if (it != memo.end())
+			{
+				nmemoized++;
+				ends.insert(ends.end(), memo_ends.begin() + it->second.first, memo_ends.begin() + it->second.first + it->second.second);
+				return;
+			}
+		}
+
+		size_t begin = ends.size();
+
+		if (nt == NT_DECL_SPECIFIER_SEQ)
+		{
+			parse_decl_specifier_seq(pos, angle, ends);
+			normalize(ends, begin);
+		}
+		else
+		{
+			const uint16_t* alternatives = &AlternativeLists[Dispatch[nt][tokens[pos].kind]];
+
+			if (alternatives[0] == 0)
+				expect(pos, First[nt]);
+			else if (alternatives[0] > 1)
+				nbacktracks++;
+
+			for (uint16_t i = 1; i <= alternatives[0]; i++)
+				parse_alternative(alternatives[i], pos, angle, ends);
+
+			if (alternatives[0] > 1)
+				normalize(ends, begin);
+		}
+
+		if (Memoize[nt])
+		{
+			memo[key] = make_pair(uint32_t(memo_ends.size()), uint32_t(ends.size() - begin));
+			memo_ends.insert(memo_ends.end(), ends.begin() + begin, ends.end());
+		}
+	}
+
+	void parse_alternative(int alternative, uint32_t pos, bool angle, Positions& ends)
+	{
+		Frame frame(depth);
+		Positions* current = &scratch(depth);
+		Positions* next = &scratch(depth + 1);
+		current->push_back(pos);
+
+		for (int i = AlternativeItems[alternative]; i < AlternativeItems[alternative + 1]; i++)
+		{
+			next->clear();
+
+			for (uint32_t p : *current)
+				parse_item(GrammarItems[i], p, angle, *next);
+
+			if (next->empty())
+				return;
+
+			normalize(*next, 0);
+			swap(current, next);
+		}
+
+		ends.insert(ends.end(), current->begin(), current->end());
+	}
+
+	void parse_item(const GrammarItem& item, uint32_t pos, bool angle, Positions& ends)
+	{
+		if (item.context != CONTEXT_INHERIT)
+			angle = item.context == CONTEXT_ANGLE;
+
+		if (item.repeat == REPEAT_ONE)
+		{
+			parse_symbol(item, pos, angle, ends);
+			return;
+		}
+
+		const KindSet& take = KindSets[item.take];
+		const KindSet& skip = KindSets[item.skip];
+
+		if (item.repeat == REPEAT_OPTIONAL)
+		{
+			if (skip.has(tokens[pos].kind))
+				ends.push_back(pos);
+
+			if (take.has(tokens[pos].kind))
+				parse_symbol(item, pos, angle, ends);
+
+			return;
+		}
+
+		// tokens reached after each number of repetitions, in order
+		Frame frame(depth);
+		Positions& reached = scratch(depth);
+		Positions& symbol_ends = scratch(depth + 1);
+		reached.push_back(pos);
+
+		for (size_t i = 0; i < reached.size(); i++)
+		{
+			uint32_t p = reached[i];
+			int kind = tokens[p].kind;
+
+			// top-level declarations: all that is left starts at p or after
+			if (&item == declarations)
+				forget_before(p);
+
+			if ((i > 0 || item.repeat == REPEAT_STAR) && skip.has(kind))
+				ends.push_back(p);
+
+			if (!take.has(kind))
+				continue;
+
+			symbol_ends.clear();
+			parse_symbol(item, p, angle, symbol_ends);
+
+			for (uint32_t end : symbol_ends)
+			{
+				// (ends are after p, and nearly always after all of reached)
+				auto it = lower_bound(reached.begin() + i + 1, reached.end(), end);
+
+				if (end > p && (it == reached.end() || *it != end))
+					reached.insert(it, end);
+			}
+		}
+	}
+
+	void parse_symbol(const GrammarItem& item, uint32_t pos, bool angle, Positions& ends)
+	{
+		if (item.symbol >= NumTerminals)
+			parse_nonterminal(item.symbol - NumTerminals, pos, angle, ends);
+		else if (kind_terminals[tokens[pos].kind].has(item.symbol) && !(angle && item.operator_in_angle))
+			ends.push_back(pos + 1);
+		else
+		{
+			TokenSet terminal = TokenSet();
+			terminal.add(item.symbol);
+			expect(pos, terminal);
+		}
+	}
+
+	// decl-specifier-seq: decl-specifier+ attribute-specifier*, where a
+	// type-name is a decl-specifier if and only if there is no type-specifier
+	// other than a cv-qualifier before it (7.1/3): so a decl-specifier-seq
+	// never ends before a type-name it could take, and never takes one after
+	// another type-specifier
+	void parse_decl_specifier_seq(uint32_t pos, bool angle, Positions& ends)
+	{
+		uint16_t alternatives = Dispatch[NT_DECL_SPECIFIER_SEQ][tokens[pos].kind];
+
+		if (alternatives == 0)
+		{
+			expect(pos, First[NT_DECL_SPECIFIER_SEQ]);
+			return;
+		}
+
+		// decl-specifier+ attribute-specifier*
+		const GrammarItem* items = &GrammarItems[AlternativeItems[AlternativeLists[alternatives + 1]]];
+
+		Frame frame(depth);
+
+		// tokens reached after one or more decl-specifiers, in order, each
+		// with whether a type-specifier other than a cv-qualifier is before
+		vector<pair<uint32_t, bool>> reached(1, make_pair(pos, false));
+		Positions& specifier_ends = scratch(depth);
+
+		for (size_t i = 0; i < reached.size(); i++)
+		{
+			uint32_t p = reached[i].first;
+			bool typed = reached[i].second;
+			const TokenSet& terminals = kind_terminals[tokens[p].kind];
+			bool type_name = terminals.intersects(type_name_starts);
+
+			specifier_ends.clear();
+
+			if (!(type_name && typed))
+				parse_symbol(items[0], p, angle, specifier_ends);
+
+			if (i > 0 && !(type_name && !typed && !specifier_ends.empty()))
+				parse_item(items[1], p, angle, ends);
+
+			typed = typed || !terminals.intersects(nontype_specifiers);
+
+			for (uint32_t end : specifier_ends)
+			{
+				auto state = make_pair(end, typed);
+				auto it = lower_bound(reached.begin() + i + 1, reached.end(), state);
+
+				if (it == reached.end() || *it != state)
+					reached.insert(it, state);
+			}
+		}
+	}
+};
@@ -0,0 +1,537 @@
+#pragma once
+
+#include "IndexSequence.h"
+
+// `simple` token types, their spellings and recognition
+//
+// Recognizing a `simple` token (keyword, operator or punctuator) is a
+// lookup in a perfect hash table that is generated at compile time, so
+// neither classifying an identifier nor printing a token type allocates.
+
+// token type enum for `simples`
+enum ETokenType
+{
+	// keywords
+	KW_ALIGNAS,
+	KW_ALIGNOF,
+	KW_ASM,
+	KW_AUTO,
+	KW_BOOL,
+	KW_BREAK,
+	KW_CASE,
+	KW_CATCH,
+	KW_CHAR,
+	KW_CHAR16_T,
+	KW_CHAR32_T,
+	KW_CLASS,
+	KW_CONST,
+	KW_CONSTEXPR,
+	KW_CONST_CAST,
+	KW_CONTINUE,
+	KW_DECLTYPE,
+	KW_DEFAULT,
+	KW_DELETE,
+	KW_DO,
+	KW_DOUBLE,
+	KW_DYNAMIC_CAST,
+	KW_ELSE,
+	KW_ENUM,
+	KW_EXPLICIT,
+	KW_EXPORT,
+	KW_EXTERN,
+	KW_FALSE,
+	KW_FLOAT,
+	KW_FOR,
+	KW_FRIEND,
+	KW_GOTO,
+	KW_IF,
+	KW_INLINE,
+	KW_INT,
+	KW_LONG,
+	KW_MUTABLE,
+	KW_NAMESPACE,
+	KW_NEW,
+	KW_NOEXCEPT,
+	KW_NULLPTR,
+	KW_OPERATOR,
+	KW_PRIVATE,
+	KW_PROTECTED,
+	KW_PUBLIC,
+	KW_REGISTER,
+	KW_REINTERPET_CAST,
+	KW_RETURN,
+	KW_SHORT,
+	KW_SIGNED,
+	KW_SIZEOF,
+	KW_STATIC,
+	KW_STATIC_ASSERT,
+	KW_STATIC_CAST,
+	KW_STRUCT,
+	KW_SWITCH,
+	KW_TEMPLATE,
+	KW_THIS,
+	KW_THREAD_LOCAL,
+	KW_THROW,
+	KW_TRUE,
+	KW_TRY,
+	KW_TYPEDEF,
+	KW_TYPEID,
+	KW_TYPENAME,
+	KW_UNION,
+	KW_UNSIGNED,
+	KW_USING,
+	KW_VIRTUAL,
+	KW_VOID,
+	KW_VOLATILE,
+	KW_WCHAR_T,
+	KW_WHILE,
+
+	// operators/punctuation
+	OP_LBRACE,
+	OP_RBRACE,
+	OP_LSQUARE,
+	OP_RSQUARE,
+	OP_LPAREN,
+	OP_RPAREN,
+	OP_BOR,
+	OP_XOR,
+	OP_COMPL,
+	OP_AMP,
+	OP_LNOT,
+	OP_SEMICOLON,
+	OP_COLON,
+	OP_DOTS,
+	OP_QMARK,
+	OP_COLON2,
+	OP_DOT,
+	OP_DOTSTAR,
+	OP_PLUS,
+	OP_MINUS,
+	OP_STAR,
+	OP_DIV,
+	OP_MOD,
+	OP_ASS,
+	OP_LT,
+	OP_GT,
+	OP_PLUSASS,
+	OP_MINUSASS,
+	OP_STARASS,
+	OP_DIVASS,
+	OP_MODASS,
+	OP_XORASS,
+	OP_BANDASS,
+	OP_BORASS,
+	OP_LSHIFT,
+	OP_RSHIFT,
+	OP_RSHIFTASS,
+	OP_LSHIFTASS,
+	OP_EQ,
+	OP_NE,
+	OP_LE,
+	OP_GE,
+	OP_LAND,
+	OP_LOR,
+	OP_INC,
+	OP_DEC,
+	OP_COMMA,
+	OP_ARROWSTAR,
+	OP_ARROW,
+};
+
+// TokenTypeToString: spelling of ETokenType enumerator, indexed by ETokenType
+constexpr const char* TokenTypeToStringTable[] =
+{
+	"KW_ALIGNAS",
+	"KW_ALIGNOF",
+	"KW_ASM",
+	"KW_AUTO",
+	"KW_BOOL",
+	"KW_BREAK",
+	"KW_CASE",
+	"KW_CATCH",
+	"KW_CHAR",
+	"KW_CHAR16_T",
+	"KW_CHAR32_T",
+	"KW_CLASS",
+	"KW_CONST",
+	"KW_CONSTEXPR",
+	"KW_CONST_CAST",
+	"KW_CONTINUE",
+	"KW_DECLTYPE",
+	"KW_DEFAULT",
+	"KW_DELETE",
+	"KW_DO",
+	"KW_DOUBLE",
+	"KW_DYNAMIC_CAST",
+	"KW_ELSE",
+	"KW_ENUM",
+	"KW_EXPLICIT",
+	"KW_EXPORT",
+	"KW_EXTERN",
+	"KW_FALSE",
+	"KW_FLOAT",
+	"KW_FOR",
+	"KW_FRIEND",
+	"KW_GOTO",
+	"KW_IF",
+	"KW_INLINE",
+	"KW_INT",
+	"KW_LONG",
+	"KW_MUTABLE",
+	"KW_NAMESPACE",
+	"KW_NEW",
+	"KW_NOEXCEPT",
+	"KW_NULLPTR",
+	"KW_OPERATOR",
+	"KW_PRIVATE",
+	"KW_PROTECTED",
+	"KW_PUBLIC",
+	"KW_REGISTER",
+	"KW_REINTERPET_CAST",
+	"KW_RETURN",
+	"KW_SHORT",
+	"KW_SIGNED",
+	"KW_SIZEOF",
+	"KW_STATIC",
+	"KW_STATIC_ASSERT",
+	"KW_STATIC_CAST",
+	"KW_STRUCT",
+	"KW_SWITCH",
+	"KW_TEMPLATE",
+	"KW_THIS",
+	"KW_THREAD_LOCAL",
+	"KW_THROW",
+	"KW_TRUE",
+	"KW_TRY",
+	"KW_TYPEDEF",
+	"KW_TYPEID",
+	"KW_TYPENAME",
+	"KW_UNION",
+	"KW_UNSIGNED",
+	"KW_USING",
+	"KW_VIRTUAL",
+	"KW_VOID",
+	"KW_VOLATILE",
+	"KW_WCHAR_T",
+	"KW_WHILE",
+	"OP_LBRACE",
+	"OP_RBRACE",
+	"OP_LSQUARE",
+	"OP_RSQUARE",
+	"OP_LPAREN",
+	"OP_RPAREN",
+	"OP_BOR",
+	"OP_XOR",
+	"OP_COMPL",
+	"OP_AMP",
+	"OP_LNOT",
+	"OP_SEMICOLON",
+	"OP_COLON",
+	"OP_DOTS",
+	"OP_QMARK",
+	"OP_COLON2",
+	"OP_DOT",
+	"OP_DOTSTAR",
+	"OP_PLUS",
+	"OP_MINUS",
+	"OP_STAR",
+	"OP_DIV",
+	"OP_MOD",
+	"OP_ASS",
+	"OP_LT",
+	"OP_GT",
+	"OP_PLUSASS",
+	"OP_MINUSASS",
+	"OP_STARASS",
+	"OP_DIVASS",
+	"OP_MODASS",
+	"OP_XORASS",
+	"OP_BANDASS",
+	"OP_BORASS",
+	"OP_LSHIFT",
+	"OP_RSHIFT",
+	"OP_RSHIFTASS",
+	"OP_LSHIFTASS",
+	"OP_EQ",
+	"OP_NE",
+	"OP_LE",
+	"OP_GE",
+	"OP_LAND",
+	"OP_LOR",
+	"OP_INC",
+	"OP_DEC",
+	"OP_COMMA",
+	"OP_ARROWSTAR",
+	"OP_ARROW"
+};
+
+static_assert(sizeof(TokenTypeToStringTable) / sizeof(TokenTypeToStringTable[0]) == OP_ARROW + 1,
+	"TokenTypeToStringTable must have one entry per ETokenType");
+
+inline const char* TokenTypeToString(ETokenType token_type)
+{
+	return TokenTypeToStringTable[token_type];
+}
+
+// SimpleTokenSpelling: spelling of a `simple` token and its ETokenType
+struct SimpleTokenSpelling
+{
+	constexpr SimpleTokenSpelling(const char* spelling, ETokenType token_type)
+		: spelling(spelling), length(ConstexprStrlen(spelling)), token_type(token_type)
+	{}
+
+	const char* spelling;
+	size_t length;
+	ETokenType token_type;
+
+	static constexpr size_t ConstexprStrlen(const char* s)
+	{
+		return *s ? 1 + ConstexprStrlen(s + 1) : 0;
+	}
+};
+
+// SimpleTokenSpellings: `simple` `preprocessing-tokens` and their ETokenType
+constexpr SimpleTokenSpelling SimpleTokenSpellings[] =
+{
+	// keywords
+	{"alignas", KW_ALIGNAS},
+	{"alignof", KW_ALIGNOF},
+	{"asm", KW_ASM},
+	{"auto", KW_AUTO},
+	{"bool", KW_BOOL},
+	{"break", KW_BREAK},
+	{"case", KW_CASE},
+	{"catch", KW_CATCH},
+	{"char", KW_CHAR},
+	{"char16_t", KW_CHAR16_T},
+	{"char32_t", KW_CHAR32_T},
+	{"class", KW_CLASS},
+	{"const", KW_CONST},
+	{"constexpr", KW_CONSTEXPR},
+	{"const_cast", KW_CONST_CAST},
+	{"continue", KW_CONTINUE},
+	{"decltype", KW_DECLTYPE},
+	{"default", KW_DEFAULT},
+	{"delete", KW_DELETE},
+	{"do", KW_DO},
+	{"double", KW_DOUBLE},
+	{"dynamic_cast", KW_DYNAMIC_CAST},
+	{"else", KW_ELSE},
+	{"enum", KW_ENUM},
+	{"explicit", KW_EXPLICIT},
+	{"export", KW_EXPORT},
+	{"extern", KW_EXTERN},
+	{"false", KW_FALSE},
+	{"float", KW_FLOAT},
+	{"for", KW_FOR},
+	{"friend", KW_FRIEND},
+	{"goto", KW_GOTO},
+	{"if", KW_IF},
+	{"inline", KW_INLINE},
+	{"int", KW_INT},
+	{"long", KW_LONG},
+	{"mutable", KW_MUTABLE},
+	{"namespace", KW_NAMESPACE},
+	{"new", KW_NEW},
+	{"noexcept", KW_NOEXCEPT},
+	{"nullptr", KW_NULLPTR},
+	{"operator", KW_OPERATOR},
+	{"private", KW_PRIVATE},
+	{"protected", KW_PROTECTED},
+	{"public", KW_PUBLIC},
+	{"register", KW_REGISTER},
+	{"reinterpret_cast", KW_REINTERPET_CAST},
+	{"return", KW_RETURN},
+	{"short", KW_SHORT},
+	{"signed", KW_SIGNED},
+	{"sizeof", KW_SIZEOF},
+	{"static", KW_STATIC},
+	{"static_assert", KW_STATIC_ASSERT},
+	{"static_cast", KW_STATIC_CAST},
+	{"struct", KW_STRUCT},
+	{"switch", KW_SWITCH},
+	{"template", KW_TEMPLATE},
+	{"this", KW_THIS},
+	{"thread_local", KW_THREAD_LOCAL},
+	{"throw", KW_THROW},
+	{"true", KW_TRUE},
+	{"try", KW_TRY},
+	{"typedef", KW_TYPEDEF},
+	{"typeid", KW_TYPEID},
+	{"typename", KW_TYPENAME},
+	{"union", KW_UNION},
+	{"unsigned", KW_UNSIGNED},
+	{"using", KW_USING},
+	{"virtual", KW_VIRTUAL},
+	{"void", KW_VOID},
+	{"volatile", KW_VOLATILE},
+	{"wchar_t", KW_WCHAR_T},
+	{"while", KW_WHILE},
+
+	// operators/punctuation
+	{"{", OP_LBRACE},
+	{"<%", OP_LBRACE},
+	{"}", OP_RBRACE},
+	{"%>", OP_RBRACE},
+	{"[", OP_LSQUARE},
+	{"<:", OP_LSQUARE},
+	{"]", OP_RSQUARE},
+	{":>", OP_RSQUARE},
+	{"(", OP_LPAREN},
+	{")", OP_RPAREN},
+	{"|", OP_BOR},
+	{"bitor", OP_BOR},
+	{"^", OP_XOR},
+	{"xor", OP_XOR},
+	{"~", OP_COMPL},
+	{"compl", OP_COMPL},
+	{"&", OP_AMP},
+	{"bitand", OP_AMP},
+	{"!", OP_LNOT},
+	{"not", OP_LNOT},
+	{";", OP_SEMICOLON},
+	{":", OP_COLON},
+	{"...", OP_DOTS},
+	{"?", OP_QMARK},
+	{"::", OP_COLON2},
+	{".", OP_DOT},
+	{".*", OP_DOTSTAR},
+	{"+", OP_PLUS},
+	{"-", OP_MINUS},
+	{"*", OP_STAR},
+	{"/", OP_DIV},
+	{"%", OP_MOD},
+	{"=", OP_ASS},
+	{"<", OP_LT},
+	{">", OP_GT},
+	{"+=", OP_PLUSASS},
+	{"-=", OP_MINUSASS},
+	{"*=", OP_STARASS},
+	{"/=", OP_DIVASS},
+	{"%=", OP_MODASS},
+	{"^=", OP_XORASS},
+	{"xor_eq", OP_XORASS},
+	{"&=", OP_BANDASS},
+	{"and_eq", OP_BANDASS},
+	{"|=", OP_BORASS},
+	{"or_eq", OP_BORASS},
+	{"<<", OP_LSHIFT},
+	{">>", OP_RSHIFT},
+	{">>=", OP_RSHIFTASS},
+	{"<<=", OP_LSHIFTASS},
+	{"==", OP_EQ},
+	{"!=", OP_NE},
+	{"not_eq", OP_NE},
+	{"<=", OP_LE},
+	{">=", OP_GE},
+	{"&&", OP_LAND},
+	{"and", OP_LAND},
+	{"||", OP_LOR},
+	{"or", OP_LOR},
+	{"++", OP_INC},
+	{"--", OP_DEC},
+	{",", OP_COMMA},
+	{"->*", OP_ARROWSTAR},
+	{"->", OP_ARROW}
+};
+
+constexpr size_t NumSimpleTokenSpellings = sizeof(SimpleTokenSpellings) / sizeof(SimpleTokenSpellings[0]);
+
+// Perfect hash of the spellings
+//
+// A spelling is hashed on its length and its first, middle and last code
+// unit, which already tell all the spellings apart.  The multipliers were
+// found by a search for a set under which the spellings all land in
+// distinct slots of a 1024-slot table; the static_assert below checks that
+// this still holds whenever the table is edited.  A lookup is then one
+// hash, one table load and one compare against the candidate spelling.
+
+constexpr int SimpleTokenHashBits = 10;
+constexpr size_t SimpleTokenHashSize = size_t(1) << SimpleTokenHashBits;
+
+// slot of an empty hash table entry
+constexpr unsigned char SimpleTokenHashEmpty = 0xFF;
+
+static_assert(NumSimpleTokenSpellings < SimpleTokenHashEmpty, "spelling index must fit a hash table entry");
+
+constexpr uint32_t SimpleTokenHash(unsigned char first, unsigned char middle, unsigned char last, size_t length)
+{
+	return (first * 0xa6eb9329u + last * 0x7a0b2ea7u + middle * 0x72ebff03u + uint32_t(length) * 0x6b06155fu)
+		>> (32 - SimpleTokenHashBits);
+}
+
+// hash of non-empty spelling [data, data+length)
+constexpr uint32_t SimpleTokenHash(const char* data, size_t length)
+{
+	return SimpleTokenHash(data[0], data[length / 2], data[length - 1], length);
+}
+
+constexpr uint32_t SimpleTokenHashOf(size_t i)
+{
+	return SimpleTokenHash(SimpleTokenSpellings[i].spelling, SimpleTokenSpellings[i].length);
+}
+
+// true iff no spelling in [j, NumSimpleTokenSpellings) hashes like spelling i
+constexpr bool SimpleTokenHashUnique(size_t i, size_t j)
+{
+	return j == NumSimpleTokenSpellings ||
+		(SimpleTokenHashOf(i) != SimpleTokenHashOf(j) && SimpleTokenHashUnique(i, j + 1));
+}
+
+constexpr bool SimpleTokenHashPerfect(size_t i = 0)
+{
+	return i == NumSimpleTokenSpellings ||
+		(SimpleTokenHashUnique(i, i + 1) && SimpleTokenHashPerfect(i + 1));
+}
+
+static_assert(SimpleTokenHashPerfect(), "SimpleTokenHash collides, search for new multipliers");
+
+// index of spelling with hash `slot` among [i, NumSimpleTokenSpellings), or SimpleTokenHashEmpty
+constexpr unsigned char SimpleTokenHashSlot(size_t slot, size_t i = 0)
+{
+	return i == NumSimpleTokenSpellings ? SimpleTokenHashEmpty :
+		SimpleTokenHashOf(i) == slot ? (unsigned char) i :
+		SimpleTokenHashSlot(slot, i + 1);
+}
+
+template<typename Indices>
+struct SimpleTokenHashTableOf;
+
+template<size_t... Slot>
+struct SimpleTokenHashTableOf<IndexSequence<Slot...>>
+{
+	static constexpr unsigned char slots[sizeof...(Slot)] = { SimpleTokenHashSlot(Slot)... };
+};
+
+template<size_t... Slot>
+constexpr unsigned char SimpleTokenHashTableOf<IndexSequence<Slot...>>::slots[sizeof...(Slot)];
+
+// SimpleTokenHashTable::slots[h]: index into SimpleTokenSpellings of the
+// spelling with hash h, or SimpleTokenHashEmpty
+typedef SimpleTokenHashTableOf<MakeIndexSequence<SimpleTokenHashSize>::type> SimpleTokenHashTable;
+
+// LookupSimpleToken: if [data, data+length) is the spelling of a `simple`
+// token, set `token_type` to its ETokenType and return true
+inline bool LookupSimpleToken(const char* data, size_t length, ETokenType& token_type)
+{
+	if (length == 0)
+		return false;
+
+	unsigned char i = SimpleTokenHashTable::slots[SimpleTokenHash(data, length)];
+
+	if (i == SimpleTokenHashEmpty)
+		return false;
+
+	const SimpleTokenSpelling& candidate = SimpleTokenSpellings[i];
+
+	if (candidate.length != length || memcmp(candidate.spelling, data, length) != 0)
+		return false;
+
+	token_type = candidate.token_type;
+	return true;
+}
+
+inline bool LookupSimpleToken(const string& s, ETokenType& token_type)
+{
+	return LookupSimpleToken(s.data(), s.size(), token_type);
+}
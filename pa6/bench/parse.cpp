@@ -0,0 +1,170 @@
+// parse: checks of the parser against tests/*.ref, then parse times of the
+// OK tests repeated 64 to 1024 times, and of declarations nesting 8 to 512
+// ambiguous parentheses
+//
+// usage: bench/parse
+//
+// (run from pa6/, it reads tests/)
+//
+// Time per token should stay flat as the input grows: each nonterminal is
+// parsed at most once per token and context where the grammar is not
+// LL(1), where backtracking without memoization takes time exponential in
+// the nesting of the ambiguity (`TC1 x(((a)));` is a declaration of x or of
+// a until the `;`).
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <deque>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <dirent.h>
+
+using namespace std;
+
+#include "../Lex.h"
+#include "../Parser.h"
+
+// mock name lookup of recog.cpp
+int NameCategories(const string& identifier)
+{
+	return (identifier.find('C') != string::npos ? NC_CLASS : 0) |
+		(identifier.find('E') != string::npos ? NC_ENUM : 0) |
+		(identifier.find('N') != string::npos ? NC_NAMESPACE : 0) |
+		(identifier.find('T') != string::npos ? NC_TEMPLATE : 0) |
+		(identifier.find('Y') != string::npos ? NC_TYPEDEF : 0);
+}
+
+string ReadFile(const string& path)
+{
+	ifstream in(path);
+
+	if (!in)
+		throw runtime_error("cannot open " + path);
+
+	ostringstream text;
+	text << in.rdbuf();
+	return text.str();
+}
+
+// whether `text` is a translation-unit, false if it does not lex
+bool Recognize(const string& text)
+{
+	try
+	{
+		LexedFile file = Lex(text.data(), text.data() + text.size(), NameCategories);
+		return Parser(file.tokens).parse();
+	}
+	catch (exception&)
+	{
+		return false;
+	}
+}
+
+struct Timing
+{
+	size_t tokens;
+	size_t calls;
+	double seconds;
+};
+
+Timing Time(const string& text)
+{
+	LexedFile file = Lex(text.data(), text.data() + text.size(), NameCategories);
+	auto start = chrono::steady_clock::now();
+	Parser parser(file.tokens);
+
+	if (!parser.parse())
+		throw runtime_error("bench input does not parse");
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+	return Timing{file.tokens.size(), parser.ncalls, elapsed.count()};
+}
+
+void Report(const string& label, const Timing& timing)
+{
+	cout << "  " << label << ": " << timing.tokens << " tokens, " << timing.seconds * 1000 << " ms, "
+		<< timing.seconds * 1e9 / timing.tokens << " ns/token, "
+		<< double(timing.calls) / timing.tokens << " nonterminals/token" << endl;
+}
+
+int main()
+{
+	try
+	{
+		// tests/*.t, each OK or BAD as in its .ref
+		vector<string> tests;
+		DIR* dir = opendir("tests");
+
+		if (!dir)
+			throw runtime_error("cannot open tests/ (run from pa6/)");
+
+		while (dirent* entry = readdir(dir))
+		{
+			string name = entry->d_name;
+
+			if (name.size() > 2 && name.compare(name.size() - 2, 2, ".t") == 0)
+				tests.push_back("tests/" + name.substr(0, name.size() - 2));
+		}
+
+		closedir(dir);
+		sort(tests.begin(), tests.end());
+
+		string corpus;
+		size_t nok = 0;
+
+		for (const string& test : tests)
+		{
+			string text = ReadFile(test + ".t");
+			string ref = ReadFile(test + ".ref");
+			bool ok = Recognize(text);
+
+			if (ref.find(ok ? " OK" : " BAD") == string::npos)
+				throw runtime_error(test + ".t: " + (ok ? "OK" : "BAD") + " differs from .ref");
+
+			if (ok)
+			{
+				corpus += text + "\n";
+				nok++;
+			}
+		}
+
+		cout << "check " << tests.size() << " tests against .ref: OK" << endl;
+
+		if (!Recognize(corpus))
+			throw runtime_error("the OK tests together do not parse");
+
+		cout << "parse the " << nok << " OK tests repeated:" << endl;
+
+		for (int copies = 64; copies <= 1024; copies *= 4)
+		{
+			string text;
+
+			for (int i = 0; i < copies; i++)
+				text += corpus;
+
+			Report("x" + to_string(copies), Time(text));
+		}
+
+		cout << "parse TC1 x(((...(a)...)));" << endl;
+
+		for (int depth = 8; depth <= 512; depth *= 4)
+		{
+			string text = "void f() { TC1 x" + string(depth, '(') + "a" + string(depth, ')') + "; }\n";
+			Report("depth " + to_string(depth), Time(text));
+		}
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
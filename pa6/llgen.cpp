@@ -0,0 +1,815 @@
+// llgen: compiles pa6.gram into the parse tables of recog
+//
+// usage: llgen -o <outfile> <grammar>
+//
+// Reads the grammar, computes the nullable nonterminals and the FIRST and
+// FOLLOW sets of each, and writes them with the LL(1) parse table as
+// GrammarTables.h (see Grammar.h).  Where the grammar is not LL(1) - a
+// lookahead that starts two alternatives of a nonterminal, or that can
+// both continue and end a repetition - the conflict is listed at the top
+// of the output: recog backtracks there, and only there.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+using namespace std;
+
+#include "Grammar.h"
+
+struct Item
+{
+	// terminal, or NumTerminals + nonterminal
+	int symbol;
+
+	ERepeat repeat;
+	EItemContext context;
+	bool operator_in_angle;
+};
+
+struct Alternative
+{
+	int nonterminal;
+	vector<Item> items;
+
+	// as written in the grammar
+	string text;
+};
+
+struct Nonterminal
+{
+	string name;
+	vector<int> alternatives;
+
+	bool nullable;
+	TokenSet first;
+	TokenSet follow;
+
+	// parsed more than once at the same token when backtracking
+	bool memoize;
+};
+
+// nonterminals matching TT_IDENTIFIERs of a name category (mock name lookup)
+const pair<const char*, int> NameNonterminals[] =
+{
+	{ "class-name", ST_CLASS_NAME },
+	{ "enum-name", ST_ENUM_NAME },
+	{ "namespace-name", ST_NAMESPACE_NAME },
+	{ "template-name", ST_TEMPLATE_NAME },
+	{ "typedef-name", ST_TYPEDEF_NAME }
+};
+
+struct Grammar
+{
+	vector<Nonterminal> nonterminals;
+	vector<Alternative> alternatives;
+
+	map<string, int> nonterminal_ids;
+	map<string, int> terminal_ids;
+
+	Grammar()
+	{
+		for (int terminal = 0; terminal < NumTerminals; terminal++)
+			terminal_ids[TerminalToString(terminal)] = terminal;
+	}
+
+	int add_nonterminal(const string& name)
+	{
+		if (nonterminal_ids.count(name))
+			throw runtime_error("nonterminal " + name + " defined twice");
+
+		nonterminal_ids[name] = nonterminals.size();
+		nonterminals.push_back(Nonterminal{name, {}, false, TokenSet(), TokenSet(), false});
+		return nonterminals.size() - 1;
+	}
+
+	bool is_nonterminal(int symbol) const
+	{
+		return symbol >= NumTerminals;
+	}
+
+	const Nonterminal& nonterminal(int symbol) const
+	{
+		return nonterminals[symbol - NumTerminals];
+	}
+
+	string symbol_name(int symbol) const
+	{
+		return is_nonterminal(symbol) ? nonterminal(symbol).name : TerminalToString(symbol);
+	}
+
+	// read the grammar: a nonterminal is a line `name:` followed by its
+	// alternatives, indented, one per (spliced) line
+	void read(istream& in)
+	{
+		vector<pair<int, string>> lines;
+		string line, spliced;
+		int line_number = 0;
+
+		while (getline(in, line))
+		{
+			line_number++;
+			spliced += line;
+
+			if (!spliced.empty() && spliced.back() == '\\')
+				spliced.back() = ' ';
+			else
+			{
+				lines.emplace_back(line_number, spliced);
+				spliced.clear();
+			}
+		}
+
+		// nonterminals can be used before they are defined
+		for (const auto& line : lines)
+			if (!line.second.empty() && !isspace(line.second[0]))
+				add_nonterminal(name_of(line.second, line.first));
+
+		int current = -1;
+		int ngroups = 0;
+		int nnamed = nonterminals.size();
+
+		for (const auto& line : lines)
+		{
+			const string& text = line.second;
+
+			if (text.find_first_not_of(" \t") == string::npos)
+				continue;
+
+			if (!isspace(text[0]))
+			{
+				current = nonterminal_ids[name_of(text, line.first)];
+				ngroups = 0;
+				continue;
+			}
+
+			if (current == -1)
+				throw runtime_error("line " + to_string(line.first) + ": alternative before any nonterminal");
+
+			vector<string> words = split(text, line.first);
+			size_t i = 0;
+			vector<Item> items = read_sequence(words, i, current, ngroups, line.first);
+
+			if (i != words.size())
+				throw runtime_error("line " + to_string(line.first) + ": unbalanced )");
+
+			add_alternative(current, items, join(words, 0, words.size()));
+		}
+
+		for (int i = 0; i < nnamed; i++)
+			if (nonterminals[i].alternatives.empty())
+				throw runtime_error("nonterminal " + nonterminals[i].name + " has no alternatives");
+	}
+
+	string name_of(const string& line, int line_number)
+	{
+		size_t end = line.find_last_not_of(" \t");
+
+		if (line[end] != ':')
+			throw runtime_error("line " + to_string(line_number) + ": expected nonterminal:");
+
+		return line.substr(0, line.find_last_not_of(" \t", end - 1) + 1);
+	}
+
+	vector<string> split(const string& text, int line_number)
+	{
+		vector<string> words;
+
+		for (size_t i = 0; i < text.size(); )
+		{
+			char c = text[i];
+
+			if (isspace(c))
+				i++;
+			else if (strchr("()?*+", c))
+				words.push_back(string(1, text[i++]));
+			else if (isalnum(c) || c == '_' || c == '-')
+			{
+				size_t start = i;
+
+				while (i < text.size() && (isalnum(text[i]) || text[i] == '_' || text[i] == '-'))
+					i++;
+
+				words.push_back(text.substr(start, i - start));
+			}
+			else
+				throw runtime_error("line " + to_string(line_number) + ": unexpected " + string(1, c));
+		}
+
+		return words;
+	}
+
+	string join(const vector<string>& words, size_t begin, size_t end)
+	{
+		string text;
+
+		for (size_t i = begin; i < end; i++)
+		{
+			bool space = !text.empty() && words[i] != ")" && !strchr("?*+", words[i][0]) && text.back() != '(';
+			text += (space ? " " : "") + words[i];
+		}
+
+		return text;
+	}
+
+	// read items from words[i] up to a ) or the end, a group becoming a
+	// nonterminal named after `nonterminal`
+	vector<Item> read_sequence(const vector<string>& words, size_t& i, int nonterminal, int& ngroups, int line_number)
+	{
+		vector<Item> items;
+
+		while (i < words.size() && words[i] != ")")
+		{
+			Item item = Item();
+
+			if (words[i] == "(")
+			{
+				size_t begin = ++i;
+				int group = add_nonterminal(nonterminals[nonterminal].name.substr(0, nonterminals[nonterminal].name.find('.')) +
+					"." + to_string(++ngroups));
+				vector<Item> group_items = read_sequence(words, i, group, ngroups, line_number);
+
+				if (i == words.size())
+					throw runtime_error("line " + to_string(line_number) + ": unbalanced (");
+
+				add_alternative(group, group_items, join(words, begin, i));
+				item.symbol = NumTerminals + group;
+			}
+			else if (terminal_ids.count(words[i]))
+			{
+				item.symbol = terminal_ids[words[i]];
+
+				for (const auto& name : NameNonterminals)
+					if (nonterminals[nonterminal].name == name.first && item.symbol == TT_IDENTIFIER)
+						item.symbol = name.second;
+
+				item.operator_in_angle = (item.symbol == OP_GT || item.symbol == ST_RSHIFT_1) &&
+					nonterminals[nonterminal].name != "close-angle-bracket";
+			}
+			else if (nonterminal_ids.count(words[i]))
+				item.symbol = NumTerminals + nonterminal_ids[words[i]];
+			else
+				throw runtime_error("line " + to_string(line_number) + ": undefined symbol " + words[i]);
+
+			i++;
+
+			if (i < words.size() && words[i].size() == 1 && strchr("?*+", words[i][0]))
+			{
+				item.repeat = words[i] == "?" ? REPEAT_OPTIONAL : words[i] == "*" ? REPEAT_STAR : REPEAT_PLUS;
+				i++;
+			}
+
+			items.push_back(item);
+		}
+
+		if (items.empty())
+			throw runtime_error("line " + to_string(line_number) + ": empty sequence");
+
+		return items;
+	}
+
+	// add an alternative, setting the bracket context of its items
+	void add_alternative(int nonterminal, vector<Item> items, const string& text)
+	{
+		int close_angle = NumTerminals + nonterminal_ids["close-angle-bracket"];
+
+		// openers of the brackets the items are in, and their contexts
+		vector<pair<int, EItemContext>> brackets;
+
+		for (size_t i = 0; i < items.size(); i++)
+		{
+			int symbol = items[i].symbol;
+			int opener = symbol == OP_RPAREN ? OP_LPAREN : symbol == OP_RSQUARE ? OP_LSQUARE : symbol == OP_RBRACE ? OP_LBRACE :
+				symbol == close_angle ? OP_LT : -1;
+
+			if (opener != -1 && !brackets.empty() && brackets.back().first == opener)
+				brackets.pop_back();
+
+			items[i].context = brackets.empty() ? CONTEXT_INHERIT : brackets.back().second;
+
+			if (symbol == OP_LPAREN || symbol == OP_LSQUARE || symbol == OP_LBRACE)
+				brackets.emplace_back(symbol, CONTEXT_PLAIN);
+			else if (symbol == OP_LT && any_of(items.begin() + i + 1, items.end(), [&](const Item& item) { return item.symbol == close_angle; }))
+				brackets.emplace_back(OP_LT, CONTEXT_ANGLE);
+		}
+
+		nonterminals[nonterminal].alternatives.push_back(alternatives.size());
+		alternatives.push_back(Alternative{nonterminal, items, text});
+	}
+
+	bool nullable(const Item& item) const
+	{
+		return item.repeat == REPEAT_OPTIONAL || item.repeat == REPEAT_STAR ||
+			(is_nonterminal(item.symbol) && nonterminal(item.symbol).nullable);
+	}
+
+	TokenSet first(int symbol) const
+	{
+		if (is_nonterminal(symbol))
+			return nonterminal(symbol).first;
+
+		TokenSet set = TokenSet();
+		set.add(symbol);
+		return set;
+	}
+
+	// FIRST of items[begin, end), and whether they are nullable
+	TokenSet first(const vector<Item>& items, size_t begin, bool& nullable) const
+	{
+		TokenSet set = TokenSet();
+		nullable = true;
+
+		for (size_t i = begin; i < items.size() && nullable; i++)
+		{
+			set.add(first(items[i].symbol));
+			nullable = this->nullable(items[i]);
+		}
+
+		return set;
+	}
+
+	// FIRST of items[begin, end), with FOLLOW of `nonterminal` if they are
+	// nullable: the lookaheads they can be parsed at
+	TokenSet first_plus(int nonterminal, const vector<Item>& items, size_t begin) const
+	{
+		bool nullable;
+		TokenSet set = first(items, begin, nullable);
+
+		if (nullable)
+			set.add(nonterminals[nonterminal].follow);
+
+		return set;
+	}
+
+	void analyze()
+	{
+		for (bool changed = true; changed; )
+		{
+			changed = false;
+
+			for (const Alternative& alternative : alternatives)
+			{
+				Nonterminal& nonterminal = nonterminals[alternative.nonterminal];
+				bool nullable;
+				changed |= nonterminal.first.add(first(alternative.items, 0, nullable));
+
+				if (nullable && !nonterminal.nullable)
+					changed = nonterminal.nullable = true;
+			}
+		}
+
+		for (bool changed = true; changed; )
+		{
+			changed = false;
+
+			for (const Alternative& alternative : alternatives)
+			{
+				const vector<Item>& items = alternative.items;
+
+				for (size_t i = 0; i < items.size(); i++)
+				{
+					if (!is_nonterminal(items[i].symbol))
+						continue;
+
+					Nonterminal& nonterminal = nonterminals[items[i].symbol - NumTerminals];
+					changed |= nonterminal.follow.add(first_plus(alternative.nonterminal, items, i + 1));
+
+					if (items[i].repeat == REPEAT_STAR || items[i].repeat == REPEAT_PLUS)
+						changed |= nonterminal.follow.add(nonterminal.first);
+				}
+			}
+		}
+
+		check_left_recursion();
+	}
+
+	// nonterminals that can start `nonterminal`, itself included
+	void left_closure(int nonterminal, set<int>& closure) const
+	{
+		if (!closure.insert(nonterminal).second)
+			return;
+
+		for (int alternative : nonterminals[nonterminal].alternatives)
+		{
+			for (const Item& item : alternatives[alternative].items)
+			{
+				if (is_nonterminal(item.symbol))
+					left_closure(item.symbol - NumTerminals, closure);
+
+				if (!nullable(item))
+					break;
+			}
+		}
+	}
+
+	void check_left_recursion() const
+	{
+		for (size_t i = 0; i < nonterminals.size(); i++)
+		{
+			for (int alternative : nonterminals[i].alternatives)
+			{
+				set<int> closure;
+
+				for (const Item& item : alternatives[alternative].items)
+				{
+					if (is_nonterminal(item.symbol))
+						left_closure(item.symbol - NumTerminals, closure);
+
+					if (!nullable(item))
+						break;
+				}
+
+				if (closure.count(i))
+					throw runtime_error("nonterminal " + nonterminals[i].name + " is left recursive");
+			}
+		}
+	}
+};
+
+// KindSet of the token kinds matching some terminal of `terminals`
+KindSet KindsOf(const TokenSet& terminals)
+{
+	KindSet set = KindSet();
+
+	for (int kind = 0; kind < NumTokenKinds; kind++)
+	{
+		// (split into ST_RSHIFT_1 ST_RSHIFT_2 before parsing)
+		if (kind != OP_RSHIFT && KindTerminals(kind).intersects(terminals))
+			set.words[kind / 64] |= uint64_t(1) << (kind % 64);
+	}
+
+	return set;
+}
+
+bool Intersects(const KindSet& a, const KindSet& b)
+{
+	for (int i = 0; i < KindSet::NumWords; i++)
+		if (a.words[i] & b.words[i])
+			return true;
+
+	return false;
+}
+
+// names of the terminals of `terminals` that kinds in `kinds` match
+string TerminalNames(const TokenSet& terminals, const vector<int>& kinds)
+{
+	string names;
+
+	for (int terminal = 0; terminal < NumTerminals; terminal++)
+	{
+		if (!terminals.has(terminal) || terminal == ST_NONPAREN)
+			continue;
+
+		for (int kind : kinds)
+		{
+			if (KindTerminals(kind).has(terminal))
+			{
+				names += string(names.empty() ? "" : " ") + TerminalToString(terminal);
+				break;
+			}
+		}
+	}
+
+	return names;
+}
+
+template<typename Words>
+string Hex(const Words& set)
+{
+	ostringstream out;
+	out << "{{";
+
+	for (size_t i = 0; i < sizeof(set.words) / sizeof(set.words[0]); i++)
+		out << (i ? ", " : "") << "0x" << hex << set.words[i] << "ull";
+
+	out << "}}";
+	return out.str();
+}
+
+string Identifier(const string& name)
+{
+	string id = "NT_";
+
+	for (char c : name)
+		id += c == '-' || c == '.' ? '_' : char(toupper(c));
+
+	return id;
+}
+
+// LL(1) table and lookahead sets of the items of a Grammar
+struct ParseTable
+{
+	Grammar& grammar;
+
+	// KindSets, KindSets[0] empty
+	vector<KindSet> kind_sets;
+
+	// item take and skip sets, in order of the alternatives
+	vector<pair<uint16_t, uint16_t>> item_sets;
+
+	// alternative lists: a count, then the alternatives; list 0 empty
+	vector<uint16_t> alternative_lists;
+
+	// alternative list of each token kind and nonterminal
+	vector<vector<uint16_t>> dispatch;
+
+	// LL(1) conflicts, as comments
+	vector<string> conflicts;
+
+	ParseTable(Grammar& grammar)
+		: grammar(grammar), kind_sets(1, KindSet()), alternative_lists(1, 0)
+	{}
+
+	uint16_t kind_set(const KindSet& set)
+	{
+		for (size_t i = 0; i < kind_sets.size(); i++)
+			if (memcmp(&kind_sets[i], &set, sizeof(set)) == 0)
+				return i;
+
+		kind_sets.push_back(set);
+		return kind_sets.size() - 1;
+	}
+
+	void build()
+	{
+		vector<Nonterminal>& nonterminals = grammar.nonterminals;
+		const vector<Alternative>& alternatives = grammar.alternatives;
+
+		// lookaheads each alternative can be parsed at
+		vector<KindSet> starts;
+
+		for (const Alternative& alternative : alternatives)
+			starts.push_back(KindsOf(grammar.first_plus(alternative.nonterminal, alternative.items, 0)));
+
+		map<vector<uint16_t>, uint16_t> lists;
+		dispatch.assign(NumTokenKinds, vector<uint16_t>(nonterminals.size()));
+
+		for (size_t nt = 0; nt < nonterminals.size(); nt++)
+		{
+			// conflicting alternatives, and the kinds they conflict on
+			set<uint16_t> conflicting;
+			vector<int> conflict_kinds;
+
+			for (int kind = 0; kind < NumTokenKinds; kind++)
+			{
+				vector<uint16_t> list;
+
+				for (int alternative : nonterminals[nt].alternatives)
+					if (starts[alternative].has(kind))
+						list.push_back(alternative);
+
+				if (list.size() > 1)
+				{
+					conflicting.insert(list.begin(), list.end());
+					conflict_kinds.push_back(kind);
+				}
+
+				if (!list.empty() && !lists.count(list))
+				{
+					lists[list] = alternative_lists.size();
+					alternative_lists.push_back(list.size());
+					alternative_lists.insert(alternative_lists.end(), list.begin(), list.end());
+				}
+
+				dispatch[kind][nt] = list.empty() ? 0 : lists[list];
+			}
+
+			if (!conflicting.empty())
+			{
+				TokenSet terminals = TokenSet();
+				string text;
+
+				for (int alternative : conflicting)
+				{
+					const Alternative& a = alternatives[alternative];
+					terminals.add(grammar.first_plus(nt, a.items, 0));
+					text += "\n//     " + a.text;
+
+					// each item of the alternatives can be parsed more than
+					// once at a token, as can whatever starts them
+					set<int> closure;
+
+					for (const Item& item : a.items)
+						if (grammar.is_nonterminal(item.symbol))
+							grammar.left_closure(item.symbol - NumTerminals, closure);
+
+					for (int memoized : closure)
+						nonterminals[memoized].memoize = true;
+				}
+
+				conflicts.push_back(nonterminals[nt].name + ", on " + TerminalNames(terminals, conflict_kinds) + ":" + text);
+			}
+		}
+
+		for (const Alternative& alternative : alternatives)
+		{
+			const vector<Item>& items = alternative.items;
+
+			for (size_t i = 0; i < items.size(); i++)
+			{
+				KindSet take = KindsOf(grammar.first(items[i].symbol));
+				KindSet skip = KindSet();
+
+				if (items[i].repeat != REPEAT_ONE)
+				{
+					TokenSet rest = grammar.first_plus(alternative.nonterminal, items, i + 1);
+					skip = KindsOf(rest);
+
+					if (Intersects(take, skip))
+					{
+						TokenSet both = grammar.first(items[i].symbol);
+						vector<int> kinds;
+
+						for (int kind = 0; kind < NumTokenKinds; kind++)
+							if (take.has(kind) && skip.has(kind))
+								kinds.push_back(kind);
+
+						both.add(rest);
+						conflicts.push_back(nonterminals[alternative.nonterminal].name + ", repeat or stop on " +
+							TerminalNames(both, kinds) + ":\n//     " + grammar.symbol_name(items[i].symbol) +
+							"?*+"[items[i].repeat - 1] + " in " + alternative.text);
+					}
+				}
+
+				item_sets.emplace_back(kind_set(take), kind_set(skip));
+			}
+		}
+	}
+
+	void write(ostream& out, const string& grammar_path)
+	{
+		const vector<Nonterminal>& nonterminals = grammar.nonterminals;
+		const vector<Alternative>& alternatives = grammar.alternatives;
+
+		size_t nitems = 0;
+
+		for (const Alternative& alternative : alternatives)
+			nitems += alternative.items.size();
+
+		size_t nmemoized = count_if(nonterminals.begin(), nonterminals.end(), [](const Nonterminal& nt) { return nt.memoize; });
+
+		out << "#pragma once\n\n";
+		out << "// generated by llgen from " << grammar_path << ", do not edit\n";
+		out << "//\n";
+		out << "// " << nonterminals.size() << " nonterminals, " << alternatives.size() << " alternatives, " << nitems << " items\n";
+		out << "//\n";
+		out << "// LL(1) conflicts, where the parser backtracks (" << nmemoized << " nonterminals memoized):\n";
+
+		for (const string& conflict : conflicts)
+			out << "//\n//   " << conflict << "\n";
+
+		out << "\nenum ENonterminal : uint16_t\n{\n";
+
+		for (const Nonterminal& nonterminal : nonterminals)
+			out << "\t" << Identifier(nonterminal.name) << ",\n";
+
+		out << "\tNumNonterminals\n};\n\n";
+
+		out << "constexpr const char* NonterminalNames[NumNonterminals] =\n{\n";
+
+		for (size_t i = 0; i < nonterminals.size(); i++)
+			out << "\t\"" << nonterminals[i].name << "\"" << (i + 1 < nonterminals.size() ? "," : "") << "\n";
+
+		out << "};\n\n";
+
+		out << "constexpr bool Nullable[NumNonterminals] =\n{\n";
+
+		for (size_t i = 0; i < nonterminals.size(); i++)
+			out << "\t" << (nonterminals[i].nullable ? "true" : "false") << (i + 1 < nonterminals.size() ? "," : "") << "\n";
+
+		out << "};\n\n";
+
+		for (auto set : { make_pair("First", &Nonterminal::first), make_pair("Follow", &Nonterminal::follow) })
+		{
+			out << "constexpr TokenSet " << set.first << "[NumNonterminals] =\n{\n";
+
+			for (size_t i = 0; i < nonterminals.size(); i++)
+				out << "\t" << Hex(nonterminals[i].*set.second) << (i + 1 < nonterminals.size() ? "," : "") << " // " << nonterminals[i].name << "\n";
+
+			out << "};\n\n";
+		}
+
+		out << "constexpr bool Memoize[NumNonterminals] =\n{\n";
+
+		for (size_t i = 0; i < nonterminals.size(); i++)
+			out << "\t" << (nonterminals[i].memoize ? "true" : "false") << (i + 1 < nonterminals.size() ? "," : "") << "\n";
+
+		out << "};\n\n";
+
+		out << "constexpr KindSet KindSets[] =\n{\n";
+
+		for (size_t i = 0; i < kind_sets.size(); i++)
+			out << "\t" << Hex(kind_sets[i]) << (i + 1 < kind_sets.size() ? "," : "") << "\n";
+
+		out << "};\n\n";
+
+		out << "constexpr int NumAlternatives = " << alternatives.size() << ";\n\n";
+
+		out << "constexpr GrammarItem GrammarItems[] =\n{\n";
+
+		for (size_t a = 0, n = 0; a < alternatives.size(); a++)
+		{
+			out << "\t// " << nonterminals[alternatives[a].nonterminal].name << ": " << alternatives[a].text << "\n";
+
+			for (const Item& item : alternatives[a].items)
+			{
+				static const char* const repeats[] = { "REPEAT_ONE", "REPEAT_OPTIONAL", "REPEAT_STAR", "REPEAT_PLUS" };
+				static const char* const contexts[] = { "CONTEXT_INHERIT", "CONTEXT_ANGLE", "CONTEXT_PLAIN" };
+
+				out << "\t{ " << (grammar.is_nonterminal(item.symbol) ? "NumTerminals + " + Identifier(grammar.symbol_name(item.symbol)) :
+					grammar.symbol_name(item.symbol)) << ", " << repeats[item.repeat] << ", " << contexts[item.context] << ", "
+					<< (item.operator_in_angle ? "true" : "false") << ", " << item_sets[n].first << ", " << item_sets[n].second << " },\n";
+				n++;
+			}
+		}
+
+		out << "};\n\n";
+
+		out << "// GrammarItems[AlternativeItems[a], AlternativeItems[a + 1]): items of alternative a\n";
+		out << "constexpr uint16_t AlternativeItems[NumAlternatives + 1] =\n{\n\t";
+
+		for (size_t a = 0, n = 0; a <= alternatives.size(); a++)
+		{
+			out << n << (a < alternatives.size() ? (a % 16 == 15 ? ",\n\t" : ", ") : "\n");
+
+			if (a < alternatives.size())
+				n += alternatives[a].items.size();
+		}
+
+		out << "};\n\n";
+
+		out << "// AlternativeLists[Dispatch[nt][kind]]: number of alternatives of nt that a\n";
+		out << "// token of kind `kind` can start, followed by them\n";
+		out << "constexpr uint16_t AlternativeLists[] =\n{\n\t";
+
+		for (size_t i = 0; i < alternative_lists.size(); i++)
+			out << alternative_lists[i] << (i + 1 < alternative_lists.size() ? (i % 16 == 15 ? ",\n\t" : ", ") : "\n");
+
+		out << "};\n\n";
+
+		out << "constexpr uint16_t Dispatch[NumNonterminals][NumTokenKinds] =\n{\n";
+
+		for (size_t nt = 0; nt < nonterminals.size(); nt++)
+		{
+			out << "\t{ ";
+
+			for (int kind = 0; kind < NumTokenKinds; kind++)
+				out << dispatch[kind][nt] << (kind + 1 < NumTokenKinds ? ", " : "");
+
+			out << " }" << (nt + 1 < nonterminals.size() ? "," : "") << " // " << nonterminals[nt].name << "\n";
+		}
+
+		out << "};\n";
+	}
+};
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		vector<string> args;
+
+		for (int i = 1; i < argc; i++)
+			args.emplace_back(argv[i]);
+
+		if (args.size() != 3 || args[0] != "-o")
+			throw logic_error("invalid usage");
+
+		ifstream in(args[2]);
+
+		if (!in)
+			throw runtime_error("cannot open " + args[2]);
+
+		Grammar grammar;
+		grammar.read(in);
+		grammar.analyze();
+
+		ParseTable table(grammar);
+		table.build();
+
+		ostringstream out;
+		table.write(out, args[2]);
+
+		ofstream file(args[1]);
+		file << out.str();
+
+		if (!file)
+			throw runtime_error("cannot write " + args[1]);
+
+		cout << grammar.nonterminals.size() << " nonterminals, " << table.conflicts.size() << " LL(1) conflicts" << endl;
+	}
+	catch (exception& e)
+	{
+		cerr << "ERROR: " << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+}
@@ -1,13 +1,22 @@
 // (C) 2013 CPPGM Foundation www.cppgm.org.  All rights reserved.
 
 #include <vector>
+#include <deque>
 #include <string>
 #include <stdexcept>
 #include <fstream>
 #include <iostream>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 
 using namespace std;
 
+#include "SourceBuffer.h"
+#include "Lex.h"
+#include "Parser.h"
+
 bool PA6_IsClassName(const string& identifier)
 {
 	return identifier.find('C') != string::npos;
@@ -33,13 +42,34 @@ bool PA6_IsNamespaceName(const string& identifier)
 	return identifier.find('N') != string::npos;
 }
 
-void DoRecog(istream& in)
+// name categories of an identifier, as ENameCategory bits
+int PA6_NameCategories(const string& identifier)
 {
-	if (/* TODO: implement PA6 */ false)
-		return;
-	else
-		throw logic_error("not yet implemented");
-};
+	return (PA6_IsClassName(identifier) ? NC_CLASS : 0) |
+		(PA6_IsEnumName(identifier) ? NC_ENUM : 0) |
+		(PA6_IsNamespaceName(identifier) ? NC_NAMESPACE : 0) |
+		(PA6_IsTemplateName(identifier) ? NC_TEMPLATE : 0) |
+		(PA6_IsTypedefName(identifier) ? NC_TYPEDEF : 0);
+}
+
+void DoRecog(const SourceBuffer& in)
+{
+	LexedFile file = Lex(in.begin(), in.end(), PA6_NameCategories);
+	Parser parser(file.tokens);
+
+	if (!parser.parse())
+	{
+		const ParseToken& token = file.tokens[parser.furthest];
+		string expected;
+
+		for (int terminal = 0; terminal < NumTerminals; terminal++)
+			if (parser.expected.has(terminal))
+				expected += string(" ") + TerminalToString(terminal);
+
+		throw runtime_error("line " + to_string(file.line(token)) + ": unexpected " +
+			(token.kind == EofKind ? "end of file" : file.spelling(token)) + ", expected" + expected);
+	}
+}
 
 int main(int argc, char** argv)
 {
@@ -66,7 +96,7 @@ int main(int argc, char** argv)
 
 			try
 			{
-				ifstream in(srcfile);
+				SourceBuffer in(srcfile);
 				DoRecog(in);
 				out << srcfile << " OK" << endl;
 			}
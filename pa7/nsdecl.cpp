@@ -8,6 +8,8 @@
 
 using namespace std;
 
+#include "SourceBuffer.h"
+
 int main(int argc, char** argv)
 {
 	try
@@ -31,7 +33,7 @@ int main(int argc, char** argv)
 		{
 			string srcfile = args[i+2];
 
-			ifstream in(srcfile);
+			SourceBuffer in(srcfile);
 
 			out << "start translation unit " << srcfile << endl;
 
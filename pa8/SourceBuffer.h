@@ -0,0 +1,126 @@
+#pragma once
+
+// bootstrap system call interface, used by SourceBuffer
+extern "C" long int syscall(long int n, ...) throw ();
+
+// SourceBuffer: read-only contents of a whole source file
+//
+// Regular files are mapped with mmap(2) and tokenized directly out of the
+// mapping, without copying.  Anything that cannot be mapped (a pipe or a
+// terminal on stdin) is read into a growable buffer instead.
+struct SourceBuffer
+{
+	// map file at `path`
+	explicit SourceBuffer(const string& path)
+		: pdata(nullptr), nbytes(0), is_mapped(false)
+	{
+		int fd = syscall(/* open */ 2, path.c_str(), /* O_RDONLY */ 0);
+
+		if (fd < 0)
+			throw runtime_error("unable to open " + path);
+
+		try
+		{
+			load(fd, path);
+		}
+		catch (...)
+		{
+			syscall(/* close */ 3, fd);
+			throw;
+		}
+
+		syscall(/* close */ 3, fd);
+	}
+
+	// map (or read, if not a regular file) already open descriptor `fd`
+	explicit SourceBuffer(int fd)
+		: pdata(nullptr), nbytes(0), is_mapped(false)
+	{
+		load(fd, "<stdin>");
+	}
+
+	SourceBuffer(const SourceBuffer&) = delete;
+	SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+	~SourceBuffer()
+	{
+		if (is_mapped)
+			syscall(/* munmap */ 11, pdata, nbytes);
+	}
+
+	const char* begin() const { return pdata; }
+	const char* end() const { return pdata + nbytes; }
+	size_t size() const { return nbytes; }
+
+	// true iff contents are mapped rather than copied
+	bool mapped() const { return is_mapped; }
+
+private:
+	const char* pdata;
+	size_t nbytes;
+	bool is_mapped;
+	vector<char> buffer;
+
+	void load(int fd, const string& name)
+	{
+		struct
+		{
+			unsigned long int dev;
+			unsigned long int ino;
+			unsigned long int nlink;
+			unsigned int mode;
+			unsigned int uid;
+			unsigned int gid;
+			unsigned int pad;
+			unsigned long int rdev;
+			long int size;
+			long int unused[12];
+		} data;
+
+		constexpr unsigned int S_IFMT = 0170000;
+		constexpr unsigned int S_IFREG = 0100000;
+
+		if (syscall(/* fstat */ 5, fd, &data) != 0)
+			throw runtime_error("unable to stat " + name);
+
+		if ((data.mode & S_IFMT) == S_IFREG)
+		{
+			nbytes = data.size;
+
+			// mmap of an empty file fails, so leave it as an empty range
+			if (nbytes == 0)
+				return;
+
+			long int addr = syscall(/* mmap */ 9, nullptr, nbytes,
+				/* PROT_READ */ 1, /* MAP_PRIVATE */ 2, fd, 0);
+
+			if (addr == -1)
+				throw runtime_error("unable to map " + name);
+
+			pdata = (const char*) addr;
+			is_mapped = true;
+			return;
+		}
+
+		// pipe or terminal: read until end of file, doubling the buffer
+		buffer.resize(64 * 1024);
+
+		for (;;)
+		{
+			if (nbytes == buffer.size())
+				buffer.resize(2 * buffer.size());
+
+			long int n = syscall(/* read */ 0, fd, buffer.data() + nbytes, buffer.size() - nbytes);
+
+			if (n < 0)
+				throw runtime_error("unable to read " + name);
+
+			if (n == 0)
+				break;
+
+			nbytes += n;
+		}
+
+		pdata = buffer.data();
+	}
+};
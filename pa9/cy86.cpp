@@ -8,6 +8,8 @@
 
 using namespace std;
 
+#include "SourceBuffer.h"
+
 struct ElfHeader
 {
     unsigned char ident[16] =
@@ -87,7 +89,7 @@ int main(int argc, char** argv)
 		{
 			string srcfile = args[i+2];
 
-			ifstream in(srcfile);
+			SourceBuffer in(srcfile);
 
 			// TODO: parse / semantically analyze / generate code for srcfile
 		}